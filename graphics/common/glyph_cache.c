@@ -0,0 +1,241 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "glyph_cache.h"
+
+struct GlyphSlot {
+    uint32_t codepoint;
+    int32_t prev;     // LRU list neighbours
+    int32_t next;
+    int32_t hashNext; // next slot in the same hash bucket
+    bool dirty;
+    bool pinned;      // (possibly) on the screen, so it can't be evicted
+};
+
+// Slot of the replacement glyph, which is never evicted
+#define REPLACEMENT_SLOT 0
+
+static inline unsigned hashCodepoint(const GlyphCache* gc, uint32_t codepoint)
+{
+    return (codepoint * 0x9E3779B1u) >> 8 & gc->bucketMask;
+}
+
+static void lruUnlink(GlyphCache* gc, int32_t id)
+{
+    GlyphSlot* slot = &gc->slots[id];
+    if (slot->prev >= 0) gc->slots[slot->prev].next = slot->next;
+    else gc->lruHead = slot->next;
+    if (slot->next >= 0) gc->slots[slot->next].prev = slot->prev;
+    else gc->lruTail = slot->prev;
+}
+
+static void lruPushFront(GlyphCache* gc, int32_t id)
+{
+    GlyphSlot* slot = &gc->slots[id];
+    slot->prev = -1;
+    slot->next = gc->lruHead;
+    if (gc->lruHead >= 0) gc->slots[gc->lruHead].prev = id;
+    else gc->lruTail = id;
+    gc->lruHead = id;
+}
+
+static void hashRemove(GlyphCache* gc, int32_t id)
+{
+    int32_t* link = &gc->buckets[hashCodepoint(gc, gc->slots[id].codepoint)];
+    while (*link != id)
+        link = &gc->slots[*link].hashNext;
+    *link = gc->slots[id].hashNext;
+}
+
+bool glyphCacheInit(GlyphCache* gc, unsigned tileWidth, unsigned tileHeight, unsigned firstTile, unsigned numSlots, GlyphRasterizeFn rasterize, void* user)
+{
+    memset(gc, 0, sizeof(*gc));
+    if (!numSlots)
+        numSlots = GLYPH_CACHE_DEFAULT_SLOTS;
+
+    // Use a hash table with at least twice as many buckets as there are slots
+    unsigned numBuckets = 1;
+    while (numBuckets < 2*numSlots)
+        numBuckets <<= 1;
+
+    gc->tileWidth = tileWidth;
+    gc->tileHeight = tileHeight;
+    gc->firstTile = firstTile;
+    gc->numSlots = numSlots;
+    gc->rasterize = rasterize;
+    gc->user = user;
+    gc->bucketMask = numBuckets - 1;
+    gc->lruHead = -1;
+    gc->lruTail = -1;
+
+    gc->slots = (GlyphSlot*)calloc(numSlots, sizeof(GlyphSlot));
+    gc->buckets = (int32_t*)malloc(numBuckets*sizeof(int32_t));
+    gc->pixels = (uint8_t*)calloc(numSlots, tileWidth*tileHeight);
+    gc->dirtySlots = (uint32_t*)malloc(numSlots*sizeof(uint32_t));
+    if (!gc->slots || !gc->buckets || !gc->pixels || !gc->dirtySlots) {
+        glyphCacheExit(gc);
+        return false;
+    }
+
+    memset(gc->buckets, 0xFF, numBuckets*sizeof(int32_t));
+
+    // Rasterize the replacement glyph right away, it's what is shown when no slot can be freed
+    glyphCacheGetTile(gc, GLYPH_CACHE_REPLACEMENT);
+    gc->misses = 0;
+    return true;
+}
+
+void glyphCacheSetPinCallback(GlyphCache* gc, GlyphPinFn collectPins, void* user)
+{
+    gc->collectPins = collectPins;
+    gc->pinUser = user;
+}
+
+void glyphCachePin(GlyphCache* gc, unsigned tile)
+{
+    unsigned id = tile - gc->firstTile;
+    if (tile >= gc->firstTile && id < gc->numUsed)
+        gc->slots[id].pinned = true;
+}
+
+// Returns the least recently used slot that isn't pinned, or -1
+static int32_t findVictim(GlyphCache* gc)
+{
+    for (int32_t id = gc->lruTail; id >= 0; id = gc->slots[id].prev) {
+        if (!gc->slots[id].pinned && id != REPLACEMENT_SLOT)
+            return id;
+    }
+    return -1;
+}
+
+// Recomputes the pins from what the renderer shows. Slots are pinned as soon as they are handed
+// out, so until this is done, every slot that was ever used counts as being on the screen.
+static void refreshPins(GlyphCache* gc)
+{
+    if (!gc->collectPins || gc->pinsRefreshed)
+        return;
+
+    for (unsigned i = 0; i < gc->numUsed; i ++)
+        gc->slots[i].pinned = false;
+    gc->collectPins(gc->pinUser, gc);
+    gc->pinsRefreshed = true;
+}
+
+void glyphCacheExit(GlyphCache* gc)
+{
+    free(gc->slots);
+    free(gc->buckets);
+    free(gc->pixels);
+    free(gc->dirtySlots);
+    memset(gc, 0, sizeof(*gc));
+}
+
+unsigned glyphCacheGetTile(GlyphCache* gc, uint32_t codepoint)
+{
+    // Look the glyph up, and move it to the front of the LRU list if found
+    unsigned bucket = hashCodepoint(gc, codepoint);
+    for (int32_t id = gc->buckets[bucket]; id >= 0; id = gc->slots[id].hashNext) {
+        if (gc->slots[id].codepoint == codepoint) {
+            if (gc->lruHead != id) {
+                lruUnlink(gc, id);
+                lruPushFront(gc, id);
+            }
+            gc->slots[id].pinned = true;
+            gc->hits ++;
+            return gc->firstTile + id;
+        }
+    }
+
+    // Pick a free slot, or evict the least recently used glyph that isn't on the screen
+    int32_t id;
+    gc->misses ++;
+    if (gc->numUsed < gc->numSlots)
+        id = gc->numUsed++;
+    else {
+        id = findVictim(gc);
+        if (id < 0) {
+            refreshPins(gc);
+            id = findVictim(gc);
+        }
+        if (id < 0) {
+            // Every slot is on the screen: show the replacement glyph rather than changing one of them
+            gc->overflows ++;
+            return gc->firstTile + REPLACEMENT_SLOT;
+        }
+        lruUnlink(gc, id);
+        hashRemove(gc, id);
+        gc->evictions ++;
+    }
+
+    GlyphSlot* slot = &gc->slots[id];
+    slot->codepoint = codepoint;
+    slot->pinned = true;
+    slot->hashNext = gc->buckets[bucket];
+    gc->buckets[bucket] = id;
+    lruPushFront(gc, id);
+
+    // Rasterize the glyph, leaving the tile blank if that fails
+    uint8_t* pixels = gc->pixels + id*gc->tileWidth*gc->tileHeight;
+    memset(pixels, 0, gc->tileWidth*gc->tileHeight);
+    if (gc->rasterize)
+        gc->rasterize(gc->user, codepoint, pixels, gc->tileWidth, gc->tileHeight);
+
+    if (!slot->dirty) {
+        slot->dirty = true;
+        gc->dirtySlots[gc->numDirty++] = id;
+    }
+
+    return gc->firstTile + id;
+}
+
+uint32_t glyphCacheGetCodepoint(const GlyphCache* gc, unsigned tile)
+{
+    unsigned id = tile - gc->firstTile;
+    if (tile < gc->firstTile || id >= gc->numUsed)
+        return 0;
+    return gc->slots[id].codepoint;
+}
+
+void glyphCacheClearDirty(GlyphCache* gc)
+{
+    for (unsigned i = 0; i < gc->numDirty; i ++)
+        gc->slots[gc->dirtySlots[i]].dirty = false;
+    gc->numDirty = 0;
+}
+
+bool utf8DecoderFeed(Utf8Decoder* dec, uint8_t byte, uint32_t* out)
+{
+    if ((byte & 0xC0) == 0x80) {
+        // Continuation byte
+        if (!dec->remaining) {
+            *out = GLYPH_CACHE_REPLACEMENT;
+            return true;
+        }
+        dec->codepoint = dec->codepoint << 6 | (byte & 0x3F);
+        if (--dec->remaining)
+            return false;
+        *out = dec->codepoint;
+        return true;
+    }
+
+    // Any other byte starts a new sequence, dropping the previous one if it was left incomplete
+    if (byte < 0x80) {
+        dec->remaining = 0;
+        *out = byte;
+        return true;
+    } else if ((byte & 0xE0) == 0xC0) {
+        dec->codepoint = byte & 0x1F;
+        dec->remaining = 1;
+    } else if ((byte & 0xF0) == 0xE0) {
+        dec->codepoint = byte & 0x0F;
+        dec->remaining = 2;
+    } else if ((byte & 0xF8) == 0xF0) {
+        dec->codepoint = byte & 0x07;
+        dec->remaining = 3;
+    } else {
+        dec->remaining = 0;
+        *out = GLYPH_CACHE_REPLACEMENT;
+        return true;
+    }
+    return false;
+}
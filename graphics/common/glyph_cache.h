@@ -0,0 +1,103 @@
+// Glyph cache for console renderers.
+// Characters outside of the built-in font are rasterized on demand into a fixed number of slots,
+// which are tiles placed right after the built-in ones in the tileset. Once all slots are in use,
+// the least recently used glyph that isn't on the screen is evicted: the renderer reports the tiles
+// it shows through a pin callback. When every slot is on the screen, the replacement glyph (which
+// always keeps its slot) is used instead. Renderers only upload the slots that were (re)rasterized.
+#pragma once
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define GLYPH_CACHE_DEFAULT_SLOTS 1024
+#define GLYPH_CACHE_REPLACEMENT   0xFFFD
+
+// Renders a glyph as 8-bit coverage values into a width*height image (top row first)
+typedef bool (*GlyphRasterizeFn)(void* user, uint32_t codepoint, uint8_t* out, unsigned width, unsigned height);
+
+typedef struct GlyphCache GlyphCache;
+
+// Calls glyphCachePin for every tile the renderer may still show
+typedef void (*GlyphPinFn)(void* user, GlyphCache* gc);
+
+typedef struct GlyphSlot GlyphSlot;
+
+struct GlyphCache {
+    unsigned tileWidth;
+    unsigned tileHeight;
+    unsigned firstTile;
+    unsigned numSlots;
+    GlyphRasterizeFn rasterize;
+    void* user;
+    GlyphPinFn collectPins;
+    void* pinUser;
+
+    GlyphSlot* slots;
+    int32_t* buckets;
+    unsigned bucketMask;
+    int32_t lruHead; // most recently used slot
+    int32_t lruTail; // least recently used slot
+    unsigned numUsed;
+    bool pinsRefreshed; // the pins were collected again during this frame
+
+    uint8_t* pixels;
+    uint32_t* dirtySlots;
+    unsigned numDirty;
+
+    // Statistics
+    uint32_t hits;
+    uint32_t misses;
+    uint32_t evictions;
+    uint32_t overflows; // glyphs shown as the replacement glyph, for lack of a slot
+};
+
+bool glyphCacheInit(GlyphCache* gc, unsigned tileWidth, unsigned tileHeight, unsigned firstTile, unsigned numSlots, GlyphRasterizeFn rasterize, void* user);
+void glyphCacheExit(GlyphCache* gc);
+
+// Sets the callback reporting the tiles on the screen. Without it, slots are never evicted.
+void glyphCacheSetPinCallback(GlyphCache* gc, GlyphPinFn collectPins, void* user);
+
+// Marks a tile as being on the screen (tiles not belonging to the cache are ignored)
+void glyphCachePin(GlyphCache* gc, unsigned tile);
+
+// Returns the tile showing a codepoint, rasterizing the glyph if it isn't cached yet
+unsigned glyphCacheGetTile(GlyphCache* gc, uint32_t codepoint);
+
+// Returns the codepoint shown by a tile, or 0 if the tile doesn't belong to the cache
+uint32_t glyphCacheGetCodepoint(const GlyphCache* gc, unsigned tile);
+
+static inline const uint8_t* glyphCacheGetSlotPixels(const GlyphCache* gc, unsigned slot)
+{
+    return gc->pixels + slot*gc->tileWidth*gc->tileHeight;
+}
+
+// Slots that were rasterized since the dirty list was last cleared
+static inline const uint32_t* glyphCacheGetDirty(const GlyphCache* gc, unsigned* outCount)
+{
+    *outCount = gc->numDirty;
+    return gc->dirtySlots;
+}
+
+void glyphCacheClearDirty(GlyphCache* gc);
+
+// Called once per frame by the renderer, allows the pins to be collected again
+static inline void glyphCacheEndFrame(GlyphCache* gc)
+{
+    gc->pinsRefreshed = false;
+}
+
+typedef struct {
+    uint32_t codepoint;
+    unsigned remaining;
+} Utf8Decoder;
+
+// Feeds a byte of UTF-8 text, returning true once a whole codepoint has been decoded.
+// Stray continuation bytes decode as GLYPH_CACHE_REPLACEMENT; truncated sequences are dropped.
+bool utf8DecoderFeed(Utf8Decoder* dec, uint8_t byte, uint32_t* out);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,289 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "scrollback.h"
+
+// Encoded row format: a 16-bit size (in bytes) of the encoded cells, followed by tokens.
+// Each token starts with a 16-bit header: if the top bit is set, the following cell is
+// repeated (header & 0x7FFF) times; otherwise, (header & 0x7FFF) literal cells follow.
+#define TOKEN_REPEAT    0x8000
+#define TOKEN_MAX_COUNT 0x7FFF
+#define MIN_REPEAT      3
+
+struct ScrollbackChunk {
+    uint32_t firstLine;
+    uint32_t numRows;
+    uint32_t used;
+    uint8_t data[SCROLLBACK_CHUNK_SIZE];
+};
+
+static inline bool cellEqual(const ScrollbackCell* a, const ScrollbackCell* b)
+{
+    return a->ch == b->ch && a->frontPal == b->frontPal && a->backPal == b->backPal;
+}
+
+static inline void putU16(uint8_t* p, uint16_t v)
+{
+    memcpy(p, &v, sizeof(v));
+}
+
+static inline uint16_t getU16(const uint8_t* p)
+{
+    uint16_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+// Encodes a row, returning the size of the encoded data. If out is NULL, only the size is calculated.
+static uint32_t encodeRow(const ScrollbackCell* row, unsigned width, uint8_t* out)
+{
+    uint32_t size = 0;
+    unsigned literalStart = 0;
+    unsigned x = 0;
+
+    while (x <= width) {
+        // Measure the run of identical cells starting here
+        unsigned run = 1;
+        if (x < width) {
+            while (x + run < width && run < TOKEN_MAX_COUNT && cellEqual(&row[x], &row[x+run]))
+                run ++;
+        }
+
+        // Flush the pending literal cells when a repeated run starts, or at the end of the row
+        if (x == width || run >= MIN_REPEAT || x - literalStart == TOKEN_MAX_COUNT) {
+            unsigned count = x - literalStart;
+            if (count) {
+                if (out) {
+                    putU16(out + size, count);
+                    memcpy(out + size + 2, &row[literalStart], count*sizeof(ScrollbackCell));
+                }
+                size += 2 + count*sizeof(ScrollbackCell);
+            }
+            literalStart = x;
+        }
+
+        if (x == width)
+            break;
+
+        if (run >= MIN_REPEAT) {
+            if (out) {
+                putU16(out + size, TOKEN_REPEAT | run);
+                memcpy(out + size + 2, &row[x], sizeof(ScrollbackCell));
+            }
+            size += 2 + sizeof(ScrollbackCell);
+            x += run;
+            literalStart = x;
+        } else {
+            x ++;
+        }
+    }
+
+    return size;
+}
+
+static void decodeRow(const uint8_t* in, uint32_t size, ScrollbackCell* out, unsigned width)
+{
+    const uint8_t* end = in + size;
+    unsigned x = 0;
+
+    while (in < end && x < width) {
+        uint16_t header = getU16(in);
+        unsigned count = header & TOKEN_MAX_COUNT;
+        if (count > width - x)
+            count = width - x;
+        in += 2;
+
+        if (header & TOKEN_REPEAT) {
+            ScrollbackCell cell;
+            memcpy(&cell, in, sizeof(cell));
+            for (unsigned i = 0; i < count; i ++)
+                out[x++] = cell;
+            in += sizeof(ScrollbackCell);
+        } else {
+            memcpy(&out[x], in, count*sizeof(ScrollbackCell));
+            x += count;
+            in += (header & TOKEN_MAX_COUNT)*sizeof(ScrollbackCell);
+        }
+    }
+
+    // Pad the row with empty cells, in case it was cut short
+    if (x < width)
+        memset(&out[x], 0, (width - x)*sizeof(ScrollbackCell));
+}
+
+static inline ScrollbackChunk* getChunk(const Scrollback* sb, unsigned i)
+{
+    return sb->chunks[(sb->firstChunk + i) % sb->maxChunks];
+}
+
+// Finds the index (relative to the oldest chunk) of the chunk containing a line
+static unsigned findChunk(const Scrollback* sb, uint32_t line)
+{
+    // Line numbers are compared relative to the oldest line, so that they may wrap around
+    uint32_t rel = line - sb->firstLine;
+    unsigned lo = 0, hi = sb->numChunks - 1;
+    while (lo < hi) {
+        unsigned mid = (lo + hi + 1) / 2;
+        if (getChunk(sb, mid)->firstLine - sb->firstLine <= rel)
+            lo = mid;
+        else
+            hi = mid - 1;
+    }
+    return lo;
+}
+
+bool scrollbackInit(Scrollback* sb, unsigned width, unsigned maxChunks)
+{
+    memset(sb, 0, sizeof(*sb));
+
+    // Make sure that even a row that doesn't compress at all fits in a chunk
+    if (!width || 2 + 2*(width/TOKEN_MAX_COUNT + 1) + width*sizeof(ScrollbackCell) > SCROLLBACK_CHUNK_SIZE)
+        return false;
+
+    sb->width = width;
+    sb->maxChunks = maxChunks ? maxChunks : SCROLLBACK_DEFAULT_CHUNKS;
+    sb->chunks = (ScrollbackChunk**)calloc(sb->maxChunks, sizeof(ScrollbackChunk*));
+    sb->tempRow = (ScrollbackCell*)malloc(width*sizeof(ScrollbackCell));
+    if (!sb->chunks || !sb->tempRow) {
+        scrollbackExit(sb);
+        return false;
+    }
+
+    return true;
+}
+
+void scrollbackExit(Scrollback* sb)
+{
+    if (sb->chunks) {
+        for (unsigned i = 0; i < sb->maxChunks; i ++)
+            free(sb->chunks[i]);
+        free(sb->chunks);
+    }
+    free(sb->tempRow);
+    memset(sb, 0, sizeof(*sb));
+}
+
+void scrollbackClear(Scrollback* sb)
+{
+    // Keep the chunks allocated, they will be reused
+    sb->firstChunk = 0;
+    sb->numChunks = 0;
+    sb->firstLine = sb->endLine;
+}
+
+void scrollbackPush(Scrollback* sb, const ScrollbackCell* row)
+{
+    if (!sb->chunks)
+        return;
+
+    uint32_t size = encodeRow(row, sb->width, NULL);
+    ScrollbackChunk* chunk = sb->numChunks ? getChunk(sb, sb->numChunks-1) : NULL;
+
+    // Start a new chunk if the row doesn't fit in the current one
+    if (!chunk || chunk->used + 2 + size > SCROLLBACK_CHUNK_SIZE) {
+        unsigned slot = (sb->firstChunk + sb->numChunks) % sb->maxChunks;
+        if (sb->numChunks == sb->maxChunks) {
+            // Recycle the oldest chunk, forgetting about the lines it holds
+            ScrollbackChunk* oldest = getChunk(sb, 0);
+            sb->firstLine += oldest->numRows;
+            sb->firstChunk = (sb->firstChunk + 1) % sb->maxChunks;
+            sb->numChunks --;
+        } else if (!sb->chunks[slot]) {
+            sb->chunks[slot] = (ScrollbackChunk*)malloc(sizeof(ScrollbackChunk));
+            if (!sb->chunks[slot])
+                return;
+        }
+
+        chunk = sb->chunks[slot];
+        chunk->firstLine = sb->endLine;
+        chunk->numRows = 0;
+        chunk->used = 0;
+        sb->numChunks ++;
+    }
+
+    putU16(chunk->data + chunk->used, size);
+    encodeRow(row, sb->width, chunk->data + chunk->used + 2);
+    chunk->used += 2 + size;
+    chunk->numRows ++;
+    sb->endLine ++;
+}
+
+bool scrollbackGetLine(Scrollback* sb, uint32_t line, ScrollbackCell* out)
+{
+    if (line - sb->firstLine >= scrollbackGetNumLines(sb))
+        return false;
+
+    ScrollbackChunk* chunk = getChunk(sb, findChunk(sb, line));
+
+    // Skip over the rows that precede the requested one
+    const uint8_t* p = chunk->data;
+    for (uint32_t i = chunk->firstLine; i != line; i ++)
+        p += 2 + getU16(p);
+
+    decodeRow(p + 2, getU16(p), out, sb->width);
+    return true;
+}
+
+static bool matchRow(const ScrollbackCell* row, unsigned width, const char* needle, size_t len, unsigned* outCol)
+{
+    for (unsigned x = 0; x + len <= width; x ++) {
+        size_t i;
+        for (i = 0; i < len && row[x+i].ch == (uint8_t)needle[i]; i ++);
+        if (i == len) {
+            *outCol = x;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool scrollbackFind(Scrollback* sb, const char* needle, uint32_t startLine, bool backwards, uint32_t* outLine, unsigned* outCol)
+{
+    size_t len = strlen(needle);
+    uint32_t numLines = scrollbackGetNumLines(sb);
+    if (!len || len > sb->width || !numLines)
+        return false;
+
+    // Clamp the starting line to the stored range
+    if ((int32_t)(startLine - sb->firstLine) < 0) {
+        if (backwards) return false;
+        startLine = sb->firstLine;
+    } else if (startLine - sb->firstLine >= numLines) {
+        if (!backwards) return false;
+        startLine = sb->endLine - 1;
+    }
+
+    // Rows are decoded sequentially chunk by chunk, so that no line needs to be looked up on its own
+    unsigned first = findChunk(sb, startLine);
+    for (unsigned n = 0; n < sb->numChunks; n ++) {
+        unsigned c = backwards ? first - n : first + n;
+        if (c >= sb->numChunks)
+            break;
+
+        ScrollbackChunk* chunk = getChunk(sb, c);
+        const uint8_t* p = chunk->data;
+        bool found = false;
+        for (uint32_t i = 0; i < chunk->numRows; i ++, p += 2 + getU16(p)) {
+            uint32_t line = chunk->firstLine + i;
+            if (backwards ? (int32_t)(line - startLine) > 0 : (int32_t)(line - startLine) < 0)
+                continue;
+
+            unsigned col;
+            decodeRow(p + 2, getU16(p), sb->tempRow, sb->width);
+            if (matchRow(sb->tempRow, sb->width, needle, len, &col)) {
+                *outLine = line;
+                *outCol = col;
+                found = true;
+
+                // Going forwards, the first match is the closest one; going backwards it is the last one
+                if (!backwards)
+                    return true;
+            }
+        }
+
+        if (found)
+            return true;
+    }
+
+    return false;
+}
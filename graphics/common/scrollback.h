@@ -0,0 +1,57 @@
+// Compact scrollback history for console renderers.
+// Rows that scroll off the screen are appended to a ring of fixed size chunks. Each row is stored
+// run-length encoded (runs of identical cells, such as blank spans, take up a single cell), and once
+// all chunks are in use the oldest one is recycled, dropping the lines it holds.
+#pragma once
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Size of each chunk of history, and default number of chunks
+#define SCROLLBACK_CHUNK_SIZE (16*1024)
+#define SCROLLBACK_DEFAULT_CHUNKS 256
+
+typedef struct {
+    uint16_t ch;
+    uint8_t frontPal;
+    uint8_t backPal;
+} ScrollbackCell;
+
+typedef struct ScrollbackChunk ScrollbackChunk;
+
+typedef struct {
+    unsigned width;
+    unsigned maxChunks;
+    unsigned firstChunk;
+    unsigned numChunks;
+    ScrollbackChunk** chunks;
+    ScrollbackCell* tempRow;
+    uint32_t firstLine; // absolute number of the oldest line still stored
+    uint32_t endLine;   // absolute number of the line after the newest one
+} Scrollback;
+
+bool scrollbackInit(Scrollback* sb, unsigned width, unsigned maxChunks);
+void scrollbackExit(Scrollback* sb);
+void scrollbackClear(Scrollback* sb);
+
+// Appends a row of sb->width cells
+void scrollbackPush(Scrollback* sb, const ScrollbackCell* row);
+
+static inline uint32_t scrollbackGetNumLines(const Scrollback* sb)
+{
+    return sb->endLine - sb->firstLine;
+}
+
+// Retrieves a line given its absolute number; returns false if it is no longer (or not yet) stored
+bool scrollbackGetLine(Scrollback* sb, uint32_t line, ScrollbackCell* out);
+
+// Looks for a substring in the history, starting at the given line and going towards older
+// lines (backwards) or newer ones. Characters outside of ASCII only match themselves.
+bool scrollbackFind(Scrollback* sb, const char* needle, uint32_t startLine, bool backwards, uint32_t* outLine, unsigned* outCol);
+
+#ifdef __cplusplus
+}
+#endif
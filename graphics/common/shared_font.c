@@ -0,0 +1,110 @@
+#include <string.h>
+#include <switch.h>
+
+#include <ft2build.h>
+#include FT_FREETYPE_H
+
+#include "shared_font.h"
+
+static FT_Library s_library;
+static FT_Face s_faces[PlSharedFontType_Total];
+static unsigned s_numFaces;
+static int s_baseline;
+
+bool sharedFontInit(unsigned tileWidth, unsigned tileHeight)
+{
+    if (s_numFaces)
+        return true;
+
+    Result rc = plInitialize(PlServiceType_User);
+    if (R_FAILED(rc))
+        return false;
+
+    if (FT_Init_FreeType(&s_library)) {
+        plExit();
+        return false;
+    }
+
+    // Load every shared font, so that glyphs missing from one can be looked up in the others
+    for (unsigned i = 0; i < PlSharedFontType_Total; i ++) {
+        PlFontData font;
+        if (R_FAILED(plGetSharedFontByType(&font, i)))
+            continue;
+
+        FT_Face face;
+        if (FT_New_Memory_Face(s_library, font.address, font.size, 0, &face))
+            continue;
+
+        // Size the glyphs so that they fit in a tile
+        if (FT_Set_Pixel_Sizes(face, 0, tileHeight)) {
+            FT_Done_Face(face);
+            continue;
+        }
+
+        s_faces[s_numFaces++] = face;
+    }
+
+    if (!s_numFaces) {
+        sharedFontExit();
+        return false;
+    }
+
+    // Place the baseline according to the ascender/descender ratio of the main font
+    FT_Size_Metrics* metrics = &s_faces[0]->size->metrics;
+    int ascender = metrics->ascender >> 6, descender = -(metrics->descender >> 6);
+    s_baseline = ascender + descender ? tileHeight * ascender / (ascender + descender) : tileHeight;
+    return true;
+}
+
+void sharedFontExit(void)
+{
+    for (unsigned i = 0; i < s_numFaces; i ++)
+        FT_Done_Face(s_faces[i]);
+    s_numFaces = 0;
+
+    if (s_library) {
+        FT_Done_FreeType(s_library);
+        s_library = NULL;
+        plExit();
+    }
+}
+
+bool sharedFontRasterize(void* user, uint32_t codepoint, uint8_t* out, unsigned width, unsigned height)
+{
+    // Find the first font that has the glyph (falling back to the first font's missing glyph)
+    FT_Face face = s_faces[0];
+    FT_UInt glyphIndex = 0;
+    for (unsigned i = 0; i < s_numFaces && !glyphIndex; i ++) {
+        glyphIndex = FT_Get_Char_Index(s_faces[i], codepoint);
+        if (glyphIndex)
+            face = s_faces[i];
+    }
+
+    if (!face || FT_Load_Glyph(face, glyphIndex, FT_LOAD_DEFAULT) || FT_Render_Glyph(face->glyph, FT_RENDER_MODE_NORMAL))
+        return false;
+
+    FT_Bitmap* bitmap = &face->glyph->bitmap;
+    if (bitmap->pixel_mode != FT_PIXEL_MODE_GRAY)
+        return false;
+
+    // Center the glyph horizontally within the tile, and clip whatever doesn't fit
+    int advance = face->glyph->advance.x >> 6;
+    int x0 = ((int)width - advance) / 2 + face->glyph->bitmap_left;
+    int y0 = s_baseline - face->glyph->bitmap_top;
+    if (x0 < 0 && x0 + (int)bitmap->width <= (int)width)
+        x0 = 0;
+
+    for (int y = 0; y < (int)bitmap->rows; y ++) {
+        int ty = y0 + y;
+        if (ty < 0 || ty >= (int)height)
+            continue;
+        const uint8_t* src = bitmap->buffer + y*bitmap->pitch;
+        for (int x = 0; x < (int)bitmap->width; x ++) {
+            int tx = x0 + x;
+            if (tx >= 0 && tx < (int)width)
+                out[ty*width + tx] = src[x];
+        }
+    }
+
+    return true;
+}
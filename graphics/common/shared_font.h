@@ -0,0 +1,18 @@
+// Rasterizes glyphs for the glyph cache using the system shared fonts (through FreeType).
+#pragma once
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+bool sharedFontInit(unsigned tileWidth, unsigned tileHeight);
+void sharedFontExit(void);
+
+// Matches GlyphRasterizeFn (the user pointer is unused)
+bool sharedFontRasterize(void* user, uint32_t codepoint, uint8_t* out, unsigned width, unsigned height);
+
+#ifdef __cplusplus
+}
+#endif
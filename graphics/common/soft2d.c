@@ -0,0 +1,183 @@
+#include <string.h>
+
+#include "soft2d.h"
+
+// Vectors of 4 pixels, which may be read from and written to any (unaligned) pixel array
+typedef u32 u32x4 __attribute__((vector_size(16), aligned(1), may_alias));
+typedef u8 u8x16 __attribute__((vector_size(16), aligned(1), may_alias));
+typedef u16 u16x8 __attribute__((vector_size(16)));
+typedef u8 mask8x16 __attribute__((vector_size(16)));
+
+// Clips a rectangle drawn at (x, y) to the surface, returning false if nothing is left of it.
+// srcX and srcY return how much of the rectangle was cut off on the left and at the top.
+static bool clipRect(const Soft2dSurface* surf, s32* x, s32* y, s32* width, s32* height, s32* srcX, s32* srcY)
+{
+    *srcX = *x < 0 ? -*x : 0;
+    *srcY = *y < 0 ? -*y : 0;
+    *x += *srcX;
+    *y += *srcY;
+    *width -= *srcX;
+    *height -= *srcY;
+
+    if (*x + *width > (s32)surf->width)
+        *width = (s32)surf->width - *x;
+    if (*y + *height > (s32)surf->height)
+        *height = (s32)surf->height - *y;
+    return *width > 0 && *height > 0;
+}
+
+static void fillRow(u32* dst, u32 count, u32 color)
+{
+    const u32x4 v = { color, color, color, color };
+    u32 i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        *(u32x4*)&dst[i+0] = v;
+        *(u32x4*)&dst[i+4] = v;
+        *(u32x4*)&dst[i+8] = v;
+        *(u32x4*)&dst[i+12] = v;
+    }
+    for (; i + 4 <= count; i += 4)
+        *(u32x4*)&dst[i] = v;
+    for (; i < count; i ++)
+        dst[i] = color;
+}
+
+void soft2dFill(const Soft2dSurface* surf, s32 x, s32 y, s32 width, s32 height, u32 color)
+{
+    s32 srcX, srcY;
+    if (!clipRect(surf, &x, &y, &width, &height, &srcX, &srcY))
+        return;
+
+    // Whole rows without padding between them can be filled in one go
+    if (width == (s32)surf->width && surf->stride == surf->width * sizeof(u32))
+    {
+        fillRow(soft2dRow(surf, y) + x, width * height, color);
+        return;
+    }
+
+    for (s32 row = 0; row < height; row ++)
+        fillRow(soft2dRow(surf, y + row) + x, width, color);
+}
+
+void soft2dCopy(const Soft2dSurface* surf, s32 x, s32 y, const u32* src, s32 width, s32 height, u32 srcStride)
+{
+    s32 srcX, srcY;
+    if (!clipRect(surf, &x, &y, &width, &height, &srcX, &srcY))
+        return;
+
+    const u8* srcRow = (const u8*)src + srcY * srcStride + srcX * sizeof(u32);
+    for (s32 row = 0; row < height; row ++, srcRow += srcStride)
+        memcpy(soft2dRow(surf, y + row) + x, srcRow, width * sizeof(u32));
+}
+
+static void convertRowRgb888(u32* dst, const u8* src, u32 count, u32 add)
+{
+    // The alpha byte is taken from anywhere (here the first byte), it's overwritten anyway
+    const mask8x16 expand = { 0, 1, 2, 0, 3, 4, 5, 0, 6, 7, 8, 0, 9, 10, 11, 0 };
+    const u32x4 alpha = { 0xff000000, 0xff000000, 0xff000000, 0xff000000 };
+    const u32x4 addv = { add, add, add, add };
+
+    // Each step loads 16 bytes but only uses 12 of them (4 pixels), so stop early enough
+    // not to read past the end of the row
+    u32 i = 0;
+    for (; i + 6 <= count; i += 4)
+    {
+        u8x16 in = *(const u8x16*)&src[i*3];
+        u8x16 px = __builtin_shuffle(in, expand) + (u8x16)addv;
+        *(u32x4*)&dst[i] = (u32x4)px | alpha;
+    }
+    for (; i < count; i ++)
+        dst[i] = RGBA8_MAXALPHA(src[i*3+0] + (add & 0xff), src[i*3+1] + ((add >> 8) & 0xff), src[i*3+2] + ((add >> 16) & 0xff));
+}
+
+void soft2dCopyRgb888(const Soft2dSurface* surf, s32 x, s32 y, const u8* src, s32 width, s32 height, u32 srcStride, u32 add)
+{
+    s32 srcX, srcY;
+    if (!clipRect(surf, &x, &y, &width, &height, &srcX, &srcY))
+        return;
+
+    const u8* srcRow = src + srcY * srcStride + srcX * 3;
+    for (s32 row = 0; row < height; row ++, srcRow += srcStride)
+        convertRowRgb888(soft2dRow(surf, y + row) + x, srcRow, width, add);
+}
+
+// Widens the low or high 8 bytes of a vector to 16 bits
+static inline u16x8 widenLo(u8x16 v)
+{
+    const mask8x16 mask = { 0, 16, 1, 16, 2, 16, 3, 16, 4, 16, 5, 16, 6, 16, 7, 16 };
+    return (u16x8)__builtin_shuffle(v, (u8x16){}, mask);
+}
+
+static inline u16x8 widenHi(u8x16 v)
+{
+    const mask8x16 mask = { 8, 16, 9, 16, 10, 16, 11, 16, 12, 16, 13, 16, 14, 16, 15, 16 };
+    return (u16x8)__builtin_shuffle(v, (u8x16){}, mask);
+}
+
+static inline u8x16 narrow(u16x8 lo, u16x8 hi)
+{
+    const mask8x16 mask = { 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30 };
+    return __builtin_shuffle((u8x16)lo, (u8x16)hi, mask);
+}
+
+// (s*a + d*(255-a)) / 255, rounded, for values that fit in 8 bits
+static inline u16x8 blendChannels(u16x8 s, u16x8 d, u16x8 a)
+{
+    u16x8 t = s * a + d * (255 - a) + 128;
+    return (t + (t >> 8)) >> 8;
+}
+
+static inline u32 blendPixel(u32 s, u32 d)
+{
+    u32 a = s >> 24;
+    u32 out = 0xff000000;
+    for (u32 shift = 0; shift < 24; shift += 8)
+    {
+        u32 t = ((s >> shift) & 0xff) * a + ((d >> shift) & 0xff) * (255 - a) + 128;
+        out |= ((t + (t >> 8)) >> 8) << shift;
+    }
+    return out;
+}
+
+static void blendRow(u32* dst, const u32* src, u32 count)
+{
+    const mask8x16 alphas = { 3, 3, 3, 3, 7, 7, 7, 7, 11, 11, 11, 11, 15, 15, 15, 15 };
+    const u32x4 opaque = { 0xff000000, 0xff000000, 0xff000000, 0xff000000 };
+
+    u32 i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        u32x4 s = *(const u32x4*)&src[i];
+
+        // Sprites are mostly fully opaque or fully transparent, which needs no blending
+        u32x4 a = s >> 24;
+        if ((a[0] & a[1] & a[2] & a[3]) == 0xff)
+        {
+            *(u32x4*)&dst[i] = s;
+            continue;
+        }
+        if (!(a[0] | a[1] | a[2] | a[3]))
+            continue;
+
+        u8x16 sb = (u8x16)s;
+        u8x16 db = *(const u8x16*)&dst[i];
+        u8x16 ab = __builtin_shuffle(sb, alphas);
+        u16x8 lo = blendChannels(widenLo(sb), widenLo(db), widenLo(ab));
+        u16x8 hi = blendChannels(widenHi(sb), widenHi(db), widenHi(ab));
+        *(u32x4*)&dst[i] = (u32x4)narrow(lo, hi) | opaque;
+    }
+    for (; i < count; i ++)
+        dst[i] = blendPixel(src[i], dst[i]);
+}
+
+void soft2dBlend(const Soft2dSurface* surf, s32 x, s32 y, const u32* src, s32 width, s32 height, u32 srcStride)
+{
+    s32 srcX, srcY;
+    if (!clipRect(surf, &x, &y, &width, &height, &srcX, &srcY))
+        return;
+
+    const u8* srcRow = (const u8*)src + srcY * srcStride + srcX * sizeof(u32);
+    for (s32 row = 0; row < height; row ++, srcRow += srcStride)
+        blendRow(soft2dRow(surf, y + row) + x, (const u32*)srcRow, width);
+}
@@ -0,0 +1,33 @@
+// Software 2D routines for linear RGBA8888 framebuffers (see libnx display/framebuffer.h).
+// Everything works a row at a time on 4 pixels at once, using GCC vector extensions which compile
+// to NEON on the Switch (and to SSE on x86 hosts). Rectangles are clipped to the surface.
+#pragma once
+
+#include <switch.h>
+
+typedef struct
+{
+    u32* pixels;
+    u32 width;
+    u32 height;
+    u32 stride;   // in bytes, as returned by framebufferBegin
+} Soft2dSurface;
+
+static inline u32* soft2dRow(const Soft2dSurface* surf, u32 y)
+{
+    return (u32*)((u8*)surf->pixels + y * surf->stride);
+}
+
+// Fills a rectangle with a color
+void soft2dFill(const Soft2dSurface* surf, s32 x, s32 y, s32 width, s32 height, u32 color);
+
+// Copies a RGBA8888 image, srcStride being in bytes
+void soft2dCopy(const Soft2dSurface* surf, s32 x, s32 y, const u32* src, s32 width, s32 height, u32 srcStride);
+
+// Copies a RGB888 image, setting the alpha to 255, srcStride being in bytes.
+// add is added to each converted pixel, channel by channel (wrapping around), 0 for a plain copy.
+void soft2dCopyRgb888(const Soft2dSurface* surf, s32 x, s32 y, const u8* src, s32 width, s32 height, u32 srcStride, u32 add);
+
+// Draws a RGBA8888 image with non-premultiplied alpha over the surface, srcStride being in bytes.
+// The framebuffer is opaque, so the alpha of the result is always 255.
+void soft2dBlend(const Soft2dSurface* surf, s32 x, s32 y, const u32* src, s32 width, s32 height, u32 srcStride);
@@ -0,0 +1,118 @@
+#include <string.h>
+
+#include "tile_pool.h"
+
+// Takes tiles until there are none left, from any number of threads at once
+static void runTiles(TilePool* pool)
+{
+    for (;;)
+    {
+        u32 i = __atomic_fetch_add(&pool->nextTile, 1, __ATOMIC_RELAXED);
+        if (i >= pool->numTiles)
+            break;
+
+        u32 x = i % pool->tilesX * pool->tileWidth;
+        u32 y = i / pool->tilesX * pool->tileHeight;
+        Soft2dSurface tile =
+        {
+            .pixels = soft2dRow(&pool->surf, y) + x,
+            .width  = pool->surf.width - x < pool->tileWidth ? pool->surf.width - x : pool->tileWidth,
+            .height = pool->surf.height - y < pool->tileHeight ? pool->surf.height - y : pool->tileHeight,
+            .stride = pool->surf.stride,
+        };
+        pool->func(pool->user, &tile, x, y);
+    }
+}
+
+static void workerMain(void* arg)
+{
+    TilePool* pool = (TilePool*)arg;
+    u32 generation = 0;
+
+    for (;;)
+    {
+        mutexLock(&pool->mutex);
+        while (pool->generation == generation && !pool->exiting)
+            condvarWait(&pool->workCondVar, &pool->mutex);
+        generation = pool->generation;
+        bool exiting = pool->exiting;
+        mutexUnlock(&pool->mutex);
+
+        if (exiting)
+            break;
+
+        runTiles(pool);
+
+        mutexLock(&pool->mutex);
+        if (--pool->busyWorkers == 0)
+            condvarWakeAll(&pool->doneCondVar);
+        mutexUnlock(&pool->mutex);
+    }
+}
+
+void tilePoolCreate(TilePool* pool, u32 numThreads)
+{
+    memset(pool, 0, sizeof(*pool));
+    mutexInit(&pool->mutex);
+    condvarInit(&pool->workCondVar);
+    condvarInit(&pool->doneCondVar);
+
+    if (numThreads > TILEPOOL_MAX_THREADS)
+        numThreads = TILEPOOL_MAX_THREADS;
+
+    // The main thread runs on core 0, so the workers go to the other cores
+    for (u32 i = 0; i + 1 < numThreads; i ++)
+    {
+        Thread* thread = &pool->threads[pool->numWorkers];
+        if (R_FAILED(threadCreate(thread, workerMain, pool, NULL, 0x4000, 0x2C, 1 + i)))
+            break;
+        if (R_FAILED(threadStart(thread)))
+        {
+            threadClose(thread);
+            break;
+        }
+        pool->numWorkers ++;
+    }
+}
+
+void tilePoolClose(TilePool* pool)
+{
+    mutexLock(&pool->mutex);
+    pool->exiting = true;
+    condvarWakeAll(&pool->workCondVar);
+    mutexUnlock(&pool->mutex);
+
+    for (u32 i = 0; i < pool->numWorkers; i ++)
+    {
+        threadWaitForExit(&pool->threads[i]);
+        threadClose(&pool->threads[i]);
+    }
+    pool->numWorkers = 0;
+}
+
+void tilePoolRun(TilePool* pool, const Soft2dSurface* surf, u32 tileWidth, u32 tileHeight, TileFunc func, void* user)
+{
+    // The job is published by the mutex, the workers only look at it once they've taken it
+    pool->func = func;
+    pool->user = user;
+    pool->surf = *surf;
+    pool->tileWidth = tileWidth;
+    pool->tileHeight = tileHeight;
+    pool->tilesX = (surf->width + tileWidth - 1) / tileWidth;
+    pool->numTiles = pool->tilesX * ((surf->height + tileHeight - 1) / tileHeight);
+    pool->nextTile = 0;
+
+    mutexLock(&pool->mutex);
+    pool->generation ++;
+    pool->busyWorkers = pool->numWorkers;
+    condvarWakeAll(&pool->workCondVar);
+    mutexUnlock(&pool->mutex);
+
+    // Help out instead of just waiting
+    runTiles(pool);
+
+    mutexLock(&pool->mutex);
+    while (pool->busyWorkers)
+        condvarWait(&pool->doneCondVar, &pool->mutex);
+    mutexUnlock(&pool->mutex);
+}
@@ -0,0 +1,47 @@
+// Multi-threaded tile rendering for CPU-drawn framebuffers.
+// The surface (usually the buffer from framebufferBegin) is split into tiles small enough to stay in
+// the L1 data cache, which a pool of threads then renders in parallel. tilePoolRun only returns once
+// every tile is done, so framebufferEnd can be called right after it.
+#pragma once
+
+#include <switch.h>
+
+#include "soft2d.h"
+
+// Applications get cores 0 to 2 (core 3 belongs to the system), the calling thread is one of them
+#define TILEPOOL_MAX_THREADS 3
+
+// 128x32 RGBA8888 pixels are 16 KiB, half the L1 data cache of the Cortex-A57
+#define TILEPOOL_TILE_WIDTH  128
+#define TILEPOOL_TILE_HEIGHT 32
+
+// Renders one tile. The tile is a surface of its own (so soft2d clips to it), x and y are its position.
+typedef void (*TileFunc)(void* user, const Soft2dSurface* tile, u32 x, u32 y);
+
+typedef struct
+{
+    Thread threads[TILEPOOL_MAX_THREADS - 1];
+    u32 numWorkers;
+    Mutex mutex;
+    CondVar workCondVar;
+    CondVar doneCondVar;
+    u32 generation;   // incremented for each tilePoolRun
+    u32 busyWorkers;
+    bool exiting;
+
+    // Current job
+    TileFunc func;
+    void* user;
+    Soft2dSurface surf;
+    u32 tileWidth, tileHeight;
+    u32 tilesX, numTiles;
+    u32 nextTile;
+} TilePool;
+
+// Starts numThreads-1 worker threads on cores 1 and up, the caller being the remaining thread.
+// If threads can't be started, the pool still works with those that could (or on the caller only).
+void tilePoolCreate(TilePool* pool, u32 numThreads);
+void tilePoolClose(TilePool* pool);
+
+// Renders all the tiles of a surface, returning once they're done
+void tilePoolRun(TilePool* pool, const Soft2dSurface* surf, u32 tileWidth, u32 tileHeight, TileFunc func, void* user);
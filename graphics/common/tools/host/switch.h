@@ -0,0 +1,60 @@
+// Just enough of libnx for the host tools to build graphics/common: types, color macros, and threads,
+// mutexes and condition variables implemented with pthreads. Threads ignore their priority and core,
+// so run the tools under taskset to choose the cores they get.
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <pthread.h>
+
+typedef uint8_t u8;
+typedef uint16_t u16;
+typedef uint32_t u32;
+typedef uint64_t u64;
+typedef int32_t s32;
+
+typedef u32 Result;
+#define R_FAILED(rc) ((rc) != 0)
+
+#define RGBA8(r,g,b,a)        (((r)&0xff)|(((g)&0xff)<<8)|(((b)&0xff)<<16)|(((a)&0xff)<<24))
+#define RGBA8_MAXALPHA(r,g,b) RGBA8((r),(g),(b),0xff)
+
+typedef void (*ThreadFunc)(void*);
+
+typedef struct
+{
+    pthread_t handle;
+    ThreadFunc entry;
+    void* arg;
+} Thread;
+
+typedef pthread_mutex_t Mutex;
+typedef pthread_cond_t CondVar;
+
+static inline void mutexInit(Mutex* m)   { pthread_mutex_init(m, NULL); }
+static inline void mutexLock(Mutex* m)   { pthread_mutex_lock(m); }
+static inline void mutexUnlock(Mutex* m) { pthread_mutex_unlock(m); }
+
+static inline void condvarInit(CondVar* c)             { pthread_cond_init(c, NULL); }
+static inline Result condvarWait(CondVar* c, Mutex* m) { return pthread_cond_wait(c, m); }
+static inline Result condvarWakeAll(CondVar* c)        { return pthread_cond_broadcast(c); }
+
+static inline void* hostThreadMain(void* arg)
+{
+    Thread* t = (Thread*)arg;
+    t->entry(t->arg);
+    return NULL;
+}
+
+static inline Result threadCreate(Thread* t, ThreadFunc entry, void* arg, void* stack_mem, size_t stack_sz, int prio, int cpuid)
+{
+    (void)stack_mem; (void)stack_sz; (void)prio; (void)cpuid;
+    t->entry = entry;
+    t->arg = arg;
+    return 0;
+}
+
+static inline Result threadStart(Thread* t)       { return pthread_create(&t->handle, NULL, hostThreadMain, t); }
+static inline Result threadWaitForExit(Thread* t) { return pthread_join(t->handle, NULL); }
+static inline Result threadClose(Thread* t)       { (void)t; return 0; }
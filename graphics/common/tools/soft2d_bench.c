@@ -0,0 +1,353 @@
+/*
+ * Validates the soft2d routines against the per-pixel loops simplegfx and simplegfx_moviemaker
+ * used before (carried below as they were), and measures both:
+ * - fill and RGB888 conversion must give exactly the same framebuffer as the original loops
+ * - blending, which the samples didn't do, must be within 1 of a naive truncating loop
+ * - clipping: random rectangles, some partly or completely off the surface, are drawn with every
+ *   routine on surfaces of odd sizes with padded rows (and from images with padded rows), and
+ *   compared with a per-pixel reference. The padding of the rows must be left untouched.
+ *
+ * This is a host tool, not part of the Switch build. Build with -march=native: without SSSE3,
+ * soft2d's byte shuffles don't vectorize.
+ *   cc -O2 -march=native -Ihost -I.. soft2d_bench.c ../soft2d.c -o soft2d_bench
+ *   ./soft2d_bench
+ */
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "soft2d.h"
+
+#define FB_WIDTH  1280
+#define FB_HEIGHT 720
+#define FB_STRIDE (FB_WIDTH*sizeof(u32)) // what framebufferBegin returns for a 1280 wide RGBA8888 framebuffer
+
+#define SPRITE_SIZE 256
+
+#define FILL_FRAMES  200
+#define COPY_FRAMES  100
+#define BLEND_FRAMES 200
+
+// ----------------------------------------------------------------------------
+// The original loops
+
+// simplegfx, and simplegfx_moviemaker without DISPLAY_IMAGE
+__attribute__((noinline)) static void originalFill(u32* framebuf, u32 stride, u32 cnt)
+{
+    // Each pixel is 4-bytes due to RGBA8888.
+    for (u32 y = 0; y < FB_HEIGHT; y ++)
+    {
+        for (u32 x = 0; x < FB_WIDTH; x ++)
+        {
+            u32 pos = y * stride / sizeof(u32) + x;
+            framebuf[pos] = 0x01010101 * cnt * 4;//Set framebuf to different shades of grey.
+        }
+    }
+}
+
+// simplegfx with DISPLAY_IMAGE
+__attribute__((noinline)) static void originalImage(u32* framebuf, u32 stride, const u8* imageptr, u32 image_width, u32 image_height, u32 cnt)
+{
+    // Each pixel is 4-bytes due to RGBA8888.
+    for (u32 y = 0; y < FB_HEIGHT; y ++)
+    {
+        for (u32 x = 0; x < FB_WIDTH; x ++)
+        {
+            u32 pos = y * stride / sizeof(u32) + x;
+            if (y >= image_height || x >= image_width) continue;
+            u32 imagepos = y * image_width + x;
+            framebuf[pos] = RGBA8_MAXALPHA(imageptr[imagepos*3+0]+(cnt*4), imageptr[imagepos*3+1], imageptr[imagepos*3+2]);
+        }
+    }
+}
+
+// simplegfx_moviemaker with DISPLAY_IMAGE, which indexes the image with the framebuffer stride,
+// so it's only right when the rows aren't padded
+__attribute__((noinline)) static void originalMovieImage(u32* framebuf, u32 stride, const u8* imageptr, u32 cnt)
+{
+    // Each pixel is 4-bytes due to RGBA8888.
+    for (u32 y = 0; y < FB_HEIGHT; y ++)
+    {
+        for (u32 x = 0; x < FB_WIDTH; x ++)
+        {
+            u32 pos = y * stride / sizeof(u32) + x;
+            framebuf[pos] = RGBA8_MAXALPHA(imageptr[pos*3+0]+(cnt*4), imageptr[pos*3+1], imageptr[pos*3+2]);
+        }
+    }
+}
+
+// Naive alpha blending, truncating instead of rounding
+__attribute__((noinline)) static void naiveBlend(u32* framebuf, u32 stride, const u32* sprite, u32 width, u32 height, u32 x0, u32 y0)
+{
+    for (u32 y = 0; y < height; y ++)
+    {
+        for (u32 x = 0; x < width; x ++)
+        {
+            u32 s = sprite[y * width + x];
+            u32* d = &framebuf[(y0 + y) * stride / sizeof(u32) + x0 + x];
+            u32 a = s >> 24;
+            u32 out = 0xff000000;
+            for (u32 shift = 0; shift < 24; shift += 8)
+                out |= ((((s >> shift) & 0xff) * a + ((*d >> shift) & 0xff) * (255 - a)) / 255) << shift;
+            *d = out;
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Per-pixel references for clipping, with the same results as soft2d
+
+static u32 refBlendPixel(u32 s, u32 d)
+{
+    u32 a = s >> 24;
+    u32 out = 0xff000000;
+    for (u32 shift = 0; shift < 24; shift += 8)
+    {
+        u32 c = ((s >> shift) & 0xff) * a + ((d >> shift) & 0xff) * (255 - a);
+        out |= ((c + 127) / 255) << shift;
+    }
+    return out;
+}
+
+enum { OP_FILL, OP_COPY, OP_RGB888, OP_BLEND, NUM_OPS };
+static const char* const s_opNames[NUM_OPS] = { "fill", "copy", "rgb888", "blend" };
+
+// Draws a width x height rectangle at (x, y) pixel by pixel, skipping what's off the surface
+static void refDraw(const Soft2dSurface* surf, int op, s32 x, s32 y, s32 width, s32 height, const void* src, u32 srcStride, u32 value)
+{
+    for (s32 j = 0; j < height; j ++)
+    {
+        for (s32 i = 0; i < width; i ++)
+        {
+            if (x + i < 0 || y + j < 0 || x + i >= (s32)surf->width || y + j >= (s32)surf->height)
+                continue;
+            u32* d = soft2dRow(surf, y + j) + x + i;
+            const u8* s = (const u8*)src + j * srcStride;
+            switch (op)
+            {
+                case OP_FILL:   *d = value; break;
+                case OP_COPY:   *d = ((const u32*)s)[i]; break;
+                case OP_RGB888: *d = RGBA8_MAXALPHA(s[i*3+0] + (value & 0xff), s[i*3+1] + ((value >> 8) & 0xff), s[i*3+2] + ((value >> 16) & 0xff)); break;
+                case OP_BLEND:  *d = refBlendPixel(((const u32*)s)[i], *d); break;
+            }
+        }
+    }
+}
+
+static void draw(const Soft2dSurface* surf, int op, s32 x, s32 y, s32 width, s32 height, const void* src, u32 srcStride, u32 value)
+{
+    switch (op)
+    {
+        case OP_FILL:   soft2dFill(surf, x, y, width, height, value); break;
+        case OP_COPY:   soft2dCopy(surf, x, y, src, width, height, srcStride); break;
+        case OP_RGB888: soft2dCopyRgb888(surf, x, y, src, width, height, srcStride, value); break;
+        case OP_BLEND:  soft2dBlend(surf, x, y, src, width, height, srcStride); break;
+    }
+}
+
+// ----------------------------------------------------------------------------
+
+static u8* s_image;   // FB_WIDTH x FB_HEIGHT, RGB888
+static u32* s_sprite; // SPRITE_SIZE x SPRITE_SIZE, RGBA8888, mostly opaque or transparent
+
+static double now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e3 + ts.tv_nsec / 1e6;
+}
+
+static u32 randomPixel(void)
+{
+    return (u32)rand() ^ ((u32)rand() << 16);
+}
+
+static u32 randomSpritePixel(void)
+{
+    static const u32 alphas[4] = { 0, 255, 255, 0 };
+    u32 r = rand() % 5;
+    u32 a = r < 4 ? alphas[r] : (u32)rand() & 0xff;
+    return (randomPixel() & 0xffffff) | (a << 24);
+}
+
+static bool checkOriginals(u32* fb, u32* ref)
+{
+    Soft2dSurface surf = { fb, FB_WIDTH, FB_HEIGHT, FB_STRIDE };
+    bool fill = true, image = true, movie = true;
+    for (u32 cnt = 0; cnt <= 60; cnt += 7)
+    {
+        originalFill(ref, FB_STRIDE, cnt);
+        soft2dFill(&surf, 0, 0, FB_WIDTH, FB_HEIGHT, 0x01010101 * cnt * 4);
+        fill = fill && !memcmp(ref, fb, FB_STRIDE * FB_HEIGHT);
+
+        originalImage(ref, FB_STRIDE, s_image, FB_WIDTH, FB_HEIGHT, cnt);
+        soft2dCopyRgb888(&surf, 0, 0, s_image, FB_WIDTH, FB_HEIGHT, FB_WIDTH * 3, RGBA8(cnt*4, 0, 0, 0));
+        image = image && !memcmp(ref, fb, FB_STRIDE * FB_HEIGHT);
+
+        originalMovieImage(ref, FB_STRIDE, s_image, cnt);
+        movie = movie && !memcmp(ref, fb, FB_STRIDE * FB_HEIGHT);
+    }
+
+    // The sprite over the image
+    memcpy(ref, fb, FB_STRIDE * FB_HEIGHT);
+    naiveBlend(ref, FB_STRIDE, s_sprite, SPRITE_SIZE, SPRITE_SIZE, 100, 50);
+    soft2dBlend(&surf, 100, 50, s_sprite, SPRITE_SIZE, SPRITE_SIZE, SPRITE_SIZE * sizeof(u32));
+    int blendDiff = 0;
+    for (u32 i = 0; i < FB_WIDTH * FB_HEIGHT; i ++)
+    {
+        for (u32 shift = 0; shift < 32; shift += 8)
+        {
+            int d = abs((int)((ref[i] >> shift) & 0xff) - (int)((fb[i] >> shift) & 0xff));
+            if (d > blendDiff)
+                blendDiff = d;
+        }
+    }
+
+    printf("Against the original loops:\n");
+    printf("  %-34s %s\n", "fill (simplegfx)", fill ? "identical" : "FAILED");
+    printf("  %-34s %s\n", "rgb888 (simplegfx)", image ? "identical" : "FAILED");
+    printf("  %-34s %s\n", "rgb888 (simplegfx_moviemaker)", movie ? "identical" : "FAILED");
+    printf("  %-34s max difference %d %s\n", "blend (naive truncating loop)", blendDiff, blendDiff <= 1 ? "ok" : "FAILED");
+    return fill && image && movie && blendDiff <= 1;
+}
+
+static bool checkClipping(void)
+{
+    // Odd sizes, with padded rows (and a row past the end) that must be left untouched
+    static const u32 sizes[][3] = { { 101, 37, 128 }, { 3, 5, 7 }, { 64, 64, 64 }, { 257, 19, 300 } };
+    // Sources are 300x300 at most, with padded rows too
+    enum { SRC_SIZE = 300, SRC_STRIDE = SRC_SIZE * 4 + 20 };
+    // Blended images have any alpha, other images and colors are opaque to keep the surface opaque
+    u8* src = malloc(SRC_STRIDE * SRC_SIZE);
+    u8* opaqueSrc = malloc(SRC_STRIDE * SRC_SIZE);
+    for (u32 i = 0; i < SRC_STRIDE * SRC_SIZE / 4; i ++)
+    {
+        ((u32*)src)[i] = randomSpritePixel();
+        ((u32*)opaqueSrc)[i] = ((u32*)src)[i] | 0xff000000;
+    }
+
+    u32 failures[NUM_OPS] = { 0 }, cases = 0;
+    for (u32 s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s ++)
+    {
+        u32 width = sizes[s][0], height = sizes[s][1], stride = sizes[s][2] * sizeof(u32);
+        u32 size = stride * (height + 1);
+        u32* pixels = malloc(size);
+        u32* expected = malloc(size);
+        Soft2dSurface surf = { pixels, width, height, stride };
+        Soft2dSurface refSurf = { expected, width, height, stride };
+
+        // The surface is opaque like a framebuffer, the padding is anything
+        for (u32 i = 0; i < size / 4; i ++)
+            pixels[i] = randomPixel();
+        for (u32 y = 0; y < height; y ++)
+            for (u32 x = 0; x < width; x ++)
+                soft2dRow(&surf, y)[x] |= 0xff000000;
+        memcpy(expected, pixels, size);
+
+        for (u32 n = 0; n < 2000; n ++)
+        {
+            int op = rand() % NUM_OPS;
+            s32 w = rand() % (width + 20), h = rand() % (height + 20);
+            s32 x = rand() % (width + 40) - 20 - w / 2, y = rand() % (height + 40) - 20 - h / 2;
+            const u8* opSrc = op == OP_BLEND ? src : opaqueSrc;
+            u32 value = op == OP_FILL ? randomPixel() | 0xff000000 : randomPixel();
+
+            // Keep to the source, with the pixel size of the operation
+            s32 maxW = op == OP_RGB888 ? SRC_STRIDE / 3 : SRC_SIZE;
+            if (w > maxW)
+                w = maxW;
+            if (h > SRC_SIZE)
+                h = SRC_SIZE;
+
+            draw(&surf, op, x, y, w, h, opSrc, SRC_STRIDE, value);
+            refDraw(&refSurf, op, x, y, w, h, opSrc, SRC_STRIDE, value);
+            if (memcmp(pixels, expected, size))
+            {
+                failures[op] ++;
+                memcpy(pixels, expected, size);
+            }
+            cases ++;
+        }
+        free(expected);
+        free(pixels);
+    }
+    free(opaqueSrc);
+    free(src);
+
+    printf("Clipping, %u random rectangles on 4 padded surfaces:\n", cases);
+    bool ok = true;
+    for (int op = 0; op < NUM_OPS; op ++)
+    {
+        printf("  %-34s %s\n", s_opNames[op], failures[op] ? "FAILED" : "ok");
+        ok = ok && !failures[op];
+    }
+    return ok;
+}
+
+static void benchmark(u32* fb)
+{
+    Soft2dSurface surf = { fb, FB_WIDTH, FB_HEIGHT, FB_STRIDE };
+    double start, original, vectorized;
+
+    printf("Timings (per frame):\n");
+
+    start = now();
+    for (u32 k = 0; k < FILL_FRAMES; k ++)
+        originalFill(fb, FB_STRIDE, k);
+    original = (now() - start) / FILL_FRAMES;
+    start = now();
+    for (u32 k = 0; k < FILL_FRAMES; k ++)
+        soft2dFill(&surf, 0, 0, FB_WIDTH, FB_HEIGHT, 0x01010101 * k * 4);
+    vectorized = (now() - start) / FILL_FRAMES;
+    printf("  %-34s %6.3f ms -> %6.3f ms (x%.2f)\n", "fill 1280x720", original, vectorized, original / vectorized);
+
+    start = now();
+    for (u32 k = 0; k < COPY_FRAMES; k ++)
+        originalImage(fb, FB_STRIDE, s_image, FB_WIDTH, FB_HEIGHT, k);
+    original = (now() - start) / COPY_FRAMES;
+    start = now();
+    for (u32 k = 0; k < COPY_FRAMES; k ++)
+        soft2dCopyRgb888(&surf, 0, 0, s_image, FB_WIDTH, FB_HEIGHT, FB_WIDTH * 3, RGBA8(k*4, 0, 0, 0));
+    vectorized = (now() - start) / COPY_FRAMES;
+    printf("  %-34s %6.3f ms -> %6.3f ms (x%.2f)\n", "rgb888 1280x720", original, vectorized, original / vectorized);
+
+    start = now();
+    for (u32 k = 0; k < BLEND_FRAMES; k ++)
+        naiveBlend(fb, FB_STRIDE, s_sprite, SPRITE_SIZE, SPRITE_SIZE, 100 + k % 50, 50);
+    original = (now() - start) / BLEND_FRAMES;
+    start = now();
+    for (u32 k = 0; k < BLEND_FRAMES; k ++)
+        soft2dBlend(&surf, 100 + k % 50, 50, s_sprite, SPRITE_SIZE, SPRITE_SIZE, SPRITE_SIZE * sizeof(u32));
+    vectorized = (now() - start) / BLEND_FRAMES;
+    printf("  %-34s %6.3f ms -> %6.3f ms (x%.2f)\n", "blend 256x256", original, vectorized, original / vectorized);
+}
+
+int main(void)
+{
+    u32* fb = aligned_alloc(64, FB_STRIDE * FB_HEIGHT);
+    u32* ref = aligned_alloc(64, FB_STRIDE * FB_HEIGHT);
+    s_image = malloc(FB_WIDTH * FB_HEIGHT * 3);
+    s_sprite = malloc(SPRITE_SIZE * SPRITE_SIZE * sizeof(u32));
+    if (!fb || !ref || !s_image || !s_sprite)
+        return 1;
+
+    srand(1);
+    for (u32 i = 0; i < FB_WIDTH * FB_HEIGHT * 3; i ++)
+        s_image[i] = rand();
+    for (u32 i = 0; i < SPRITE_SIZE * SPRITE_SIZE; i ++)
+        s_sprite[i] = randomSpritePixel();
+
+    bool ok = checkOriginals(fb, ref);
+    ok = checkClipping() && ok;
+    benchmark(fb);
+    printf("Validation: %s\n", ok ? "ok" : "FAILED");
+
+    free(s_sprite);
+    free(s_image);
+    free(ref);
+    free(fb);
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,144 @@
+/*
+ * Checks that tile_pool renders every pixel of a surface exactly once, and measures how rendering
+ * scales with the number of threads, on two workloads:
+ * - rgb888 copy: soft2dCopyRgb888 of a full frame (memory bound, like irsensor and the moviemaker)
+ * - plasma: three sinf per pixel (compute bound)
+ *
+ * This is a host tool, not part of the Switch build. libnx threads are emulated with pthreads
+ * (see host/switch.h), so the cores are chosen with taskset (here, three cores like the Switch
+ * gives applications). Build with -march=native: without SSSE3, soft2d's byte shuffles don't vectorize.
+ *   cc -O2 -march=native -pthread -Ihost -I.. tile_pool_bench.c ../tile_pool.c ../soft2d.c -o tile_pool_bench -lm
+ *   taskset -c 0-2 ./tile_pool_bench
+ */
+
+#define _GNU_SOURCE
+#include <math.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "tile_pool.h"
+
+#define WIDTH  1280
+#define HEIGHT 720
+#define STRIDE (1344*sizeof(u32)) // padded rows, like framebufferBegin may return
+
+#define COPY_FRAMES   200
+#define PLASMA_FRAMES 20
+
+static u8* s_image;
+static u32 s_frame;
+
+static double now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e3 + ts.tv_nsec / 1e6;
+}
+
+static void copyTile(void* user, const Soft2dSurface* tile, u32 x, u32 y)
+{
+    soft2dCopyRgb888(tile, -(s32)x, -(s32)y, s_image, WIDTH, HEIGHT, WIDTH*3, RGBA8(s_frame*4, 0, 0, 0));
+}
+
+static void plasmaTile(void* user, const Soft2dSurface* tile, u32 x0, u32 y0)
+{
+    for (u32 y = 0; y < tile->height; y ++)
+    {
+        u32* row = soft2dRow(tile, y);
+        for (u32 x = 0; x < tile->width; x ++)
+        {
+            float fx = (x0 + x) * 0.02f, fy = (y0 + y) * 0.02f;
+            float v = sinf(fx + s_frame * 0.1f) + sinf(fy * 1.3f) + sinf((fx + fy) * 0.7f);
+            u8 c = (u8)(v * 40 + 128);
+            row[x] = RGBA8_MAXALPHA(c, 255 - c, c / 2);
+        }
+    }
+}
+
+// Adds the pixel number + 1 to each pixel, so that pixels rendered twice (or never) show up
+static void countTile(void* user, const Soft2dSurface* tile, u32 x, u32 y)
+{
+    for (u32 j = 0; j < tile->height; j ++)
+        for (u32 i = 0; i < tile->width; i ++)
+            soft2dRow(tile, j)[i] += (y + j) * WIDTH + x + i + 1;
+}
+
+static bool checkCoverage(TilePool* pool, u32* pixels)
+{
+    // Odd sizes too, so that the tiles on the right and bottom edges are partial
+    for (u32 rep = 0; rep < 50; rep ++)
+    {
+        Soft2dSurface surf = { pixels, WIDTH - rep, HEIGHT - rep*3, STRIDE };
+        memset(pixels, 0, STRIDE * HEIGHT);
+        tilePoolRun(pool, &surf, TILEPOOL_TILE_WIDTH, TILEPOOL_TILE_HEIGHT, countTile, NULL);
+
+        for (u32 y = 0; y < HEIGHT; y ++)
+        {
+            const u32* row = (const u32*)((const u8*)pixels + y * STRIDE);
+            for (u32 x = 0; x < STRIDE / sizeof(u32); x ++)
+            {
+                u32 expected = x < surf.width && y < surf.height ? y * WIDTH + x + 1 : 0;
+                if (row[x] != expected)
+                    return false;
+            }
+        }
+    }
+    return true;
+}
+
+int main(void)
+{
+    u32* pixels = aligned_alloc(64, STRIDE * HEIGHT);
+    s_image = malloc(WIDTH * HEIGHT * 3);
+    if (!pixels || !s_image)
+        return 1;
+    for (u32 i = 0; i < WIDTH * HEIGHT * 3; i ++)
+        s_image[i] = rand();
+
+    cpu_set_t cpus;
+    sched_getaffinity(0, sizeof(cpus), &cpus);
+    printf("%ux%u, %ux%u tiles, %d CPU(s) available\n", WIDTH, HEIGHT, TILEPOOL_TILE_WIDTH, TILEPOOL_TILE_HEIGHT, CPU_COUNT(&cpus));
+    printf("  threads  rgb888 copy         plasma\n");
+
+    Soft2dSurface surf = { pixels, WIDTH, HEIGHT, STRIDE };
+    double copyBase = 0, plasmaBase = 0;
+    bool ok = true;
+    for (u32 threads = 1; threads <= TILEPOOL_MAX_THREADS; threads ++)
+    {
+        TilePool pool;
+        tilePoolCreate(&pool, threads);
+        ok = checkCoverage(&pool, pixels) && ok;
+
+        double start = now();
+        for (s_frame = 0; s_frame < COPY_FRAMES; s_frame ++)
+            tilePoolRun(&pool, &surf, TILEPOOL_TILE_WIDTH, TILEPOOL_TILE_HEIGHT, copyTile, NULL);
+        double copy = (now() - start) / COPY_FRAMES;
+
+        start = now();
+        for (s_frame = 0; s_frame < PLASMA_FRAMES; s_frame ++)
+            tilePoolRun(&pool, &surf, TILEPOOL_TILE_WIDTH, TILEPOOL_TILE_HEIGHT, plasmaTile, NULL);
+        double plasma = (now() - start) / PLASMA_FRAMES;
+
+        if (threads == 1)
+        {
+            copyBase = copy;
+            plasmaBase = plasma;
+        }
+        printf("  %-7u  %6.3f ms (x%.2f)  %6.2f ms (x%.2f)\n", threads, copy, copyBase / copy, plasma, plasmaBase / plasma);
+        tilePoolClose(&pool);
+    }
+
+    // The same copy without the pool, for the cost of splitting the frame into tiles
+    double start = now();
+    for (s_frame = 0; s_frame < COPY_FRAMES; s_frame ++)
+        soft2dCopyRgb888(&surf, 0, 0, s_image, WIDTH, HEIGHT, WIDTH*3, RGBA8(s_frame*4, 0, 0, 0));
+    printf("  no pool  %6.3f ms\n", (now() - start) / COPY_FRAMES);
+    printf("Coverage: %s\n", ok ? "ok" : "FAILED");
+
+    free(s_image);
+    free(pixels);
+    return ok ? 0 : 1;
+}
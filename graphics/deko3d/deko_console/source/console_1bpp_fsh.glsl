@@ -0,0 +1,19 @@
+#version 460
+
+layout (location = 0) noperspective in vec3 inTexCoord;
+layout (location = 1) flat in vec4 inFrontPal;
+layout (location = 2) flat in vec4 inBackPal;
+
+layout (location = 0) out vec4 outColor;
+
+layout (binding = 0) uniform usampler2DArray tileset;
+
+void main()
+{
+    // Each texel packs 8 pixels of a row of the tile, with the leftmost one in the top bit
+    ivec3 size = textureSize(tileset, 0);
+    ivec2 pixel = min(ivec2(inTexCoord.xy * vec2(size.x * 8, size.y)), ivec2(size.x * 8 - 1, size.y - 1));
+    uint bits = texelFetch(tileset, ivec3(pixel.x >> 3, pixel.y, int(inTexCoord.z)), 0).r;
+    float value = float((bits >> (7 - (pixel.x & 7))) & 1u);
+    outColor = mix(inBackPal, inFrontPal, value);
+}
@@ -12,13 +12,22 @@ layout (std140, binding = 0) uniform Config
     vec4 dimensions;
     vec4 vertices[3];
     vec4 palettes[24];
+    vec4 tileset;
 } u;
 
+layout (std140, binding = 1) uniform Scroll
+{
+    uint rowOffset;
+} s;
+
 void main()
 {
     float id = float(gl_InstanceID);
-    float tileRow = floor(id / u.dimensions.z);
-    float tileCol = id - tileRow * u.dimensions.z;
+    float physRow = floor(id / u.dimensions.z);
+    float tileCol = id - physRow * u.dimensions.z;
+
+    // The rows of the character buffer form a ring, which starts at rowOffset
+    float tileRow = mod(physRow - float(s.rowOffset), u.dimensions.w);
 
     vec2 basePos;
     basePos.x = 2.0 * (tileCol + 0.5) / u.dimensions.z - 1.0;
@@ -29,7 +38,10 @@ void main()
     gl_Position.xy = vtxData * scale + basePos;
     gl_Position.zw = vec2(0.5, 1.0);
 
-    outTexCoord = vec3(u.vertices[gl_VertexID].zw, inTileId);
+    // Tiles are laid out side by side within the layers of the tileset
+    float layer = floor(inTileId / u.tileset.x);
+    float tileX = inTileId - layer * u.tileset.x;
+    outTexCoord = vec3((tileX + u.vertices[gl_VertexID].z) / u.tileset.x, u.vertices[gl_VertexID].w, layer);
     outFrontPal = u.palettes[inColorId.x];
     outBackPal  = u.palettes[inColorId.y];
 }
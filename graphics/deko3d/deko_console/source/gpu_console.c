@@ -6,15 +6,31 @@
 #include <switch.h>
 #include <deko3d.h>
 
+#include "glyph_cache.h"
+#include "gpu_console.h"
+#include "scrollback.h"
+#include "shared_font.h"
+
 // Define the desired number of framebuffers
 #define FB_NUM 2
 
+// Define the number of copies of the character buffer the GPU reads from (one per frame in flight)
+#define CHARBUF_NUM FB_NUM
+
 // Define the size of the memory block that will hold code
 #define CODEMEMSIZE (64*1024)
 
 // Define the size of the memory block that will hold command lists
 #define CMDMEMSIZE (64*1024)
 
+// Define the size of the memory used to record glyph uploads
+#define GLYPHCMDMEMSIZE (64*1024)
+
+// Define the number of bits per texel of the tileset: either 8 (coverage, sampled as is), or 1 (rows of
+// 8 pixels packed into each byte, expanded by the fragment shader). The latter takes an eighth of the
+// memory, but requires the tile width to be a multiple of 8 and drops the antialiasing of cached glyphs.
+#define TILESET_BPP 8
+
 #define NUM_IMAGE_SLOTS   1
 #define NUM_SAMPLER_SLOTS 1
 
@@ -34,8 +50,14 @@ typedef struct {
     float dimensions[4];
     VertexDef vertices[3];
     PaletteColor palettes[24];
+    float tileset[4];
 } ConsoleConfig;
 
+typedef struct {
+    uint32_t rowOffset;
+    uint32_t padding[3];
+} ConsoleScroll;
+
 static const VertexDef g_vertexData[3] = {
     { {  0.0f, +1.0f }, { 0.5f, 0.0f, } },
     { { -1.0f, -1.0f }, { 0.0f, 1.0f, } },
@@ -77,6 +99,9 @@ typedef struct {
     uint8_t backPal;
 } ConsoleChar;
 
+// Rows of the scrollback history are decoded straight into the character buffer
+_Static_assert(sizeof(ConsoleChar) == sizeof(ScrollbackCell), "ConsoleChar must match ScrollbackCell");
+
 static const DkVtxAttribState g_attribState[] = {
     { .bufferId=0, .isFixed=0, .offset=offsetof(ConsoleChar,tileId),   .size=DkVtxAttribSize_1x16, .type=DkVtxAttribType_Uscaled, .isBgra=0 },
     { .bufferId=0, .isFixed=0, .offset=offsetof(ConsoleChar,frontPal), .size=DkVtxAttribSize_2x8,  .type=DkVtxAttribType_Uint,    .isBgra=0 },
@@ -101,7 +126,41 @@ struct GpuRenderer {
     DkSwapchain swapchain;
     DkImage framebuffers[FB_NUM];
     DkImage tileset;
-    ConsoleChar* charBuf;
+    unsigned numTiles;
+    bool packedTileset;
+    unsigned tilesetWidth;  // width of a tile in the tileset, in texels
+    unsigned tilesPerLayer; // tiles are laid out side by side within each layer of the tileset
+    unsigned numLayers;
+
+    // Characters outside of the built-in font are rasterized on demand into the tiles following it.
+    // Newly rasterized glyphs are written into a copy of the tileset kept in the staging memory,
+    // and the layers they belong to are then copied into the tileset.
+    GlyphCache glyphs;
+    Utf8Decoder utf8;
+    DkMemBlock stagingMemBlock;
+    uint8_t* tilesetMirror;
+    bool* dirtyLayers;
+    DkCmdBuf glyphCmdbuf;
+    DkFence glyphFence;
+
+    // The CPU only ever writes to the shadow buffer, which lives in regular (cached) memory.
+    // Once per frame, its contents are published to the next GPU visible copy of the buffer.
+    // The rows of the buffer form a ring starting at rowOffset, so that scrolling doesn't move any data.
+    ConsoleChar* shadowBuf;
+    ConsoleChar* charBuf[CHARBUF_NUM];
+    ConsoleScroll* scrollBuf[CHARBUF_NUM];
+    uint32_t* rowGen;
+    uint32_t shadowGen;
+    uint32_t charBufGen[CHARBUF_NUM];
+    unsigned curCharBuf;
+    unsigned rowOffset;
+
+    // Lines that scrolled off the screen. When viewOffset is non-zero, the screen shows the history
+    // scrolled back by that many lines; charBufView keeps track of what each copy of the buffer shows.
+    Scrollback history;
+    uint32_t viewOffset;
+    uint32_t charBufView[CHARBUF_NUM];
+    ScrollbackCell* historyRow;
 
     uint32_t codeMemOffset;
     DkShader vertexShader;
@@ -109,9 +168,9 @@ struct GpuRenderer {
 
     DkCmdBuf cmdbuf;
     DkCmdList cmdsBindFramebuffer[FB_NUM];
-    DkCmdList cmdsRender;
+    DkCmdList cmdsRender[CHARBUF_NUM];
 
-    DkFence lastRenderFence;
+    DkFence renderFences[CHARBUF_NUM];
 };
 
 static struct GpuRenderer* GpuRenderer(PrintConsole* con)
@@ -119,19 +178,54 @@ static struct GpuRenderer* GpuRenderer(PrintConsole* con)
     return (struct GpuRenderer*)con->renderer;
 }
 
+// Pins the glyph cache tiles that may be on the screen: those of the shadow buffer, and those of every
+// copy of the character buffer (a copy keeps being drawn until something new is published to it)
+static void GpuRenderer_collectPins(void* user, GlyphCache* gc)
+{
+    PrintConsole* con = (PrintConsole*)user;
+    struct GpuRenderer* r = GpuRenderer(con);
+    unsigned totalConSize = con->consoleWidth * con->consoleHeight;
+
+    for (unsigned i = 0; i < totalConSize; i ++)
+        glyphCachePin(gc, r->shadowBuf[i].tileId);
+    for (unsigned buf = 0; buf < CHARBUF_NUM; buf ++)
+        for (unsigned i = 0; i < totalConSize; i ++)
+            glyphCachePin(gc, r->charBuf[buf][i].tileId);
+}
+
+// Destroys whatever was created so far, so that it can also undo a partial initialization
 static void GpuRenderer_destroy(struct GpuRenderer* r)
 {
     // Make sure the queue is idle before destroying anything
-    dkQueueWaitIdle(r->queue);
+    if (r->queue)
+        dkQueueWaitIdle(r->queue);
 
     // Destroy all the resources we've created
-    dkQueueDestroy(r->queue);
-    dkCmdBufDestroy(r->cmdbuf);
-    dkSwapchainDestroy(r->swapchain);
-    dkMemBlockDestroy(r->dataMemBlock);
-    dkMemBlockDestroy(r->codeMemBlock);
-    dkMemBlockDestroy(r->imageMemBlock);
-    dkDeviceDestroy(r->device);
+    if (r->queue)
+        dkQueueDestroy(r->queue);
+    if (r->cmdbuf)
+        dkCmdBufDestroy(r->cmdbuf);
+    if (r->glyphCmdbuf)
+        dkCmdBufDestroy(r->glyphCmdbuf);
+    if (r->swapchain)
+        dkSwapchainDestroy(r->swapchain);
+    if (r->stagingMemBlock)
+        dkMemBlockDestroy(r->stagingMemBlock);
+    if (r->dataMemBlock)
+        dkMemBlockDestroy(r->dataMemBlock);
+    if (r->codeMemBlock)
+        dkMemBlockDestroy(r->codeMemBlock);
+    if (r->imageMemBlock)
+        dkMemBlockDestroy(r->imageMemBlock);
+    if (r->device)
+        dkDeviceDestroy(r->device);
+    glyphCacheExit(&r->glyphs);
+    sharedFontExit();
+    scrollbackExit(&r->history);
+    free(r->historyRow);
+    free(r->dirtyLayers);
+    free(r->rowGen);
+    free(r->shadowBuf);
 
     // Clear out all state
     memset(&r->initialized, 0, sizeof(*r) - offsetof(struct GpuRenderer, initialized));
@@ -162,6 +256,14 @@ static void GpuRenderer_loadShader(struct GpuRenderer* r, DkShader* pShader, con
     dkShaderInitialize(pShader, &shaderMaker);
 }
 
+// Returns the location of a tile within the copy of the tileset
+static uint8_t* GpuRenderer_getTileMirror(struct GpuRenderer* r, PrintConsole* con, unsigned tile)
+{
+    unsigned layer = tile / r->tilesPerLayer;
+    unsigned layerWidth = r->tilesPerLayer * r->tilesetWidth;
+    return r->tilesetMirror + layer*layerWidth*con->font.tileHeight + (tile - layer*r->tilesPerLayer)*r->tilesetWidth;
+}
+
 static bool GpuRenderer_init(PrintConsole* con)
 {
     struct GpuRenderer* r = GpuRenderer(con);
@@ -187,6 +289,25 @@ static bool GpuRenderer_init(PrintConsole* con)
     u32 height = con->font.tileHeight * con->consoleHeight;
     u32 totalConSize = con->consoleWidth * con->consoleHeight;
 
+    // Set up the glyph cache if the shared font is available. The tileset then holds the built-in
+    // font followed by the cache slots; tile IDs stay within 16 bits as long as the total does.
+    unsigned numGlyphSlots = 0;
+    if (sharedFontInit(con->font.tileWidth, con->font.tileHeight) &&
+        glyphCacheInit(&r->glyphs, con->font.tileWidth, con->font.tileHeight, con->font.numChars, GLYPH_CACHE_DEFAULT_SLOTS, sharedFontRasterize, NULL))
+        numGlyphSlots = r->glyphs.numSlots;
+    r->numTiles = con->font.numChars + numGlyphSlots;
+    memset(&r->utf8, 0, sizeof(r->utf8));
+
+    // Choose the tileset format. Images are stored in blocks that are 64 bytes wide, so rather than
+    // padding each tile to that width, tiles are laid out side by side within each layer.
+    unsigned packedTileWidth = (con->font.tileWidth+7)/8;
+    r->packedTileset = TILESET_BPP == 1 && (con->font.tileWidth & 7) == 0;
+    r->tilesetWidth = r->packedTileset ? packedTileWidth : con->font.tileWidth;
+    r->tilesPerLayer = r->tilesetWidth < 64 && 64 % r->tilesetWidth == 0 ? 64 / r->tilesetWidth : 1;
+    r->numLayers = (r->numTiles + r->tilesPerLayer - 1) / r->tilesPerLayer;
+    uint32_t layerWidth = r->tilesPerLayer * r->tilesetWidth;
+    uint32_t mirrorSize = layerWidth * con->font.tileHeight * r->numLayers;
+
     // Calculate layout for the framebuffers
     DkImageLayoutMaker imageLayoutMaker;
     dkImageLayoutMakerDefaults(&imageLayoutMaker, r->device);
@@ -202,10 +323,10 @@ static bool GpuRenderer_init(PrintConsole* con)
     // Calculate layout for the tileset
     dkImageLayoutMakerDefaults(&imageLayoutMaker, r->device);
     imageLayoutMaker.type = DkImageType_2DArray;
-    imageLayoutMaker.format = DkImageFormat_R32_Float;
-    imageLayoutMaker.dimensions[0] = con->font.tileWidth;
+    imageLayoutMaker.format = r->packedTileset ? DkImageFormat_R8_Uint : DkImageFormat_R8_Unorm;
+    imageLayoutMaker.dimensions[0] = layerWidth;
     imageLayoutMaker.dimensions[1] = con->font.tileHeight;
-    imageLayoutMaker.dimensions[2] = con->font.numChars;
+    imageLayoutMaker.dimensions[2] = r->numLayers;
 
     // Calculate layout for the tileset
     DkImageLayout tilesetLayout;
@@ -226,6 +347,8 @@ static bool GpuRenderer_init(PrintConsole* con)
     dkMemBlockMakerDefaults(&memBlockMaker, r->device, FB_NUM*framebufferSize + tilesetSize);
     memBlockMaker.flags = DkMemBlockFlags_GpuCached | DkMemBlockFlags_Image;
     r->imageMemBlock = dkMemBlockCreate(&memBlockMaker);
+    if (!r->imageMemBlock)
+        goto _fail;
 
     // Initialize the framebuffers with the layout and backing memory we've just created
     DkImage const* swapchainImages[FB_NUM];
@@ -246,11 +369,13 @@ static bool GpuRenderer_init(PrintConsole* con)
     dkMemBlockMakerDefaults(&memBlockMaker, r->device, CODEMEMSIZE);
     memBlockMaker.flags = DkMemBlockFlags_CpuUncached | DkMemBlockFlags_GpuCached | DkMemBlockFlags_Code;
     r->codeMemBlock = dkMemBlockCreate(&memBlockMaker);
+    if (!r->codeMemBlock)
+        goto _fail;
     r->codeMemOffset = 0;
 
     // Load our shaders (both vertex and fragment)
     GpuRenderer_loadShader(r, &r->vertexShader, "romfs:/shaders/console_vsh.dksh");
-    GpuRenderer_loadShader(r, &r->fragmentShader, "romfs:/shaders/console_fsh.dksh");
+    GpuRenderer_loadShader(r, &r->fragmentShader, r->packedTileset ? "romfs:/shaders/console_1bpp_fsh.dksh" : "romfs:/shaders/console_fsh.dksh");
 
     // Generate the descriptors
     struct {
@@ -276,15 +401,20 @@ static bool GpuRenderer_init(PrintConsole* con)
     uint32_t configOffset = (descriptorsOffset + sizeof(descriptors) + DK_UNIFORM_BUF_ALIGNMENT - 1) &~ (DK_UNIFORM_BUF_ALIGNMENT - 1);
     uint32_t configSize = (sizeof(ConsoleConfig) + DK_UNIFORM_BUF_ALIGNMENT - 1) &~ (DK_UNIFORM_BUF_ALIGNMENT - 1);
 
+    // Each copy of the character buffer is preceded by its scroll state
+    uint32_t scrollSize    = (sizeof(ConsoleScroll) + DK_UNIFORM_BUF_ALIGNMENT - 1) &~ (DK_UNIFORM_BUF_ALIGNMENT - 1);
     uint32_t charBufOffset = configOffset + configSize;
     uint32_t charBufSize   = totalConSize * sizeof(ConsoleChar);
+    uint32_t charBufStride = scrollSize + ((charBufSize + DK_UNIFORM_BUF_ALIGNMENT - 1) &~ (DK_UNIFORM_BUF_ALIGNMENT - 1));
 
     // Create a memory block which will be used for recording command lists using a command buffer
     dkMemBlockMakerDefaults(&memBlockMaker, r->device,
-        (charBufOffset + charBufSize + DK_MEMBLOCK_ALIGNMENT - 1) &~ (DK_MEMBLOCK_ALIGNMENT - 1)
+        (charBufOffset + CHARBUF_NUM*charBufStride + DK_MEMBLOCK_ALIGNMENT - 1) &~ (DK_MEMBLOCK_ALIGNMENT - 1)
     );
     memBlockMaker.flags = DkMemBlockFlags_CpuUncached | DkMemBlockFlags_GpuCached;
     r->dataMemBlock = dkMemBlockCreate(&memBlockMaker);
+    if (!r->dataMemBlock)
+        goto _fail;
 
     // Create a command buffer object
     DkCmdBufMaker cmdbufMaker;
@@ -294,25 +424,35 @@ static bool GpuRenderer_init(PrintConsole* con)
     // Feed our memory to the command buffer so that we can start recording commands
     dkCmdBufAddMemory(r->cmdbuf, r->dataMemBlock, 0, CMDMEMSIZE);
 
-    // Create a temporary buffer that will hold the tileset
+    // Create the staging memory, which holds a copy of the tileset (followed by the memory used to record glyph uploads)
+    uint32_t stagingSize = (mirrorSize + DK_CMDMEM_ALIGNMENT - 1) &~ (DK_CMDMEM_ALIGNMENT - 1);
     dkMemBlockMakerDefaults(&memBlockMaker, r->device,
-        (sizeof(float)*con->font.tileWidth*con->font.tileHeight*con->font.numChars + DK_MEMBLOCK_ALIGNMENT - 1) &~ (DK_MEMBLOCK_ALIGNMENT - 1)
+        (stagingSize + (numGlyphSlots ? GLYPHCMDMEMSIZE : 0) + DK_MEMBLOCK_ALIGNMENT - 1) &~ (DK_MEMBLOCK_ALIGNMENT - 1)
     );
     memBlockMaker.flags = DkMemBlockFlags_CpuUncached | DkMemBlockFlags_GpuCached;
-    DkMemBlock scratchMemBlock = dkMemBlockCreate(&memBlockMaker);
-    float* scratchMem = (float*)dkMemBlockGetCpuAddr(scratchMemBlock);
-
-    // Unpack 1bpp tileset into a texture image the GPU can read
-    unsigned packedTileWidth = (con->font.tileWidth+7)/8;
+    r->stagingMemBlock = dkMemBlockCreate(&memBlockMaker);
+    if (!r->stagingMemBlock)
+        goto _fail;
+    r->tilesetMirror = (uint8_t*)dkMemBlockGetCpuAddr(r->stagingMemBlock);
+    memset(r->tilesetMirror, 0, mirrorSize);
+
+    // Convert the 1bpp tileset into a texture image the GPU can read. The bytes of each row of the
+    // font are stored right to left: keep them packed (in left to right order), or unpack them.
     for (unsigned tile = 0; tile < con->font.numChars; tile ++) {
         const uint8_t* data = (const uint8_t*)con->font.gfx + con->font.tileHeight*packedTileWidth*tile;
-        for (unsigned y = 0; y < con->font.tileHeight; y ++) {
+        uint8_t* dst = GpuRenderer_getTileMirror(r, con, tile);
+        for (unsigned y = 0; y < con->font.tileHeight; y ++, dst += layerWidth) {
             const uint8_t* row = &data[packedTileWidth*(y+1)];
+            if (r->packedTileset) {
+                for (unsigned x = 0; x < packedTileWidth; x ++)
+                    dst[x] = *--row;
+                continue;
+            }
             uint8_t c = 0;
             for (unsigned x = 0; x < con->font.tileWidth; x ++) {
                 if (!(x & 7))
                     c = *--row;
-                *scratchMem++ = (c & 0x80) ? 1.0f : 0.0f;
+                dst[x] = (c & 0x80) ? 0xFF : 0x00;
                 c <<= 1;
             }
         }
@@ -327,11 +467,12 @@ static bool GpuRenderer_init(PrintConsole* con)
     consoleConfig.dimensions[3] = con->consoleHeight;
     memcpy(consoleConfig.vertices, g_vertexData, sizeof(g_vertexData));
     memcpy(consoleConfig.palettes, g_paletteData, sizeof(g_paletteData));
+    consoleConfig.tileset[0] = r->tilesPerLayer;
 
     // Generate a temporary command list for uploading stuff and run it
     DkGpuAddr descriptorSet = dkMemBlockGetGpuAddr(r->dataMemBlock) + descriptorsOffset;
-    DkCopyBuf copySrc = { dkMemBlockGetGpuAddr(scratchMemBlock), 0, 0 };
-    DkImageRect copyDst = { 0, 0, 0, con->font.tileWidth, con->font.tileHeight, con->font.numChars };
+    DkCopyBuf copySrc = { dkMemBlockGetGpuAddr(r->stagingMemBlock), 0, 0 };
+    DkImageRect copyDst = { 0, 0, 0, layerWidth, con->font.tileHeight, r->numLayers };
     dkCmdBufPushData(r->cmdbuf, descriptorSet, &descriptors, sizeof(descriptors));
     dkCmdBufPushConstants(r->cmdbuf, configAddr, configSize, 0, sizeof(consoleConfig), &consoleConfig);
     dkCmdBufBindImageDescriptorSet(r->cmdbuf, descriptorSet, NUM_IMAGE_SLOTS);
@@ -342,13 +483,53 @@ static bool GpuRenderer_init(PrintConsole* con)
     dkQueueWaitIdle(r->queue);
     dkCmdBufClear(r->cmdbuf);
 
-    // Destroy the scratch memory block since we don't need it anymore
-    dkMemBlockDestroy(scratchMemBlock);
+    if (numGlyphSlots) {
+        // Keep the staging memory around for the glyph cache, and create a command buffer used to upload glyphs
+        r->dirtyLayers = (bool*)calloc(r->numLayers, sizeof(bool));
+        if (!r->dirtyLayers)
+            goto _fail;
+        r->glyphCmdbuf = dkCmdBufCreate(&cmdbufMaker);
+        dkCmdBufAddMemory(r->glyphCmdbuf, r->stagingMemBlock, stagingSize, GLYPHCMDMEMSIZE);
+    } else {
+        // Destroy the staging memory block since we don't need it anymore
+        dkMemBlockDestroy(r->stagingMemBlock);
+        r->stagingMemBlock = NULL;
+        r->tilesetMirror = NULL;
+    }
+
+    // Retrieve the addresses of the copies of the character buffer (and their scroll state), and clear them
+    DkGpuAddr scrollAddr[CHARBUF_NUM];
+    DkGpuAddr charBufAddr[CHARBUF_NUM];
+    for (unsigned i = 0; i < CHARBUF_NUM; i ++) {
+        uint32_t offset = charBufOffset + i*charBufStride;
+        scrollAddr[i] = dkMemBlockGetGpuAddr(r->dataMemBlock) + offset;
+        charBufAddr[i] = scrollAddr[i] + scrollSize;
+        r->scrollBuf[i] = (ConsoleScroll*)((uint8_t*)dkMemBlockGetCpuAddr(r->dataMemBlock) + offset);
+        r->charBuf[i] = (ConsoleChar*)((uint8_t*)r->scrollBuf[i] + scrollSize);
+        memset(r->scrollBuf[i], 0, charBufStride);
+        r->charBufGen[i] = 0;
+    }
 
-    // Retrieve the address of the character buffer
-    DkGpuAddr charBufAddr = dkMemBlockGetGpuAddr(r->dataMemBlock) + charBufOffset;
-    r->charBuf = (ConsoleChar*)((uint8_t*)dkMemBlockGetCpuAddr(r->dataMemBlock) + charBufOffset);
-    memset(r->charBuf, 0, charBufSize);
+    // Allocate the shadow character buffer along with the per-row modification counters, and clear them
+    r->shadowBuf = (ConsoleChar*)calloc(totalConSize, sizeof(ConsoleChar));
+    r->rowGen = (uint32_t*)calloc(con->consoleHeight, sizeof(uint32_t));
+    if (!r->shadowBuf || !r->rowGen)
+        goto _fail;
+    r->shadowGen = 0;
+    r->curCharBuf = 0;
+    r->rowOffset = 0;
+
+    // Glyphs on the screen must not be evicted from the glyph cache
+    glyphCacheSetPinCallback(&r->glyphs, GpuRenderer_collectPins, con);
+
+    // Initialize the scrollback history
+    if (!scrollbackInit(&r->history, con->consoleWidth, SCROLLBACK_DEFAULT_CHUNKS))
+        goto _fail;
+    r->historyRow = (ScrollbackCell*)calloc(con->consoleWidth, sizeof(ScrollbackCell));
+    if (!r->historyRow)
+        goto _fail;
+    r->viewOffset = 0;
+    memset(r->charBufView, 0, sizeof(r->charBufView));
 
     // Generate a command list for each framebuffer, which will bind each of them as a render target
     for (unsigned i = 0; i < FB_NUM; i ++) {
@@ -374,26 +555,33 @@ static bool GpuRenderer_init(PrintConsole* con)
     rasterizerState.fillRectangleEnable = true;
     colorState.alphaCompareOp = DkCompareOp_Greater;
 
-    // Generate the main rendering command list
-    dkCmdBufSetViewports(r->cmdbuf, 0, &viewport, 1);
-    dkCmdBufSetScissors(r->cmdbuf, 0, &scissor, 1);
-    //dkCmdBufClearColorFloat(r->cmdbuf, 0, DkColorMask_RGBA, 0.125f, 0.294f, 0.478f, 0.0f);
-    dkCmdBufClearColorFloat(r->cmdbuf, 0, DkColorMask_RGBA, 0.0f, 0.0f, 0.0f, 0.0f);
-    dkCmdBufBindShaders(r->cmdbuf, DkStageFlag_GraphicsMask, shaders, sizeof(shaders)/sizeof(shaders[0]));
-    dkCmdBufBindRasterizerState(r->cmdbuf, &rasterizerState);
-    dkCmdBufBindColorState(r->cmdbuf, &colorState);
-    dkCmdBufBindColorWriteState(r->cmdbuf, &colorWriteState);
-    dkCmdBufBindUniformBuffer(r->cmdbuf, DkStage_Vertex, 0, configAddr, configSize);
-    dkCmdBufBindTexture(r->cmdbuf, DkStage_Fragment, 0, dkMakeTextureHandle(0, 0));
-    dkCmdBufBindVtxAttribState(r->cmdbuf, g_attribState, sizeof(g_attribState)/sizeof(g_attribState[0]));
-    dkCmdBufBindVtxBufferState(r->cmdbuf, g_vtxbufState, sizeof(g_vtxbufState)/sizeof(g_vtxbufState[0]));
-    dkCmdBufBindVtxBuffer(r->cmdbuf, 0, charBufAddr, charBufSize);
-    dkCmdBufSetAlphaRef(r->cmdbuf, 0.0f);
-    dkCmdBufDraw(r->cmdbuf, DkPrimitive_Triangles, 3, totalConSize, 0, 0);
-    r->cmdsRender = dkCmdBufFinishList(r->cmdbuf);
+    // Generate the main rendering command list, once for each copy of the character buffer
+    for (unsigned i = 0; i < CHARBUF_NUM; i ++) {
+        dkCmdBufSetViewports(r->cmdbuf, 0, &viewport, 1);
+        dkCmdBufSetScissors(r->cmdbuf, 0, &scissor, 1);
+        //dkCmdBufClearColorFloat(r->cmdbuf, 0, DkColorMask_RGBA, 0.125f, 0.294f, 0.478f, 0.0f);
+        dkCmdBufClearColorFloat(r->cmdbuf, 0, DkColorMask_RGBA, 0.0f, 0.0f, 0.0f, 0.0f);
+        dkCmdBufBindShaders(r->cmdbuf, DkStageFlag_GraphicsMask, shaders, sizeof(shaders)/sizeof(shaders[0]));
+        dkCmdBufBindRasterizerState(r->cmdbuf, &rasterizerState);
+        dkCmdBufBindColorState(r->cmdbuf, &colorState);
+        dkCmdBufBindColorWriteState(r->cmdbuf, &colorWriteState);
+        dkCmdBufBindUniformBuffer(r->cmdbuf, DkStage_Vertex, 0, configAddr, configSize);
+        dkCmdBufBindUniformBuffer(r->cmdbuf, DkStage_Vertex, 1, scrollAddr[i], scrollSize);
+        dkCmdBufBindTexture(r->cmdbuf, DkStage_Fragment, 0, dkMakeTextureHandle(0, 0));
+        dkCmdBufBindVtxAttribState(r->cmdbuf, g_attribState, sizeof(g_attribState)/sizeof(g_attribState[0]));
+        dkCmdBufBindVtxBufferState(r->cmdbuf, g_vtxbufState, sizeof(g_vtxbufState)/sizeof(g_vtxbufState[0]));
+        dkCmdBufBindVtxBuffer(r->cmdbuf, 0, charBufAddr[i], charBufSize);
+        dkCmdBufSetAlphaRef(r->cmdbuf, 0.0f);
+        dkCmdBufDraw(r->cmdbuf, DkPrimitive_Triangles, 3, totalConSize, 0, 0);
+        r->cmdsRender[i] = dkCmdBufFinishList(r->cmdbuf);
+    }
 
     r->initialized = true;
     return true;
+
+_fail:
+    GpuRenderer_destroy(r);
+    return false;
 }
 
 static void GpuRenderer_deinit(PrintConsole* con)
@@ -405,10 +593,46 @@ static void GpuRenderer_deinit(PrintConsole* con)
     }
 }
 
+// Converts a row of the console into a row of the character buffer ring
+static inline unsigned GpuRenderer_physRow(struct GpuRenderer* r, PrintConsole* con, int y)
+{
+    return (y + r->rowOffset) % con->consoleHeight;
+}
+
+// Returns the tile showing a character
+static unsigned GpuRenderer_getTile(struct GpuRenderer* r, PrintConsole* con, uint32_t codepoint)
+{
+    // ASCII comes from the built-in font, everything else from the glyph cache
+    if (codepoint < 0x80 && codepoint >= (uint32_t)con->font.asciiOffset)
+        return codepoint - con->font.asciiOffset;
+    if (r->glyphs.numSlots)
+        return glyphCacheGetTile(&r->glyphs, codepoint);
+
+    // Without the shared font, use the built-in font wherever it has the character
+    if (codepoint >= (uint32_t)con->font.asciiOffset && codepoint - con->font.asciiOffset < con->font.numChars)
+        return codepoint - con->font.asciiOffset;
+    return '?' - con->font.asciiOffset;
+}
+
+// Returns the character shown by a tile, as stored in the scrollback history
+static uint16_t GpuRenderer_getTileChar(struct GpuRenderer* r, PrintConsole* con, unsigned tile)
+{
+    uint32_t codepoint = tile < con->font.numChars ? tile + con->font.asciiOffset : glyphCacheGetCodepoint(&r->glyphs, tile);
+    return codepoint < 0x10000 ? codepoint : GLYPH_CACHE_REPLACEMENT;
+}
+
 static void GpuRenderer_drawChar(PrintConsole* con, int x, int y, int c)
 {
     struct GpuRenderer* r = GpuRenderer(con);
 
+    // Decode UTF-8 text. Bytes that don't complete a character don't take up a cell,
+    // so undo the cursor advance the console applies after this call.
+    uint32_t codepoint;
+    if (!utf8DecoderFeed(&r->utf8, c + con->font.asciiOffset, &codepoint)) {
+        con->cursorX --;
+        return;
+    }
+
     int writingColor = con->fg;
     int screenColor = con->bg;
 
@@ -424,34 +648,164 @@ static void GpuRenderer_drawChar(PrintConsole* con, int x, int y, int c)
         screenColor = tmp;
     }
 
-    // Wait for the fence
-    dkFenceWait(&r->lastRenderFence, UINT64_MAX);
-
-    ConsoleChar* pos = &r->charBuf[y*con->consoleWidth+x];
-    pos->tileId = c;
+    // Write to the shadow buffer; this never needs to wait for the GPU
+    unsigned row = GpuRenderer_physRow(r, con, y);
+    ConsoleChar* pos = &r->shadowBuf[row*con->consoleWidth+x];
+    pos->tileId = GpuRenderer_getTile(r, con, codepoint);
     pos->frontPal = writingColor;
     pos->backPal = screenColor;
+    r->rowGen[row] = ++r->shadowGen;
 }
 
 static void GpuRenderer_scrollWindow(PrintConsole* con)
 {
     struct GpuRenderer* r = GpuRenderer(con);
 
-    // Wait for the fence
-    dkFenceWait(&r->lastRenderFence, UINT64_MAX);
+    // Save the row that is about to scroll off into the history (storing characters rather than tiles,
+    // since glyph cache tiles are reused once they're off the screen), keeping the history view (if any) in place
+    const ConsoleChar* oldRow = &r->shadowBuf[GpuRenderer_physRow(r, con, con->windowY)*con->consoleWidth];
+    for (int x = 0; x < con->consoleWidth; x ++) {
+        r->historyRow[x].ch = GpuRenderer_getTileChar(r, con, oldRow[x].tileId);
+        r->historyRow[x].frontPal = oldRow[x].frontPal;
+        r->historyRow[x].backPal = oldRow[x].backPal;
+    }
+    scrollbackPush(&r->history, r->historyRow);
+    if (r->viewOffset && r->viewOffset < scrollbackGetNumLines(&r->history))
+        r->viewOffset ++;
+
+    // If the window covers the whole console, scrolling just moves the start of the ring
+    // (the console itself then clears the row that becomes the last one)
+    if (con->windowX == 0 && con->windowY == 0 && con->windowWidth == con->consoleWidth && con->windowHeight == con->consoleHeight) {
+        r->rowOffset = (r->rowOffset + 1) % con->consoleHeight;
+        r->shadowGen ++;
+        return;
+    }
 
-    // Perform the scrolling
+    // Otherwise, perform the scrolling row by row (on the shadow buffer, so that there is no need to wait for the GPU)
     for (int y = 0; y < con->windowHeight-1; y ++) {
+        unsigned dstRow = GpuRenderer_physRow(r, con, con->windowY+y+0);
+        unsigned srcRow = GpuRenderer_physRow(r, con, con->windowY+y+1);
         memcpy(
-            &r->charBuf[(con->windowY+y+0)*con->consoleWidth + con->windowX],
-            &r->charBuf[(con->windowY+y+1)*con->consoleWidth + con->windowX],
+            &r->shadowBuf[dstRow*con->consoleWidth + con->windowX],
+            &r->shadowBuf[srcRow*con->consoleWidth + con->windowX],
             sizeof(ConsoleChar)*con->windowWidth);
+        r->rowGen[dstRow] = ++r->shadowGen;
+    }
+}
+
+// Fills a copy of the character buffer with the screen as seen with the current history view
+static void GpuRenderer_composeView(struct GpuRenderer* r, PrintConsole* con, unsigned buf)
+{
+    uint32_t firstViewLine = r->history.endLine - r->viewOffset;
+    for (int y = 0; y < con->consoleHeight; y ++) {
+        uint32_t line = firstViewLine + y;
+        ConsoleChar* dst = &r->charBuf[buf][GpuRenderer_physRow(r, con, y)*con->consoleWidth];
+        if ((int32_t)(line - r->history.endLine) >= 0) {
+            // This line is on the screen
+            const ConsoleChar* src = &r->shadowBuf[GpuRenderer_physRow(r, con, line - r->history.endLine)*con->consoleWidth];
+            memcpy(dst, src, sizeof(ConsoleChar)*con->consoleWidth);
+        } else if (scrollbackGetLine(&r->history, line, (ScrollbackCell*)dst)) {
+            for (int x = 0; x < con->consoleWidth; x ++)
+                dst[x].tileId = GpuRenderer_getTile(r, con, dst[x].tileId);
+        } else {
+            memset(dst, 0, sizeof(ConsoleChar)*con->consoleWidth);
+        }
+    }
+
+    r->scrollBuf[buf]->rowOffset = r->rowOffset;
+    r->charBufGen[buf] = r->shadowGen;
+    r->charBufView[buf] = r->viewOffset;
+}
+
+// Copies the glyphs that were rasterized since the last frame into the tileset
+static void GpuRenderer_uploadGlyphs(struct GpuRenderer* r, PrintConsole* con)
+{
+    unsigned numDirty;
+    const uint32_t* dirty = glyphCacheGetDirty(&r->glyphs, &numDirty);
+    if (!numDirty)
+        return;
+
+    // Make sure the previous upload is done before touching the staging memory and commands
+    dkFenceWait(&r->glyphFence, UINT64_MAX);
+    dkCmdBufClear(r->glyphCmdbuf);
+
+    // Write the new glyphs into the copy of the tileset
+    unsigned layerWidth = r->tilesPerLayer * r->tilesetWidth;
+    for (unsigned i = 0; i < numDirty; i ++) {
+        unsigned tile = r->glyphs.firstTile + dirty[i];
+        const uint8_t* src = glyphCacheGetSlotPixels(&r->glyphs, dirty[i]);
+        uint8_t* dst = GpuRenderer_getTileMirror(r, con, tile);
+        for (unsigned y = 0; y < con->font.tileHeight; y ++, src += con->font.tileWidth, dst += layerWidth) {
+            if (r->packedTileset) {
+                // Threshold the coverage, packing 8 pixels per byte
+                for (unsigned x = 0; x < r->tilesetWidth; x ++) {
+                    uint8_t bits = 0;
+                    for (unsigned bit = 0; bit < 8; bit ++)
+                        bits = bits << 1 | (src[x*8+bit] >= 0x80);
+                    dst[x] = bits;
+                }
+            } else
+                memcpy(dst, src, con->font.tileWidth);
+        }
+        r->dirtyLayers[tile / r->tilesPerLayer] = true;
+    }
+
+    // Copy the layers that changed, a run of consecutive layers at a time
+    DkImageView tilesetView;
+    dkImageViewDefaults(&tilesetView, &r->tileset);
+    DkGpuAddr stagingAddr = dkMemBlockGetGpuAddr(r->stagingMemBlock);
+    for (unsigned layer = 0; layer < r->numLayers; ) {
+        if (!r->dirtyLayers[layer]) {
+            layer ++;
+            continue;
+        }
+
+        unsigned first = layer;
+        while (layer < r->numLayers && r->dirtyLayers[layer])
+            r->dirtyLayers[layer++] = false;
+
+        DkCopyBuf copySrc = { stagingAddr + first*layerWidth*con->font.tileHeight, 0, 0 };
+        DkImageRect copyDst = { 0, 0, first, layerWidth, con->font.tileHeight, layer - first };
+        dkCmdBufCopyBufferToImage(r->glyphCmdbuf, &copySrc, &tilesetView, &copyDst, 0);
     }
+
+    // Make the new glyphs visible to the rendering that follows
+    dkCmdBufBarrier(r->glyphCmdbuf, DkBarrier_Full, DkInvalidateFlags_Image);
+    dkQueueSubmitCommands(r->queue, dkCmdBufFinishList(r->glyphCmdbuf));
+    dkQueueSignalFence(r->queue, &r->glyphFence, false);
+    glyphCacheClearDirty(&r->glyphs);
 }
 
 static void GpuRenderer_flushAndSwap(PrintConsole* con)
 {
     struct GpuRenderer* r = GpuRenderer(con);
+    unsigned buf = r->curCharBuf;
+
+    // Wait for the GPU to be done with the copy of the character buffer we are about to publish to.
+    // This is the only point where the CPU waits for the GPU, and it only happens once per frame.
+    dkFenceWait(&r->renderFences[buf], UINT64_MAX);
+
+    if (r->viewOffset || r->charBufView[buf]) {
+        // The history is being shown (or this copy still shows it): rebuild the whole copy
+        if (r->charBufGen[buf] != r->shadowGen || r->charBufView[buf] != r->viewOffset)
+            GpuRenderer_composeView(r, con, buf);
+    } else if (r->charBufGen[buf] != r->shadowGen) {
+        // Publish the rows of the shadow buffer that changed since this copy was last published, along with the scroll state
+        for (int row = 0; row < con->consoleHeight; row ++) {
+            if ((int32_t)(r->rowGen[row] - r->charBufGen[buf]) > 0) {
+                memcpy(
+                    &r->charBuf[buf][row*con->consoleWidth],
+                    &r->shadowBuf[row*con->consoleWidth],
+                    sizeof(ConsoleChar)*con->consoleWidth);
+            }
+        }
+        r->scrollBuf[buf]->rowOffset = r->rowOffset;
+        r->charBufGen[buf] = r->shadowGen;
+    }
+
+    // Upload any glyphs needed by what we've just published
+    GpuRenderer_uploadGlyphs(r, con);
+    glyphCacheEndFrame(&r->glyphs);
 
     // Acquire a framebuffer from the swapchain (and wait for it to be available)
     int slot = dkQueueAcquireImage(r->queue, r->swapchain);
@@ -459,14 +813,17 @@ static void GpuRenderer_flushAndSwap(PrintConsole* con)
     // Run the command list that binds said framebuffer as a render target
     dkQueueSubmitCommands(r->queue, r->cmdsBindFramebuffer[slot]);
 
-    // Run the main rendering command list
-    dkQueueSubmitCommands(r->queue, r->cmdsRender);
+    // Run the main rendering command list, reading from the copy of the character buffer we've just published
+    dkQueueSubmitCommands(r->queue, r->cmdsRender[buf]);
 
-    // Signal the fence
-    dkQueueSignalFence(r->queue, &r->lastRenderFence, false);
+    // Signal the fence guarding this copy of the character buffer
+    dkQueueSignalFence(r->queue, &r->renderFences[buf], false);
 
     // Now that we are done rendering, present it to the screen
     dkQueuePresentImage(r->queue, r->swapchain, slot);
+
+    // Move on to the next copy of the character buffer
+    r->curCharBuf = (buf + 1) % CHARBUF_NUM;
 }
 
 static struct GpuRenderer s_gpuRenderer =
@@ -484,3 +841,38 @@ ConsoleRenderer* getDefaultConsoleRenderer(void)
 {
     return &s_gpuRenderer.base;
 }
+
+void gpuConsoleScrollback(int lines)
+{
+    struct GpuRenderer* r = &s_gpuRenderer;
+    if (!r->initialized)
+        return;
+
+    int64_t offset = (int64_t)r->viewOffset + lines;
+    if (offset < 0)
+        offset = 0;
+    if (offset > scrollbackGetNumLines(&r->history))
+        offset = scrollbackGetNumLines(&r->history);
+    r->viewOffset = offset;
+}
+
+void gpuConsoleScrollbackReset(void)
+{
+    s_gpuRenderer.viewOffset = 0;
+}
+
+bool gpuConsoleScrollbackFind(const char* needle)
+{
+    struct GpuRenderer* r = &s_gpuRenderer;
+    if (!r->initialized)
+        return false;
+
+    // Look for the closest match above the top of the screen, and bring it to the top of the screen
+    uint32_t line;
+    unsigned col;
+    if (!scrollbackFind(&r->history, needle, r->history.endLine - r->viewOffset - 1, true, &line, &col))
+        return false;
+
+    r->viewOffset = r->history.endLine - line;
+    return true;
+}
@@ -0,0 +1,22 @@
+// Scrollback history controls for the GPU console renderer.
+// Lines that scroll off the screen are kept in a compact history, which can be browsed and searched.
+#pragma once
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Scrolls the view by the given number of lines (positive values go towards older lines)
+void gpuConsoleScrollback(int lines);
+
+// Goes back to showing the current contents of the console
+void gpuConsoleScrollbackReset(void);
+
+// Searches the history for a string, starting above the top of the screen and going towards older
+// lines. If found, the view is scrolled so that the matching line is at the top of the screen.
+bool gpuConsoleScrollbackFind(const char* needle);
+
+#ifdef __cplusplus
+}
+#endif
@@ -3,9 +3,11 @@
 
 #include <switch.h>
 
+#include "gpu_console.h"
+
 int main(int argc, char **argv)
 {
-    consoleInit(NULL);
+    PrintConsole* con = consoleInit(NULL);
 
     // Configure our supported input layout: a single player with standard controller styles
     padConfigureInput(1, HidNpadStyleSet_NpadStandard);
@@ -65,6 +67,13 @@ int main(int argc, char **argv)
                 , i + 30);
     }
 
+    // Characters outside of the built-in font are rendered using the system shared font
+    printf("\nUnicode: Ünïcödé, ファイル, 中文, 한국어\n");
+
+    printf("\nPress A to print some log lines, Up/Down to scroll the history by a line,\n");
+    printf("L/R to scroll it by a page, Y to search for an error and ZR to go back.\n");
+    unsigned logLine = 0;
+
     // Main loop
     while(appletMainLoop())
     {
@@ -78,6 +87,24 @@ int main(int argc, char **argv)
 
         if (kDown & HidNpadButton_Plus) break; // break in order to return to hbmenu
 
+        // Print a batch of log lines, which will scroll off the screen into the history
+        if (kDown & HidNpadButton_A) {
+            for (int i = 0; i < 50; i ++, logLine ++) {
+                if (logLine % 37 == 0)
+                    printf(CONSOLE_RED "Log line %u: error!" CONSOLE_RESET "\n", logLine);
+                else
+                    printf("Log line %u\n", logLine);
+            }
+        }
+
+        // Browse the history
+        if (kDown & HidNpadButton_Up)   gpuConsoleScrollback(1);
+        if (kDown & HidNpadButton_Down) gpuConsoleScrollback(-1);
+        if (kDown & HidNpadButton_L)    gpuConsoleScrollback(con->consoleHeight);
+        if (kDown & HidNpadButton_R)    gpuConsoleScrollback(-con->consoleHeight);
+        if (kDown & HidNpadButton_ZR)   gpuConsoleScrollbackReset();
+        if (kDown & HidNpadButton_Y)    gpuConsoleScrollbackFind("error");
+
         consoleUpdate(NULL);
     }
 
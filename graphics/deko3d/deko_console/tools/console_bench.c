@@ -0,0 +1,361 @@
+/*
+ * Measures the console output throughput (lines per second) of the deko3d console renderer, and
+ * checks what it draws. source/gpu_console.c is built as is against a host version of deko3d
+ * (host/deko3d.c), which runs command lists on the CPU as soon as they are submitted: memory blocks
+ * are plain memory, data pushes and image copies are performed, and draws record the character
+ * buffer, scroll state and tileset they read. Fences and presentation complete immediately.
+ *
+ * The renderer is driven the way libnx's console drives it: each line is written on the last row
+ * of the window, the window is scrolled, and the new last row is cleared; a frame is published
+ * every LINES_PER_FRAME lines. The font is generated so that the first rows of each tile encode
+ * the tile's character, and the shared font is replaced by a rasterizer that does the same for
+ * any codepoint (host/shared_font.c). After each frame of the checked runs, the characters of the
+ * drawn screen are decoded from the tileset and compared to what was written, and the scrollback
+ * history is checked by scrolling the view back. Initialization is also made to fail at each of
+ * its memory block creations, and must then fail without leaving any deko3d object behind.
+ *
+ * This is a host tool, not part of the Switch build. The renderer loads its shaders from romfs:,
+ * so the tool runs from a temporary directory holding empty shader files.
+ *   cc -O2 -Ihost -I../source -I../../../common console_bench.c host/deko3d.c host/shared_font.c \
+ *      ../source/gpu_console.c ../../../common/scrollback.c ../../../common/glyph_cache.c -o console_bench
+ *   ./console_bench
+ */
+
+#define _GNU_SOURCE
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#include <switch.h>
+#include <deko3d.h>
+
+#include "gpu_console.h"
+
+// Console size (1280x720 with a 16x16 font) and workload
+#define TILE_WIDTH     16
+#define TILE_HEIGHT    16
+#define NUM_CHARS      256
+#define CONSOLE_WIDTH  80
+#define CONSOLE_HEIGHT 45
+#define LINES_PER_FRAME 64
+#define NUM_LINES      1000000
+#define CHECKED_LINES  5000
+
+// Lines that scrolled off the screen, as remembered by the checks
+#define HISTORY_LINES 1024
+
+typedef struct {
+    uint32_t screen[CONSOLE_HEIGHT][CONSOLE_WIDTH];
+    uint32_t history[HISTORY_LINES][CONSOLE_WIDTH];
+    uint32_t numHistory;
+} Model;
+
+static uint8_t s_fontGfx[NUM_CHARS*TILE_HEIGHT*TILE_WIDTH/8];
+static PrintConsole s_con;
+static Model s_model;
+static bool s_checking;
+static unsigned s_errors;
+
+static double now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// Writes the bits of a value into the first two rows of a tile (1 = covered), 16 bits per row
+static void encodeTile(uint32_t value, uint8_t* out, unsigned width)
+{
+    for (unsigned y = 0; y < 2; y ++)
+        for (unsigned x = 0; x < width; x ++)
+            out[y*width+x] = x < 16 && (value >> (y*16+x) & 1) ? 0xFF : 0x00;
+}
+
+// Builds the 1bpp font: the bytes of each row are stored right to left, with the leftmost pixel in the top bit
+static void makeFont(void)
+{
+    const unsigned rowBytes = TILE_WIDTH/8;
+    for (unsigned tile = 0; tile < NUM_CHARS; tile ++) {
+        uint8_t pixels[2*TILE_WIDTH];
+        encodeTile(tile, pixels, TILE_WIDTH);
+        uint8_t* data = &s_fontGfx[tile*TILE_HEIGHT*rowBytes];
+        for (unsigned y = 0; y < 2; y ++)
+            for (unsigned x = 0; x < TILE_WIDTH; x ++)
+                if (pixels[y*TILE_WIDTH+x])
+                    data[y*rowBytes + rowBytes-1 - x/8] |= 0x80 >> (x & 7);
+    }
+}
+
+// Reads back the value encoded in a tile of the tileset the last draw used
+static uint32_t decodeTile(unsigned tile)
+{
+    const DkImage* tileset = hostLastDraw.texture;
+    unsigned tilesPerLayer = tileset->layout.width / TILE_WIDTH;
+    unsigned layer = tile / tilesPerLayer;
+    unsigned x0 = (tile % tilesPerLayer) * TILE_WIDTH;
+    uint32_t value = 0;
+    for (unsigned y = 0; y < 2; y ++)
+        for (unsigned x = 0; x < 16; x ++) {
+            const uint8_t* texel = hostImageTexel(tileset, x0 + x, y, layer);
+            for (unsigned i = 0; i < tileset->layout.texelSize; i ++)
+                if (texel[i])
+                    value |= 1u << (y*16+x);
+        }
+    return value;
+}
+
+// Checks that the last frame showed the screen scrolled back by viewOffset lines
+static void checkFrame(const char* what, uint32_t viewOffset)
+{
+    uint32_t rowOffset = hostLastDraw.uniforms[1] ? *(const uint32_t*)(uintptr_t)hostLastDraw.uniforms[1] : 0;
+    for (int y = 0; y < CONSOLE_HEIGHT; y ++) {
+        uint32_t line = s_model.numHistory - viewOffset + y;
+        const uint32_t* expected = line < s_model.numHistory ? s_model.history[line % HISTORY_LINES] : s_model.screen[y - viewOffset];
+        const uint8_t* row = hostLastDraw.vertexData + (y + rowOffset) % CONSOLE_HEIGHT * CONSOLE_WIDTH * 4;
+        for (int x = 0; x < CONSOLE_WIDTH; x ++) {
+            uint16_t tile;
+            memcpy(&tile, &row[x*4], sizeof(tile));
+            uint32_t shown = decodeTile(tile);
+            if (shown != expected[x]) {
+                if (s_errors++ < 10)
+                    fprintf(stderr, "%s: at (%d,%d), view %u: U+%04X shown instead of U+%04X\n", what, x, y, viewOffset, shown, expected[x]);
+                return;
+            }
+        }
+    }
+}
+
+static void putChar(int y, uint32_t codepoint)
+{
+    // Encode the character as UTF-8, which the console sends to the renderer one byte at a time
+    uint8_t bytes[4];
+    unsigned len;
+    if (codepoint < 0x80) {
+        bytes[0] = codepoint;
+        len = 1;
+    } else if (codepoint < 0x800) {
+        bytes[0] = 0xC0 | codepoint >> 6;
+        bytes[1] = 0x80 | (codepoint & 0x3F);
+        len = 2;
+    } else if (codepoint < 0x10000) {
+        bytes[0] = 0xE0 | codepoint >> 12;
+        bytes[1] = 0x80 | (codepoint >> 6 & 0x3F);
+        bytes[2] = 0x80 | (codepoint & 0x3F);
+        len = 3;
+    } else {
+        bytes[0] = 0xF0 | codepoint >> 18;
+        bytes[1] = 0x80 | (codepoint >> 12 & 0x3F);
+        bytes[2] = 0x80 | (codepoint >> 6 & 0x3F);
+        bytes[3] = 0x80 | (codepoint & 0x3F);
+        len = 4;
+    }
+
+    if (s_checking)
+        s_model.screen[y][s_con.cursorX] = codepoint;
+    for (unsigned i = 0; i < len; i ++) {
+        s_con.renderer->drawChar(&s_con, s_con.cursorX, y, bytes[i] - s_con.font.asciiOffset);
+        s_con.cursorX ++;
+    }
+}
+
+static void scrollWindow(void)
+{
+    s_con.renderer->scrollWindow(&s_con);
+    if (!s_checking)
+        return;
+
+    // The history keeps the rows that scroll off the top of the window (as characters of the Basic Multilingual Plane)
+    uint32_t* saved = s_model.history[s_model.numHistory++ % HISTORY_LINES];
+    for (int x = 0; x < CONSOLE_WIDTH; x ++) {
+        uint32_t codepoint = s_model.screen[s_con.windowY][x];
+        saved[x] = codepoint < 0x10000 ? codepoint : 0xFFFD;
+    }
+    for (int y = s_con.windowY; y < s_con.windowY + s_con.windowHeight - 1; y ++)
+        memcpy(&s_model.screen[y][s_con.windowX], &s_model.screen[y+1][s_con.windowX], s_con.windowWidth*sizeof(uint32_t));
+}
+
+static void flushAndSwap(const char* what)
+{
+    s_con.renderer->flushAndSwap(&s_con);
+    if (s_checking)
+        checkFrame(what, 0);
+}
+
+// Same as the console: write a line on the last row, move to the next one (scrolling), and clear it
+static void printLine(const char* what, const uint32_t* text, unsigned len, unsigned n)
+{
+    int y = s_con.windowY + s_con.windowHeight - 1;
+    s_con.cursorX = s_con.windowX;
+    for (unsigned i = 0; i < len && i < (unsigned)s_con.windowWidth; i ++)
+        putChar(y, text[i]);
+    scrollWindow();
+    s_con.cursorX = s_con.windowX;
+    for (int x = 0; x < s_con.windowWidth; x ++)
+        putChar(y, ' ');
+    if (n % LINES_PER_FRAME == LINES_PER_FRAME-1)
+        flushAndSwap(what);
+}
+
+// Lines of ASCII text, or of mixed ASCII and CJK text with an emoji every 8 lines. The CJK characters
+// cycle through more codepoints than the glyph cache holds, while those on the screen still fit.
+static unsigned makeLine(uint32_t* text, unsigned n, bool unicode)
+{
+    char ascii[CONSOLE_WIDTH+1];
+    unsigned len = snprintf(ascii, sizeof(ascii), unicode ? "[%8u] " : "[%8u] frame=%u value=0x%08x status=ok",
+        n, n / LINES_PER_FRAME, n * 2654435761u);
+    for (unsigned i = 0; i < len; i ++)
+        text[i] = ascii[i];
+    if (unicode) {
+        for (unsigned i = 0; i < 5; i ++)
+            text[len++] = 0x4E00 + (n*5 + i) % 3000;
+        if (n % 8 == 0)
+            text[len++] = 0x1F600 + n / 8 % 16;
+    }
+    return len;
+}
+
+static bool start(int windowX, int windowY, int windowWidth, int windowHeight)
+{
+    memset(&s_model, 0, sizeof(s_model));
+    s_con.windowX = windowX;
+    s_con.windowY = windowY;
+    s_con.windowWidth = windowWidth;
+    s_con.windowHeight = windowHeight;
+    s_con.cursorX = s_con.cursorY = 0;
+    if (!s_con.renderer->init(&s_con)) {
+        fprintf(stderr, "renderer initialization failed\n");
+        return false;
+    }
+    return true;
+}
+
+// Fails each memory block creation of the initialization in turn, until it succeeds
+static void checkInitFailures(void)
+{
+    for (unsigned n = 1; ; n ++) {
+        memset(&s_model, 0, sizeof(s_model));
+        hostFailMemBlock = n;
+        bool ok = s_con.renderer->init(&s_con);
+        if (hostFailMemBlock == 0 && ok) {
+            fprintf(stderr, "init: succeeded although memory block creation %u failed\n", n);
+            s_errors ++;
+        }
+        if (ok) {
+            hostFailMemBlock = 0;
+            s_con.renderer->deinit(&s_con);
+        }
+        if (hostNumObjects != 0) {
+            fprintf(stderr, "init: %u deko3d object(s) left after memory block creation %u failed\n", hostNumObjects, n);
+            s_errors ++;
+        }
+        if (ok)
+            break;
+    }
+}
+
+// Prints lines through the renderer, and returns the number of lines per second
+static double run(const char* what, int windowX, int windowY, int windowWidth, int windowHeight, bool unicode, unsigned numLines, bool checking)
+{
+    static uint32_t lines[LINES_PER_FRAME*16][CONSOLE_WIDTH];
+    static unsigned lineLen[LINES_PER_FRAME*16];
+    const unsigned numPrepared = sizeof(lines)/sizeof(lines[0]);
+
+    if (!start(windowX, windowY, windowWidth, windowHeight))
+        exit(1);
+    s_checking = checking;
+
+    double elapsed = 0;
+    for (unsigned first = 0; first < numLines; first += numPrepared) {
+        for (unsigned i = 0; i < numPrepared; i ++)
+            lineLen[i] = makeLine(lines[i], first + i, unicode);
+
+        double t = now();
+        for (unsigned i = 0; i < numPrepared && first + i < numLines; i ++)
+            printLine(what, lines[i], lineLen[i], first + i);
+        elapsed += now() - t;
+    }
+    flushAndSwap(what);
+
+    // Browse the history: both copies of the character buffer need to catch up with each change of the view
+    if (checking && windowWidth == CONSOLE_WIDTH && windowHeight == CONSOLE_HEIGHT) {
+        static const int steps[] = { 1, 10, CONSOLE_HEIGHT, 300, -200, -156 };
+        uint32_t viewOffset = 0;
+        for (unsigned i = 0; i < sizeof(steps)/sizeof(steps[0]); i ++) {
+            gpuConsoleScrollback(steps[i]);
+            viewOffset += steps[i];
+            for (unsigned frame = 0; frame < 2; frame ++) {
+                s_con.renderer->flushAndSwap(&s_con);
+                checkFrame(what, viewOffset);
+            }
+        }
+        gpuConsoleScrollbackReset();
+        flushAndSwap(what);
+    }
+
+    s_con.renderer->deinit(&s_con);
+    return numLines / elapsed;
+}
+
+// The renderer loads its shaders from romfs:/shaders, which is a relative path on the host
+static bool makeShaderDir(char* dir)
+{
+    static const char* shaders[] = { "console_vsh.dksh", "console_fsh.dksh", "console_1bpp_fsh.dksh" };
+    if (!mkdtemp(dir) || chdir(dir) != 0 || mkdir("romfs:", 0755) != 0 || mkdir("romfs:/shaders", 0755) != 0)
+        return false;
+    for (unsigned i = 0; i < sizeof(shaders)/sizeof(shaders[0]); i ++) {
+        char path[64];
+        snprintf(path, sizeof(path), "romfs:/shaders/%s", shaders[i]);
+        FILE* f = fopen(path, "wb");
+        if (!f)
+            return false;
+        fclose(f);
+    }
+    return true;
+}
+
+static void removeShaderDir(const char* dir)
+{
+    char cmd[128];
+    snprintf(cmd, sizeof(cmd), "rm -rf '%s'", dir);
+    if (system(cmd) != 0)
+        fprintf(stderr, "could not remove %s\n", dir);
+}
+
+int main(void)
+{
+    char dir[] = "/tmp/console_bench.XXXXXX";
+    if (!makeShaderDir(dir)) {
+        fprintf(stderr, "could not set up the shader directory\n");
+        return 1;
+    }
+
+    makeFont();
+    s_con.font.gfx = s_fontGfx;
+    s_con.font.tileWidth = TILE_WIDTH;
+    s_con.font.tileHeight = TILE_HEIGHT;
+    s_con.font.asciiOffset = 0;
+    s_con.font.numChars = NUM_CHARS;
+    s_con.consoleWidth = CONSOLE_WIDTH;
+    s_con.consoleHeight = CONSOLE_HEIGHT;
+    s_con.fg = 7;
+    s_con.renderer = getDefaultConsoleRenderer();
+
+    checkInitFailures();
+    run("full window", 0, 0, CONSOLE_WIDTH, CONSOLE_HEIGHT, false, CHECKED_LINES, true);
+    run("window", 4, 2, CONSOLE_WIDTH-8, CONSOLE_HEIGHT-4, false, CHECKED_LINES, true);
+    run("unicode", 0, 0, CONSOLE_WIDTH, CONSOLE_HEIGHT, true, CHECKED_LINES, true);
+
+    printf("%ux%u console, published every %u lines:\n", CONSOLE_WIDTH, CONSOLE_HEIGHT, LINES_PER_FRAME);
+    printf("  full window  %6.2f M lines/s\n", run("full window", 0, 0, CONSOLE_WIDTH, CONSOLE_HEIGHT, false, NUM_LINES, false) / 1e6);
+    printf("  window       %6.2f M lines/s\n", run("window", 4, 2, CONSOLE_WIDTH-8, CONSOLE_HEIGHT-4, false, NUM_LINES/4, false) / 1e6);
+    printf("  unicode      %6.2f M lines/s\n", run("unicode", 0, 0, CONSOLE_WIDTH, CONSOLE_HEIGHT, true, NUM_LINES/4, false) / 1e6);
+    printf("Init failures, screen and history: %s\n", s_errors ? "FAILED" : "ok");
+
+    removeShaderDir(dir);
+    return s_errors ? 1 : 0;
+}
@@ -0,0 +1,423 @@
+// Host implementation of the parts of deko3d declared in host/deko3d.h.
+// Objects that are destroyed twice, or that were never created, abort the tool.
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "deko3d.h"
+
+typedef enum {
+    HostCmd_PushData,
+    HostCmd_CopyBufferToImage,
+    HostCmd_BindImageDescriptorSet,
+    HostCmd_BindUniformBuffer,
+    HostCmd_BindVtxBuffer,
+    HostCmd_Draw,
+} HostCmdType;
+
+typedef struct {
+    HostCmdType type;
+    DkGpuAddr addr;
+    uint32_t size;
+    uint32_t id;
+    void* data;
+    DkCopyBuf copySrc;
+    const DkImage* copyDst;
+    DkImageRect copyRect;
+} HostCmd;
+
+typedef struct {
+    HostCmd* cmds;
+    unsigned numCmds;
+} HostCmdList;
+
+struct HostDevice { int dummy; };
+
+struct HostQueue {
+    DkGpuAddr imageSet;
+    DkGpuAddr uniforms[4];
+    DkGpuAddr vertexAddr;
+    uint32_t vertexSize;
+};
+
+struct HostMemBlock {
+    void* mem;
+    uint32_t size;
+};
+
+struct HostSwapchain {
+    unsigned numImages;
+    unsigned nextImage;
+};
+
+struct HostCmdBuf {
+    HostCmd* cmds;
+    unsigned numCmds, maxCmds;
+    unsigned listStart;
+    HostCmdList** lists;
+    unsigned numLists;
+};
+
+HostDraw hostLastDraw;
+unsigned hostNumObjects;
+unsigned hostFailMemBlock;
+
+static void hostCheck(const void* object, const char* what)
+{
+    if (!object) {
+        fprintf(stderr, "deko3d: %s on a null object\n", what);
+        abort();
+    }
+}
+
+static void* hostAlloc(size_t size)
+{
+    void* mem = calloc(1, size ? size : 1);
+    if (!mem) {
+        fprintf(stderr, "deko3d: out of memory\n");
+        abort();
+    }
+    return mem;
+}
+
+const uint8_t* hostImageTexel(const DkImage* image, uint32_t x, uint32_t y, uint32_t z)
+{
+    const DkImageLayout* l = &image->layout;
+    return image->data + (((size_t)z*l->height + y)*l->width + x)*l->texelSize;
+}
+
+DkDevice dkDeviceCreate(const DkDeviceMaker* maker)
+{
+    (void)maker;
+    hostNumObjects ++;
+    return (DkDevice)hostAlloc(sizeof(struct HostDevice));
+}
+
+void dkDeviceDestroy(DkDevice device)
+{
+    hostCheck(device, "dkDeviceDestroy");
+    hostNumObjects --;
+    free(device);
+}
+
+DkQueue dkQueueCreate(const DkQueueMaker* maker)
+{
+    hostCheck(maker->device, "dkQueueCreate");
+    hostNumObjects ++;
+    return (DkQueue)hostAlloc(sizeof(struct HostQueue));
+}
+
+void dkQueueDestroy(DkQueue queue)
+{
+    hostCheck(queue, "dkQueueDestroy");
+    hostNumObjects --;
+    free(queue);
+}
+
+static void hostRunCopy(const HostCmd* cmd)
+{
+    const DkImage* image = cmd->copyDst;
+    const DkImageRect* rect = &cmd->copyRect;
+    uint32_t rowLength = cmd->copySrc.rowLength ? cmd->copySrc.rowLength : rect->width;
+    uint32_t imageHeight = cmd->copySrc.imageHeight ? cmd->copySrc.imageHeight : rect->height;
+    const uint8_t* src = (const uint8_t*)(uintptr_t)cmd->copySrc.addr;
+    for (uint32_t z = 0; z < rect->depth; z ++)
+        for (uint32_t y = 0; y < rect->height; y ++)
+            memcpy((uint8_t*)hostImageTexel(image, rect->x, rect->y + y, rect->z + z),
+                src + ((size_t)z*imageHeight + y)*rowLength*image->layout.texelSize,
+                rect->width*image->layout.texelSize);
+}
+
+void dkQueueSubmitCommands(DkQueue queue, DkCmdList cmds)
+{
+    hostCheck(queue, "dkQueueSubmitCommands");
+    const HostCmdList* list = (const HostCmdList*)cmds;
+    hostCheck(list, "dkQueueSubmitCommands");
+
+    for (unsigned i = 0; i < list->numCmds; i ++) {
+        const HostCmd* cmd = &list->cmds[i];
+        switch (cmd->type) {
+            case HostCmd_PushData:
+                memcpy((void*)(uintptr_t)cmd->addr, cmd->data, cmd->size);
+                break;
+            case HostCmd_CopyBufferToImage:
+                hostRunCopy(cmd);
+                break;
+            case HostCmd_BindImageDescriptorSet:
+                queue->imageSet = cmd->addr;
+                break;
+            case HostCmd_BindUniformBuffer:
+                queue->uniforms[cmd->id] = cmd->addr;
+                break;
+            case HostCmd_BindVtxBuffer:
+                queue->vertexAddr = cmd->addr;
+                queue->vertexSize = cmd->size;
+                break;
+            case HostCmd_Draw:
+                free(hostLastDraw.vertexData);
+                hostLastDraw.vertexData = (uint8_t*)hostAlloc(queue->vertexSize);
+                hostLastDraw.vertexSize = queue->vertexSize;
+                memcpy(hostLastDraw.vertexData, (const void*)(uintptr_t)queue->vertexAddr, queue->vertexSize);
+                memcpy(hostLastDraw.uniforms, queue->uniforms, sizeof(queue->uniforms));
+                hostLastDraw.texture = queue->imageSet ? ((const DkImageDescriptor*)(uintptr_t)queue->imageSet)->pImage : NULL;
+                hostLastDraw.instanceCount = cmd->size;
+                break;
+        }
+    }
+}
+
+void dkQueueSignalFence(DkQueue queue, DkFence* fence, bool flush)
+{
+    (void)flush;
+    hostCheck(queue, "dkQueueSignalFence");
+    fence->signaled = 1;
+}
+
+void dkQueueFlush(DkQueue queue)
+{
+    hostCheck(queue, "dkQueueFlush");
+}
+
+void dkQueueWaitIdle(DkQueue queue)
+{
+    hostCheck(queue, "dkQueueWaitIdle");
+}
+
+int dkQueueAcquireImage(DkQueue queue, DkSwapchain swapchain)
+{
+    hostCheck(queue, "dkQueueAcquireImage");
+    hostCheck(swapchain, "dkQueueAcquireImage");
+    int slot = swapchain->nextImage;
+    swapchain->nextImage = (swapchain->nextImage + 1) % swapchain->numImages;
+    return slot;
+}
+
+void dkQueuePresentImage(DkQueue queue, DkSwapchain swapchain, int imageSlot)
+{
+    (void)imageSlot;
+    hostCheck(queue, "dkQueuePresentImage");
+    hostCheck(swapchain, "dkQueuePresentImage");
+}
+
+DkMemBlock dkMemBlockCreate(const DkMemBlockMaker* maker)
+{
+    hostCheck(maker->device, "dkMemBlockCreate");
+    if (hostFailMemBlock && !--hostFailMemBlock)
+        return NULL;
+    hostNumObjects ++;
+    DkMemBlock mem = (DkMemBlock)hostAlloc(sizeof(struct HostMemBlock));
+    mem->mem = aligned_alloc(DK_MEMBLOCK_ALIGNMENT, (maker->size + DK_MEMBLOCK_ALIGNMENT - 1) &~ (DK_MEMBLOCK_ALIGNMENT - 1));
+    hostCheck(mem->mem, "dkMemBlockCreate (out of memory)");
+    mem->size = maker->size;
+    return mem;
+}
+
+void dkMemBlockDestroy(DkMemBlock mem)
+{
+    hostCheck(mem, "dkMemBlockDestroy");
+    hostNumObjects --;
+    free(mem->mem);
+    free(mem);
+}
+
+void* dkMemBlockGetCpuAddr(DkMemBlock mem)
+{
+    hostCheck(mem, "dkMemBlockGetCpuAddr");
+    return mem->mem;
+}
+
+DkGpuAddr dkMemBlockGetGpuAddr(DkMemBlock mem)
+{
+    hostCheck(mem, "dkMemBlockGetGpuAddr");
+    return (uintptr_t)mem->mem;
+}
+
+void dkImageLayoutInitialize(DkImageLayout* layout, const DkImageLayoutMaker* maker)
+{
+    layout->type = maker->type;
+    layout->format = maker->format;
+    layout->width = maker->dimensions[0];
+    layout->height = maker->dimensions[1];
+    layout->depth = maker->type == DkImageType_2DArray ? maker->dimensions[2] : 1;
+    switch (maker->format) {
+        case DkImageFormat_R8_Unorm:
+        case DkImageFormat_R8_Uint:
+            layout->texelSize = 1;
+            break;
+        case DkImageFormat_R32_Float:
+        case DkImageFormat_RGBA8_Unorm:
+            layout->texelSize = 4;
+            break;
+    }
+}
+
+uint64_t dkImageLayoutGetSize(const DkImageLayout* layout)
+{
+    return (uint64_t)layout->width * layout->height * layout->depth * layout->texelSize;
+}
+
+uint32_t dkImageLayoutGetAlignment(const DkImageLayout* layout)
+{
+    (void)layout;
+    return 512;
+}
+
+void dkImageInitialize(DkImage* image, const DkImageLayout* layout, DkMemBlock memBlock, uint32_t offset)
+{
+    hostCheck(memBlock, "dkImageInitialize");
+    if (offset + dkImageLayoutGetSize(layout) > memBlock->size) {
+        fprintf(stderr, "deko3d: image doesn't fit in its memory block\n");
+        abort();
+    }
+    image->layout = *layout;
+    image->data = (uint8_t*)memBlock->mem + offset;
+}
+
+DkSwapchain dkSwapchainCreate(const DkSwapchainMaker* maker)
+{
+    hostCheck(maker->device, "dkSwapchainCreate");
+    hostNumObjects ++;
+    DkSwapchain swapchain = (DkSwapchain)hostAlloc(sizeof(struct HostSwapchain));
+    swapchain->numImages = maker->numFramebuffers;
+    return swapchain;
+}
+
+void dkSwapchainDestroy(DkSwapchain swapchain)
+{
+    hostCheck(swapchain, "dkSwapchainDestroy");
+    hostNumObjects --;
+    free(swapchain);
+}
+
+DkCmdBuf dkCmdBufCreate(const DkCmdBufMaker* maker)
+{
+    hostCheck(maker->device, "dkCmdBufCreate");
+    hostNumObjects ++;
+    return (DkCmdBuf)hostAlloc(sizeof(struct HostCmdBuf));
+}
+
+void dkCmdBufDestroy(DkCmdBuf cmdbuf)
+{
+    hostCheck(cmdbuf, "dkCmdBufDestroy");
+    hostNumObjects --;
+    dkCmdBufClear(cmdbuf);
+    free(cmdbuf->cmds);
+    free(cmdbuf->lists);
+    free(cmdbuf);
+}
+
+void dkCmdBufAddMemory(DkCmdBuf cmdbuf, DkMemBlock mem, uint32_t offset, uint32_t size)
+{
+    hostCheck(cmdbuf, "dkCmdBufAddMemory");
+    hostCheck(mem, "dkCmdBufAddMemory");
+    if (offset + size > mem->size) {
+        fprintf(stderr, "deko3d: command memory outside of its memory block\n");
+        abort();
+    }
+}
+
+static HostCmd* hostRecord(DkCmdBuf cmdbuf, HostCmdType type)
+{
+    hostCheck(cmdbuf, "recording a command");
+    if (cmdbuf->numCmds == cmdbuf->maxCmds) {
+        cmdbuf->maxCmds = cmdbuf->maxCmds ? cmdbuf->maxCmds*2 : 64;
+        cmdbuf->cmds = (HostCmd*)realloc(cmdbuf->cmds, cmdbuf->maxCmds*sizeof(HostCmd));
+        hostCheck(cmdbuf->cmds, "recording a command (out of memory)");
+    }
+    HostCmd* cmd = &cmdbuf->cmds[cmdbuf->numCmds++];
+    memset(cmd, 0, sizeof(*cmd));
+    cmd->type = type;
+    return cmd;
+}
+
+DkCmdList dkCmdBufFinishList(DkCmdBuf cmdbuf)
+{
+    hostCheck(cmdbuf, "dkCmdBufFinishList");
+    HostCmdList* list = (HostCmdList*)hostAlloc(sizeof(HostCmdList));
+    list->numCmds = cmdbuf->numCmds - cmdbuf->listStart;
+    list->cmds = (HostCmd*)hostAlloc(list->numCmds*sizeof(HostCmd));
+    memcpy(list->cmds, &cmdbuf->cmds[cmdbuf->listStart], list->numCmds*sizeof(HostCmd));
+    cmdbuf->listStart = cmdbuf->numCmds;
+
+    cmdbuf->lists = (HostCmdList**)realloc(cmdbuf->lists, (cmdbuf->numLists+1)*sizeof(HostCmdList*));
+    hostCheck(cmdbuf->lists, "dkCmdBufFinishList (out of memory)");
+    cmdbuf->lists[cmdbuf->numLists++] = list;
+    return (DkCmdList)list;
+}
+
+// Command lists are only valid until their command buffer is cleared
+void dkCmdBufClear(DkCmdBuf cmdbuf)
+{
+    hostCheck(cmdbuf, "dkCmdBufClear");
+    for (unsigned i = 0; i < cmdbuf->numCmds; i ++)
+        free(cmdbuf->cmds[i].data);
+    for (unsigned i = 0; i < cmdbuf->numLists; i ++) {
+        free(cmdbuf->lists[i]->cmds);
+        free(cmdbuf->lists[i]);
+    }
+    cmdbuf->numCmds = cmdbuf->listStart = cmdbuf->numLists = 0;
+}
+
+void dkCmdBufPushData(DkCmdBuf cmdbuf, DkGpuAddr addr, const void* data, uint32_t size)
+{
+    HostCmd* cmd = hostRecord(cmdbuf, HostCmd_PushData);
+    cmd->addr = addr;
+    cmd->size = size;
+    cmd->data = hostAlloc(size);
+    memcpy(cmd->data, data, size);
+}
+
+void dkCmdBufPushConstants(DkCmdBuf cmdbuf, DkGpuAddr uboAddr, uint32_t uboSize, uint32_t offset, uint32_t size, const void* data)
+{
+    if (offset + size > uboSize) {
+        fprintf(stderr, "deko3d: dkCmdBufPushConstants outside of the uniform buffer\n");
+        abort();
+    }
+    dkCmdBufPushData(cmdbuf, uboAddr + offset, data, size);
+}
+
+void dkCmdBufCopyBufferToImage(DkCmdBuf cmdbuf, const DkCopyBuf* src, const DkImageView* dstView, const DkImageRect* dstRect, uint32_t flags)
+{
+    (void)flags;
+    const DkImageLayout* l = &dstView->pImage->layout;
+    if (dstRect->x + dstRect->width > l->width || dstRect->y + dstRect->height > l->height || dstRect->z + dstRect->depth > l->depth) {
+        fprintf(stderr, "deko3d: dkCmdBufCopyBufferToImage outside of the image\n");
+        abort();
+    }
+    HostCmd* cmd = hostRecord(cmdbuf, HostCmd_CopyBufferToImage);
+    cmd->copySrc = *src;
+    cmd->copyDst = dstView->pImage;
+    cmd->copyRect = *dstRect;
+}
+
+void dkCmdBufBindImageDescriptorSet(DkCmdBuf cmdbuf, DkGpuAddr setAddr, uint32_t numDescriptors)
+{
+    (void)numDescriptors;
+    HostCmd* cmd = hostRecord(cmdbuf, HostCmd_BindImageDescriptorSet);
+    cmd->addr = setAddr;
+}
+
+void dkCmdBufBindUniformBuffer(DkCmdBuf cmdbuf, DkStage stage, uint32_t id, DkGpuAddr bufAddr, uint32_t bufSize)
+{
+    if (stage != DkStage_Vertex || id >= 4)
+        return;
+    HostCmd* cmd = hostRecord(cmdbuf, HostCmd_BindUniformBuffer);
+    cmd->id = id;
+    cmd->addr = bufAddr;
+    cmd->size = bufSize;
+}
+
+void dkCmdBufBindVtxBuffer(DkCmdBuf cmdbuf, uint32_t id, DkGpuAddr bufAddr, uint32_t bufSize)
+{
+    HostCmd* cmd = hostRecord(cmdbuf, HostCmd_BindVtxBuffer);
+    cmd->id = id;
+    cmd->addr = bufAddr;
+    cmd->size = bufSize;
+}
+
+void dkCmdBufDraw(DkCmdBuf cmdbuf, DkPrimitive prim, uint32_t numVertices, uint32_t numInstances, uint32_t firstVertex, uint32_t firstInstance)
+{
+    (void)prim; (void)numVertices; (void)firstVertex; (void)firstInstance;
+    HostCmd* cmd = hostRecord(cmdbuf, HostCmd_Draw);
+    cmd->size = numInstances;
+}
@@ -0,0 +1,248 @@
+// Just enough of deko3d for the console renderer to build and run on the host (see host/deko3d.c).
+// Memory blocks are plain memory whose GPU address is their CPU address, images are linear,
+// and command lists run on the CPU as soon as they are submitted.
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <switch.h>
+
+#define DK_MEMBLOCK_ALIGNMENT    0x1000
+#define DK_CMDMEM_ALIGNMENT      4
+#define DK_SHADER_CODE_ALIGNMENT 256
+#define DK_UNIFORM_BUF_ALIGNMENT 256
+
+typedef uint64_t DkGpuAddr;
+typedef uintptr_t DkCmdList;
+
+typedef struct HostDevice* DkDevice;
+typedef struct HostQueue* DkQueue;
+typedef struct HostMemBlock* DkMemBlock;
+typedef struct HostSwapchain* DkSwapchain;
+typedef struct HostCmdBuf* DkCmdBuf;
+
+typedef enum {
+    DkImageFormat_R8_Unorm,
+    DkImageFormat_R8_Uint,
+    DkImageFormat_R32_Float,
+    DkImageFormat_RGBA8_Unorm,
+} DkImageFormat;
+
+typedef enum {
+    DkImageType_2D,
+    DkImageType_2DArray,
+} DkImageType;
+
+enum {
+    DkQueueFlags_Graphics = 1,
+
+    DkMemBlockFlags_CpuUncached = 1 << 0,
+    DkMemBlockFlags_GpuCached   = 1 << 1,
+    DkMemBlockFlags_Code        = 1 << 2,
+    DkMemBlockFlags_Image       = 1 << 3,
+
+    DkImageFlags_UsageRender   = 1 << 0,
+    DkImageFlags_UsagePresent  = 1 << 1,
+    DkImageFlags_HwCompression = 1 << 2,
+
+    DkStageFlag_GraphicsMask = 0x1F,
+    DkColorMask_RGBA = 0xF,
+    DkInvalidateFlags_Image = 1 << 0,
+};
+
+typedef enum { DkStage_Vertex, DkStage_Fragment = 4 } DkStage;
+typedef enum { DkBarrier_None, DkBarrier_Full = 3 } DkBarrier;
+typedef enum { DkPrimitive_Triangles = 4 } DkPrimitive;
+typedef enum { DkCompareOp_Always, DkCompareOp_Greater } DkCompareOp;
+typedef enum { DkWrapMode_Repeat, DkWrapMode_ClampToEdge } DkWrapMode;
+typedef enum { DkFilter_Nearest, DkFilter_Linear } DkFilter;
+typedef enum { DkVtxAttribSize_1x16, DkVtxAttribSize_2x8 } DkVtxAttribSize;
+typedef enum { DkVtxAttribType_Uint, DkVtxAttribType_Uscaled } DkVtxAttribType;
+
+typedef struct { int dummy; } DkDeviceMaker;
+typedef struct { DkDevice device; uint32_t flags; } DkQueueMaker;
+typedef struct { DkDevice device; uint32_t size; uint32_t flags; } DkMemBlockMaker;
+typedef struct { DkDevice device; } DkCmdBufMaker;
+
+typedef struct {
+    DkDevice device;
+    DkImageType type;
+    uint32_t flags;
+    DkImageFormat format;
+    uint32_t dimensions[3];
+} DkImageLayoutMaker;
+
+typedef struct {
+    DkImageType type;
+    DkImageFormat format;
+    uint32_t width, height, depth;
+    uint32_t texelSize;
+} DkImageLayout;
+
+typedef struct {
+    DkImageLayout layout;
+    uint8_t* data;
+} DkImage;
+
+typedef struct { const DkImage* pImage; } DkImageView;
+
+typedef struct {
+    DkDevice device;
+    NWindow* nativeWindow;
+    DkImage const* const* pFramebuffers;
+    uint32_t numFramebuffers;
+} DkSwapchainMaker;
+
+typedef struct { DkMemBlock codeMem; uint32_t codeMemOffset; } DkShaderMaker;
+typedef struct { uint32_t codeOffset; } DkShader;
+
+typedef struct { const DkImage* pImage; uint8_t padding[32 - sizeof(void*)]; } DkImageDescriptor;
+typedef struct { uint32_t data[8]; } DkSamplerDescriptor;
+
+typedef struct {
+    DkWrapMode wrapMode[3];
+    DkFilter minFilter;
+    DkFilter magFilter;
+} DkSampler;
+
+typedef struct { bool fillRectangleEnable; } DkRasterizerState;
+typedef struct { DkCompareOp alphaCompareOp; } DkColorState;
+typedef struct { uint32_t masks; } DkColorWriteState;
+
+typedef struct {
+    uint32_t bufferId, isFixed, offset;
+    DkVtxAttribSize size;
+    DkVtxAttribType type;
+    uint32_t isBgra;
+} DkVtxAttribState;
+
+typedef struct { uint32_t stride, divisor; } DkVtxBufferState;
+
+typedef struct { float x, y, width, height, near, far; } DkViewport;
+typedef struct { uint32_t x, y, width, height; } DkScissor;
+
+typedef struct { DkGpuAddr addr; uint32_t rowLength; uint32_t imageHeight; } DkCopyBuf;
+typedef struct { uint32_t x, y, z, width, height, depth; } DkImageRect;
+
+// Fences are signaled as soon as they are submitted, since command lists run on submission
+typedef struct { uint32_t signaled; } DkFence;
+
+// What the last draw call read: the vertex buffer (as it was when the draw ran), the vertex stage
+// uniform buffers, and the image of the first image descriptor
+typedef struct {
+    uint8_t* vertexData;
+    uint32_t vertexSize;
+    DkGpuAddr uniforms[4];
+    const DkImage* texture;
+    uint32_t instanceCount;
+} HostDraw;
+
+extern HostDraw hostLastDraw;
+
+// Number of devices, queues, memory blocks, swapchains and command buffers that exist
+extern unsigned hostNumObjects;
+
+// When non-zero, the memory block creation that many creations from now fails (returns NULL)
+extern unsigned hostFailMemBlock;
+
+// Returns a texel of an image
+const uint8_t* hostImageTexel(const DkImage* image, uint32_t x, uint32_t y, uint32_t z);
+
+static inline void dkDeviceMakerDefaults(DkDeviceMaker* maker) { maker->dummy = 0; }
+DkDevice dkDeviceCreate(const DkDeviceMaker* maker);
+void dkDeviceDestroy(DkDevice device);
+
+static inline void dkQueueMakerDefaults(DkQueueMaker* maker, DkDevice device) { maker->device = device; maker->flags = 0; }
+DkQueue dkQueueCreate(const DkQueueMaker* maker);
+void dkQueueDestroy(DkQueue queue);
+void dkQueueSubmitCommands(DkQueue queue, DkCmdList cmds);
+void dkQueueSignalFence(DkQueue queue, DkFence* fence, bool flush);
+void dkQueueFlush(DkQueue queue);
+void dkQueueWaitIdle(DkQueue queue);
+int dkQueueAcquireImage(DkQueue queue, DkSwapchain swapchain);
+void dkQueuePresentImage(DkQueue queue, DkSwapchain swapchain, int imageSlot);
+static inline void dkFenceWait(DkFence* fence, int64_t timeout_ns) { (void)fence; (void)timeout_ns; }
+
+static inline void dkMemBlockMakerDefaults(DkMemBlockMaker* maker, DkDevice device, uint32_t size)
+{
+    maker->device = device;
+    maker->size = size;
+    maker->flags = DkMemBlockFlags_CpuUncached | DkMemBlockFlags_GpuCached;
+}
+DkMemBlock dkMemBlockCreate(const DkMemBlockMaker* maker);
+void dkMemBlockDestroy(DkMemBlock mem);
+void* dkMemBlockGetCpuAddr(DkMemBlock mem);
+DkGpuAddr dkMemBlockGetGpuAddr(DkMemBlock mem);
+
+static inline void dkImageLayoutMakerDefaults(DkImageLayoutMaker* maker, DkDevice device)
+{
+    maker->device = device;
+    maker->type = DkImageType_2D;
+    maker->flags = 0;
+    maker->format = DkImageFormat_R8_Unorm;
+    maker->dimensions[0] = maker->dimensions[1] = maker->dimensions[2] = 0;
+}
+void dkImageLayoutInitialize(DkImageLayout* layout, const DkImageLayoutMaker* maker);
+uint64_t dkImageLayoutGetSize(const DkImageLayout* layout);
+uint32_t dkImageLayoutGetAlignment(const DkImageLayout* layout);
+void dkImageInitialize(DkImage* image, const DkImageLayout* layout, DkMemBlock memBlock, uint32_t offset);
+static inline void dkImageViewDefaults(DkImageView* view, const DkImage* image) { view->pImage = image; }
+static inline void dkImageDescriptorInitialize(DkImageDescriptor* desc, const DkImageView* view, bool usesLoadOrStore, bool decayMS) { (void)usesLoadOrStore; (void)decayMS; desc->pImage = view->pImage; }
+
+static inline void dkSwapchainMakerDefaults(DkSwapchainMaker* maker, DkDevice device, NWindow* nativeWindow, DkImage const* const* pFramebuffers, uint32_t numFramebuffers)
+{
+    maker->device = device;
+    maker->nativeWindow = nativeWindow;
+    maker->pFramebuffers = pFramebuffers;
+    maker->numFramebuffers = numFramebuffers;
+}
+DkSwapchain dkSwapchainCreate(const DkSwapchainMaker* maker);
+void dkSwapchainDestroy(DkSwapchain swapchain);
+
+static inline void dkShaderMakerDefaults(DkShaderMaker* maker, DkMemBlock codeMem, uint32_t codeMemOffset) { maker->codeMem = codeMem; maker->codeMemOffset = codeMemOffset; }
+static inline void dkShaderInitialize(DkShader* shader, const DkShaderMaker* maker) { shader->codeOffset = maker->codeMemOffset; }
+
+static inline void dkSamplerDefaults(DkSampler* sampler)
+{
+    sampler->wrapMode[0] = sampler->wrapMode[1] = sampler->wrapMode[2] = DkWrapMode_Repeat;
+    sampler->minFilter = sampler->magFilter = DkFilter_Linear;
+}
+static inline void dkSamplerDescriptorInitialize(DkSamplerDescriptor* desc, const DkSampler* sampler) { (void)desc; (void)sampler; }
+
+static inline void dkRasterizerStateDefaults(DkRasterizerState* state) { state->fillRectangleEnable = false; }
+static inline void dkColorStateDefaults(DkColorState* state) { state->alphaCompareOp = DkCompareOp_Always; }
+static inline void dkColorWriteStateDefaults(DkColorWriteState* state) { state->masks = 0xFFFFFFFF; }
+static inline uint32_t dkMakeTextureHandle(uint32_t imageId, uint32_t samplerId) { return imageId | samplerId << 20; }
+
+static inline void dkCmdBufMakerDefaults(DkCmdBufMaker* maker, DkDevice device) { maker->device = device; }
+DkCmdBuf dkCmdBufCreate(const DkCmdBufMaker* maker);
+void dkCmdBufDestroy(DkCmdBuf cmdbuf);
+void dkCmdBufAddMemory(DkCmdBuf cmdbuf, DkMemBlock mem, uint32_t offset, uint32_t size);
+DkCmdList dkCmdBufFinishList(DkCmdBuf cmdbuf);
+void dkCmdBufClear(DkCmdBuf cmdbuf);
+
+// Commands that affect what the host can observe are recorded, the others do nothing
+void dkCmdBufPushData(DkCmdBuf cmdbuf, DkGpuAddr addr, const void* data, uint32_t size);
+void dkCmdBufPushConstants(DkCmdBuf cmdbuf, DkGpuAddr uboAddr, uint32_t uboSize, uint32_t offset, uint32_t size, const void* data);
+void dkCmdBufCopyBufferToImage(DkCmdBuf cmdbuf, const DkCopyBuf* src, const DkImageView* dstView, const DkImageRect* dstRect, uint32_t flags);
+void dkCmdBufBindImageDescriptorSet(DkCmdBuf cmdbuf, DkGpuAddr setAddr, uint32_t numDescriptors);
+void dkCmdBufBindUniformBuffer(DkCmdBuf cmdbuf, DkStage stage, uint32_t id, DkGpuAddr bufAddr, uint32_t bufSize);
+void dkCmdBufBindVtxBuffer(DkCmdBuf cmdbuf, uint32_t id, DkGpuAddr bufAddr, uint32_t bufSize);
+void dkCmdBufDraw(DkCmdBuf cmdbuf, DkPrimitive prim, uint32_t numVertices, uint32_t numInstances, uint32_t firstVertex, uint32_t firstInstance);
+
+static inline void dkCmdBufBindSamplerDescriptorSet(DkCmdBuf cmdbuf, DkGpuAddr setAddr, uint32_t numDescriptors) { (void)cmdbuf; (void)setAddr; (void)numDescriptors; }
+static inline void dkCmdBufBindRenderTarget(DkCmdBuf cmdbuf, const DkImageView* colorTarget, const DkImageView* depthTarget) { (void)cmdbuf; (void)colorTarget; (void)depthTarget; }
+static inline void dkCmdBufSetViewports(DkCmdBuf cmdbuf, uint32_t firstId, const DkViewport* viewports, uint32_t numViewports) { (void)cmdbuf; (void)firstId; (void)viewports; (void)numViewports; }
+static inline void dkCmdBufSetScissors(DkCmdBuf cmdbuf, uint32_t firstId, const DkScissor* scissors, uint32_t numScissors) { (void)cmdbuf; (void)firstId; (void)scissors; (void)numScissors; }
+static inline void dkCmdBufClearColorFloat(DkCmdBuf cmdbuf, uint32_t targetId, uint32_t clearMask, float red, float green, float blue, float alpha) { (void)cmdbuf; (void)targetId; (void)clearMask; (void)red; (void)green; (void)blue; (void)alpha; }
+static inline void dkCmdBufBindShaders(DkCmdBuf cmdbuf, uint32_t stageMask, DkShader const* const shaders[], uint32_t numShaders) { (void)cmdbuf; (void)stageMask; (void)shaders; (void)numShaders; }
+static inline void dkCmdBufBindRasterizerState(DkCmdBuf cmdbuf, const DkRasterizerState* state) { (void)cmdbuf; (void)state; }
+static inline void dkCmdBufBindColorState(DkCmdBuf cmdbuf, const DkColorState* state) { (void)cmdbuf; (void)state; }
+static inline void dkCmdBufBindColorWriteState(DkCmdBuf cmdbuf, const DkColorWriteState* state) { (void)cmdbuf; (void)state; }
+static inline void dkCmdBufBindTexture(DkCmdBuf cmdbuf, DkStage stage, uint32_t id, uint32_t handle) { (void)cmdbuf; (void)stage; (void)id; (void)handle; }
+static inline void dkCmdBufBindVtxAttribState(DkCmdBuf cmdbuf, DkVtxAttribState const* attribs, uint32_t numAttribs) { (void)cmdbuf; (void)attribs; (void)numAttribs; }
+static inline void dkCmdBufBindVtxBufferState(DkCmdBuf cmdbuf, DkVtxBufferState const* buffers, uint32_t numBuffers) { (void)cmdbuf; (void)buffers; (void)numBuffers; }
+static inline void dkCmdBufSetAlphaRef(DkCmdBuf cmdbuf, float ref) { (void)cmdbuf; (void)ref; }
+static inline void dkCmdBufBarrier(DkCmdBuf cmdbuf, DkBarrier mode, uint32_t invalidateFlags) { (void)cmdbuf; (void)mode; (void)invalidateFlags; }
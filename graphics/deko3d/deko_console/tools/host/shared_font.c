@@ -0,0 +1,30 @@
+// Stands in for graphics/common/shared_font.c, since the system fonts only exist on the console.
+// Every codepoint is "rasterized" as its bits in the first two rows of the tile (16 bits per row),
+// so that the tool can tell which character a tile of the tileset holds.
+#include <string.h>
+
+#include "shared_font.h"
+
+static unsigned s_tileWidth;
+
+bool sharedFontInit(unsigned tileWidth, unsigned tileHeight)
+{
+    (void)tileHeight;
+    s_tileWidth = tileWidth;
+    return tileWidth >= 16 && tileHeight >= 2;
+}
+
+void sharedFontExit(void)
+{
+}
+
+bool sharedFontRasterize(void* user, uint32_t codepoint, uint8_t* out, unsigned width, unsigned height)
+{
+    (void)user;
+    memset(out, 0, width*height);
+    for (unsigned y = 0; y < 2; y ++)
+        for (unsigned x = 0; x < 16; x ++)
+            if (codepoint >> (y*16+x) & 1)
+                out[y*width+x] = 0xFF;
+    return true;
+}
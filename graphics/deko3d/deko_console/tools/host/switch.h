@@ -0,0 +1,71 @@
+// Just enough of libnx for the console renderer to build on the host: types, and the console
+// structures and flags the renderer uses (laid out for the host, not as libnx has them).
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+typedef uint8_t u8;
+typedef uint16_t u16;
+typedef uint32_t u32;
+typedef uint64_t u64;
+typedef int32_t s32;
+
+typedef struct NWindow NWindow;
+static inline NWindow* nwindowGetDefault(void) { return NULL; }
+
+#define CONSOLE_COLOR_BOLD    (1<<0)
+#define CONSOLE_COLOR_FAINT   (1<<1)
+#define CONSOLE_ITALIC        (1<<2)
+#define CONSOLE_UNDERLINE     (1<<3)
+#define CONSOLE_BLINK_SLOW    (1<<4)
+#define CONSOLE_BLINK_FAST    (1<<5)
+#define CONSOLE_COLOR_REVERSE (1<<6)
+#define CONSOLE_CONCEAL       (1<<7)
+#define CONSOLE_CROSSED_OUT   (1<<8)
+
+typedef struct PrintConsole PrintConsole;
+
+typedef struct {
+    bool (*init)(PrintConsole* con);
+    void (*deinit)(PrintConsole* con);
+    void (*drawChar)(PrintConsole* con, int x, int y, int c);
+    void (*scrollWindow)(PrintConsole* con);
+    void (*flushAndSwap)(PrintConsole* con);
+} ConsoleRenderer;
+
+typedef struct {
+    const void* gfx;   // 1bpp tiles, the bytes of each row stored right to left
+    u16 asciiOffset;   // first ASCII code in the font
+    u16 numChars;
+    u16 tileWidth;
+    u16 tileHeight;
+} ConsoleFont;
+
+struct PrintConsole {
+    ConsoleFont font;
+    ConsoleRenderer* renderer;
+
+    int cursorX;
+    int cursorY;
+    int prevCursorX;
+    int prevCursorY;
+
+    int consoleWidth;
+    int consoleHeight;
+    int windowX;
+    int windowY;
+    int windowWidth;
+    int windowHeight;
+
+    int tabSize;
+    int fg;
+    int bg;
+    int flags;
+
+    bool consoleInitialised;
+};
+
+// Provided by the renderer being built
+ConsoleRenderer* getDefaultConsoleRenderer(void);
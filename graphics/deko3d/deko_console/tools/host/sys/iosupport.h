@@ -0,0 +1,2 @@
+// libnx's console renderer interface lives in host/switch.h
+#pragma once
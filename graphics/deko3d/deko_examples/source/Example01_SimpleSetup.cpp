@@ -150,6 +150,9 @@ public:
 
     void render()
     {
+        // Measure the time spent submitting this frame (only when running a benchmark)
+        CBenchmark::SubmitScope submitScope;
+
         // Acquire a framebuffer from the swapchain (and wait for it to be available)
         int slot = queue.acquireImage(swapchain);
 
@@ -307,6 +307,9 @@ public:
 
     void render()
     {
+        // Measure the time spent submitting this frame (only when running a benchmark)
+        CBenchmark::SubmitScope submitScope;
+
         // Begin generating the dynamic command list, for commands that need to be sent only this frame specifically
         dynmem.begin(dyncmd);
 
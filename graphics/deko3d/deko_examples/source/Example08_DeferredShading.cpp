@@ -14,6 +14,7 @@
 #include "SampleFramework/CMemPool.h"
 #include "SampleFramework/CShader.h"
 #include "SampleFramework/CCmdMemRing.h"
+#include "SampleFramework/CUniformRing.h"
 #include "SampleFramework/CDescriptorSet.h"
 #include "SampleFramework/FileLoader.h"
 
@@ -73,6 +74,7 @@ class CExample08 final : public CApplication
     static constexpr unsigned NumFramebuffers = 2;
     static constexpr unsigned StaticCmdSize = 0x10000;
     static constexpr unsigned DynamicCmdSize = 0x10000;
+    static constexpr unsigned UniformRingSize = 0x1000;
     static constexpr unsigned MaxImages = 3;
     static constexpr unsigned MaxSamplers = 1;
 
@@ -88,6 +90,7 @@ class CExample08 final : public CApplication
     dk::UniqueCmdBuf cmdbuf;
     dk::UniqueCmdBuf dyncmd;
     CCmdMemRing<NumFramebuffers> dynmem;
+    CUniformRing<NumFramebuffers> uniforms;
 
     CDescriptorSet<MaxImages> imageDescriptorSet;
     CDescriptorSet<MaxSamplers> samplerDescriptorSet;
@@ -99,10 +102,8 @@ class CExample08 final : public CApplication
     CShader compositionFragmentShader;
 
     Transformation transformState;
-    CMemPool::Handle transformUniformBuffer;
 
     Lighting lightingState;
-    CMemPool::Handle lightingUniformBuffer;
 
     CMemPool::Handle vertexBuffer;
     CMemPool::Handle indexBuffer;
@@ -159,11 +160,8 @@ public:
         compositionVertexShader.load(*pool_code, "romfs:/shaders/composition_vsh.dksh");
         compositionFragmentShader.load(*pool_code, "romfs:/shaders/composition_fsh.dksh");
 
-        // Create the transformation uniform buffer
-        transformUniformBuffer = pool_data->allocate(sizeof(transformState), DK_UNIFORM_BUF_ALIGNMENT);
-
-        // Create the lighting uniform buffer
-        lightingUniformBuffer = pool_data->allocate(sizeof(lightingState), DK_UNIFORM_BUF_ALIGNMENT);
+        // Allocate memory for the uniform ring, which holds the uniform data of each frame in flight
+        uniforms.allocate(*pool_data, UniformRingSize);
 
         // Initialize the lighting state
         lightingState.lightPos = glm::vec4{0.0f, 4.0f, 1.0f, 1.0f};
@@ -305,10 +303,6 @@ public:
 
         // Destroy the vertex buffer (not strictly needed in this case)
         vertexBuffer.destroy();
-
-        // Destroy the uniform buffers (not strictly needed in this case)
-        lightingUniformBuffer.destroy();
-        transformUniformBuffer.destroy();
     }
 
     void recordStaticCommands()
@@ -337,7 +331,6 @@ public:
 
         // Bind state required for drawing the mesh
         cmdbuf.bindShaders(DkStageFlag_GraphicsMask, { vertexShader, fragmentShader });
-        cmdbuf.bindUniformBuffer(DkStage_Vertex, 0, transformUniformBuffer.getGpuAddr(), transformUniformBuffer.getSize());
         cmdbuf.bindRasterizerState(rasterizerState);
         cmdbuf.bindColorState(colorState);
         cmdbuf.bindColorWriteState(colorWriteState);
@@ -380,7 +373,6 @@ public:
         cmdbuf.setViewports(0, viewport);
         cmdbuf.setScissors(0, scissor);
         cmdbuf.bindShaders(DkStageFlag_GraphicsMask, { compositionVertexShader, compositionFragmentShader });
-        cmdbuf.bindUniformBuffer(DkStage_Fragment, 0, lightingUniformBuffer.getGpuAddr(), lightingUniformBuffer.getSize());
         cmdbuf.bindTextures(DkStage_Fragment, 0, {
             dkMakeTextureHandle(0, 0),
             dkMakeTextureHandle(1, 0),
@@ -409,18 +401,23 @@ public:
 
     void render()
     {
+        // Measure the time spent submitting this frame (only when running a benchmark)
+        CBenchmark::SubmitScope submitScope;
+
         // Begin generating the dynamic command list, for commands that need to be sent only this frame specifically
         dynmem.begin(dyncmd);
 
-        // Update the transformation uniform buffer with the new state (this data gets inlined in the command list)
-        dyncmd.pushConstants(
-            transformUniformBuffer.getGpuAddr(), transformUniformBuffer.getSize(),
-            0, sizeof(transformState), &transformState);
+        // Begin using the uniform ring for this frame
+        uniforms.begin(dyncmd);
 
-        // Update the lighting uniform buffer with the new state
-        dyncmd.pushConstants(
-            lightingUniformBuffer.getGpuAddr(), lightingUniformBuffer.getSize(),
-            0, sizeof(lightingState), &lightingState);
+        // Write the transformation uniform buffer for this frame (this data is *not* inlined in the command list)
+        // and bind it; the uniform buffer bindings persist across all the command lists that follow
+        auto transformUniformBuffer = uniforms.push(transformState);
+        dyncmd.bindUniformBuffer(DkStage_Vertex, 0, transformUniformBuffer.gpuAddr, transformUniformBuffer.size);
+
+        // Write and bind the lighting uniform buffer for this frame
+        auto lightingUniformBuffer = uniforms.push(lightingState);
+        dyncmd.bindUniformBuffer(DkStage_Fragment, 0, lightingUniformBuffer.gpuAddr, lightingUniformBuffer.size);
 
         // Finish off the dynamic command list (which also submits it to the queue)
         queue.submitCommands(dynmem.end(dyncmd));
@@ -437,6 +434,9 @@ public:
         // Submit the command list used for performing the composition
         queue.submitCommands(composition_cmdlist);
 
+        // Signal the fence guarding this frame's uniform data, now that all commands using it have been submitted
+        uniforms.end(queue);
+
         // Now that we are done rendering, present it to the screen (this also flushes the queue)
         queue.presentImage(swapchain, slot);
     }
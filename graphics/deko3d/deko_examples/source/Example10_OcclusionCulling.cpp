@@ -0,0 +1,506 @@
+/*
+** deko3d Example 10: Occlusion Culling (Hierarchical Depth Buffer)
+** This example shows how to skip the drawing of hidden geometry in a dense scene, entirely on the GPU.
+** New concepts in this example:
+** - Using per-instance vertex attributes together with the base instance of a draw
+** - Issuing indirect draws whose parameters are written by a compute shader
+** - Building a depth pyramid (Hi-Z) out of the depth buffer with compute shaders
+** - Testing object bounding boxes against the view frustum and the depth pyramid (see CHiZCuller)
+** - Recording a large static command list once per frame in flight, and patching its uniforms (see CStaticCmdList)
+** Press A to toggle the occlusion test; the number of visible objects is printed to stdout.
+*/
+
+// Sample Framework headers
+#include "SampleFramework/CApplication.h"
+#include "SampleFramework/CMemPool.h"
+#include "SampleFramework/CShader.h"
+#include "SampleFramework/CCmdMemRing.h"
+#include "SampleFramework/CHiZCuller.h"
+#include "SampleFramework/CStaticCmdList.h"
+
+// C++ standard library headers
+#include <array>
+#include <optional>
+
+// GLM headers
+#define GLM_FORCE_DEFAULT_ALIGNED_GENTYPES // Enforces GLSL std140/std430 alignment rules for glm types
+#define GLM_FORCE_INTRINSICS               // Enables usage of SIMD CPU instructions (requiring the above as well)
+#include <glm/vec3.hpp>
+#include <glm/vec4.hpp>
+#include <glm/mat4x4.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/type_ptr.hpp>
+
+namespace
+{
+    struct Vertex
+    {
+        float position[3];
+        float normal[3];
+    };
+
+    struct Instance
+    {
+        float position[4];
+        float scale[4]; // half extents of the box
+        float color[4];
+    };
+
+    constexpr std::array VertexAttribState =
+    {
+        DkVtxAttribState{ 0, 0, offsetof(Vertex, position),   DkVtxAttribSize_3x32, DkVtxAttribType_Float, 0 },
+        DkVtxAttribState{ 0, 0, offsetof(Vertex, normal),     DkVtxAttribSize_3x32, DkVtxAttribType_Float, 0 },
+        DkVtxAttribState{ 1, 0, offsetof(Instance, position), DkVtxAttribSize_4x32, DkVtxAttribType_Float, 0 },
+        DkVtxAttribState{ 1, 0, offsetof(Instance, scale),    DkVtxAttribSize_4x32, DkVtxAttribType_Float, 0 },
+        DkVtxAttribState{ 1, 0, offsetof(Instance, color),    DkVtxAttribSize_4x32, DkVtxAttribType_Float, 0 },
+    };
+
+    constexpr std::array VertexBufferState =
+    {
+        DkVtxBufferState{ sizeof(Vertex),   0 },
+        DkVtxBufferState{ sizeof(Instance), 1 }, // advances once per instance
+    };
+
+    constexpr std::array CubeVertexData =
+    {
+        // +X face
+        Vertex{ { +1.0f, +1.0f, +1.0f }, { +1.0f, 0.0f, 0.0f } },
+        Vertex{ { +1.0f, -1.0f, +1.0f }, { +1.0f, 0.0f, 0.0f } },
+        Vertex{ { +1.0f, -1.0f, -1.0f }, { +1.0f, 0.0f, 0.0f } },
+        Vertex{ { +1.0f, +1.0f, -1.0f }, { +1.0f, 0.0f, 0.0f } },
+
+        // -X face
+        Vertex{ { -1.0f, +1.0f, -1.0f }, { -1.0f, 0.0f, 0.0f } },
+        Vertex{ { -1.0f, -1.0f, -1.0f }, { -1.0f, 0.0f, 0.0f } },
+        Vertex{ { -1.0f, -1.0f, +1.0f }, { -1.0f, 0.0f, 0.0f } },
+        Vertex{ { -1.0f, +1.0f, +1.0f }, { -1.0f, 0.0f, 0.0f } },
+
+        // +Y face
+        Vertex{ { -1.0f, +1.0f, -1.0f }, { 0.0f, +1.0f, 0.0f } },
+        Vertex{ { -1.0f, +1.0f, +1.0f }, { 0.0f, +1.0f, 0.0f } },
+        Vertex{ { +1.0f, +1.0f, +1.0f }, { 0.0f, +1.0f, 0.0f } },
+        Vertex{ { +1.0f, +1.0f, -1.0f }, { 0.0f, +1.0f, 0.0f } },
+
+        // -Y face
+        Vertex{ { -1.0f, -1.0f, +1.0f }, { 0.0f, -1.0f, 0.0f } },
+        Vertex{ { -1.0f, -1.0f, -1.0f }, { 0.0f, -1.0f, 0.0f } },
+        Vertex{ { +1.0f, -1.0f, -1.0f }, { 0.0f, -1.0f, 0.0f } },
+        Vertex{ { +1.0f, -1.0f, +1.0f }, { 0.0f, -1.0f, 0.0f } },
+
+        // +Z face
+        Vertex{ { -1.0f, +1.0f, +1.0f }, { 0.0f, 0.0f, +1.0f } },
+        Vertex{ { -1.0f, -1.0f, +1.0f }, { 0.0f, 0.0f, +1.0f } },
+        Vertex{ { +1.0f, -1.0f, +1.0f }, { 0.0f, 0.0f, +1.0f } },
+        Vertex{ { +1.0f, +1.0f, +1.0f }, { 0.0f, 0.0f, +1.0f } },
+
+        // -Z face
+        Vertex{ { +1.0f, +1.0f, -1.0f }, { 0.0f, 0.0f, -1.0f } },
+        Vertex{ { +1.0f, -1.0f, -1.0f }, { 0.0f, 0.0f, -1.0f } },
+        Vertex{ { -1.0f, -1.0f, -1.0f }, { 0.0f, 0.0f, -1.0f } },
+        Vertex{ { -1.0f, +1.0f, -1.0f }, { 0.0f, 0.0f, -1.0f } },
+    };
+
+    // Two triangles per face
+    constexpr std::array<u16, 36> CubeIndexData =
+    {
+         0,  1,  2,  0,  2,  3,
+         4,  5,  6,  4,  6,  7,
+         8,  9, 10,  8, 10, 11,
+        12, 13, 14, 12, 14, 15,
+        16, 17, 18, 16, 18, 19,
+        20, 21, 22, 20, 22, 23,
+    };
+
+    struct Transformation
+    {
+        glm::mat4 mdlvMtx;
+        glm::mat4 projMtx;
+    };
+
+    inline float fractf(float x)
+    {
+        return x - floorf(x);
+    }
+
+    // Small deterministic pseudo-random generator, so that the scene is the same on every run
+    inline float randf(uint32_t& state)
+    {
+        state = state * 1664525U + 1013904223U;
+        return (state >> 8) * (1.0f / 16777216.0f);
+    }
+}
+
+class CExample10 final : public CApplication
+{
+    static constexpr unsigned NumFramebuffers = 2;
+    static constexpr unsigned StaticCmdSize = 0x10000;
+    static constexpr unsigned RenderCmdSize = 0x40000;
+    static constexpr unsigned DynamicCmdSize = 0x10000;
+    static constexpr unsigned GridSize = 32;
+    static constexpr unsigned NumWalls = 4;
+    static constexpr unsigned NumObjects = 1 + NumWalls + GridSize*GridSize; // ground + walls + pillars
+    static constexpr unsigned StatsInterval = 60;
+
+    PadState pad;
+
+    dk::UniqueDevice device;
+    dk::UniqueQueue queue;
+
+    std::optional<CMemPool> pool_images;
+    std::optional<CMemPool> pool_code;
+    std::optional<CMemPool> pool_data;
+
+    dk::UniqueCmdBuf cmdbuf;
+    dk::UniqueCmdBuf dyncmd;
+    CCmdMemRing<NumFramebuffers> dynmem;
+
+    CShader vertexShader;
+    CShader fragmentShader;
+
+    CHiZCuller culler;
+
+    CStaticCmdList<NumFramebuffers> renderList;
+    CStaticCmdList<NumFramebuffers>::SlotId transformSlot;
+
+    Transformation transformState;
+
+    CMemPool::Handle vertexBuffer;
+    CMemPool::Handle indexBuffer;
+    CMemPool::Handle instanceBuffer;
+
+    uint32_t framebufferWidth;
+    uint32_t framebufferHeight;
+
+    CMemPool::Handle depthBuffer_mem;
+    CMemPool::Handle framebuffers_mem[NumFramebuffers];
+
+    dk::Image depthBuffer;
+    dk::Image framebuffers[NumFramebuffers];
+    DkCmdList framebuffer_cmdlists[NumFramebuffers];
+    dk::UniqueSwapchain swapchain;
+
+    DkCmdList cull_cmdlist;
+
+    unsigned frameCounter;
+
+public:
+    CExample10() : frameCounter{}
+    {
+        // Create the deko3d device
+        device = dk::DeviceMaker{}.create();
+
+        // Create the main queue (compute is needed for the culler)
+        queue = dk::QueueMaker{device}.setFlags(DkQueueFlags_Graphics | DkQueueFlags_Compute).create();
+
+        // Create the memory pools
+        pool_images.emplace(device, DkMemBlockFlags_GpuCached | DkMemBlockFlags_Image, 32*1024*1024);
+        pool_code.emplace(device, DkMemBlockFlags_CpuUncached | DkMemBlockFlags_GpuCached | DkMemBlockFlags_Code, 128*1024);
+        pool_data.emplace(device, DkMemBlockFlags_CpuUncached | DkMemBlockFlags_GpuCached, 1*1024*1024);
+
+        // Create the static command buffer and feed it freshly allocated memory
+        cmdbuf = dk::CmdBufMaker{device}.create();
+        CMemPool::Handle cmdmem = pool_data->allocate(StaticCmdSize);
+        cmdbuf.addMemory(cmdmem.getMemBlock(), cmdmem.getOffset(), cmdmem.getSize());
+
+        // Create the dynamic command buffer and allocate memory for it
+        dyncmd = dk::CmdBufMaker{device}.create();
+        dynmem.allocate(*pool_data, DynamicCmdSize);
+
+        // Load the shaders
+        vertexShader.load(*pool_code, "romfs:/shaders/instance_transform_vsh.dksh");
+        fragmentShader.load(*pool_code, "romfs:/shaders/color_fsh.dksh");
+
+        // Initialize the culler
+        culler.initialize(device, *pool_code, *pool_data, NumObjects);
+
+        // Create the main rendering command list, which holds the transformation uniform buffer in a slot
+        transformSlot = renderList.addSlot("transform", sizeof(transformState));
+        renderList.allocate(device, *pool_data, RenderCmdSize);
+
+        // Load the vertex and index buffers
+        vertexBuffer = pool_data->allocate(sizeof(CubeVertexData), alignof(Vertex));
+        memcpy(vertexBuffer.getCpuAddr(), CubeVertexData.data(), vertexBuffer.getSize());
+        indexBuffer = pool_data->allocate(sizeof(CubeIndexData), alignof(u16));
+        memcpy(indexBuffer.getCpuAddr(), CubeIndexData.data(), indexBuffer.getSize());
+
+        // Generate the scene
+        instanceBuffer = pool_data->allocate(NumObjects*sizeof(Instance), alignof(Instance));
+        generateScene();
+
+        // Initialize gamepad
+        padConfigureInput(1, HidNpadStyleSet_NpadStandard);
+        padInitializeDefault(&pad);
+    }
+
+    ~CExample10()
+    {
+        // Destroy the framebuffer resources
+        destroyFramebufferResources();
+
+        // Destroy the scene buffers (not strictly needed in this case)
+        instanceBuffer.destroy();
+        indexBuffer.destroy();
+        vertexBuffer.destroy();
+    }
+
+    void addObject(unsigned id, glm::vec3 const& center, glm::vec3 const& halfExtents, glm::vec3 const& color)
+    {
+        // Per-instance data read by the vertex shader
+        Instance& inst = ((Instance*)instanceBuffer.getCpuAddr())[id];
+        inst = Instance{
+            { center.x, center.y, center.z, 1.0f },
+            { halfExtents.x, halfExtents.y, halfExtents.z, 1.0f },
+            { color.r, color.g, color.b, 1.0f },
+        };
+
+        // Bounding box and draw parameters used by the culler; each object is
+        // drawn as a single instance, using the base instance to select its data
+        glm::vec3 aabbMin = center - halfExtents;
+        glm::vec3 aabbMax = center + halfExtents;
+        culler.setObject(id, glm::value_ptr(aabbMin), glm::value_ptr(aabbMax),
+            DkDrawIndexedIndirectData{ uint32_t(CubeIndexData.size()), 1, 0, 0, id });
+    }
+
+    void generateScene()
+    {
+        unsigned id = 0;
+
+        // Ground
+        addObject(id++, glm::vec3{0.0f, -0.05f, 0.0f}, glm::vec3{20.0f, 0.05f, 20.0f}, glm::vec3{0.3f, 0.3f, 0.3f});
+
+        // Walls arranged in a # shape, which hide most of the pillars from the camera
+        for (unsigned i = 0; i < NumWalls; i ++)
+        {
+            float offset = (i & 1) ? 6.0f : -6.0f;
+            glm::vec3 center = (i & 2) ? glm::vec3{offset, 1.5f, 0.0f} : glm::vec3{0.0f, 1.5f, offset};
+            glm::vec3 halfExtents = (i & 2) ? glm::vec3{0.1f, 1.5f, 14.0f} : glm::vec3{14.0f, 1.5f, 0.1f};
+            addObject(id++, center, halfExtents, glm::vec3{0.6f, 0.5f, 0.4f});
+        }
+
+        // Grid of pillars of random height and color
+        uint32_t seed = 1;
+        for (unsigned z = 0; z < GridSize; z ++)
+        {
+            for (unsigned x = 0; x < GridSize; x ++)
+            {
+                float height = 0.3f + 1.7f*randf(seed);
+                glm::vec3 center{float(x) - GridSize/2 + 0.5f, height/2, float(z) - GridSize/2 + 0.5f};
+                glm::vec3 color{0.2f + 0.8f*randf(seed), 0.2f + 0.8f*randf(seed), 0.2f + 0.8f*randf(seed)};
+                addObject(id++, center, glm::vec3{0.2f, height/2, 0.2f}, color);
+            }
+        }
+    }
+
+    void createFramebufferResources()
+    {
+        // Create layout for the depth buffer (needs to be sampled by the culler)
+        dk::ImageLayout layout_depthbuffer;
+        dk::ImageLayoutMaker{device}
+            .setFlags(DkImageFlags_UsageRender | DkImageFlags_HwCompression)
+            .setFormat(DkImageFormat_Z32F)
+            .setDimensions(framebufferWidth, framebufferHeight)
+            .initialize(layout_depthbuffer);
+
+        // Create the depth buffer
+        depthBuffer_mem = pool_images->allocate(layout_depthbuffer.getSize(), layout_depthbuffer.getAlignment());
+        depthBuffer.initialize(layout_depthbuffer, depthBuffer_mem.getMemBlock(), depthBuffer_mem.getOffset());
+
+        // Create the depth pyramid
+        culler.createPyramid(*pool_images, queue, depthBuffer, framebufferWidth, framebufferHeight);
+
+        // Create layout for the framebuffers
+        dk::ImageLayout layout_framebuffer;
+        dk::ImageLayoutMaker{device}
+            .setFlags(DkImageFlags_UsageRender | DkImageFlags_UsagePresent | DkImageFlags_HwCompression)
+            .setFormat(DkImageFormat_RGBA8_Unorm)
+            .setDimensions(framebufferWidth, framebufferHeight)
+            .initialize(layout_framebuffer);
+
+        // Create the framebuffers
+        std::array<DkImage const*, NumFramebuffers> fb_array;
+        uint64_t fb_size  = layout_framebuffer.getSize();
+        uint32_t fb_align = layout_framebuffer.getAlignment();
+        for (unsigned i = 0; i < NumFramebuffers; i ++)
+        {
+            // Allocate a framebuffer
+            framebuffers_mem[i] = pool_images->allocate(fb_size, fb_align);
+            framebuffers[i].initialize(layout_framebuffer, framebuffers_mem[i].getMemBlock(), framebuffers_mem[i].getOffset());
+
+            // Generate a command list that binds it
+            dk::ImageView colorTarget{ framebuffers[i] }, depthTarget{ depthBuffer };
+            cmdbuf.bindRenderTargets(&colorTarget, &depthTarget);
+            framebuffer_cmdlists[i] = cmdbuf.finishList();
+
+            // Fill in the array for use later by the swapchain creation code
+            fb_array[i] = &framebuffers[i];
+        }
+
+        // Create the swapchain using the framebuffers
+        swapchain = dk::SwapchainMaker{device, nwindowGetDefault(), fb_array}.create();
+
+        // Generate the static command lists
+        recordStaticCommands();
+
+        // Initialize the projection matrix
+        transformState.projMtx = glm::perspectiveRH_ZO(
+            glm::radians(40.0f),
+            float(framebufferWidth)/float(framebufferHeight),
+            0.1f, 100.0f);
+    }
+
+    void destroyFramebufferResources()
+    {
+        // Return early if we have nothing to destroy
+        if (!swapchain) return;
+
+        // Make sure the queue is idle before destroying anything
+        queue.waitIdle();
+
+        // Clear the static cmdbuf, destroying the static cmdlists in the process
+        cmdbuf.clear();
+
+        // Destroy the swapchain
+        swapchain.destroy();
+
+        // Destroy the framebuffers
+        for (unsigned i = 0; i < NumFramebuffers; i ++)
+            framebuffers_mem[i].destroy();
+
+        // Destroy the depth pyramid
+        culler.destroyPyramid();
+
+        // Destroy the depth buffer
+        depthBuffer_mem.destroy();
+    }
+
+    void recordStaticCommands()
+    {
+        // Run the culling job, which fills in the instance counts of the indirect draws
+        culler.recordCull(cmdbuf, NumObjects);
+        cull_cmdlist = cmdbuf.finishList();
+
+        // Record the main rendering command list, once per frame in flight
+        renderList.record([this](dk::CmdBuf cmdlist, unsigned slice)
+        {
+            // Initialize state structs with deko3d defaults
+            dk::RasterizerState rasterizerState;
+            dk::ColorState colorState;
+            dk::ColorWriteState colorWriteState;
+            dk::DepthStencilState depthStencilState;
+
+            // Configure viewport and scissor
+            cmdlist.setViewports(0, { { 0.0f, 0.0f, (float)framebufferWidth, (float)framebufferHeight, 0.0f, 1.0f } });
+            cmdlist.setScissors(0, { { 0, 0, framebufferWidth, framebufferHeight } });
+
+            // Clear the color and depth buffers
+            cmdlist.clearColor(0, DkColorMask_RGBA, 0.4f, 0.6f, 0.8f, 1.0f);
+            cmdlist.clearDepthStencil(true, 1.0f, 0xFF, 0);
+
+            // Bind state required for drawing the objects (using this slice's copy of the transformation slot)
+            cmdlist.bindShaders(DkStageFlag_GraphicsMask, { vertexShader, fragmentShader });
+            cmdlist.bindUniformBuffer(DkStage_Vertex, 0, renderList.getSlotGpuAddr(slice, transformSlot), renderList.getSlotSize(transformSlot));
+            cmdlist.bindRasterizerState(rasterizerState);
+            cmdlist.bindColorState(colorState);
+            cmdlist.bindColorWriteState(colorWriteState);
+            cmdlist.bindDepthStencilState(depthStencilState);
+            cmdlist.bindVtxBuffer(0, vertexBuffer.getGpuAddr(), vertexBuffer.getSize());
+            cmdlist.bindVtxBuffer(1, instanceBuffer.getGpuAddr(), instanceBuffer.getSize());
+            cmdlist.bindVtxAttribState(VertexAttribState);
+            cmdlist.bindVtxBufferState(VertexBufferState);
+            cmdlist.bindIdxBuffer(DkIdxFormat_Uint16, indexBuffer.getGpuAddr());
+
+            // Draw every object; the ones that were culled have an instance count of zero
+            for (unsigned i = 0; i < NumObjects; i ++)
+                cmdlist.drawIndexedIndirect(DkPrimitive_Triangles, culler.getDrawCmdAddr(i));
+
+            // Build the depth pyramid for the next frame out of this frame's depth buffer
+            culler.recordBuild(cmdlist);
+
+            // Discard the depth buffer since we don't need it anymore
+            cmdlist.discardDepthStencil();
+        });
+    }
+
+    void render()
+    {
+        // Measure the time spent submitting this frame (only when running a benchmark)
+        CBenchmark::SubmitScope submitScope;
+
+        // Wait for the current copy of the main rendering command list to be available,
+        // and patch its transformation slot with the new state (no commands are generated for this)
+        renderList.begin();
+        renderList.patch(transformSlot, transformState);
+
+        // Begin generating the dynamic command list, for commands that need to be sent only this frame specifically
+        dynmem.begin(dyncmd);
+
+        // Update the culling parameters
+        glm::mat4 viewProjMtx = transformState.projMtx * transformState.mdlvMtx;
+        culler.update(dyncmd, glm::value_ptr(viewProjMtx));
+
+        // Finish off the dynamic command list, and submit it to the queue
+        queue.submitCommands(dynmem.end(dyncmd));
+
+        // Run the culling job
+        queue.submitCommands(cull_cmdlist);
+
+        // Acquire a framebuffer from the swapchain (and wait for it to be available)
+        int slot = queue.acquireImage(swapchain);
+
+        // Run the command list that attaches said framebuffer to the queue
+        queue.submitCommands(framebuffer_cmdlists[slot]);
+
+        // Run the main rendering command list
+        renderList.submit(queue);
+
+        // Now that we are done rendering, present it to the screen
+        queue.presentImage(swapchain, slot);
+    }
+
+    void onOperationMode(AppletOperationMode mode) override
+    {
+        // Destroy the framebuffer resources
+        destroyFramebufferResources();
+
+        // Choose framebuffer size
+        chooseFramebufferSize(framebufferWidth, framebufferHeight, mode);
+
+        // Recreate the framebuffers and its associated resources
+        createFramebufferResources();
+    }
+
+    bool onFrame(u64 ns) override
+    {
+        padUpdate(&pad);
+        u64 kDown = padGetButtonsDown(&pad);
+        if (kDown & HidNpadButton_Plus)
+            return false;
+        if (kDown & HidNpadButton_A)
+            culler.setOcclusionEnabled(!culler.isOcclusionEnabled());
+
+        float time = ns / 1000000000.0; // double precision division; followed by implicit cast to single precision
+        float tau = glm::two_pi<float>();
+
+        // Orbit the camera around the scene, close to the ground
+        float angle = fractf(time/32.0f) * tau;
+        glm::vec3 eye{24.0f*sinf(angle), 1.5f, 24.0f*cosf(angle)};
+        transformState.mdlvMtx = glm::lookAt(eye, glm::vec3{0.0f, 0.5f, 0.0f}, glm::vec3{0.0f, 1.0f, 0.0f});
+
+        render();
+
+        // Report the culling statistics every once in a while
+        if (++frameCounter == StatsInterval)
+        {
+            frameCounter = 0;
+            printf("Visible objects: %u/%u (occlusion test %s)\n", culler.getNumVisible(), NumObjects,
+                culler.isOcclusionEnabled() ? "on" : "off");
+        }
+        return true;
+    }
+};
+
+void Example10(void)
+{
+    CExample10 app;
+    app.run();
+}
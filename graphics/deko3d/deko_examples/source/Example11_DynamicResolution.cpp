@@ -0,0 +1,476 @@
+/*
+** deko3d Example 11: Dynamic Resolution
+** This example shows how to keep a steady frame rate by adjusting the rendering resolution on the fly.
+** New concepts in this example:
+** - Measuring GPU frame time with timestamp counters
+** - Rendering to a variable viewport inside fixed size render targets (no image is ever recreated)
+** - Upscaling the result to the framebuffer with a sharpening filter
+** - Controlling GPU load with an indirect draw whose instance count is patched every frame
+** See CDynamicResolution for the controller itself.
+** Press UP/DOWN to change the GPU load, A to toggle dynamic resolution; statistics are printed to stdout.
+*/
+
+// Sample Framework headers
+#include "SampleFramework/CApplication.h"
+#include "SampleFramework/CMemPool.h"
+#include "SampleFramework/CShader.h"
+#include "SampleFramework/CDescriptorSet.h"
+#include "SampleFramework/CStaticCmdList.h"
+#include "SampleFramework/CDynamicResolution.h"
+#include "SampleFramework/FileLoader.h"
+
+// C++ standard library headers
+#include <array>
+#include <optional>
+
+// GLM headers
+#define GLM_FORCE_DEFAULT_ALIGNED_GENTYPES // Enforces GLSL std140/std430 alignment rules for glm types
+#define GLM_FORCE_INTRINSICS               // Enables usage of SIMD CPU instructions (requiring the above as well)
+#include <glm/vec3.hpp>
+#include <glm/vec4.hpp>
+#include <glm/mat4x4.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+namespace
+{
+    struct Vertex
+    {
+        float position[3];
+        float normal[3];
+    };
+
+    constexpr std::array VertexAttribState =
+    {
+        DkVtxAttribState{ 0, 0, offsetof(Vertex, position), DkVtxAttribSize_3x32, DkVtxAttribType_Float, 0 },
+        DkVtxAttribState{ 0, 0, offsetof(Vertex, normal),   DkVtxAttribSize_3x32, DkVtxAttribType_Float, 0 },
+    };
+
+    constexpr std::array VertexBufferState =
+    {
+        DkVtxBufferState{ sizeof(Vertex), 0 },
+    };
+
+    struct Transformation
+    {
+        glm::mat4 mdlvMtx;
+        glm::mat4 projMtx;
+    };
+
+    struct Lighting
+    {
+        glm::vec4 lightPos; // if w=0 this is lightDir
+        glm::vec3 ambient;
+        glm::vec3 diffuse;
+        glm::vec4 specular; // w is shininess
+    };
+
+    inline float fractf(float x)
+    {
+        return x - floorf(x);
+    }
+}
+
+class CExample11 final : public CApplication
+{
+    static constexpr unsigned NumFramebuffers = 2;
+    static constexpr unsigned StaticCmdSize = 0x10000;
+    static constexpr unsigned RenderCmdSize = 0x1000;
+    static constexpr unsigned MaxImages = 1;
+    static constexpr unsigned MaxSamplers = 1;
+    static constexpr unsigned MaxLoad = 64;
+    static constexpr unsigned StatsInterval = 60;
+
+    PadState pad;
+
+    dk::UniqueDevice device;
+    dk::UniqueQueue queue;
+
+    std::optional<CMemPool> pool_images;
+    std::optional<CMemPool> pool_code;
+    std::optional<CMemPool> pool_data;
+
+    dk::UniqueCmdBuf cmdbuf;
+
+    CDescriptorSet<MaxImages> imageDescriptorSet;
+    CDescriptorSet<MaxSamplers> samplerDescriptorSet;
+
+    CShader vertexShader;
+    CShader fragmentShader;
+
+    CStaticCmdList<NumFramebuffers> renderList;
+    CStaticCmdList<NumFramebuffers>::SlotId transformSlot, drawSlot;
+
+    CDynamicResolution<NumFramebuffers> dynres;
+
+    Transformation transformState;
+
+    Lighting lightingState;
+    CMemPool::Handle lightingUniformBuffer;
+
+    CMemPool::Handle vertexBuffer;
+    CMemPool::Handle indexBuffer;
+
+    uint32_t framebufferWidth;
+    uint32_t framebufferHeight;
+
+    CMemPool::Handle colorBuffer_mem;
+    CMemPool::Handle depthBuffer_mem;
+    CMemPool::Handle framebuffers_mem[NumFramebuffers];
+
+    dk::Image colorBuffer;
+    dk::Image depthBuffer;
+    dk::Image framebuffers[NumFramebuffers];
+    DkCmdList framebuffer_cmdlists[NumFramebuffers];
+    dk::UniqueSwapchain swapchain;
+
+    DkCmdList upscale_cmdlist;
+
+    unsigned load;
+    unsigned frameCounter;
+
+public:
+    CExample11() : load{8}, frameCounter{}
+    {
+        // Create the deko3d device
+        device = dk::DeviceMaker{}.create();
+
+        // Create the main queue
+        queue = dk::QueueMaker{device}.setFlags(DkQueueFlags_Graphics).create();
+
+        // Create the memory pools
+        pool_images.emplace(device, DkMemBlockFlags_GpuCached | DkMemBlockFlags_Image, 32*1024*1024);
+        pool_code.emplace(device, DkMemBlockFlags_CpuUncached | DkMemBlockFlags_GpuCached | DkMemBlockFlags_Code, 128*1024);
+        pool_data.emplace(device, DkMemBlockFlags_CpuUncached | DkMemBlockFlags_GpuCached, 1*1024*1024);
+
+        // Create the static command buffer and feed it freshly allocated memory
+        cmdbuf = dk::CmdBufMaker{device}.create();
+        CMemPool::Handle cmdmem = pool_data->allocate(StaticCmdSize);
+        cmdbuf.addMemory(cmdmem.getMemBlock(), cmdmem.getOffset(), cmdmem.getSize());
+
+        // Create the image and sampler descriptor sets
+        imageDescriptorSet.allocate(*pool_data);
+        samplerDescriptorSet.allocate(*pool_data);
+
+        // Load the shaders
+        vertexShader.load(*pool_code, "romfs:/shaders/transform_normal_vsh.dksh");
+        fragmentShader.load(*pool_code, "romfs:/shaders/basic_lighting_fsh.dksh");
+
+        // Initialize the dynamic resolution controller: aim for 60 fps, leaving some headroom
+        dynres.initialize(device, *pool_code, *pool_data);
+        dynres.setTargetFrameTime(15.0f);
+        dynres.setScaleBounds(0.5f, 1.0f);
+
+        // Create the scene command list, which holds the transformation uniform buffer
+        // and the parameters of the indirect draw in slots that are patched every frame
+        transformSlot = renderList.addSlot("transform", sizeof(transformState));
+        drawSlot = renderList.addSlot("draw", sizeof(DkDrawIndexedIndirectData));
+        renderList.allocate(device, *pool_data, RenderCmdSize);
+
+        // Create the lighting uniform buffer, and fill it in directly since it never changes
+        lightingUniformBuffer = pool_data->allocate(sizeof(lightingState), DK_UNIFORM_BUF_ALIGNMENT);
+        lightingState.lightPos = glm::vec4{0.0f, 4.0f, 1.0f, 1.0f};
+        lightingState.ambient = glm::vec3{0.046227f,0.028832f,0.003302f};
+        lightingState.diffuse = glm::vec3{0.564963f,0.367818f,0.051293f};
+        lightingState.specular = glm::vec4{24.0f*glm::vec3{0.394737f,0.308916f,0.134004f}, 64.0f};
+        memcpy(lightingUniformBuffer.getCpuAddr(), &lightingState, sizeof(lightingState));
+
+        // Load the teapot mesh
+        vertexBuffer = LoadFile(*pool_data, "romfs:/teapot-vtx.bin", alignof(Vertex));
+        indexBuffer = LoadFile(*pool_data, "romfs:/teapot-idx.bin", alignof(u16));
+
+        // Initialize gamepad
+        padConfigureInput(1, HidNpadStyleSet_NpadStandard);
+        padInitializeDefault(&pad);
+    }
+
+    ~CExample11()
+    {
+        // Destroy the framebuffer resources
+        destroyFramebufferResources();
+
+        // Destroy the index buffer (not strictly needed in this case)
+        indexBuffer.destroy();
+
+        // Destroy the vertex buffer (not strictly needed in this case)
+        vertexBuffer.destroy();
+
+        // Destroy the uniform buffer (not strictly needed in this case)
+        lightingUniformBuffer.destroy();
+    }
+
+    void createFramebufferResources()
+    {
+        // Create layout for the color buffer, which is sampled by the upscaling step. Like the
+        // depth buffer, it has the size of the framebuffer (i.e. the maximum resolution).
+        dk::ImageLayout layout_colorbuffer;
+        dk::ImageLayoutMaker{device}
+            .setFlags(DkImageFlags_UsageRender | DkImageFlags_HwCompression)
+            .setFormat(DkImageFormat_RGBA8_Unorm_sRGB)
+            .setDimensions(framebufferWidth, framebufferHeight)
+            .initialize(layout_colorbuffer);
+
+        // Create layout for the depth buffer
+        dk::ImageLayout layout_depthbuffer;
+        dk::ImageLayoutMaker{device}
+            .setFlags(DkImageFlags_UsageRender | DkImageFlags_HwCompression)
+            .setFormat(DkImageFormat_Z24S8)
+            .setDimensions(framebufferWidth, framebufferHeight)
+            .initialize(layout_depthbuffer);
+
+        // Create the color buffer
+        colorBuffer_mem = pool_images->allocate(layout_colorbuffer.getSize(), layout_colorbuffer.getAlignment());
+        colorBuffer.initialize(layout_colorbuffer, colorBuffer_mem.getMemBlock(), colorBuffer_mem.getOffset());
+
+        // Create the depth buffer
+        depthBuffer_mem = pool_images->allocate(layout_depthbuffer.getSize(), layout_depthbuffer.getAlignment());
+        depthBuffer.initialize(layout_depthbuffer, depthBuffer_mem.getMemBlock(), depthBuffer_mem.getOffset());
+
+        // Configure persistent state in the queue
+        {
+            // Upload the image descriptor
+            dk::ImageView colorView{colorBuffer};
+            dk::ImageDescriptor colorDescriptor;
+            colorDescriptor.initialize(colorView);
+            imageDescriptorSet.update(cmdbuf, 0, colorDescriptor);
+
+            // Configure a sampler for bilinear upscaling
+            dk::Sampler sampler;
+            sampler.setFilter(DkFilter_Linear, DkFilter_Linear);
+            sampler.setWrapMode(DkWrapMode_ClampToEdge, DkWrapMode_ClampToEdge, DkWrapMode_ClampToEdge);
+
+            // Upload the sampler descriptor
+            dk::SamplerDescriptor samplerDescriptor;
+            samplerDescriptor.initialize(sampler);
+            samplerDescriptorSet.update(cmdbuf, 0, samplerDescriptor);
+
+            // Bind the image and sampler descriptor sets
+            imageDescriptorSet.bindForImages(cmdbuf);
+            samplerDescriptorSet.bindForSamplers(cmdbuf);
+
+            // Submit the configuration commands to the queue
+            queue.submitCommands(cmdbuf.finishList());
+            queue.waitIdle();
+            cmdbuf.clear();
+        }
+
+        // Create layout for the framebuffers
+        dk::ImageLayout layout_framebuffer;
+        dk::ImageLayoutMaker{device}
+            .setFlags(DkImageFlags_UsageRender | DkImageFlags_UsagePresent)
+            .setFormat(DkImageFormat_RGBA8_Unorm_sRGB)
+            .setDimensions(framebufferWidth, framebufferHeight)
+            .initialize(layout_framebuffer);
+
+        // Create the framebuffers
+        std::array<DkImage const*, NumFramebuffers> fb_array;
+        uint64_t fb_size  = layout_framebuffer.getSize();
+        uint32_t fb_align = layout_framebuffer.getAlignment();
+        for (unsigned i = 0; i < NumFramebuffers; i ++)
+        {
+            // Allocate a framebuffer
+            framebuffers_mem[i] = pool_images->allocate(fb_size, fb_align);
+            framebuffers[i].initialize(layout_framebuffer, framebuffers_mem[i].getMemBlock(), framebuffers_mem[i].getOffset());
+
+            // Generate a command list that binds the framebuffer
+            dk::ImageView framebufferView { framebuffers[i] };
+            cmdbuf.bindRenderTargets(&framebufferView);
+            framebuffer_cmdlists[i] = cmdbuf.finishList();
+
+            // Fill in the array for use later by the swapchain creation code
+            fb_array[i] = &framebuffers[i];
+        }
+
+        // Create the swapchain using the framebuffers
+        swapchain = dk::SwapchainMaker{device, nwindowGetDefault(), fb_array}.create();
+
+        // The framebuffer size is the maximum resolution
+        dynres.setOutputSize(framebufferWidth, framebufferHeight);
+
+        // Generate the static command lists
+        recordStaticCommands();
+
+        // Initialize the projection matrix (the aspect ratio is the same at every resolution)
+        transformState.projMtx = glm::perspectiveRH_ZO(
+            glm::radians(40.0f),
+            float(framebufferWidth)/float(framebufferHeight),
+            0.01f, 1000.0f);
+    }
+
+    void destroyFramebufferResources()
+    {
+        // Return early if we have nothing to destroy
+        if (!swapchain) return;
+
+        // Make sure the queue is idle before destroying anything
+        queue.waitIdle();
+
+        // Clear the static cmdbuf, destroying the static cmdlists in the process
+        cmdbuf.clear();
+
+        // Destroy the swapchain
+        swapchain.destroy();
+
+        // Destroy the framebuffers
+        for (unsigned i = 0; i < NumFramebuffers; i ++)
+            framebuffers_mem[i].destroy();
+
+        // Destroy the depth buffer
+        depthBuffer_mem.destroy();
+
+        // Destroy the color buffer
+        colorBuffer_mem.destroy();
+    }
+
+    void recordStaticCommands()
+    {
+        // Record the scene command list, once per frame in flight. Note that it doesn't set
+        // the viewport and scissor, since those are chosen every frame by the controller.
+        renderList.record([this](dk::CmdBuf cmdlist, unsigned slice)
+        {
+            // Initialize state structs with deko3d defaults
+            dk::RasterizerState rasterizerState;
+            dk::ColorState colorState;
+            dk::ColorWriteState colorWriteState;
+            dk::DepthStencilState depthStencilState;
+
+            // Configure depth state: let every copy of the teapot pass, in order to generate GPU load
+            depthStencilState.setDepthCompareOp(DkCompareOp_Lequal);
+
+            // Bind color buffer and depth buffer
+            dk::ImageView colorTarget { colorBuffer }, depthTarget { depthBuffer };
+            cmdlist.bindRenderTargets(&colorTarget, &depthTarget);
+
+            // Clear the color and depth buffers
+            cmdlist.clearColor(0, DkColorMask_RGBA, 0.0f, 0.0f, 0.0f, 0.0f);
+            cmdlist.clearDepthStencil(true, 1.0f, 0xFF, 0);
+
+            // Bind state required for drawing the mesh
+            cmdlist.bindShaders(DkStageFlag_GraphicsMask, { vertexShader, fragmentShader });
+            cmdlist.bindUniformBuffer(DkStage_Vertex, 0, renderList.getSlotGpuAddr(slice, transformSlot), renderList.getSlotSize(transformSlot));
+            cmdlist.bindUniformBuffer(DkStage_Fragment, 0, lightingUniformBuffer.getGpuAddr(), lightingUniformBuffer.getSize());
+            cmdlist.bindRasterizerState(rasterizerState);
+            cmdlist.bindColorState(colorState);
+            cmdlist.bindColorWriteState(colorWriteState);
+            cmdlist.bindDepthStencilState(depthStencilState);
+            cmdlist.bindVtxBuffer(0, vertexBuffer.getGpuAddr(), vertexBuffer.getSize());
+            cmdlist.bindVtxAttribState(VertexAttribState);
+            cmdlist.bindVtxBufferState(VertexBufferState);
+            cmdlist.bindIdxBuffer(DkIdxFormat_Uint16, indexBuffer.getGpuAddr());
+
+            // Draw the mesh, as many times as the draw slot says
+            cmdlist.drawIndexedIndirect(DkPrimitive_Triangles, renderList.getSlotGpuAddr(slice, drawSlot));
+
+            // Fragment barrier, to make sure we finish previous work before discarding the depth buffer
+            cmdlist.barrier(DkBarrier_Fragments, 0);
+
+            // Discard the depth buffer since we don't need it anymore
+            cmdlist.discardDepthStencil();
+        });
+
+        // Record the command list that upscales the scene to the framebuffer
+        dynres.recordUpscale(cmdbuf, dkMakeTextureHandle(0, 0));
+        upscale_cmdlist = cmdbuf.finishList();
+    }
+
+    void render()
+    {
+        // Measure the time spent submitting this frame (only when running a benchmark)
+        CBenchmark::SubmitScope submitScope;
+
+        // Wait for the current copy of the scene command list to be available, and patch its slots
+        renderList.begin();
+        renderList.patch(transformSlot, transformState);
+        renderList.patch(drawSlot, DkDrawIndexedIndirectData{ indexBuffer.getSize() / uint32_t(sizeof(u16)), load, 0, 0, 0 });
+
+        // Choose the resolution for this frame, and start measuring the GPU time
+        dynres.begin(queue);
+
+        // Run the scene command list
+        renderList.submit(queue);
+
+        // Stop measuring while acquiring the framebuffer, since that may wait for the display
+        dynres.pause(queue);
+
+        // Acquire a framebuffer from the swapchain
+        int slot = queue.acquireImage(swapchain);
+
+        // Submit the command list that binds the correct framebuffer
+        queue.submitCommands(framebuffer_cmdlists[slot]);
+
+        // Measure the upscale too, as it also gets more expensive at higher resolutions
+        dynres.resume(queue);
+
+        // Submit the command list that upscales the scene to the framebuffer
+        queue.submitCommands(upscale_cmdlist);
+
+        // Stop measuring the GPU time
+        dynres.end(queue);
+
+        // Now that we are done rendering, present it to the screen (this also flushes the queue)
+        queue.presentImage(swapchain, slot);
+    }
+
+    void onOperationMode(AppletOperationMode mode) override
+    {
+        // Destroy the framebuffer resources
+        destroyFramebufferResources();
+
+        // Choose framebuffer size
+        chooseFramebufferSize(framebufferWidth, framebufferHeight, mode);
+
+        // Recreate the framebuffers and its associated resources
+        createFramebufferResources();
+    }
+
+    bool onFrame(u64 ns) override
+    {
+        padUpdate(&pad);
+        u64 kDown = padGetButtonsDown(&pad);
+        if (kDown & HidNpadButton_Plus)
+            return false;
+        if (kDown & HidNpadButton_A)
+        {
+            dynres.setEnabled(!dynres.isEnabled());
+            if (!dynres.isEnabled())
+                dynres.setScale(1.0f);
+        }
+        if ((kDown & HidNpadButton_AnyUp) && load < MaxLoad)
+            load ++;
+        if ((kDown & HidNpadButton_AnyDown) && load > 1)
+            load --;
+
+        float time = ns / 1000000000.0; // double precision division; followed by implicit cast to single precision
+        float tau = glm::two_pi<float>();
+
+        float period1 = fractf(time/8.0f);
+        float period2 = fractf(time/4.0f);
+
+        // Generate the model-view matrix for this frame
+        // Keep in mind that GLM transformation functions multiply to the right, so essentially we have:
+        //   mdlvMtx = Translate1 * RotateX * RotateY * Translate2
+        // This means that the Translate2 operation is applied first, then RotateY, and so on.
+        transformState.mdlvMtx = glm::mat4{1.0f};
+        transformState.mdlvMtx = glm::translate(transformState.mdlvMtx, glm::vec3{0.0f, 0.0f, -2.0f});
+        transformState.mdlvMtx = glm::rotate(transformState.mdlvMtx, sinf(period2 * tau) * tau / 8.0f, glm::vec3{1.0f, 0.0f, 0.0f});
+        transformState.mdlvMtx = glm::rotate(transformState.mdlvMtx, -period1 * tau, glm::vec3{0.0f, 1.0f, 0.0f});
+        transformState.mdlvMtx = glm::translate(transformState.mdlvMtx, glm::vec3{0.0f, -0.5f, 0.0f});
+
+        render();
+
+        // Report the controller state every once in a while
+        if (++frameCounter == StatsInterval)
+        {
+            frameCounter = 0;
+            printf("Load %u: GPU %.2f ms, %ux%u (scale %.3f, dynamic resolution %s)\n", load,
+                dynres.getLastGpuTime(), dynres.getRenderWidth(), dynres.getRenderHeight(), dynres.getScale(),
+                dynres.isEnabled() ? "on" : "off");
+        }
+        return true;
+    }
+};
+
+void Example11(void)
+{
+    CExample11 app;
+    app.run();
+}
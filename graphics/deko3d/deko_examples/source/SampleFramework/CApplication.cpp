@@ -22,6 +22,10 @@ void CApplication::run()
     u64 tick_saved = tick_ref;
     bool focused = appletGetFocusState() == AppletFocusState_InFocus;
 
+    // When running as part of a benchmark, the frame times are measured and the application
+    // is fed a scripted time instead of the real one; it is stopped after a fixed number of frames
+    CBenchmark* bench = CBenchmark::getActive();
+
     onOperationMode(appletGetOperationMode());
 
     for (;;)
@@ -63,7 +67,17 @@ void CApplication::run()
             }
         }
 
-        if (focused && !onFrame(armTicksToNs(armGetSystemTick() - tick_ref)))
+        if (!focused)
+            continue;
+
+        if (bench)
+        {
+            // A frame on which the application quits rendered nothing, so it isn't counted
+            bench->beginFrame();
+            if (!onFrame(bench->getScriptedTime()) || !bench->endFrame())
+                break;
+        }
+        else if (!onFrame(armTicksToNs(armGetSystemTick() - tick_ref)))
             break;
     }
 }
@@ -4,6 +4,7 @@
 */
 #pragma once
 #include "common.h"
+#include "CBenchmark.h"
 
 class CApplication
 {
@@ -0,0 +1,125 @@
+/*
+** Sample Framework for deko3d Applications
+**   CBenchmark.cpp: Headless benchmark runner collecting per-frame timing statistics
+*/
+#include "CBenchmark.h"
+
+#include <algorithm>
+
+CBenchmark* CBenchmark::s_active;
+
+CBenchmark::CBenchmark(ClockFunc clock, unsigned numFrames) :
+    m_clock{clock}, m_numFrames{numFrames ? numFrames : 1}, m_curFrame{}, m_frameStart{}, m_submitStart{}, m_submitTime{},
+    m_curName{}, m_cpuTimes{}, m_submitTimes{}, m_results{}, m_numResults{}
+{
+    m_cpuTimes.reserve(m_numFrames);
+    m_submitTimes.reserve(m_numFrames);
+}
+
+CBenchmark::~CBenchmark()
+{
+    if (s_active == this)
+        s_active = nullptr;
+}
+
+void CBenchmark::beginExample(const char* name)
+{
+    m_curName = name;
+    m_curFrame = 0;
+    m_cpuTimes.clear();
+    m_submitTimes.clear();
+    s_active = this;
+}
+
+void CBenchmark::endExample(uint64_t memPeak, uint64_t memBlocks)
+{
+    s_active = nullptr;
+    if (m_numResults == MaxResults)
+        return;
+
+    Result& res = m_results[m_numResults++];
+    res = Result{};
+    res.name = m_curName;
+    res.numFrames = m_cpuTimes.size();
+    res.memPeak = memPeak;
+    res.memBlocks = memBlocks;
+    if (!res.numFrames)
+        return;
+
+    uint64_t cpuTotal = 0, submitTotal = 0;
+    for (unsigned i = 0; i < res.numFrames; i ++)
+    {
+        cpuTotal += m_cpuTimes[i];
+        submitTotal += m_submitTimes[i];
+        res.submitMax = std::max(res.submitMax, m_submitTimes[i]);
+    }
+    res.cpuAvg = cpuTotal / res.numFrames;
+    res.submitAvg = submitTotal / res.numFrames;
+
+    // The frame times are no longer needed in order, so sort them in place for the percentiles
+    std::sort(m_cpuTimes.begin(), m_cpuTimes.end());
+    res.cpuMin = m_cpuTimes.front();
+    res.cpuMax = m_cpuTimes.back();
+    res.cpuP95 = m_cpuTimes[(res.numFrames - 1) * 95 / 100];
+}
+
+void CBenchmark::beginFrame()
+{
+    m_submitTime = 0;
+    m_frameStart = m_clock();
+}
+
+bool CBenchmark::endFrame()
+{
+    m_cpuTimes.push_back(m_clock() - m_frameStart);
+    m_submitTimes.push_back(m_submitTime);
+    return ++m_curFrame < m_numFrames;
+}
+
+void CBenchmark::beginSubmit()
+{
+    m_submitStart = m_clock();
+}
+
+void CBenchmark::endSubmit()
+{
+    m_submitTime += m_clock() - m_submitStart;
+}
+
+bool CBenchmark::writeCsv(FILE* f) const
+{
+    if (fprintf(f, "name,frames,cpu_min_us,cpu_avg_us,cpu_p95_us,cpu_max_us,submit_avg_us,submit_max_us,mem_peak_bytes,mem_blocks_bytes\n") < 0)
+        return false;
+
+    for (unsigned i = 0; i < m_numResults; i ++)
+    {
+        Result const& res = m_results[i];
+        if (fprintf(f, "\"%s\",%u,%.1f,%.1f,%.1f,%.1f,%.1f,%.1f,%llu,%llu\n", res.name, res.numFrames,
+            res.cpuMin/1000.0, res.cpuAvg/1000.0, res.cpuP95/1000.0, res.cpuMax/1000.0,
+            res.submitAvg/1000.0, res.submitMax/1000.0,
+            (unsigned long long)res.memPeak, (unsigned long long)res.memBlocks) < 0)
+            return false;
+    }
+    return true;
+}
+
+bool CBenchmark::writeJson(FILE* f) const
+{
+    if (fprintf(f, "{\n  \"frames\": %u,\n  \"results\": [", m_numFrames) < 0)
+        return false;
+
+    for (unsigned i = 0; i < m_numResults; i ++)
+    {
+        Result const& res = m_results[i];
+        if (fprintf(f, "%s\n    { \"name\": \"%s\", \"frames\": %u, "
+            "\"cpu_us\": { \"min\": %.1f, \"avg\": %.1f, \"p95\": %.1f, \"max\": %.1f }, "
+            "\"submit_us\": { \"avg\": %.1f, \"max\": %.1f }, "
+            "\"mem_bytes\": { \"peak\": %llu, \"blocks\": %llu } }",
+            i ? "," : "", res.name, res.numFrames,
+            res.cpuMin/1000.0, res.cpuAvg/1000.0, res.cpuP95/1000.0, res.cpuMax/1000.0,
+            res.submitAvg/1000.0, res.submitMax/1000.0,
+            (unsigned long long)res.memPeak, (unsigned long long)res.memBlocks) < 0)
+            return false;
+    }
+    return fprintf(f, "\n  ]\n}\n") >= 0;
+}
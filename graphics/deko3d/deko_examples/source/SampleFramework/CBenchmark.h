@@ -0,0 +1,95 @@
+/*
+** Sample Framework for deko3d Applications
+**   CBenchmark.h: Headless benchmark runner collecting per-frame timing statistics
+*/
+#pragma once
+// This class deliberately does not depend on libnx or deko3d (the clock is supplied by the
+// caller), so that it can also be built and exercised on a development machine.
+#include <stdint.h>
+#include <stdio.h>
+#include <vector>
+
+class CBenchmark
+{
+public:
+    using ClockFunc = uint64_t(*)(void); // must return a monotonic time in nanoseconds
+
+    static constexpr unsigned MaxResults = 32;
+    static constexpr uint64_t FrameTimeNs = 1000000000ULL / 60; // scripted time step
+
+    struct Result
+    {
+        const char* name;
+        unsigned numFrames;
+        uint64_t cpuMin, cpuAvg, cpuMax, cpuP95;
+        uint64_t submitAvg, submitMax;
+        uint64_t memPeak;
+        uint64_t memBlocks;
+    };
+
+    // Measures the time spent recording and submitting commands within a frame.
+    // Does nothing unless a benchmark is running.
+    class SubmitScope
+    {
+        CBenchmark* m_bench;
+    public:
+        SubmitScope() : m_bench{CBenchmark::getActive()}
+        {
+            if (m_bench) m_bench->beginSubmit();
+        }
+
+        ~SubmitScope()
+        {
+            if (m_bench) m_bench->endSubmit();
+        }
+
+        SubmitScope(const SubmitScope&) = delete;
+
+        SubmitScope& operator=(const SubmitScope&) = delete;
+    };
+
+private:
+    static CBenchmark* s_active;
+
+    ClockFunc m_clock;
+    unsigned m_numFrames;
+    unsigned m_curFrame;
+    uint64_t m_frameStart;
+    uint64_t m_submitStart;
+    uint64_t m_submitTime;
+    const char* m_curName;
+    std::vector<uint64_t> m_cpuTimes;
+    std::vector<uint64_t> m_submitTimes;
+    Result m_results[MaxResults];
+    unsigned m_numResults;
+
+public:
+    CBenchmark(ClockFunc clock, unsigned numFrames);
+    ~CBenchmark();
+
+    CBenchmark(const CBenchmark&) = delete;
+
+    CBenchmark& operator=(const CBenchmark&) = delete;
+
+    // Returns the benchmark that is currently running an example, if any
+    static CBenchmark* getActive() { return s_active; }
+
+    void beginExample(const char* name);
+    void endExample(uint64_t memPeak, uint64_t memBlocks);
+
+    // The time passed to the application for the current frame. It advances by a fixed step
+    // every frame, so that the animations (i.e. the camera) follow the same script every run.
+    uint64_t getScriptedTime() const { return m_curFrame * FrameTimeNs; }
+
+    void beginFrame();
+    bool endFrame(); // returns false once all frames have been run
+
+    void beginSubmit();
+    void endSubmit();
+
+    unsigned getNumResults() const { return m_numResults; }
+    Result const& getResult(unsigned id) const { return m_results[id]; }
+
+    bool writeCsv(FILE* f) const;
+    bool writeJson(FILE* f) const;
+};
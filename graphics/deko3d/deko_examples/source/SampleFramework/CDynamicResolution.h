@@ -0,0 +1,260 @@
+/*
+** Sample Framework for deko3d Applications
+**   CDynamicResolution.h: GPU frame time driven render resolution controller, with sharpening upscale
+*/
+#pragma once
+#include "common.h"
+#include "CMemPool.h"
+#include "CShader.h"
+#include "CCmdMemRing.h"
+
+#include <math.h>
+
+// The scene is rendered into images allocated at the full output size, and only the viewport
+// changes from frame to frame; so no image is ever recreated. Usage for every frame:
+// - begin(): picks the resolution for this frame, sets the viewport/scissor and starts the GPU timer
+// - (the application renders its scene)
+// - pause(): stops the GPU timer, before anything that may wait for the display such as acquiring
+//   a swapchain image, which would otherwise be counted as GPU time
+// - (the application acquires and binds the output framebuffer)
+// - resume(): starts the GPU timer again
+// - the command list recorded with recordUpscale() is submitted, stretching the scene to the output
+// - end(): stops the GPU timer
+// The GPU time of a frame (the sum of both intervals) is read back NumSlices frames later, once its
+// fence has been signalled.
+template <unsigned NumSlices>
+class CDynamicResolution
+{
+    static_assert(NumSlices > 0, "Need a non-zero number of slices...");
+    static constexpr unsigned DynamicCmdSize = 0x1000;
+    // Timestamps taken per frame: the start and end of the scene, then of the upscale
+    static constexpr unsigned NumReports = 4;
+
+    // Hysteresis: the resolution only changes when the frame time is off by more than this fraction
+    static constexpr float Deadband = 0.05f;
+    // Maximum change of the scale in a single frame (dropping quickly, raising slowly)
+    static constexpr float MaxStepDown = 0.10f;
+    static constexpr float MaxStepUp = 0.02f;
+
+    struct CounterReport
+    {
+        uint64_t value;
+        uint64_t timestamp;
+    };
+
+    // Must match the layout of the uniform block in upscale_fsh.glsl
+    struct UpscaleParams
+    {
+        float uvScale[2];
+        float uvMax[2];
+        float texelSize[2];
+        float outputSizeInv[2];
+        float sharpness;
+        float padding[3];
+    };
+
+    dk::UniqueCmdBuf m_cmdbuf;
+    CCmdMemRing<NumReports*NumSlices> m_cmdmem;
+    CMemPool::Handle m_reportmem;
+    CMemPool::Handle m_paramsBuffer;
+    CShader m_vertexShader;
+    CShader m_fragmentShader;
+    dk::Fence m_fences[NumSlices];
+    bool m_pending[NumSlices];
+    unsigned m_curSlice;
+
+    uint32_t m_outputWidth, m_outputHeight;
+    uint32_t m_renderWidth, m_renderHeight;
+    float m_scale, m_minScale, m_maxScale;
+    float m_targetTime, m_lastGpuTime;
+    float m_sharpness;
+    bool m_enabled;
+
+    void reportTimestamp(dk::Queue queue, unsigned id)
+    {
+        m_cmdmem.begin(m_cmdbuf);
+        m_cmdbuf.reportCounter(DkCounter_Timestamp, getReportGpuAddr(m_curSlice, id));
+        queue.submitCommands(m_cmdmem.end(m_cmdbuf));
+    }
+
+    CounterReport* getReports(unsigned slice) const
+    {
+        return (CounterReport*)m_reportmem.getCpuAddr() + NumReports*slice;
+    }
+
+    DkGpuAddr getReportGpuAddr(unsigned slice, unsigned id) const
+    {
+        return m_reportmem.getGpuAddr() + (NumReports*slice + id)*sizeof(CounterReport);
+    }
+
+    void adjust(float gpuTime)
+    {
+        m_lastGpuTime = gpuTime;
+        if (!m_enabled || gpuTime <= 0.0f)
+            return;
+
+        float ratio = m_targetTime / gpuTime;
+        if (ratio > 1.0f - Deadband && ratio < 1.0f + Deadband)
+            return;
+
+        // The cost of a frame is roughly proportional to its pixel count, i.e. to the square of the scale
+        float delta = m_scale*sqrtf(ratio) - m_scale;
+        if (delta < -MaxStepDown) delta = -MaxStepDown;
+        if (delta > MaxStepUp)    delta = MaxStepUp;
+        setScale(m_scale + delta);
+    }
+
+public:
+    CDynamicResolution() :
+        m_cmdbuf{}, m_cmdmem{}, m_reportmem{}, m_paramsBuffer{}, m_fences{}, m_pending{}, m_curSlice{},
+        m_outputWidth{}, m_outputHeight{}, m_renderWidth{}, m_renderHeight{},
+        m_scale{1.0f}, m_minScale{0.5f}, m_maxScale{1.0f}, m_targetTime{1000.0f/60.0f*0.9f}, m_lastGpuTime{},
+        m_sharpness{0.25f}, m_enabled{true} { }
+
+    CDynamicResolution(const CDynamicResolution&) = delete;
+
+    CDynamicResolution& operator=(const CDynamicResolution&) = delete;
+
+    ~CDynamicResolution()
+    {
+        m_paramsBuffer.destroy();
+        m_reportmem.destroy();
+    }
+
+    // Converts a GPU timestamp delta (in GPU ticks) to nanoseconds
+    static constexpr uint64_t ticksToNs(uint64_t ticks)
+    {
+        return ticks * 625 / 384;
+    }
+
+    bool initialize(dk::Device device, CMemPool& codePool, CMemPool& dataPool)
+    {
+        if (!m_vertexShader.load(codePool, "romfs:/shaders/composition_vsh.dksh") ||
+            !m_fragmentShader.load(codePool, "romfs:/shaders/upscale_fsh.dksh"))
+            return false;
+
+        m_cmdbuf = dk::CmdBufMaker{device}.create();
+        m_reportmem = dataPool.allocate(NumReports*NumSlices*sizeof(CounterReport), DK_UNIFORM_BUF_ALIGNMENT);
+        m_paramsBuffer = dataPool.allocate(sizeof(UpscaleParams), DK_UNIFORM_BUF_ALIGNMENT);
+        return m_cmdmem.allocate(dataPool, DynamicCmdSize) && m_reportmem && m_paramsBuffer;
+    }
+
+    // Sets the output (i.e. maximum) resolution, which is also the size of the scene render targets
+    void setOutputSize(uint32_t width, uint32_t height)
+    {
+        m_outputWidth = width;
+        m_outputHeight = height;
+        setScale(m_scale);
+    }
+
+    // Sets the GPU frame time (in milliseconds) the controller aims for
+    void setTargetFrameTime(float ms)
+    {
+        m_targetTime = ms;
+    }
+
+    void setScaleBounds(float minScale, float maxScale)
+    {
+        m_minScale = minScale;
+        m_maxScale = maxScale;
+        setScale(m_scale);
+    }
+
+    void setScale(float scale)
+    {
+        if (scale < m_minScale) scale = m_minScale;
+        if (scale > m_maxScale) scale = m_maxScale;
+        m_scale = scale;
+
+        // Keep the render size even, and never empty
+        m_renderWidth  = uint32_t(m_outputWidth  * scale) &~ 1U;
+        m_renderHeight = uint32_t(m_outputHeight * scale) &~ 1U;
+        if (m_renderWidth  < 2) m_renderWidth  = m_outputWidth  < 2 ? m_outputWidth  : 2;
+        if (m_renderHeight < 2) m_renderHeight = m_outputHeight < 2 ? m_outputHeight : 2;
+    }
+
+    void setSharpness(float sharpness)
+    {
+        m_sharpness = sharpness;
+    }
+
+    // When disabled, the scale is no longer adjusted automatically (but frame times are still measured)
+    void setEnabled(bool enable)
+    {
+        m_enabled = enable;
+    }
+
+    constexpr bool isEnabled() const { return m_enabled; }
+    constexpr float getScale() const { return m_scale; }
+    constexpr float getLastGpuTime() const { return m_lastGpuTime; }
+    constexpr uint32_t getRenderWidth() const { return m_renderWidth; }
+    constexpr uint32_t getRenderHeight() const { return m_renderHeight; }
+
+    // Records the commands that stretch the scene texture (bound in the given texture handle) over the
+    // whole output framebuffer. The output framebuffer must be bound as the only render target beforehand.
+    void recordUpscale(dk::CmdBuf cmdbuf, DkResHandle sceneTexture)
+    {
+        // Wait for the scene to be finished before sampling it
+        cmdbuf.barrier(DkBarrier_Fragments, DkInvalidateFlags_Image);
+
+        cmdbuf.setViewports(0, { { 0.0f, 0.0f, float(m_outputWidth), float(m_outputHeight), 0.0f, 1.0f } });
+        cmdbuf.setScissors(0, { { 0, 0, m_outputWidth, m_outputHeight } });
+        cmdbuf.bindShaders(DkStageFlag_GraphicsMask, { m_vertexShader, m_fragmentShader });
+        cmdbuf.bindUniformBuffer(DkStage_Fragment, 0, m_paramsBuffer.getGpuAddr(), m_paramsBuffer.getSize());
+        cmdbuf.bindTextures(DkStage_Fragment, 0, sceneTexture);
+        cmdbuf.bindRasterizerState(dk::RasterizerState{});
+        cmdbuf.bindColorState(dk::ColorState{});
+        cmdbuf.bindColorWriteState(dk::ColorWriteState{});
+        cmdbuf.bindVtxAttribState({});
+        cmdbuf.draw(DkPrimitive_Quads, 4, 1, 0, 0);
+    }
+
+    void begin(dk::Queue queue)
+    {
+        // Wait for the frame that last used this slice, and feed its GPU time to the controller
+        m_fences[m_curSlice].wait();
+        if (m_pending[m_curSlice])
+        {
+            CounterReport* reports = getReports(m_curSlice);
+            uint64_t ticks = (reports[1].timestamp - reports[0].timestamp) + (reports[3].timestamp - reports[2].timestamp);
+            adjust(ticksToNs(ticks) / 1000000.0f);
+            m_pending[m_curSlice] = false;
+        }
+
+        UpscaleParams params;
+        params.uvScale[0] = float(m_renderWidth) / float(m_outputWidth);
+        params.uvScale[1] = float(m_renderHeight) / float(m_outputHeight);
+        params.uvMax[0] = (m_renderWidth - 0.5f) / float(m_outputWidth);
+        params.uvMax[1] = (m_renderHeight - 0.5f) / float(m_outputHeight);
+        params.texelSize[0] = params.outputSizeInv[0] = 1.0f / float(m_outputWidth);
+        params.texelSize[1] = params.outputSizeInv[1] = 1.0f / float(m_outputHeight);
+        params.sharpness = m_renderWidth < m_outputWidth ? m_sharpness : 0.0f;
+
+        m_cmdmem.begin(m_cmdbuf);
+        m_cmdbuf.reportCounter(DkCounter_Timestamp, getReportGpuAddr(m_curSlice, 0));
+        m_cmdbuf.setViewports(0, { { 0.0f, 0.0f, float(m_renderWidth), float(m_renderHeight), 0.0f, 1.0f } });
+        m_cmdbuf.setScissors(0, { { 0, 0, m_renderWidth, m_renderHeight } });
+        m_cmdbuf.pushConstants(m_paramsBuffer.getGpuAddr(), m_paramsBuffer.getSize(), 0, sizeof(params), &params);
+        queue.submitCommands(m_cmdmem.end(m_cmdbuf));
+    }
+
+    void pause(dk::Queue queue)
+    {
+        reportTimestamp(queue, 1);
+    }
+
+    void resume(dk::Queue queue)
+    {
+        reportTimestamp(queue, 2);
+    }
+
+    void end(dk::Queue queue)
+    {
+        reportTimestamp(queue, 3);
+
+        // Flush, so that the reports are visible to the CPU by the time the fence is signalled
+        queue.signalFence(m_fences[m_curSlice], true);
+        m_pending[m_curSlice] = true;
+        m_curSlice = (m_curSlice + 1) % NumSlices;
+    }
+};
@@ -0,0 +1,213 @@
+/*
+** Sample Framework for deko3d Applications
+**   CHiZCuller.cpp: GPU occlusion culling using a hierarchical depth buffer (Hi-Z)
+*/
+#include "CHiZCuller.h"
+
+#include <array>
+
+namespace
+{
+    constexpr uint32_t ReduceGroupSize = 8; // must match local_size_x/y in hiz_copy.glsl and hiz_reduce.glsl
+    constexpr uint32_t CullGroupSize = 64;  // must match local_size_x in hiz_cull.glsl
+
+    constexpr uint32_t divRoundUp(uint32_t x, uint32_t y)
+    {
+        return (x + y - 1) / y;
+    }
+}
+
+bool CHiZCuller::initialize(dk::Device device, CMemPool& codePool, CMemPool& dataPool, uint32_t maxObjects)
+{
+    m_device = device;
+    m_dataPool = &dataPool;
+    m_maxObjects = maxObjects;
+
+    if (!m_copyShader.load(codePool, "romfs:/shaders/hiz_copy.dksh") ||
+        !m_reduceShader.load(codePool, "romfs:/shaders/hiz_reduce.dksh") ||
+        !m_cullShader.load(codePool, "romfs:/shaders/hiz_cull.dksh"))
+        return false;
+
+    if (!m_imageDescriptorSet.allocate(dataPool) || !m_samplerDescriptorSet.allocate(dataPool))
+        return false;
+
+    m_paramsBuffer = dataPool.allocate(sizeof(Params), DK_UNIFORM_BUF_ALIGNMENT);
+    m_boundsBuffer = dataPool.allocate(maxObjects*sizeof(Bounds), DK_UNIFORM_BUF_ALIGNMENT);
+    m_drawBuffer   = dataPool.allocate(maxObjects*sizeof(DkDrawIndexedIndirectData), DK_UNIFORM_BUF_ALIGNMENT);
+    m_statsBuffer  = dataPool.allocate(sizeof(uint32_t), DK_UNIFORM_BUF_ALIGNMENT);
+    if (!m_paramsBuffer || !m_boundsBuffer || !m_drawBuffer || !m_statsBuffer)
+        return false;
+
+    memset(m_drawBuffer.getCpuAddr(), 0, m_drawBuffer.getSize());
+    memset(m_statsBuffer.getCpuAddr(), 0, m_statsBuffer.getSize());
+    return true;
+}
+
+void CHiZCuller::setObject(uint32_t id, const float aabbMin[3], const float aabbMax[3], DkDrawIndexedIndirectData const& draw)
+{
+    if (id >= m_maxObjects)
+        return;
+
+    // Both buffers live in CPU-visible memory, so they are written directly
+    Bounds& bounds = ((Bounds*)m_boundsBuffer.getCpuAddr())[id];
+    for (unsigned i = 0; i < 3; i ++)
+    {
+        bounds.aabbMin[i] = aabbMin[i];
+        bounds.aabbMax[i] = aabbMax[i];
+    }
+    bounds.aabbMin[3] = bounds.aabbMax[3] = 1.0f;
+
+    // The instance count is overwritten by the culling job every frame
+    ((DkDrawIndexedIndirectData*)m_drawBuffer.getCpuAddr())[id] = draw;
+}
+
+bool CHiZCuller::createPyramid(CMemPool& imagePool, dk::Queue queue, dk::Image& depthBuffer, uint32_t width, uint32_t height)
+{
+    destroyPyramid();
+
+    // Full mip chain, down to 1x1
+    uint32_t numLevels = 1;
+    while (numLevels < MaxLevels && ((width >> numLevels) || (height >> numLevels)))
+        numLevels ++;
+
+    dk::ImageLayout layout_pyramid;
+    dk::ImageLayoutMaker{m_device}
+        .setFlags(DkImageFlags_UsageLoadStore)
+        .setFormat(DkImageFormat_R32_Float)
+        .setDimensions(width, height)
+        .setMipLevels(numLevels)
+        .initialize(layout_pyramid);
+
+    m_pyramid_mem = imagePool.allocate(layout_pyramid.getSize(), layout_pyramid.getAlignment());
+    if (!m_pyramid_mem)
+        return false;
+    m_pyramid.initialize(layout_pyramid, m_pyramid_mem.getMemBlock(), m_pyramid_mem.getOffset());
+
+    m_width = width;
+    m_height = height;
+    m_numLevels = numLevels;
+    m_historyValid = false;
+
+    dk::UniqueCmdBuf tempcmdbuf = dk::CmdBufMaker{m_device}.create();
+    CMemPool::Handle tempcmdmem = m_dataPool->allocate(DK_MEMBLOCK_ALIGNMENT);
+    tempcmdbuf.addMemory(tempcmdmem.getMemBlock(), tempcmdmem.getOffset(), tempcmdmem.getSize());
+
+    // Upload the image descriptors: the depth buffer and the whole pyramid are sampled,
+    // while each individual level is accessed through image load/store
+    std::array<dk::ImageDescriptor, MaxImages> descriptors;
+    dk::ImageView depthView{depthBuffer}, pyramidView{m_pyramid};
+    descriptors[DepthImageId].initialize(depthView);
+    descriptors[PyramidImageId].initialize(pyramidView);
+    for (uint32_t i = 0; i < numLevels; i ++)
+    {
+        dk::ImageView levelView{m_pyramid};
+        levelView.setMipLevels(i, 1);
+        descriptors[LevelImageId+i].initialize(levelView, true);
+    }
+    m_imageDescriptorSet.update(tempcmdbuf, 0, descriptors);
+
+    // Upload the sampler descriptor (only texelFetch is used, but a sampler is still needed)
+    dk::Sampler sampler;
+    sampler.setFilter(DkFilter_Nearest, DkFilter_Nearest, DkMipFilter_Nearest);
+    sampler.setWrapMode(DkWrapMode_ClampToEdge, DkWrapMode_ClampToEdge, DkWrapMode_ClampToEdge);
+    dk::SamplerDescriptor samplerDescriptor;
+    samplerDescriptor.initialize(sampler);
+    m_samplerDescriptorSet.update(tempcmdbuf, 0, samplerDescriptor);
+
+    // Flush the descriptor cache
+    tempcmdbuf.barrier(DkBarrier_None, DkInvalidateFlags_Descriptors);
+
+    queue.submitCommands(tempcmdbuf.finishList());
+    queue.waitIdle();
+
+    tempcmdmem.destroy();
+    return true;
+}
+
+void CHiZCuller::destroyPyramid()
+{
+    m_pyramid_mem.destroy();
+    m_width = m_height = m_numLevels = 0;
+    m_historyValid = false;
+}
+
+void CHiZCuller::update(dk::CmdBuf dyncmd, const float viewProjMtx[16])
+{
+    // The occlusion test needs the matrix that was used to render the depth buffer the pyramid was built from,
+    // which is the one from the previous frame. Objects are tested against it with a one frame latency.
+    memcpy(m_params.prevViewProjMtx, m_params.viewProjMtx, sizeof(m_params.viewProjMtx));
+    memcpy(m_params.viewProjMtx, viewProjMtx, sizeof(m_params.viewProjMtx));
+    m_params.pyramidSize[0] = float(m_width);
+    m_params.pyramidSize[1] = float(m_height);
+    m_params.numLevels = m_numLevels;
+    m_params.flags = Flag_FrustumTest;
+    if (m_occlusionEnabled && m_historyValid && m_numLevels)
+        m_params.flags |= Flag_OcclusionTest;
+
+    dyncmd.pushConstants(
+        m_paramsBuffer.getGpuAddr(), m_paramsBuffer.getSize(),
+        0, sizeof(m_params), &m_params);
+
+    // From now on, the pyramid built at the end of this frame is usable by the next one
+    m_historyValid = m_numLevels != 0;
+}
+
+void CHiZCuller::recordCull(dk::CmdBuf cmdbuf, uint32_t numObjects)
+{
+    if (numObjects > m_maxObjects)
+        numObjects = m_maxObjects;
+    m_params.numObjects = numObjects;
+
+    // Reset the visible object counter
+    static const uint32_t zero = 0;
+    cmdbuf.pushData(m_statsBuffer.getGpuAddr(), &zero, sizeof(zero));
+
+    // Bind state required for running the culling job
+    m_imageDescriptorSet.bindForImages(cmdbuf);
+    m_samplerDescriptorSet.bindForSamplers(cmdbuf);
+    cmdbuf.bindShaders(DkStageFlag_Compute, { m_cullShader });
+    cmdbuf.bindUniformBuffer(DkStage_Compute, 0, m_paramsBuffer.getGpuAddr(), m_paramsBuffer.getSize());
+    cmdbuf.bindStorageBuffer(DkStage_Compute, 0, m_boundsBuffer.getGpuAddr(), m_boundsBuffer.getSize());
+    cmdbuf.bindStorageBuffer(DkStage_Compute, 1, m_drawBuffer.getGpuAddr(), m_drawBuffer.getSize());
+    cmdbuf.bindStorageBuffer(DkStage_Compute, 2, m_statsBuffer.getGpuAddr(), m_statsBuffer.getSize());
+    cmdbuf.bindTextures(DkStage_Compute, 0, dkMakeTextureHandle(PyramidImageId, 0));
+
+    // Run the culling job
+    cmdbuf.dispatchCompute(divRoundUp(numObjects, CullGroupSize), 1, 1);
+
+    // Full barrier, since the indirect draw parameters are consumed by the command processor itself
+    cmdbuf.barrier(DkBarrier_Full, 0);
+}
+
+void CHiZCuller::recordBuild(dk::CmdBuf cmdbuf)
+{
+    if (!m_numLevels)
+        return;
+
+    // Wait for rendering to finish before reading the depth buffer
+    cmdbuf.barrier(DkBarrier_Fragments, DkInvalidateFlags_Image);
+
+    m_imageDescriptorSet.bindForImages(cmdbuf);
+    m_samplerDescriptorSet.bindForSamplers(cmdbuf);
+
+    // Copy the depth buffer into the first level of the pyramid
+    cmdbuf.bindShaders(DkStageFlag_Compute, { m_copyShader });
+    cmdbuf.bindTextures(DkStage_Compute, 0, dkMakeTextureHandle(DepthImageId, 0));
+    cmdbuf.bindImages(DkStage_Compute, 0, dkMakeImageHandle(LevelImageId));
+    cmdbuf.dispatchCompute(divRoundUp(m_width, ReduceGroupSize), divRoundUp(m_height, ReduceGroupSize), 1);
+
+    // Generate each following level by taking the maximum (i.e. farthest) depth of the previous one
+    cmdbuf.bindShaders(DkStageFlag_Compute, { m_reduceShader });
+    for (uint32_t i = 1; i < m_numLevels; i ++)
+    {
+        uint32_t levelWidth  = m_width  >> i; if (!levelWidth)  levelWidth  = 1;
+        uint32_t levelHeight = m_height >> i; if (!levelHeight) levelHeight = 1;
+
+        cmdbuf.barrier(DkBarrier_Primitives, DkInvalidateFlags_Image);
+        cmdbuf.bindImages(DkStage_Compute, 0, { dkMakeImageHandle(LevelImageId+i-1), dkMakeImageHandle(LevelImageId+i) });
+        cmdbuf.dispatchCompute(divRoundUp(levelWidth, ReduceGroupSize), divRoundUp(levelHeight, ReduceGroupSize), 1);
+    }
+
+    // Make the finished pyramid visible to the culling job
+    cmdbuf.barrier(DkBarrier_Primitives, DkInvalidateFlags_Image);
+}
@@ -0,0 +1,131 @@
+/*
+** Sample Framework for deko3d Applications
+**   CHiZCuller.h: GPU occlusion culling using a hierarchical depth buffer (Hi-Z)
+*/
+#pragma once
+#include "common.h"
+#include "CMemPool.h"
+#include "CShader.h"
+#include "CDescriptorSet.h"
+
+// Usage overview:
+// - Each culled object is described by a world space bounding box and the indexed draw that renders it.
+// - recordCull() runs a compute job that tests every box against the view frustum and against the depth
+//   pyramid built from the previous frame, writing the instance count of each object's indirect draw.
+// - The application draws each object with drawIndexedIndirect() using getDrawCmdAddr().
+// - recordBuild() turns the depth buffer of the current frame into the depth pyramid used by the next one.
+// Note that both recording functions bind the culler's own image/sampler descriptor sets.
+class CHiZCuller
+{
+public:
+    static constexpr unsigned MaxLevels = 16;
+
+    struct Bounds
+    {
+        float aabbMin[4]; // xyz: minimum corner in world space, w: unused
+        float aabbMax[4]; // xyz: maximum corner in world space, w: unused
+    };
+
+private:
+    static constexpr unsigned MaxImages = 2 + MaxLevels;
+    static constexpr unsigned MaxSamplers = 1;
+
+    // Image descriptor slots
+    static constexpr unsigned DepthImageId = 0;
+    static constexpr unsigned PyramidImageId = 1;
+    static constexpr unsigned LevelImageId = 2; // one per mip level, for load/store access
+
+    enum
+    {
+        Flag_FrustumTest   = 1U << 0,
+        Flag_OcclusionTest = 1U << 1,
+    };
+
+    // Must match the layout of the uniform block in hiz_cull.glsl
+    struct Params
+    {
+        float viewProjMtx[16];     // current frame, used for the frustum test
+        float prevViewProjMtx[16]; // previous frame, i.e. the one that produced the depth pyramid
+        float pyramidSize[2];
+        uint32_t numObjects;
+        uint32_t numLevels;
+        uint32_t flags;
+        uint32_t padding[3];
+    };
+
+    dk::Device m_device;
+    CMemPool* m_dataPool;
+
+    CShader m_copyShader;
+    CShader m_reduceShader;
+    CShader m_cullShader;
+
+    CDescriptorSet<MaxImages> m_imageDescriptorSet;
+    CDescriptorSet<MaxSamplers> m_samplerDescriptorSet;
+
+    uint32_t m_maxObjects;
+    CMemPool::Handle m_paramsBuffer;
+    CMemPool::Handle m_boundsBuffer;
+    CMemPool::Handle m_drawBuffer;
+    CMemPool::Handle m_statsBuffer;
+
+    CMemPool::Handle m_pyramid_mem;
+    dk::Image m_pyramid;
+    uint32_t m_width, m_height, m_numLevels;
+
+    Params m_params;
+    bool m_historyValid;
+    bool m_occlusionEnabled;
+
+public:
+    CHiZCuller() : m_device{}, m_dataPool{}, m_maxObjects{}, m_width{}, m_height{}, m_numLevels{}, m_params{}, m_historyValid{}, m_occlusionEnabled{true} { }
+
+    CHiZCuller(const CHiZCuller&) = delete;
+
+    CHiZCuller& operator=(const CHiZCuller&) = delete;
+
+    ~CHiZCuller()
+    {
+        destroyPyramid();
+        m_statsBuffer.destroy();
+        m_drawBuffer.destroy();
+        m_boundsBuffer.destroy();
+        m_paramsBuffer.destroy();
+    }
+
+    constexpr uint32_t getNumLevels() const
+    {
+        return m_numLevels;
+    }
+
+    constexpr bool isOcclusionEnabled() const
+    {
+        return m_occlusionEnabled;
+    }
+
+    void setOcclusionEnabled(bool enable)
+    {
+        m_occlusionEnabled = enable;
+    }
+
+    DkGpuAddr getDrawCmdAddr(uint32_t id) const
+    {
+        return m_drawBuffer.getGpuAddr() + id*sizeof(DkDrawIndexedIndirectData);
+    }
+
+    // Number of objects that passed the tests, as last written by the GPU
+    uint32_t getNumVisible() const
+    {
+        return *(volatile uint32_t*)m_statsBuffer.getCpuAddr();
+    }
+
+    bool initialize(dk::Device device, CMemPool& codePool, CMemPool& dataPool, uint32_t maxObjects);
+    void setObject(uint32_t id, const float aabbMin[3], const float aabbMax[3], DkDrawIndexedIndirectData const& draw);
+
+    bool createPyramid(CMemPool& imagePool, dk::Queue queue, dk::Image& depthBuffer, uint32_t width, uint32_t height);
+    void destroyPyramid();
+
+    void update(dk::CmdBuf dyncmd, const float viewProjMtx[16]);
+    void recordCull(dk::CmdBuf cmdbuf, uint32_t numObjects);
+    void recordBuild(dk::CmdBuf cmdbuf);
+};
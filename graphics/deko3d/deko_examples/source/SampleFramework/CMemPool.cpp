@@ -4,6 +4,22 @@
 */
 #include "CMemPool.h"
 
+CMemPool::Stats CMemPool::s_stats;
+
+void CMemPool::_trackAllocated(int64_t delta)
+{
+    s_stats.allocatedSize += delta;
+    if (s_stats.allocatedSize > s_stats.peakAllocatedSize)
+        s_stats.peakAllocatedSize = s_stats.allocatedSize;
+}
+
+void CMemPool::_trackBlocks(int64_t delta)
+{
+    s_stats.blockSize += delta;
+    if (s_stats.blockSize > s_stats.peakBlockSize)
+        s_stats.peakBlockSize = s_stats.blockSize;
+}
+
 inline auto CMemPool::_newSlice() -> Slice*
 {
     Slice* ret = m_sliceHeap.pop();
@@ -19,9 +35,13 @@ inline void CMemPool::_deleteSlice(Slice* s)
 
 CMemPool::~CMemPool()
 {
-    m_memMap.iterate([](Slice* s) { ::free(s); });
+    m_memMap.iterate([](Slice* s) {
+        if (s->m_pool) _trackAllocated(-int64_t(s->getSize()));
+        ::free(s);
+    });
     m_sliceHeap.iterate([](Slice* s) { ::free(s); });
     m_blocks.iterate([](Block* blk) {
+        _trackBlocks(-int64_t(blk->m_obj.getSize()));
         blk->m_obj.destroy();
         ::free(blk);
     });
@@ -96,6 +116,7 @@ auto CMemPool::allocate(uint32_t size, uint32_t alignment) -> Handle
         blk->m_cpuAddr = blk->m_obj.getCpuAddr();
         blk->m_gpuAddr = blk->m_obj.getGpuAddr();
         m_blocks.add(blk);
+        _trackBlocks(blkSize);
 
         start_offset = 0;
         end_offset = size;
@@ -141,6 +162,7 @@ auto CMemPool::allocate(uint32_t size, uint32_t alignment) -> Handle
     }
 
     slice->m_pool = this;
+    _trackAllocated(slice->getSize());
     return slice;
 
 _bad:
@@ -150,6 +172,7 @@ _bad:
 
 void CMemPool::_destroy(Slice* slice)
 {
+    _trackAllocated(-int64_t(slice->getSize()));
     slice->m_pool = nullptr;
 
     Slice* left  = m_memMap.prev(slice);
@@ -67,6 +67,22 @@ class CMemPool
 
     void _destroy(Slice* slice);
 
+public:
+    // Memory usage totals across all the pools in the application
+    struct Stats
+    {
+        uint64_t allocatedSize;
+        uint64_t peakAllocatedSize;
+        uint64_t blockSize;
+        uint64_t peakBlockSize;
+    };
+
+private:
+    static Stats s_stats;
+
+    static void _trackAllocated(int64_t delta);
+    static void _trackBlocks(int64_t delta);
+
 public:
     static constexpr uint32_t DefaultBlockSize = 0x800000;
     class Handle
@@ -125,6 +141,15 @@ public:
     CMemPool(const CMemPool&) = delete;
 
     CMemPool& operator=(const CMemPool&) = delete;
+
+    static Stats const& getStats() { return s_stats; }
+
+    // Restarts peak tracking from the current usage
+    static void resetPeakStats()
+    {
+        s_stats.peakAllocatedSize = s_stats.allocatedSize;
+        s_stats.peakBlockSize = s_stats.blockSize;
+    }
 };
 
 constexpr bool operator<(uint32_t lhs, CMemPool::Slice const& rhs)
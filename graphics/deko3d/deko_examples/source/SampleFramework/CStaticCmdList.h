@@ -0,0 +1,138 @@
+/*
+** Sample Framework for deko3d Applications
+**   CStaticCmdList.h: Static command list with named per-frame patch slots
+*/
+#pragma once
+#include "common.h"
+#include "CMemPool.h"
+
+#include <type_traits>
+
+// A static command list is recorded once per slice (i.e. per frame in flight), and each copy
+// references its own instance of every slot. Slots are small blocks of CPU-visible memory that
+// the commands consume by address (uniform buffers, indirect draw parameters, etc), so that
+// updating them per frame does not involve re-recording or inlining any commands.
+template <unsigned NumSlices>
+class CStaticCmdList
+{
+    static_assert(NumSlices > 0, "Need a non-zero number of slices...");
+    static constexpr unsigned MaxSlots = 16;
+
+    struct Slot
+    {
+        const char* name;
+        uint32_t offset;
+        uint32_t size;
+    };
+
+    dk::UniqueCmdBuf m_cmdbuf;
+    CMemPool::Handle m_cmdmem;
+    CMemPool::Handle m_slotmem;
+    Slot m_slots[MaxSlots];
+    unsigned m_numSlots;
+    uint32_t m_sliceSize;
+    unsigned m_curSlice;
+    DkCmdList m_lists[NumSlices];
+    dk::Fence m_fences[NumSlices];
+
+public:
+    using SlotId = unsigned;
+    static constexpr SlotId InvalidSlot = ~0U;
+
+    CStaticCmdList() : m_cmdbuf{}, m_cmdmem{}, m_slotmem{}, m_slots{}, m_numSlots{}, m_sliceSize{}, m_curSlice{}, m_lists{}, m_fences{} { }
+
+    CStaticCmdList(const CStaticCmdList&) = delete;
+
+    CStaticCmdList& operator=(const CStaticCmdList&) = delete;
+
+    ~CStaticCmdList()
+    {
+        m_slotmem.destroy();
+        m_cmdmem.destroy();
+    }
+
+    // Declares a slot; all slots must be declared before calling allocate()
+    SlotId addSlot(const char* name, uint32_t size, uint32_t alignment = DK_UNIFORM_BUF_ALIGNMENT)
+    {
+        if (m_slotmem || m_numSlots == MaxSlots || (alignment & (alignment - 1)))
+            return InvalidSlot;
+
+        uint32_t offset = (m_sliceSize + alignment - 1) &~ (alignment - 1);
+        m_slots[m_numSlots] = Slot{ name, offset, size };
+        m_sliceSize = offset + size;
+        return m_numSlots++;
+    }
+
+    SlotId findSlot(const char* name) const
+    {
+        for (unsigned i = 0; i < m_numSlots; i ++)
+            if (strcmp(m_slots[i].name, name) == 0)
+                return i;
+        return InvalidSlot;
+    }
+
+    // Allocates the command memory (enough for all copies of the list) and the slot memory
+    bool allocate(dk::Device device, CMemPool& pool, uint32_t cmdSize)
+    {
+        m_sliceSize = (m_sliceSize + DK_UNIFORM_BUF_ALIGNMENT - 1) &~ (DK_UNIFORM_BUF_ALIGNMENT - 1);
+        m_cmdbuf = dk::CmdBufMaker{device}.create();
+        m_cmdmem = pool.allocate(NumSlices*cmdSize);
+        if (m_sliceSize)
+            m_slotmem = pool.allocate(NumSlices*m_sliceSize, DK_UNIFORM_BUF_ALIGNMENT);
+        return m_cmdmem && (m_slotmem || !m_sliceSize);
+    }
+
+    DkGpuAddr getSlotGpuAddr(unsigned slice, SlotId slot) const
+    {
+        return m_slotmem.getGpuAddr() + slice*m_sliceSize + m_slots[slot].offset;
+    }
+
+    constexpr uint32_t getSlotSize(SlotId slot) const
+    {
+        return m_slots[slot].size;
+    }
+
+    // Records the list once per slice. The lambda receives the command buffer and the slice index,
+    // which it uses to look up the slot addresses with getSlotGpuAddr(). Any previously recorded
+    // copies are discarded, so the caller must make sure the GPU is no longer using them.
+    template <typename L>
+    void record(L lambda)
+    {
+        m_cmdbuf.clear();
+        m_cmdbuf.addMemory(m_cmdmem.getMemBlock(), m_cmdmem.getOffset(), m_cmdmem.getSize());
+        for (unsigned i = 0; i < NumSlices; i ++)
+        {
+            // The slots are written by the CPU, so make sure the GPU does not see stale cached data
+            m_cmdbuf.barrier(DkBarrier_None, DkInvalidateFlags_L2Cache);
+            lambda(dk::CmdBuf{m_cmdbuf}, i);
+            m_lists[i] = m_cmdbuf.finishList();
+        }
+        m_curSlice = 0;
+    }
+
+    // Waits until the GPU is done with the current slice, after which its slots can be patched
+    void begin()
+    {
+        m_fences[m_curSlice].wait();
+    }
+
+    void* getSlotCpuAddr(SlotId slot) const
+    {
+        return (u8*)m_slotmem.getCpuAddr() + m_curSlice*m_sliceSize + m_slots[slot].offset;
+    }
+
+    template <typename T>
+    void patch(SlotId slot, T const& data)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        memcpy(getSlotCpuAddr(slot), &data, sizeof(T) < m_slots[slot].size ? sizeof(T) : m_slots[slot].size);
+    }
+
+    // Submits the copy of the list belonging to the current slice, and moves on to the next one
+    void submit(dk::Queue queue)
+    {
+        queue.submitCommands(m_lists[m_curSlice]);
+        queue.signalFence(m_fences[m_curSlice]);
+        m_curSlice = (m_curSlice + 1) % NumSlices;
+    }
+};
@@ -0,0 +1,101 @@
+/*
+** Sample Framework for deko3d Applications
+**   CUniformRing.h: Memory provider class for per-frame uniform data
+*/
+#pragma once
+#include "common.h"
+#include "CMemPool.h"
+
+#include <type_traits>
+
+// Uniform data is written by the CPU straight into mapped GPU memory, instead of being
+// inlined into a command list with pushConstants; so the size of the command list does
+// not grow with the amount of data. Each frame in flight uses its own slice of memory,
+// which is guarded by a fence. Usage for every frame:
+// - begin(): waits for the current slice to be available, and records a cache invalidation
+// - push()/reserve(): copy the data and get back the GPU address to bind
+// - end(): signals the slice's fence, after all commands consuming the data have been submitted
+template <unsigned NumSlices>
+class CUniformRing
+{
+    static_assert(NumSlices > 0, "Need a non-zero number of slices...");
+    CMemPool::Handle m_mem;
+    uint32_t m_sliceSize;
+    uint32_t m_curOffset;
+    unsigned m_curSlice;
+    dk::Fence m_fences[NumSlices];
+public:
+    struct Allocation
+    {
+        void* cpuAddr;
+        DkGpuAddr gpuAddr;
+        uint32_t size;
+
+        constexpr operator bool() const { return cpuAddr != nullptr; }
+    };
+
+    CUniformRing() : m_mem{}, m_sliceSize{}, m_curOffset{}, m_curSlice{}, m_fences{} { }
+
+    CUniformRing(const CUniformRing&) = delete;
+
+    CUniformRing& operator=(const CUniformRing&) = delete;
+
+    ~CUniformRing()
+    {
+        m_mem.destroy();
+    }
+
+    bool allocate(CMemPool& pool, uint32_t sliceSize)
+    {
+        sliceSize = (sliceSize + DK_UNIFORM_BUF_ALIGNMENT - 1) &~ (DK_UNIFORM_BUF_ALIGNMENT - 1);
+        m_mem = pool.allocate(NumSlices*sliceSize, DK_UNIFORM_BUF_ALIGNMENT);
+        m_sliceSize = m_mem ? sliceSize : 0;
+        return m_mem;
+    }
+
+    void begin(dk::CmdBuf cmdbuf)
+    {
+        // Wait for the current slice of memory to be available (i.e. for the GPU to be done
+        // with the frame that last used it), after which it can be overwritten
+        m_fences[m_curSlice].wait();
+        m_curOffset = 0;
+
+        // The data is written by the CPU, so make sure the GPU does not see stale cached data
+        cmdbuf.barrier(DkBarrier_None, DkInvalidateFlags_L2Cache);
+    }
+
+    // Reserves space in the current slice; returns an empty allocation if the slice is full
+    Allocation reserve(uint32_t size, uint32_t alignment = DK_UNIFORM_BUF_ALIGNMENT)
+    {
+        uint32_t offset = (m_curOffset + alignment - 1) &~ (alignment - 1);
+        if (offset + size > m_sliceSize)
+            return Allocation{};
+
+        m_curOffset = offset + size;
+        offset += m_curSlice * m_sliceSize;
+        return Allocation{ (u8*)m_mem.getCpuAddr() + offset, m_mem.getGpuAddr() + offset, size };
+    }
+
+    template <typename T>
+    Allocation push(T const& data, uint32_t alignment = DK_UNIFORM_BUF_ALIGNMENT)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        Allocation alloc = reserve(sizeof(T), alignment);
+        if (alloc)
+            memcpy(alloc.cpuAddr, &data, sizeof(T));
+        return alloc;
+    }
+
+    void end(dk::Queue queue)
+    {
+        // Signal the fence corresponding to the current slice; this must come after all commands
+        // reading from it have been submitted, so that its memory isn't overwritten while in use
+        queue.signalFence(m_fences[m_curSlice]);
+
+        // Advance the current slice counter; wrapping around when we reach the end
+        m_curSlice = (m_curSlice + 1) % NumSlices;
+    }
+
+    constexpr uint32_t getSliceSize() const { return m_sliceSize; }
+    constexpr uint32_t getUsedSize() const { return m_curOffset; }
+};
@@ -0,0 +1,15 @@
+#version 460
+
+layout (local_size_x = 8, local_size_y = 8) in;
+
+layout (binding = 0) uniform sampler2D texDepth;
+layout (binding = 0, r32f) uniform writeonly image2D outLevel;
+
+void main()
+{
+	ivec2 pos = ivec2(gl_GlobalInvocationID.xy);
+	if (any(greaterThanEqual(pos, imageSize(outLevel))))
+		return;
+
+	imageStore(outLevel, pos, vec4(texelFetch(texDepth, pos, 0).r));
+}
@@ -0,0 +1,124 @@
+#version 460
+
+layout (local_size_x = 64) in;
+
+struct Bounds
+{
+	vec4 aabbMin;
+	vec4 aabbMax;
+};
+
+struct DrawCmd
+{
+	uint indexCount;
+	uint instanceCount;
+	uint firstIndex;
+	int  vertexOffset;
+	uint baseInstance;
+};
+
+const uint Flag_FrustumTest   = 1;
+const uint Flag_OcclusionTest = 2;
+
+layout (std140, binding = 0) uniform Params
+{
+	mat4 viewProjMtx;
+	mat4 prevViewProjMtx;
+	vec2 pyramidSize;
+	uint numObjects;
+	uint numLevels;
+	uint flags;
+} u;
+
+layout (std430, binding = 0) readonly buffer Objects
+{
+	Bounds bounds[];
+} objs;
+
+layout (std430, binding = 1) buffer Draws
+{
+	DrawCmd cmds[];
+} draws;
+
+layout (std430, binding = 2) buffer Stats
+{
+	uint numVisible;
+} stats;
+
+layout (binding = 0) uniform sampler2D texPyramid;
+
+// Projects the box with the given matrix, returning false if it crosses the near plane.
+// Otherwise ndcMin/ndcMax receive the screen-space bounding rectangle and depth range.
+bool projectBox(mat4 mtx, Bounds b, out vec3 ndcMin, out vec3 ndcMax)
+{
+	ndcMin = vec3(1.0e30);
+	ndcMax = vec3(-1.0e30);
+	for (int i = 0; i < 8; i ++)
+	{
+		vec3 corner = vec3(
+			(i & 1) != 0 ? b.aabbMax.x : b.aabbMin.x,
+			(i & 2) != 0 ? b.aabbMax.y : b.aabbMin.y,
+			(i & 4) != 0 ? b.aabbMax.z : b.aabbMin.z);
+		vec4 clip = mtx * vec4(corner, 1.0);
+		if (clip.w <= 1.0e-5)
+			return false;
+		vec3 ndc = clip.xyz / clip.w;
+		ndcMin = min(ndcMin, ndc);
+		ndcMax = max(ndcMax, ndc);
+	}
+	return true;
+}
+
+bool isOutsideFrustum(Bounds b)
+{
+	vec3 ndcMin, ndcMax;
+	if (!projectBox(u.viewProjMtx, b, ndcMin, ndcMax))
+		return false; // crosses the near plane, be conservative
+
+	return any(lessThan(ndcMax, vec3(-1.0, -1.0, 0.0))) || any(greaterThan(ndcMin, vec3(1.0)));
+}
+
+bool isOccluded(Bounds b)
+{
+	vec3 ndcMin, ndcMax;
+	if (!projectBox(u.prevViewProjMtx, b, ndcMin, ndcMax))
+		return false;
+
+	// Convert to pyramid texel coordinates (NDC +Y points upwards, texel rows go downwards)
+	vec2 rectMin = clamp(vec2(ndcMin.x, -ndcMax.y) * 0.5 + 0.5, 0.0, 1.0) * u.pyramidSize;
+	vec2 rectMax = clamp(vec2(ndcMax.x, -ndcMin.y) * 0.5 + 0.5, 0.0, 1.0) * u.pyramidSize;
+
+	// Pick the level at which the rectangle spans at most 2x2 texels
+	vec2 extent = rectMax - rectMin;
+	int level = int(ceil(log2(max(max(extent.x, extent.y), 1.0))));
+	level = min(level, int(u.numLevels) - 1);
+
+	ivec2 levelSize = textureSize(texPyramid, level);
+	ivec2 p0 = min(ivec2(rectMin) >> level, levelSize - 1);
+	ivec2 p1 = min(ivec2(rectMax) >> level, levelSize - 1);
+
+	float depth = max(
+		max(texelFetch(texPyramid, ivec2(p0.x, p0.y), level).r, texelFetch(texPyramid, ivec2(p1.x, p0.y), level).r),
+		max(texelFetch(texPyramid, ivec2(p0.x, p1.y), level).r, texelFetch(texPyramid, ivec2(p1.x, p1.y), level).r));
+
+	// The box is hidden if its nearest point lies behind everything that was drawn over it
+	return ndcMin.z > depth;
+}
+
+void main()
+{
+	uint id = gl_GlobalInvocationID.x;
+	if (id >= u.numObjects)
+		return;
+
+	Bounds b = objs.bounds[id];
+	bool visible = true;
+	if ((u.flags & Flag_FrustumTest) != 0 && isOutsideFrustum(b))
+		visible = false;
+	else if ((u.flags & Flag_OcclusionTest) != 0 && isOccluded(b))
+		visible = false;
+
+	draws.cmds[id].instanceCount = visible ? 1 : 0;
+	if (visible)
+		atomicAdd(stats.numVisible, 1);
+}
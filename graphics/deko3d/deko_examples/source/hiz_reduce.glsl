@@ -0,0 +1,30 @@
+#version 460
+
+layout (local_size_x = 8, local_size_y = 8) in;
+
+layout (binding = 0, r32f) uniform readonly image2D inLevel;
+layout (binding = 1, r32f) uniform writeonly image2D outLevel;
+
+void main()
+{
+	ivec2 pos = ivec2(gl_GlobalInvocationID.xy);
+	ivec2 outSize = imageSize(outLevel);
+	if (any(greaterThanEqual(pos, outSize)))
+		return;
+
+	// Each texel covers a 2x2 block of the previous level. When the previous level has an odd
+	// size, the texels on the last row/column also take in the leftover texels so that the
+	// result stays conservative.
+	ivec2 inSize = imageSize(inLevel);
+	ivec2 first = pos * 2;
+	ivec2 last = min(first + 1, inSize - 1);
+	if (pos.x == outSize.x - 1) last.x = inSize.x - 1;
+	if (pos.y == outSize.y - 1) last.y = inSize.y - 1;
+
+	float depth = 0.0;
+	for (int y = first.y; y <= last.y; y ++)
+		for (int x = first.x; x <= last.x; x ++)
+			depth = max(depth, imageLoad(inLevel, ivec2(x, y)).r);
+
+	imageStore(outLevel, pos, vec4(depth));
+}
@@ -0,0 +1,27 @@
+#version 460
+
+layout (location = 0) in vec3 inPos;
+layout (location = 1) in vec3 inNormal;
+layout (location = 2) in vec4 inInstancePos;
+layout (location = 3) in vec4 inInstanceScale;
+layout (location = 4) in vec4 inInstanceColor;
+
+layout (location = 0) out vec3 outColor;
+
+layout (std140, binding = 0) uniform Transformation
+{
+    mat4 mdlvMtx;
+    mat4 projMtx;
+} u;
+
+const vec3 lightDir = vec3(0.267261, 0.801784, 0.534522);
+
+void main()
+{
+    vec3 worldPos = inInstancePos.xyz + inPos * inInstanceScale.xyz;
+    gl_Position = u.projMtx * (u.mdlvMtx * vec4(worldPos, 1.0));
+
+    // Simple per-vertex diffuse lighting in world space
+    float diffuse = max(0.0, dot(inNormal, lightDir));
+    outColor = inInstanceColor.rgb * (0.25 + 0.75 * diffuse);
+}
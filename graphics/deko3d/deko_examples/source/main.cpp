@@ -4,6 +4,7 @@
 
 // Sample Framework headers
 #include "SampleFramework/CApplication.h"
+#include "SampleFramework/CMemPool.h"
 
 // C++ standard library headers
 #include <array>
@@ -17,6 +18,8 @@ void Example06(void);
 void Example07(void);
 void Example08(void);
 void Example09(void);
+void Example10(void);
+void Example11(void);
 
 namespace
 {
@@ -38,7 +41,56 @@ namespace
         Example{ Example07, "07: Mesh Loading and Lighting (sRGB)"                        },
         Example{ Example08, "08: Deferred Shading (Multipass Rendering with Tiled Cache)" },
         Example{ Example09, "09: Simple Compute Shader (Geometry Generation)"             },
+        Example{ Example10, "10: Occlusion Culling (Hierarchical Depth Buffer)"           },
+        Example{ Example11, "11: Dynamic Resolution (GPU Timing and Upscaling)"           },
     };
+
+    constexpr unsigned DefaultBenchmarkFrames = 600;
+    constexpr const char* BenchmarkCsvPath = "sdmc:/deko3d_benchmark.csv";
+    constexpr const char* BenchmarkJsonPath = "sdmc:/deko3d_benchmark.json";
+
+    uint64_t BenchmarkClock()
+    {
+        return armTicksToNs(armGetSystemTick());
+    }
+
+    void RunBenchmark(unsigned numFrames)
+    {
+        CBenchmark bench{BenchmarkClock, numFrames};
+
+        // Run every example for a fixed number of frames, one after the other
+        for (auto& example : Examples)
+        {
+            CMemPool::resetPeakStats();
+            bench.beginExample(example.name);
+            example.mainfunc();
+            bench.endExample(CMemPool::getStats().peakAllocatedSize, CMemPool::getStats().peakBlockSize);
+        }
+
+        // Write the reports
+        auto writeReport = [&bench](const char* path, bool json)
+        {
+            FILE* f = fopen(path, "w");
+            bool ok = f && (json ? bench.writeJson(f) : bench.writeCsv(f));
+            if (f) fclose(f);
+            if (!ok) printf("Cannot write %s\n", path);
+        };
+        writeReport(BenchmarkCsvPath, false);
+        writeReport(BenchmarkJsonPath, true);
+
+        // Also print a summary to stdout (e.g. for nxlink)
+        for (unsigned i = 0; i < bench.getNumResults(); i ++)
+        {
+            auto& res = bench.getResult(i);
+            printf("%-60s cpu %7.1f us (p95 %7.1f) submit %7.1f us mem %6llu KiB\n", res.name,
+                res.cpuAvg/1000.0, res.cpuP95/1000.0, res.submitAvg/1000.0, (unsigned long long)res.memPeak/1024);
+        }
+    }
+
+    void RunBenchmark(void)
+    {
+        RunBenchmark(DefaultBenchmarkFrames);
+    }
 }
 
 class CMainMenu final : public CApplication
@@ -55,7 +107,7 @@ class CMainMenu final : public CApplication
     {
         printf("\x1b[2J\n");
         printf("  deko3d Examples\n");
-        printf("  Press PLUS(+) to exit; A to select an example to run\n");
+        printf("  Press PLUS(+) to exit; A to select an example to run; X to run the benchmark\n");
         printf("\n");
         printf("--------------------------------------------------------------------------------");
         printf("\n");
@@ -95,6 +147,11 @@ class CMainMenu final : public CApplication
         }
         if (kDown & HidNpadButton_A)
             return false;
+        if (kDown & HidNpadButton_X)
+        {
+            selectPos = -2;
+            return false;
+        }
         if (kDown & HidNpadButton_AnyUp)
             selectPos -= 1;
         if (kDown & HidNpadButton_AnyDown)
@@ -127,12 +184,21 @@ public:
     {
         CMainMenu app;
         app.run();
+        if (app.selectPos == -2)
+            return RunBenchmark;
         return app.selectPos >= 0 ? Examples[app.selectPos].mainfunc : nullptr;
     }
 };
 
 int main(int argc, char* argv[])
 {
+    // Headless benchmark mode: "--benchmark [frames]" runs every example and exits
+    if (argc >= 2 && strcmp(argv[1], "--benchmark") == 0)
+    {
+        RunBenchmark(argc >= 3 ? unsigned(atoi(argv[2])) : DefaultBenchmarkFrames);
+        return 0;
+    }
+
     for (;;)
     {
         ExampleFunc func = CMainMenu::Display();
@@ -0,0 +1,45 @@
+#version 460
+
+layout (location = 0) out vec4 outColor;
+
+layout (binding = 0) uniform sampler2D texScene;
+
+layout (std140, binding = 0) uniform Params
+{
+    vec2 uvScale;       // rendered size / texture size
+    vec2 uvMax;         // center of the last rendered texel
+    vec2 texelSize;
+    vec2 outputSizeInv;
+    float sharpness;
+} u;
+
+vec3 fetch(vec2 uv)
+{
+    // Never sample outside of the rendered area, since the rest of the texture holds stale data
+    return texture(texScene, min(uv, u.uvMax)).rgb;
+}
+
+void main()
+{
+    vec2 uv = gl_FragCoord.xy * u.outputSizeInv * u.uvScale;
+
+    // Bilinear upscale
+    vec3 c = fetch(uv);
+    if (u.sharpness <= 0.0)
+    {
+        outColor = vec4(c, 1.0);
+        return;
+    }
+
+    // Sharpen with a cross-shaped unsharp mask, clamped to the neighbourhood to avoid ringing
+    vec3 n = fetch(uv - vec2(0.0, u.texelSize.y));
+    vec3 s = fetch(uv + vec2(0.0, u.texelSize.y));
+    vec3 w = fetch(uv - vec2(u.texelSize.x, 0.0));
+    vec3 e = fetch(uv + vec2(u.texelSize.x, 0.0));
+
+    vec3 minColor = min(c, min(min(n, s), min(w, e)));
+    vec3 maxColor = max(c, max(max(n, s), max(w, e)));
+    vec3 sharpened = c + u.sharpness * (4.0*c - n - s - w - e);
+
+    outColor = vec4(clamp(sharpened, minColor, maxColor), 1.0);
+}
@@ -0,0 +1,380 @@
+/*
+ * Checks the benchmark mode of the deko3d examples: CBenchmark, the scripted-time loop of
+ * CApplication::run and the CMemPool usage statistics are built as they are, against host versions
+ * of libnx and deko3d (host/switch.h, host/deko3d.hpp). Fake examples are run the way the example
+ * menu's RunBenchmark runs the real ones, on a simulated clock which each frame advances by a known
+ * amount (part of it within a CBenchmark::SubmitScope), while allocating known amounts from their
+ * memory pools. The tool then checks:
+ * - that each example is fed the scripted time of each frame, and is stopped after the set number
+ *   of frames (or when it quits)
+ * - the per-example results, and the same values read back from the CSV and JSON reports
+ * - that the memory statistics of each example only cover that example, and that everything it
+ *   allocated is freed once it is done
+ *
+ * This is a host tool, not part of the Switch build:
+ *   c++ -std=gnu++17 -O2 -fno-exceptions -fno-rtti -Ihost -I../source benchmark_check.cpp \
+ *      ../source/SampleFramework/CBenchmark.cpp ../source/SampleFramework/CApplication.cpp \
+ *      ../source/SampleFramework/CMemPool.cpp ../source/SampleFramework/CIntrusiveTree.cpp -o benchmark_check
+ *   ./benchmark_check
+ */
+
+#include <algorithm>
+#include <math.h>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "SampleFramework/CApplication.h"
+#include "SampleFramework/CMemPool.h"
+
+namespace
+{
+    constexpr unsigned NumFrames = 120;
+    constexpr uint32_t PoolBlockSize = 0x10000;
+
+    // How a fake example behaves: the memory it allocates up front, a larger buffer it only holds
+    // for one frame, and the frame on which it quits (if it does)
+    struct Script
+    {
+        const char* name;
+        uint32_t allocSize;
+        unsigned numAllocs;
+        uint32_t transientSize;
+        unsigned quitFrame;
+    };
+
+    constexpr Script Scripts[] =
+    {
+        { "big",   0x4000, 4, 0x19000, ~0U },
+        { "small", 0x1000, 1, 0,       ~0U },
+        { "quits", 0x2000, 3, 0x12000, 40  },
+    };
+
+    // Simulated time, which only moves when a fake example does some "work"
+    uint64_t s_clock;
+
+    uint64_t SimulatedClock()
+    {
+        return s_clock;
+    }
+
+    // Time spent on each frame, and the part of it spent submitting
+    uint64_t FrameCpuNs(unsigned frame)
+    {
+        return 100000 + (frame * 37 % 50) * 1000;
+    }
+
+    uint64_t FrameSubmitNs(unsigned frame)
+    {
+        return 20000 + (frame % 4) * 5000;
+    }
+
+    unsigned s_errors;
+
+    void fail(const char* what, const char* name, double value, double expected)
+    {
+        fprintf(stderr, "%s: %s is %.1f, expected %.1f\n", name, what, value, expected);
+        s_errors ++;
+    }
+
+    void expect(const char* what, const char* name, double value, double expected)
+    {
+        if (fabs(value - expected) > 0.051) // the reports print microseconds with one decimal
+            fail(what, name, value, expected);
+    }
+}
+
+class CFakeExample final : public CApplication
+{
+    Script const& script;
+
+    dk::UniqueDevice device{dk::DeviceMaker{}.create()};
+    dk::UniqueQueue queue{dk::QueueMaker{device}.setFlags(DkQueueFlags_Graphics).create()};
+
+    std::optional<CMemPool> pool_data;
+    std::vector<CMemPool::Handle> buffers;
+    CMemPool::Handle transient;
+
+    unsigned frame = 0;
+
+public:
+    unsigned numSubmits = 0;
+
+    CFakeExample(Script const& s) : script{s}
+    {
+        pool_data.emplace(device, DkMemBlockFlags_CpuUncached | DkMemBlockFlags_GpuCached, PoolBlockSize);
+        for (unsigned i = 0; i < script.numAllocs; i ++)
+            buffers.push_back(pool_data->allocate(script.allocSize));
+    }
+
+    ~CFakeExample()
+    {
+        for (auto& buf : buffers)
+            buf.destroy();
+        transient.destroy();
+    }
+
+    bool onFrame(u64 ns) override
+    {
+        // The scripted time is what the examples animate their camera with
+        if (CBenchmark::getActive() && ns != frame * CBenchmark::FrameTimeNs)
+            fail("scripted time", script.name, ns, frame * CBenchmark::FrameTimeNs);
+        if (frame == script.quitFrame)
+            return false;
+
+        // Hold a large buffer during frame 10 only, which raises the peak
+        if (frame == 10 && script.transientSize)
+            transient = pool_data->allocate(script.transientSize);
+        else
+            transient.destroy();
+
+        s_clock += FrameCpuNs(frame) - FrameSubmitNs(frame);
+        {
+            CBenchmark::SubmitScope submitScope;
+            s_clock += FrameSubmitNs(frame);
+            queue.submitCommands(0);
+            queue.flush();
+            numSubmits ++;
+        }
+
+        frame ++;
+        return true;
+    }
+};
+
+namespace
+{
+    // What the results of an example should be
+    CBenchmark::Result expectedResult(Script const& script)
+    {
+        CBenchmark::Result res{};
+        res.name = script.name;
+        res.numFrames = std::min(NumFrames, script.quitFrame);
+
+        std::vector<uint64_t> cpu;
+        uint64_t cpuTotal = 0, submitTotal = 0;
+        for (unsigned i = 0; i < res.numFrames; i ++)
+        {
+            cpu.push_back(FrameCpuNs(i));
+            cpuTotal += FrameCpuNs(i);
+            submitTotal += FrameSubmitNs(i);
+            res.submitMax = std::max(res.submitMax, FrameSubmitNs(i));
+        }
+        std::sort(cpu.begin(), cpu.end());
+        res.cpuMin = cpu.front();
+        res.cpuMax = cpu.back();
+        res.cpuAvg = cpuTotal / res.numFrames;
+        res.cpuP95 = cpu[(res.numFrames - 1) * 95 / 100];
+        res.submitAvg = submitTotal / res.numFrames;
+
+        // The up front allocations start a block, and the transient buffer is too large for any block
+        // so it gets one of its own
+        uint32_t upFront = script.allocSize * script.numAllocs;
+        res.memPeak = upFront + script.transientSize;
+        res.memBlocks = (upFront + PoolBlockSize - 1) / PoolBlockSize * PoolBlockSize + script.transientSize;
+        return res;
+    }
+
+    void checkResult(CBenchmark::Result const& res, CBenchmark::Result const& exp)
+    {
+        expect("frames", exp.name, res.numFrames, exp.numFrames);
+        expect("cpu min", exp.name, res.cpuMin/1000.0, exp.cpuMin/1000.0);
+        expect("cpu avg", exp.name, res.cpuAvg/1000.0, exp.cpuAvg/1000.0);
+        expect("cpu p95", exp.name, res.cpuP95/1000.0, exp.cpuP95/1000.0);
+        expect("cpu max", exp.name, res.cpuMax/1000.0, exp.cpuMax/1000.0);
+        expect("submit avg", exp.name, res.submitAvg/1000.0, exp.submitAvg/1000.0);
+        expect("submit max", exp.name, res.submitMax/1000.0, exp.submitMax/1000.0);
+        expect("mem peak", exp.name, res.memPeak, exp.memPeak);
+        expect("mem blocks", exp.name, res.memBlocks, exp.memBlocks);
+    }
+
+    // Runs the report writer into memory
+    template <typename Func>
+    std::string writeReport(Func func)
+    {
+        char* buf = nullptr;
+        size_t size = 0;
+        FILE* f = open_memstream(&buf, &size);
+        bool ok = f && func(f);
+        if (f) fclose(f);
+        std::string text = ok && buf ? buf : "";
+        free(buf);
+        return text;
+    }
+
+    void checkCsv(std::string const& csv)
+    {
+        static const char header[] = "name,frames,cpu_min_us,cpu_avg_us,cpu_p95_us,cpu_max_us,submit_avg_us,submit_max_us,mem_peak_bytes,mem_blocks_bytes\n";
+        if (csv.compare(0, sizeof(header)-1, header) != 0)
+        {
+            fprintf(stderr, "csv: wrong header\n");
+            s_errors ++;
+            return;
+        }
+
+        const char* p = csv.c_str() + sizeof(header)-1;
+        for (auto& script : Scripts)
+        {
+            CBenchmark::Result exp = expectedResult(script);
+            char name[64];
+            unsigned frames;
+            double cpuMin, cpuAvg, cpuP95, cpuMax, submitAvg, submitMax;
+            unsigned long long memPeak, memBlocks;
+            int len = 0;
+            if (sscanf(p, "\"%63[^\"]\",%u,%lf,%lf,%lf,%lf,%lf,%lf,%llu,%llu\n%n", name, &frames,
+                &cpuMin, &cpuAvg, &cpuP95, &cpuMax, &submitAvg, &submitMax, &memPeak, &memBlocks, &len) != 10 || !len)
+            {
+                fprintf(stderr, "csv: cannot parse the row of %s\n", script.name);
+                s_errors ++;
+                return;
+            }
+            p += len;
+
+            if (strcmp(name, script.name) != 0)
+            {
+                fprintf(stderr, "csv: row of %s found instead of %s\n", name, script.name);
+                s_errors ++;
+            }
+            expect("csv frames", script.name, frames, exp.numFrames);
+            expect("csv cpu min", script.name, cpuMin, exp.cpuMin/1000.0);
+            expect("csv cpu avg", script.name, cpuAvg, exp.cpuAvg/1000.0);
+            expect("csv cpu p95", script.name, cpuP95, exp.cpuP95/1000.0);
+            expect("csv cpu max", script.name, cpuMax, exp.cpuMax/1000.0);
+            expect("csv submit avg", script.name, submitAvg, exp.submitAvg/1000.0);
+            expect("csv submit max", script.name, submitMax, exp.submitMax/1000.0);
+            expect("csv mem peak", script.name, memPeak, exp.memPeak);
+            expect("csv mem blocks", script.name, memBlocks, exp.memBlocks);
+        }
+        if (*p)
+        {
+            fprintf(stderr, "csv: unexpected trailing data\n");
+            s_errors ++;
+        }
+    }
+
+    void checkJson(std::string const& json)
+    {
+        const char* p = json.c_str();
+        unsigned frames = 0;
+        int len = 0;
+        if (sscanf(p, "{\n  \"frames\": %u,\n  \"results\": [%n", &frames, &len) != 1 || !len)
+        {
+            fprintf(stderr, "json: cannot parse the header\n");
+            s_errors ++;
+            return;
+        }
+        p += len;
+        expect("json frames", "report", frames, NumFrames);
+
+        bool first = true;
+        for (auto& script : Scripts)
+        {
+            CBenchmark::Result exp = expectedResult(script);
+            if (!first && *p++ != ',')
+            {
+                fprintf(stderr, "json: missing comma before %s\n", script.name);
+                s_errors ++;
+                return;
+            }
+            first = false;
+
+            char name[64];
+            unsigned frames;
+            double cpuMin, cpuAvg, cpuP95, cpuMax, submitAvg, submitMax;
+            unsigned long long memPeak, memBlocks;
+            len = 0;
+            if (sscanf(p, "\n    { \"name\": \"%63[^\"]\", \"frames\": %u, "
+                "\"cpu_us\": { \"min\": %lf, \"avg\": %lf, \"p95\": %lf, \"max\": %lf }, "
+                "\"submit_us\": { \"avg\": %lf, \"max\": %lf }, "
+                "\"mem_bytes\": { \"peak\": %llu, \"blocks\": %llu } }%n", name, &frames,
+                &cpuMin, &cpuAvg, &cpuP95, &cpuMax, &submitAvg, &submitMax, &memPeak, &memBlocks, &len) != 10 || !len)
+            {
+                fprintf(stderr, "json: cannot parse the result of %s\n", script.name);
+                s_errors ++;
+                return;
+            }
+            p += len;
+
+            if (strcmp(name, script.name) != 0)
+            {
+                fprintf(stderr, "json: result of %s found instead of %s\n", name, script.name);
+                s_errors ++;
+            }
+            expect("json frames", script.name, frames, exp.numFrames);
+            expect("json cpu min", script.name, cpuMin, exp.cpuMin/1000.0);
+            expect("json cpu avg", script.name, cpuAvg, exp.cpuAvg/1000.0);
+            expect("json cpu p95", script.name, cpuP95, exp.cpuP95/1000.0);
+            expect("json cpu max", script.name, cpuMax, exp.cpuMax/1000.0);
+            expect("json submit avg", script.name, submitAvg, exp.submitAvg/1000.0);
+            expect("json submit max", script.name, submitMax, exp.submitMax/1000.0);
+            expect("json mem peak", script.name, memPeak, exp.memPeak);
+            expect("json mem blocks", script.name, memBlocks, exp.memBlocks);
+        }
+        if (strcmp(p, "\n  ]\n}\n") != 0)
+        {
+            fprintf(stderr, "json: unexpected end of the report\n");
+            s_errors ++;
+        }
+    }
+}
+
+int main(void)
+{
+    CBenchmark bench{SimulatedClock, NumFrames};
+
+    // Like RunBenchmark in main.cpp
+    for (auto& script : Scripts)
+    {
+        unsigned submitsBefore = hostNumSubmits, numSubmits;
+        CMemPool::resetPeakStats();
+        bench.beginExample(script.name);
+        {
+            CFakeExample app{script};
+            app.run();
+            numSubmits = app.numSubmits;
+        }
+        bench.endExample(CMemPool::getStats().peakAllocatedSize, CMemPool::getStats().peakBlockSize);
+
+        expect("submissions", script.name, hostNumSubmits - submitsBefore, numSubmits);
+        expect("memory left allocated", script.name, CMemPool::getStats().allocatedSize, 0);
+        expect("memory blocks left", script.name, CMemPool::getStats().blockSize, 0);
+        expect("deko3d objects left", script.name, hostNumObjects, 0);
+        if (CBenchmark::getActive())
+        {
+            fprintf(stderr, "%s: benchmark still active after the example\n", script.name);
+            s_errors ++;
+        }
+    }
+
+    // Outside of a benchmark, SubmitScope does nothing and the application gets the real time
+    {
+        Script script = { "interactive", 0x1000, 1, 0, 3 };
+        CFakeExample app{script};
+        uint64_t clockBefore = s_clock;
+        app.run();
+        if (bench.getNumResults() != sizeof(Scripts)/sizeof(Scripts[0]) || s_clock == clockBefore)
+        {
+            fprintf(stderr, "interactive: the run was measured, or didn't run\n");
+            s_errors ++;
+        }
+    }
+
+    if (bench.getNumResults() == sizeof(Scripts)/sizeof(Scripts[0]))
+    {
+        for (unsigned i = 0; i < bench.getNumResults(); i ++)
+            checkResult(bench.getResult(i), expectedResult(Scripts[i]));
+    }
+
+    checkCsv(writeReport([&bench](FILE* f) { return bench.writeCsv(f); }));
+    checkJson(writeReport([&bench](FILE* f) { return bench.writeJson(f); }));
+
+    for (unsigned i = 0; i < bench.getNumResults(); i ++)
+    {
+        auto& res = bench.getResult(i);
+        printf("%-8s %3u frames, cpu %6.1f us (p95 %6.1f), submit %5.1f us, mem %4llu KiB (blocks %4llu KiB)\n",
+            res.name, res.numFrames, res.cpuAvg/1000.0, res.cpuP95/1000.0, res.submitAvg/1000.0,
+            (unsigned long long)res.memPeak/1024, (unsigned long long)res.memBlocks/1024);
+    }
+    printf("Benchmark results and reports: %s\n", s_errors ? "FAILED" : "ok");
+    return s_errors ? 1 : 0;
+}
@@ -0,0 +1,190 @@
+// Just enough of deko3d (and its C++ wrapper) for the sample framework's CMemPool and the benchmark
+// check to build on the host: devices, queues and memory blocks. Memory blocks are plain memory
+// (their GPU address is their CPU address), and command lists submitted to a queue are only counted.
+// Using an object that was never created (or was destroyed) aborts the tool.
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+typedef uint64_t DkGpuAddr;
+typedef uintptr_t DkCmdList;
+
+#define DK_GPU_ADDR_INVALID          (~(DkGpuAddr)0)
+#define DK_MEMBLOCK_ALIGNMENT        0x1000
+#define DK_CMDMEM_ALIGNMENT          4
+#define DK_SHADER_CODE_ALIGNMENT     0x100
+#define DK_SHADER_CODE_UNUSABLE_SIZE 0x80
+#define DK_UNIFORM_BUF_ALIGNMENT     0x100
+
+enum
+{
+    DkMemBlockFlags_CpuUncached = 1U << 0,
+    DkMemBlockFlags_CpuCached   = 2U << 0,
+    DkMemBlockFlags_GpuUncached = 1U << 2,
+    DkMemBlockFlags_GpuCached   = 2U << 2,
+    DkMemBlockFlags_Code        = 1U << 4,
+    DkMemBlockFlags_Image       = 1U << 5,
+};
+
+enum
+{
+    DkQueueFlags_Graphics = 1U << 0,
+    DkQueueFlags_Compute  = 1U << 1,
+};
+
+struct HostDevice { int dummy; };
+struct HostQueue { int dummy; };
+struct HostMemBlock { void* mem; uint32_t size; };
+
+typedef HostDevice* DkDevice;
+typedef HostQueue* DkQueue;
+typedef HostMemBlock* DkMemBlock;
+
+// Number of devices, queues and memory blocks that exist, and of command lists submitted so far
+inline unsigned hostNumObjects;
+inline unsigned hostNumSubmits;
+
+inline void hostCheck(const void* object, const char* what)
+{
+    if (!object)
+    {
+        fprintf(stderr, "deko3d: %s on a null object\n", what);
+        abort();
+    }
+}
+
+namespace dk
+{
+    namespace detail
+    {
+        template <typename T>
+        class Handle
+        {
+        protected:
+            T m_obj;
+        public:
+            constexpr Handle(T obj = nullptr) : m_obj{obj} { }
+            constexpr operator T() const { return m_obj; }
+            constexpr explicit operator bool() const { return m_obj != nullptr; }
+        };
+
+        // Destroys the object when going out of scope, like deko3d's UniqueHandle
+        template <typename T>
+        class UniqueHandle : public T
+        {
+        public:
+            UniqueHandle() = default;
+            UniqueHandle(T&& obj) : T{obj} { }
+            ~UniqueHandle() { if (*this) T::destroy(); }
+
+            UniqueHandle(const UniqueHandle&) = delete;
+
+            UniqueHandle& operator=(const UniqueHandle&) = delete;
+        };
+    }
+
+    struct Device : public detail::Handle<DkDevice>
+    {
+        using Handle::Handle;
+
+        void destroy()
+        {
+            hostCheck(m_obj, "dkDeviceDestroy");
+            hostNumObjects --;
+            delete m_obj;
+            m_obj = nullptr;
+        }
+    };
+
+    struct Queue : public detail::Handle<DkQueue>
+    {
+        using Handle::Handle;
+
+        void submitCommands(DkCmdList cmdList)
+        {
+            hostCheck(m_obj, "dkQueueSubmitCommands");
+            (void)cmdList;
+            hostNumSubmits ++;
+        }
+
+        void flush() { hostCheck(m_obj, "dkQueueFlush"); }
+        void waitIdle() { hostCheck(m_obj, "dkQueueWaitIdle"); }
+
+        void destroy()
+        {
+            hostCheck(m_obj, "dkQueueDestroy");
+            hostNumObjects --;
+            delete m_obj;
+            m_obj = nullptr;
+        }
+    };
+
+    struct MemBlock : public detail::Handle<DkMemBlock>
+    {
+        using Handle::Handle;
+
+        void* getCpuAddr() const { hostCheck(m_obj, "dkMemBlockGetCpuAddr"); return m_obj->mem; }
+        DkGpuAddr getGpuAddr() const { hostCheck(m_obj, "dkMemBlockGetGpuAddr"); return (DkGpuAddr)(uintptr_t)m_obj->mem; }
+        uint32_t getSize() const { hostCheck(m_obj, "dkMemBlockGetSize"); return m_obj->size; }
+
+        void destroy()
+        {
+            hostCheck(m_obj, "dkMemBlockDestroy");
+            hostNumObjects --;
+            free(m_obj->mem);
+            delete m_obj;
+            m_obj = nullptr;
+        }
+    };
+
+    using UniqueDevice = detail::UniqueHandle<Device>;
+    using UniqueQueue = detail::UniqueHandle<Queue>;
+    using UniqueMemBlock = detail::UniqueHandle<MemBlock>;
+
+    struct DeviceMaker
+    {
+        Device create()
+        {
+            hostNumObjects ++;
+            return Device{new HostDevice{}};
+        }
+    };
+
+    struct QueueMaker
+    {
+        Device device;
+        uint32_t flags;
+
+        QueueMaker(Device dev) : device{dev}, flags{DkQueueFlags_Graphics} { }
+        QueueMaker& setFlags(uint32_t f) { flags = f; return *this; }
+
+        Queue create()
+        {
+            hostCheck(device, "dkQueueCreate");
+            hostNumObjects ++;
+            return Queue{new HostQueue{}};
+        }
+    };
+
+    struct MemBlockMaker
+    {
+        Device device;
+        uint32_t size;
+        uint32_t flags;
+
+        MemBlockMaker(Device dev, uint32_t sz) : device{dev}, size{sz}, flags{DkMemBlockFlags_CpuUncached | DkMemBlockFlags_GpuCached} { }
+        MemBlockMaker& setFlags(uint32_t f) { flags = f; return *this; }
+
+        MemBlock create()
+        {
+            hostCheck(device, "dkMemBlockCreate");
+            void* mem = aligned_alloc(DK_MEMBLOCK_ALIGNMENT, (size + DK_MEMBLOCK_ALIGNMENT - 1) &~ (DK_MEMBLOCK_ALIGNMENT - 1));
+            if (!mem)
+                return MemBlock{};
+            hostNumObjects ++;
+            return MemBlock{new HostMemBlock{mem, size}};
+        }
+    };
+}
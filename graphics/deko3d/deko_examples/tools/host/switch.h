@@ -0,0 +1,65 @@
+// Just enough of libnx for the sample framework's CApplication to build on the host: types, and
+// an applet that never sends messages and always has the focus.
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <time.h>
+
+typedef uint8_t u8;
+typedef uint16_t u16;
+typedef uint32_t u32;
+typedef uint64_t u64;
+typedef int32_t s32;
+typedef int64_t s64;
+
+#ifdef __cplusplus
+#define NX_CONSTEXPR constexpr
+#else
+#define NX_CONSTEXPR static inline
+#endif
+
+typedef u32 Result;
+#define R_SUCCEEDED(res) ((res) == 0)
+#define R_FAILED(res)    ((res) != 0)
+
+typedef enum {
+    AppletFocusState_InFocus    = 1,
+    AppletFocusState_OutOfFocus = 2,
+    AppletFocusState_Background = 3,
+} AppletFocusState;
+
+typedef enum {
+    AppletOperationMode_Handheld = 0,
+    AppletOperationMode_Console  = 1,
+} AppletOperationMode;
+
+typedef enum {
+    AppletFocusHandlingMode_SuspendHomeSleep       = 0,
+    AppletFocusHandlingMode_NoSuspend              = 1,
+    AppletFocusHandlingMode_SuspendHomeSleepNotify = 2,
+    AppletFocusHandlingMode_AlwaysSuspend          = 3,
+} AppletFocusHandlingMode;
+
+typedef enum {
+    AppletMessage_FocusStateChanged    = 15,
+    AppletMessage_OperationModeChanged = 30,
+} AppletMessage;
+
+static inline Result appletLockExit(void) { return 0; }
+static inline Result appletUnlockExit(void) { return 0; }
+static inline Result appletSetFocusHandlingMode(AppletFocusHandlingMode mode) { (void)mode; return 0; }
+static inline Result appletGetMessage(u32* msg) { (void)msg; return 1; } // no message
+static inline bool appletProcessMessage(u32 msg) { (void)msg; return true; }
+static inline AppletFocusState appletGetFocusState(void) { return AppletFocusState_InFocus; }
+static inline AppletOperationMode appletGetOperationMode(void) { return AppletOperationMode_Handheld; }
+
+// The system tick is the host's monotonic clock, in nanoseconds
+static inline u64 armGetSystemTick(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (u64)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static inline u64 armTicksToNs(u64 tick) { return tick; }
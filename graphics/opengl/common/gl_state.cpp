@@ -0,0 +1,350 @@
+#include <string.h>
+#include <stdint.h>
+
+#include "gl_state.h"
+
+// Binding value meaning "unknown", so that the next bind always reaches GL
+constexpr GLuint UNKNOWN = ~0u;
+
+// Number of texture units tracked (binds to higher units are passed through)
+constexpr unsigned NUMTEXUNITS = 16;
+
+// Number of programs whose uniforms are remembered at once
+constexpr unsigned NUMUNIFORMPROGRAMS = 8;
+
+// Uniform locations below this are remembered (others are passed through)
+constexpr unsigned NUMUNIFORMLOCATIONS = 32;
+
+// Largest uniform value remembered, in 32-bit words (a mat4)
+constexpr unsigned MAXUNIFORMWORDS = 16;
+
+enum
+{
+    BufferArray,
+    BufferElementArray,
+    BufferPixelPack,
+    BufferPixelUnpack,
+    BufferUniform,
+    BufferCopyRead,
+    BufferCopyWrite,
+    BufferDrawIndirect,
+
+    NumBufferTargets
+};
+
+enum
+{
+    Texture2D,
+    Texture2DArray,
+    Texture3D,
+    TextureCubeMap,
+
+    NumTextureTargets
+};
+
+struct UniformValue
+{
+    uint32_t numWords; // 0 when unknown
+    uint32_t words[MAXUNIFORMWORDS];
+};
+
+struct ProgramUniforms
+{
+    GLuint program; // 0 when the slot is free
+    UniformValue values[NUMUNIFORMLOCATIONS];
+};
+
+// The default bindings of a new context are all zero, as are these
+static GLuint s_program;
+static GLuint s_pipeline;
+static GLuint s_vao;
+static GLuint s_buffers[NumBufferTargets];
+static GLenum s_activeTexture = GL_TEXTURE0;
+static GLuint s_textures[NUMTEXUNITS][NumTextureTargets];
+
+static ProgramUniforms s_uniforms[NUMUNIFORMPROGRAMS];
+static unsigned s_nextUniformsSlot;
+
+static GlStateStats s_stats;
+static GlStateStats s_frameStats;
+
+static int bufferTargetIndex(GLenum target)
+{
+    switch (target)
+    {
+        case GL_ARRAY_BUFFER:         return BufferArray;
+        case GL_ELEMENT_ARRAY_BUFFER: return BufferElementArray;
+        case GL_PIXEL_PACK_BUFFER:    return BufferPixelPack;
+        case GL_PIXEL_UNPACK_BUFFER:  return BufferPixelUnpack;
+        case GL_UNIFORM_BUFFER:       return BufferUniform;
+        case GL_COPY_READ_BUFFER:     return BufferCopyRead;
+        case GL_COPY_WRITE_BUFFER:    return BufferCopyWrite;
+        case GL_DRAW_INDIRECT_BUFFER: return BufferDrawIndirect;
+        default:                      return -1;
+    }
+}
+
+static int textureTargetIndex(GLenum target)
+{
+    switch (target)
+    {
+        case GL_TEXTURE_2D:       return Texture2D;
+        case GL_TEXTURE_2D_ARRAY: return Texture2DArray;
+        case GL_TEXTURE_3D:       return Texture3D;
+        case GL_TEXTURE_CUBE_MAP: return TextureCubeMap;
+        default:                  return -1;
+    }
+}
+
+// Records a new binding, returning false (and counting a skipped call) if it was already current
+static bool changeBinding(GLuint* current, GLuint value)
+{
+    if (*current == value)
+    {
+        s_stats.skipped ++;
+        return false;
+    }
+
+    *current = value;
+    s_stats.issued ++;
+    return true;
+}
+
+static ProgramUniforms* findUniforms(GLuint program, bool create)
+{
+    for (unsigned i = 0; i < NUMUNIFORMPROGRAMS; i ++)
+        if (s_uniforms[i].program == program)
+            return &s_uniforms[i];
+
+    if (!create)
+        return nullptr;
+
+    // Take a free slot if there is one, otherwise evict the programs in turn
+    ProgramUniforms* slot = findUniforms(0, false);
+    if (!slot)
+    {
+        slot = &s_uniforms[s_nextUniformsSlot];
+        s_nextUniformsSlot = (s_nextUniformsSlot + 1) % NUMUNIFORMPROGRAMS;
+    }
+
+    memset(slot, 0, sizeof(*slot));
+    slot->program = program;
+    return slot;
+}
+
+// Records a new uniform value, returning false (and counting a skipped call) if it was already set
+static bool changeUniform(GLuint program, GLint location, const void* data, unsigned size)
+{
+    unsigned numWords = size / sizeof(uint32_t);
+
+    // GL silently ignores location -1 (uniforms optimized out), so there's no point in calling it
+    if (location == -1)
+    {
+        s_stats.skipped ++;
+        return false;
+    }
+
+    if (program != 0 && program != UNKNOWN && location >= 0 && (unsigned)location < NUMUNIFORMLOCATIONS && numWords <= MAXUNIFORMWORDS)
+    {
+        UniformValue* value = &findUniforms(program, true)->values[location];
+        if (value->numWords == numWords && memcmp(value->words, data, size) == 0)
+        {
+            s_stats.skipped ++;
+            return false;
+        }
+
+        value->numWords = numWords;
+        memcpy(value->words, data, size);
+    }
+
+    s_stats.issued ++;
+    return true;
+}
+
+void glStateInvalidate()
+{
+    s_program = UNKNOWN;
+    s_pipeline = UNKNOWN;
+    s_vao = UNKNOWN;
+    for (unsigned i = 0; i < NumBufferTargets; i ++)
+        s_buffers[i] = UNKNOWN;
+    s_activeTexture = UNKNOWN;
+    for (unsigned i = 0; i < NUMTEXUNITS; i ++)
+        for (unsigned j = 0; j < NumTextureTargets; j ++)
+            s_textures[i][j] = UNKNOWN;
+
+    memset(s_uniforms, 0, sizeof(s_uniforms));
+    s_nextUniformsSlot = 0;
+}
+
+void glStateUseProgram(GLuint program)
+{
+    if (changeBinding(&s_program, program))
+        glUseProgram(program);
+}
+
+void glStateBindProgramPipeline(GLuint pipeline)
+{
+    if (changeBinding(&s_pipeline, pipeline))
+        glBindProgramPipeline(pipeline);
+}
+
+void glStateBindVertexArray(GLuint vao)
+{
+    if (changeBinding(&s_vao, vao))
+    {
+        glBindVertexArray(vao);
+
+        // The element array buffer binding is part of the vertex array object
+        s_buffers[BufferElementArray] = UNKNOWN;
+    }
+}
+
+void glStateBindBuffer(GLenum target, GLuint buffer)
+{
+    int index = bufferTargetIndex(target);
+    if (index < 0)
+    {
+        s_stats.issued ++;
+        glBindBuffer(target, buffer);
+    }
+    else if (changeBinding(&s_buffers[index], buffer))
+        glBindBuffer(target, buffer);
+}
+
+void glStateActiveTexture(GLenum unit)
+{
+    if (changeBinding(&s_activeTexture, unit))
+        glActiveTexture(unit);
+}
+
+void glStateBindTexture(GLenum target, GLuint texture)
+{
+    int index = textureTargetIndex(target);
+    unsigned unit = s_activeTexture - GL_TEXTURE0;
+    if (index < 0 || unit >= NUMTEXUNITS)
+    {
+        s_stats.issued ++;
+        glBindTexture(target, texture);
+    }
+    else if (changeBinding(&s_textures[unit][index], texture))
+        glBindTexture(target, texture);
+}
+
+void glStateUniform1i(GLint location, GLint v0)
+{
+    if (changeUniform(s_program, location, &v0, sizeof(v0)))
+        glUniform1i(location, v0);
+}
+
+void glStateUniform1f(GLint location, GLfloat v0)
+{
+    if (changeUniform(s_program, location, &v0, sizeof(v0)))
+        glUniform1f(location, v0);
+}
+
+void glStateUniform2f(GLint location, GLfloat v0, GLfloat v1)
+{
+    const GLfloat v[] = { v0, v1 };
+    if (changeUniform(s_program, location, v, sizeof(v)))
+        glUniform2f(location, v0, v1);
+}
+
+void glStateUniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2)
+{
+    const GLfloat v[] = { v0, v1, v2 };
+    if (changeUniform(s_program, location, v, sizeof(v)))
+        glUniform3f(location, v0, v1, v2);
+}
+
+void glStateUniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3)
+{
+    const GLfloat v[] = { v0, v1, v2, v3 };
+    if (changeUniform(s_program, location, v, sizeof(v)))
+        glUniform4f(location, v0, v1, v2, v3);
+}
+
+void glStateUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat* value)
+{
+    // Only single untransposed matrices are remembered
+    if (count != 1 || transpose)
+    {
+        s_stats.issued ++;
+        glUniformMatrix4fv(location, count, transpose, value);
+    }
+    else if (changeUniform(s_program, location, value, 16*sizeof(GLfloat)))
+        glUniformMatrix4fv(location, count, transpose, value);
+}
+
+void glStateProgramUniform1i(GLuint program, GLint location, GLint v0)
+{
+    if (changeUniform(program, location, &v0, sizeof(v0)))
+        glProgramUniform1i(program, location, v0);
+}
+
+void glStateProgramUniform2i(GLuint program, GLint location, GLint v0, GLint v1)
+{
+    const GLint v[] = { v0, v1 };
+    if (changeUniform(program, location, v, sizeof(v)))
+        glProgramUniform2i(program, location, v0, v1);
+}
+
+void glStateDeleteProgram(GLuint program)
+{
+    // A program in use is only deleted once it stops being used, so its binding stays valid until then
+    ProgramUniforms* uniforms = findUniforms(program, false);
+    if (program && uniforms)
+        uniforms->program = 0;
+    glDeleteProgram(program);
+}
+
+void glStateDeleteProgramPipelines(GLsizei n, const GLuint* pipelines)
+{
+    for (GLsizei i = 0; i < n; i ++)
+        if (pipelines[i] && pipelines[i] == s_pipeline)
+            s_pipeline = 0;
+    glDeleteProgramPipelines(n, pipelines);
+}
+
+void glStateDeleteVertexArrays(GLsizei n, const GLuint* vaos)
+{
+    for (GLsizei i = 0; i < n; i ++)
+    {
+        if (vaos[i] && vaos[i] == s_vao)
+        {
+            s_vao = 0;
+            s_buffers[BufferElementArray] = UNKNOWN;
+        }
+    }
+    glDeleteVertexArrays(n, vaos);
+}
+
+void glStateDeleteBuffers(GLsizei n, const GLuint* buffers)
+{
+    for (GLsizei i = 0; i < n; i ++)
+        for (unsigned j = 0; j < NumBufferTargets; j ++)
+            if (buffers[i] && buffers[i] == s_buffers[j])
+                s_buffers[j] = 0;
+    glDeleteBuffers(n, buffers);
+}
+
+void glStateDeleteTextures(GLsizei n, const GLuint* textures)
+{
+    for (GLsizei i = 0; i < n; i ++)
+        for (unsigned j = 0; j < NUMTEXUNITS; j ++)
+            for (unsigned k = 0; k < NumTextureTargets; k ++)
+                if (textures[i] && textures[i] == s_textures[j][k])
+                    s_textures[j][k] = 0;
+    glDeleteTextures(n, textures);
+}
+
+void glStateEndFrame()
+{
+    s_frameStats = s_stats;
+    s_stats = GlStateStats{};
+}
+
+GlStateStats glStateGetFrameStats()
+{
+    return s_frameStats;
+}
@@ -0,0 +1,47 @@
+#pragma once
+#include <glad/glad.h>
+
+// Thin GL state tracker shared by the OpenGL examples.
+// It remembers the objects bound and the uniform values set through it, and only forwards the
+// calls that actually change something to the driver. The tracker starts out matching a freshly
+// created context; code that changes the same state behind its back must call glStateInvalidate.
+// Objects must be deleted through the glStateDelete* functions, so that their names are forgotten.
+
+struct GlStateStats
+{
+    unsigned issued;  // calls forwarded to GL
+    unsigned skipped; // redundant calls filtered out
+};
+
+// Forgets everything, so that the next call of each kind reaches GL
+void glStateInvalidate();
+
+void glStateUseProgram(GLuint program);
+void glStateBindProgramPipeline(GLuint pipeline);
+void glStateBindVertexArray(GLuint vao);
+void glStateBindBuffer(GLenum target, GLuint buffer);
+void glStateActiveTexture(GLenum unit);
+void glStateBindTexture(GLenum target, GLuint texture);
+
+// Uniforms of the current program (set with glStateUseProgram)
+void glStateUniform1i(GLint location, GLint v0);
+void glStateUniform1f(GLint location, GLfloat v0);
+void glStateUniform2f(GLint location, GLfloat v0, GLfloat v1);
+void glStateUniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2);
+void glStateUniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3);
+void glStateUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat* value);
+
+// Uniforms of separable programs, as used by program pipelines
+void glStateProgramUniform1i(GLuint program, GLint location, GLint v0);
+void glStateProgramUniform2i(GLuint program, GLint location, GLint v0, GLint v1);
+
+void glStateDeleteProgram(GLuint program);
+void glStateDeleteProgramPipelines(GLsizei n, const GLuint* pipelines);
+void glStateDeleteVertexArrays(GLsizei n, const GLuint* vaos);
+void glStateDeleteBuffers(GLsizei n, const GLuint* buffers);
+void glStateDeleteTextures(GLsizei n, const GLuint* textures);
+
+// Marks the end of a frame: the counters restart from zero, and glStateGetFrameStats returns
+// those of the frame that just ended
+void glStateEndFrame();
+GlStateStats glStateGetFrameStats();
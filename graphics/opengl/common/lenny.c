@@ -0,0 +1,1694 @@
+// Generated by tools/bake_mesh.py from tools/lenny_flat.c, do not edit.
+// 3345 flat vertices welded into 1176 unique ones; ACMR (32-entry FIFO) 1.192 -> 1.062
+#include "lenny.h"
+
+const lennyVertex lennyVertices[1176] =
+{
+	{ -0.387339, 0.141317, -0.179352, 0x000001FF },
+	{ -0.387339, 0.142913, -0.149352, 0x000001FF },
+	{ -0.387339, 0.141317, -0.149352, 0x000001FF },
+	{ -0.387339, 0.142913, -0.179352, 0x000001FF },
+	{ -0.387339, 0.142913, -0.179352, 0x0007FC00 },
+	{ -0.423897, 0.142913, -0.149352, 0x0007FC00 },
+	{ -0.387339, 0.142913, -0.149352, 0x0007FC00 },
+	{ -0.423897, 0.142913, -0.179352, 0x0007FC00 },
+	{ -0.423897, -0.171263, -0.179352, 0x00080400 },
+	{ -0.387339, -0.171263, -0.149352, 0x00080400 },
+	{ -0.423897, -0.171263, -0.149352, 0x00080400 },
+	{ -0.387339, -0.171263, -0.179352, 0x00080400 },
+	{ -0.387339, -0.171263, -0.149352, 0x000001FF },
+	{ -0.387339, -0.169666, -0.179352, 0x000001FF },
+	{ -0.387339, -0.169666, -0.149352, 0x000001FF },
+	{ -0.387339, -0.171263, -0.179352, 0x000001FF },
+	{ -0.300972, 0.0948611, -0.179352, 0x00080400 },
+	{ -0.27511, 0.0948611, -0.149352, 0x00080400 },
+	{ -0.300972, 0.0948611, -0.149352, 0x00080400 },
+	{ -0.27511, 0.0948611, -0.179352, 0x00080400 },
+	{ -0.0734815, 0.0948611, -0.179352, 0x00080400 },
+	{ -0.0476195, 0.0948611, -0.149352, 0x00080400 },
+	{ -0.0734815, 0.0948611, -0.149352, 0x00080400 },
+	{ -0.0476195, 0.0948611, -0.179352, 0x00080400 },
+	{ -0.118022, -0.112195, -0.179352, 0x0007FC00 },
+	{ -0.143884, -0.112195, -0.149352, 0x0007FC00 },
+	{ -0.118022, -0.112195, -0.149352, 0x0007FC00 },
+	{ -0.143884, -0.112195, -0.179352, 0x0007FC00 },
+	{ 0.0836066, -0.112195, -0.149352, 0x0007FC00 },
+	{ 0.109469, -0.112195, -0.179352, 0x0007FC00 },
+	{ 0.0836066, -0.112195, -0.179352, 0x0007FC00 },
+	{ 0.109469, -0.112195, -0.149352, 0x0007FC00 },
+	{ 0.0574252, 0.142913, -0.179352, 0x000001FF },
+	{ 0.0574252, 0.075704, -0.149352, 0x000001FF },
+	{ 0.0574252, 0.075704, -0.179352, 0x000001FF },
+	{ 0.0574252, 0.142913, -0.149352, 0x000001FF },
+	{ 0.0574252, 0.142913, -0.179352, 0x0007FC00 },
+	{ 0.0274125, 0.142913, -0.149352, 0x0007FC00 },
+	{ 0.0574252, 0.142913, -0.149352, 0x0007FC00 },
+	{ 0.0274125, 0.142913, -0.179352, 0x0007FC00 },
+	{ 0.0274125, 0.0509594, -0.179352, 0x00000201 },
+	{ 0.0274125, 0.142913, -0.149352, 0x00000201 },
+	{ 0.0274125, 0.142913, -0.179352, 0x00000201 },
+	{ 0.0274125, 0.0509594, -0.149352, 0x00000201 },
+	{ -0.0116999, -0.0954327, -0.149352, 0x00000201 },
+	{ -0.0116999, -0.0617481, -0.179352, 0x00000201 },
+	{ -0.0116999, -0.0954327, -0.179352, 0x00000201 },
+	{ -0.0116999, -0.0617481, -0.149352, 0x00000201 },
+	{ -0.00994386, -0.0617481, -0.179352, 0x0007FC00 },
+	{ -0.0116999, -0.0617481, -0.149352, 0x0007FC00 },
+	{ -0.00994386, -0.0617481, -0.149352, 0x0007FC00 },
+	{ -0.0116999, -0.0617481, -0.179352, 0x0007FC00 },
+	{ 0.208128, 0.0948611, -0.179352, 0x00080400 },
+	{ 0.23399, 0.0948611, -0.149352, 0x00080400 },
+	{ 0.208128, 0.0948611, -0.149352, 0x00080400 },
+	{ 0.23399, 0.0948611, -0.179352, 0x00080400 },
+	{ 0.401455, 0.142913, -0.149352, 0x00000201 },
+	{ 0.401455, 0.141317, -0.179352, 0x00000201 },
+	{ 0.401455, 0.141317, -0.149352, 0x00000201 },
+	{ 0.401455, 0.142913, -0.179352, 0x00000201 },
+	{ 0.401455, -0.171263, -0.179352, 0x00000201 },
+	{ 0.401455, -0.169666, -0.149352, 0x00000201 },
+	{ 0.401455, -0.169666, -0.179352, 0x00000201 },
+	{ 0.401455, -0.171263, -0.149352, 0x00000201 },
+	{ 0.401455, -0.171263, -0.179352, 0x00080400 },
+	{ 0.438013, -0.171263, -0.149352, 0x00080400 },
+	{ 0.401455, -0.171263, -0.149352, 0x00080400 },
+	{ 0.438013, -0.171263, -0.179352, 0x00080400 },
+	{ -0.48246, 0.00967688, -0.179352, 0x20100000 },
+	{ -0.48245, -0.0384802, -0.179352, 0x20100000 },
+	{ -0.483443, -0.0141747, -0.179352, 0x20100000 },
+	{ -0.479512, 0.0320617, -0.179352, 0x20100000 },
+	{ -0.479472, -0.0611096, -0.179352, 0x20100000 },
+	{ -0.474598, 0.0529799, -0.179352, 0x20100000 },
+	{ -0.474508, -0.0820626, -0.179352, 0x20100000 },
+	{ -0.467718, 0.0724313, -0.179352, 0x20100000 },
+	{ -0.467559, -0.101339, -0.179352, 0x20100000 },
+	{ -0.448901, 0.10877, -0.179352, 0x20100000 },
+	{ -0.455346, -0.0141747, -0.179352, 0x20100000 },
+	{ -0.448701, -0.137259, -0.179352, 0x20100000 },
+	{ -0.45385, 0.0113681, -0.179352, 0x20100000 },
+	{ -0.453889, -0.0403161, -0.179352, 0x20100000 },
+	{ -0.44936, 0.0356337, -0.179352, 0x20100000 },
+	{ -0.449519, -0.0641428, -0.179352, 0x20100000 },
+	{ -0.442475, 0.058263, -0.179352, 0x20100000 },
+	{ -0.442675, -0.0862532, -0.179352, 0x20100000 },
+	{ -0.423897, 0.142913, -0.179352, 0x20100000 },
+	{ -0.423897, -0.171263, -0.179352, 0x20100000 },
+	{ -0.433794, 0.0788968, -0.179352, 0x20100000 },
+	{ -0.433794, -0.107246, -0.179352, 0x20100000 },
+	{ -0.423318, 0.0979142, -0.179352, 0x20100000 },
+	{ -0.423537, -0.125944, -0.179352, 0x20100000 },
+	{ -0.412003, 0.114417, -0.179352, 0x20100000 },
+	{ -0.411923, -0.142767, -0.179352, 0x20100000 },
+	{ -0.387339, 0.142913, -0.179352, 0x20100000 },
+	{ -0.387339, 0.141317, -0.179352, 0x20100000 },
+	{ -0.387339, -0.171263, -0.179352, 0x20100000 },
+	{ -0.387339, -0.169666, -0.179352, 0x20100000 },
+	{ -0.48245, -0.0384802, -0.149352, 0x1FF00000 },
+	{ -0.48246, 0.00967688, -0.149352, 0x1FF00000 },
+	{ -0.483443, -0.0141747, -0.149352, 0x1FF00000 },
+	{ -0.479512, 0.0320617, -0.149352, 0x1FF00000 },
+	{ -0.479472, -0.0611096, -0.149352, 0x1FF00000 },
+	{ -0.474598, 0.0529799, -0.149352, 0x1FF00000 },
+	{ -0.474508, -0.0820626, -0.149352, 0x1FF00000 },
+	{ -0.467718, 0.0724313, -0.149352, 0x1FF00000 },
+	{ -0.467559, -0.101339, -0.149352, 0x1FF00000 },
+	{ -0.448901, 0.10877, -0.149352, 0x1FF00000 },
+	{ -0.455346, -0.0141747, -0.149352, 0x1FF00000 },
+	{ -0.448701, -0.137259, -0.149352, 0x1FF00000 },
+	{ -0.45385, 0.0113681, -0.149352, 0x1FF00000 },
+	{ -0.453889, -0.0403161, -0.149352, 0x1FF00000 },
+	{ -0.44936, 0.0356337, -0.149352, 0x1FF00000 },
+	{ -0.449519, -0.0641428, -0.149352, 0x1FF00000 },
+	{ -0.442475, 0.058263, -0.149352, 0x1FF00000 },
+	{ -0.442675, -0.0862532, -0.149352, 0x1FF00000 },
+	{ -0.423897, 0.142913, -0.149352, 0x1FF00000 },
+	{ -0.423897, -0.171263, -0.149352, 0x1FF00000 },
+	{ -0.433794, 0.0788968, -0.149352, 0x1FF00000 },
+	{ -0.433794, -0.107246, -0.149352, 0x1FF00000 },
+	{ -0.423318, 0.0979142, -0.149352, 0x1FF00000 },
+	{ -0.423537, -0.125944, -0.149352, 0x1FF00000 },
+	{ -0.412003, 0.114417, -0.149352, 0x1FF00000 },
+	{ -0.411923, -0.142767, -0.149352, 0x1FF00000 },
+	{ -0.387339, 0.142913, -0.149352, 0x1FF00000 },
+	{ -0.387339, 0.141317, -0.149352, 0x1FF00000 },
+	{ -0.387339, -0.171263, -0.149352, 0x1FF00000 },
+	{ -0.387339, -0.169666, -0.149352, 0x1FF00000 },
+	{ -0.448701, -0.137259, -0.149352, 0x000BCA4E },
+	{ -0.423897, -0.171263, -0.179352, 0x000B4E63 },
+	{ -0.423897, -0.171263, -0.149352, 0x000B4E63 },
+	{ -0.448701, -0.137259, -0.179352, 0x000BCA4E },
+	{ -0.467559, -0.101339, -0.149352, 0x000CCA2C },
+	{ -0.467559, -0.101339, -0.179352, 0x000CCA2C },
+	{ -0.474508, -0.0820626, -0.179352, 0x000DBA16 },
+	{ -0.474508, -0.0820626, -0.149352, 0x000DBA16 },
+	{ -0.479472, -0.0611096, -0.179352, 0x000E9209 },
+	{ -0.479472, -0.0611096, -0.149352, 0x000E9209 },
+	{ -0.48245, -0.0384802, -0.179352, 0x000F5203 },
+	{ -0.48245, -0.0384802, -0.149352, 0x000F5203 },
+	{ -0.483443, -0.0141747, -0.149352, 0x00000201 },
+	{ -0.483443, -0.0141747, -0.179352, 0x00000201 },
+	{ -0.48246, 0.00967688, -0.149352, 0x0000B203 },
+	{ -0.48246, 0.00967688, -0.179352, 0x0000B203 },
+	{ -0.479512, 0.0320617, -0.149352, 0x00017209 },
+	{ -0.479512, 0.0320617, -0.179352, 0x00017209 },
+	{ -0.474598, 0.0529799, -0.149352, 0x00024216 },
+	{ -0.474598, 0.0529799, -0.179352, 0x00024216 },
+	{ -0.467718, 0.0724313, -0.149352, 0x00032E2B },
+	{ -0.467718, 0.0724313, -0.179352, 0x00032E2B },
+	{ -0.448901, 0.10877, -0.149352, 0x0004364E },
+	{ -0.448901, 0.10877, -0.179352, 0x0004364E },
+	{ -0.423897, 0.142913, -0.149352, 0x0004BA64 },
+	{ -0.423897, 0.142913, -0.179352, 0x0004BA64 },
+	{ -0.412003, 0.114417, -0.149352, 0x000B0990 },
+	{ -0.387339, 0.141317, -0.179352, 0x000A9D79 },
+	{ -0.387339, 0.141317, -0.149352, 0x000A9D79 },
+	{ -0.412003, 0.114417, -0.179352, 0x000B0990 },
+	{ -0.423318, 0.0979142, -0.149352, 0x000BD1B3 },
+	{ -0.423318, 0.0979142, -0.179352, 0x000BD1B3 },
+	{ -0.433794, 0.0788968, -0.149352, 0x000C85CC },
+	{ -0.433794, 0.0788968, -0.179352, 0x000C85CC },
+	{ -0.442475, 0.058263, -0.149352, 0x000D49E1 },
+	{ -0.442475, 0.058263, -0.179352, 0x000D49E1 },
+	{ -0.44936, 0.0356337, -0.149352, 0x000E1DF0 },
+	{ -0.44936, 0.0356337, -0.179352, 0x000E1DF0 },
+	{ -0.45385, 0.0113681, -0.149352, 0x000F09FB },
+	{ -0.45385, 0.0113681, -0.179352, 0x000F09FB },
+	{ -0.455346, -0.0141747, -0.149352, 0x000FFDFF },
+	{ -0.455346, -0.0141747, -0.179352, 0x000FFDFF },
+	{ -0.453889, -0.0403161, -0.149352, 0x0000F1FB },
+	{ -0.453889, -0.0403161, -0.179352, 0x0000F1FB },
+	{ -0.449519, -0.0641428, -0.149352, 0x0001E9F0 },
+	{ -0.449519, -0.0641428, -0.179352, 0x0001E9F0 },
+	{ -0.442675, -0.0862532, -0.149352, 0x0002BDE0 },
+	{ -0.442675, -0.0862532, -0.179352, 0x0002BDE0 },
+	{ -0.433794, -0.107246, -0.149352, 0x00037DCC },
+	{ -0.433794, -0.107246, -0.179352, 0x00037DCC },
+	{ -0.423537, -0.125944, -0.179352, 0x000431B3 },
+	{ -0.423537, -0.125944, -0.149352, 0x000431B3 },
+	{ -0.411923, -0.142767, -0.149352, 0x0004F990 },
+	{ -0.411923, -0.142767, -0.179352, 0x0004F990 },
+	{ -0.387339, -0.169666, -0.149352, 0x00056579 },
+	{ -0.387339, -0.169666, -0.179352, 0x00056579 },
+	{ -0.29061, 0.109117, -0.149352, 0x00052279 },
+	{ -0.300972, 0.0948611, -0.179352, 0x0004B263 },
+	{ -0.300972, 0.0948611, -0.149352, 0x0004B263 },
+	{ -0.29061, 0.109117, -0.179352, 0x00052279 },
+	{ -0.278682, 0.121471, -0.149352, 0x0005F2AB },
+	{ -0.278682, 0.121471, -0.179352, 0x0005F2AB },
+	{ -0.265187, 0.131926, -0.179352, 0x0006A6E5 },
+	{ -0.265187, 0.131926, -0.149352, 0x0006A6E5 },
+	{ -0.250126, 0.140479, -0.179352, 0x00073322 },
+	{ -0.250126, 0.140479, -0.149352, 0x00073322 },
+	{ -0.233498, 0.147131, -0.179352, 0x00079760 },
+	{ -0.233498, 0.147131, -0.149352, 0x00079760 },
+	{ -0.215304, 0.151883, -0.179352, 0x0007D79B },
+	{ -0.215304, 0.151883, -0.149352, 0x0007D79B },
+	{ -0.195543, 0.154734, -0.179352, 0x0007F7D0 },
+	{ -0.195543, 0.154734, -0.149352, 0x0007F7D0 },
+	{ -0.174216, 0.155685, -0.149352, 0x0007FC00 },
+	{ -0.174216, 0.155685, -0.179352, 0x0007FC00 },
+	{ -0.152926, 0.154734, -0.179352, 0x0007F430 },
+	{ -0.152926, 0.154734, -0.149352, 0x0007F430 },
+	{ -0.133198, 0.151883, -0.179352, 0x0007D465 },
+	{ -0.133198, 0.151883, -0.149352, 0x0007D465 },
+	{ -0.115031, 0.147131, -0.179352, 0x000794A0 },
+	{ -0.115031, 0.147131, -0.149352, 0x000794A0 },
+	{ -0.0984257, 0.140479, -0.179352, 0x000730DE },
+	{ -0.0984257, 0.140479, -0.149352, 0x000730DE },
+	{ -0.0833819, 0.131926, -0.179352, 0x0006A51C },
+	{ -0.0833819, 0.131926, -0.149352, 0x0006A51C },
+	{ -0.0698996, 0.121471, -0.179352, 0x0005F155 },
+	{ -0.0698996, 0.121471, -0.149352, 0x0005F155 },
+	{ -0.0579788, 0.109117, -0.149352, 0x00052188 },
+	{ -0.0579788, 0.109117, -0.179352, 0x00052188 },
+	{ -0.0476195, 0.0948611, -0.149352, 0x0004B19D },
+	{ -0.0476195, 0.0948611, -0.179352, 0x0004B19D },
+	{ -0.256132, 0.0879765, -0.179352, 0x20100000 },
+	{ -0.256122, 0.0633018, -0.179352, 0x20100000 },
+	{ -0.25723, 0.075704, -0.179352, 0x20100000 },
+	{ -0.25284, 0.0992512, -0.179352, 0x20100000 },
+	{ -0.2528, 0.0519572, -0.179352, 0x20100000 },
+	{ -0.247352, 0.109528, -0.179352, 0x20100000 },
+	{ -0.247262, 0.0416702, -0.179352, 0x20100000 },
+	{ -0.239669, 0.118807, -0.179352, 0x20100000 },
+	{ -0.23951, 0.0324409, -0.179352, 0x20100000 },
+	{ -0.23038, 0.12649, -0.179352, 0x20100000 },
+	{ -0.232166, 0.075704, -0.179352, 0x20100000 },
+	{ -0.230171, 0.0248279, -0.179352, 0x20100000 },
+	{ -0.229612, 0.0898323, -0.179352, 0x20100000 },
+	{ -0.229552, 0.0613761, -0.179352, 0x20100000 },
+	{ -0.220073, 0.131978, -0.179352, 0x20100000 },
+	{ -0.219874, 0.0193901, -0.179352, 0x20100000 },
+	{ -0.221949, 0.101566, -0.179352, 0x20100000 },
+	{ -0.22171, 0.0496823, -0.179352, 0x20100000 },
+	{ -0.210455, 0.109468, -0.179352, 0x20100000 },
+	{ -0.210155, 0.0418997, -0.179352, 0x20100000 },
+	{ -0.208749, 0.135271, -0.179352, 0x20100000 },
+	{ -0.208619, 0.0161274, -0.179352, 0x20100000 },
+	{ -0.196406, 0.112102, -0.179352, 0x20100000 },
+	{ -0.196406, 0.0393055, -0.179352, 0x20100000 },
+	{ -0.196406, 0.136368, -0.179352, 0x20100000 },
+	{ -0.196406, 0.0150399, -0.179352, 0x20100000 },
+	{ -0.184064, 0.135271, -0.179352, 0x20100000 },
+	{ -0.182358, 0.0419596, -0.179352, 0x20100000 },
+	{ -0.182358, 0.109468, -0.179352, 0x20100000 },
+	{ -0.184064, 0.0161374, -0.179352, 0x20100000 },
+	{ -0.172739, 0.131978, -0.179352, 0x20100000 },
+	{ -0.172739, 0.01943, -0.179352, 0x20100000 },
+	{ -0.170863, 0.101566, -0.179352, 0x20100000 },
+	{ -0.170863, 0.0499217, -0.179352, 0x20100000 },
+	{ -0.162432, 0.12649, -0.179352, 0x20100000 },
+	{ -0.162432, 0.0249177, -0.179352, 0x20100000 },
+	{ -0.163201, 0.0898323, -0.179352, 0x20100000 },
+	{ -0.163201, 0.0616754, -0.179352, 0x20100000 },
+	{ -0.160646, 0.075704, -0.179352, 0x20100000 },
+	{ -0.153143, 0.118807, -0.179352, 0x20100000 },
+	{ -0.153143, 0.0326005, -0.179352, 0x20100000 },
+	{ -0.14546, 0.109528, -0.179352, 0x20100000 },
+	{ -0.14546, 0.0418797, -0.179352, 0x20100000 },
+	{ -0.139973, 0.0992512, -0.179352, 0x20100000 },
+	{ -0.139973, 0.0521567, -0.179352, 0x20100000 },
+	{ -0.13668, 0.0879765, -0.179352, 0x20100000 },
+	{ -0.13668, 0.0634315, -0.179352, 0x20100000 },
+	{ -0.135582, 0.075704, -0.179352, 0x20100000 },
+	{ -0.256122, 0.0633018, -0.149352, 0x1FF00000 },
+	{ -0.256132, 0.0879765, -0.149352, 0x1FF00000 },
+	{ -0.25723, 0.075704, -0.149352, 0x1FF00000 },
+	{ -0.25284, 0.0992512, -0.149352, 0x1FF00000 },
+	{ -0.2528, 0.0519572, -0.149352, 0x1FF00000 },
+	{ -0.247352, 0.109528, -0.149352, 0x1FF00000 },
+	{ -0.247262, 0.0416702, -0.149352, 0x1FF00000 },
+	{ -0.239669, 0.118807, -0.149352, 0x1FF00000 },
+	{ -0.23951, 0.0324409, -0.149352, 0x1FF00000 },
+	{ -0.23038, 0.12649, -0.149352, 0x1FF00000 },
+	{ -0.232166, 0.075704, -0.149352, 0x1FF00000 },
+	{ -0.230171, 0.0248279, -0.149352, 0x1FF00000 },
+	{ -0.229612, 0.0898323, -0.149352, 0x1FF00000 },
+	{ -0.229552, 0.0613761, -0.149352, 0x1FF00000 },
+	{ -0.22987, 0.126762, -0.149352, 0x1FF00000 },
+	{ -0.219874, 0.0193901, -0.149352, 0x1FF00000 },
+	{ -0.22171, 0.0496823, -0.149352, 0x1FF00000 },
+	{ -0.210155, 0.0418997, -0.149352, 0x1FF00000 },
+	{ -0.208619, 0.0161274, -0.149352, 0x1FF00000 },
+	{ -0.196406, 0.0393055, -0.149352, 0x1FF00000 },
+	{ -0.196406, 0.0150399, -0.149352, 0x1FF00000 },
+	{ -0.184064, 0.0161374, -0.149352, 0x1FF00000 },
+	{ -0.182358, 0.0419596, -0.149352, 0x1FF00000 },
+	{ -0.172739, 0.01943, -0.149352, 0x1FF00000 },
+	{ -0.170863, 0.0499217, -0.149352, 0x1FF00000 },
+	{ -0.162432, 0.0249177, -0.149352, 0x1FF00000 },
+	{ -0.163201, 0.0616754, -0.149352, 0x1FF00000 },
+	{ -0.160646, 0.075704, -0.149352, 0x1FF00000 },
+	{ -0.153143, 0.0326005, -0.149352, 0x1FF00000 },
+	{ -0.153143, 0.118807, -0.149352, 0x1FF00000 },
+	{ -0.14546, 0.0418797, -0.149352, 0x1FF00000 },
+	{ -0.162432, 0.12649, -0.149352, 0x1FF00000 },
+	{ -0.14546, 0.109528, -0.149352, 0x1FF00000 },
+	{ -0.163201, 0.0898323, -0.149352, 0x1FF00000 },
+	{ -0.139973, 0.0521567, -0.149352, 0x1FF00000 },
+	{ -0.170863, 0.101566, -0.149352, 0x1FF00000 },
+	{ -0.139973, 0.0992512, -0.149352, 0x1FF00000 },
+	{ -0.172739, 0.131978, -0.149352, 0x1FF00000 },
+	{ -0.13668, 0.0634315, -0.149352, 0x1FF00000 },
+	{ -0.182358, 0.109468, -0.149352, 0x1FF00000 },
+	{ -0.13668, 0.0879765, -0.149352, 0x1FF00000 },
+	{ -0.135582, 0.075704, -0.149352, 0x1FF00000 },
+	{ -0.182425, 0.134794, -0.149352, 0x1FF00000 },
+	{ -0.196406, 0.112102, -0.149352, 0x1FF00000 },
+	{ -0.207491, 0.132876, -0.149352, 0x1FF00000 },
+	{ -0.210455, 0.109468, -0.149352, 0x1FF00000 },
+	{ -0.221949, 0.101566, -0.149352, 0x1FF00000 },
+	{ -0.220073, 0.131978, -0.149352, 0x1FF00000 },
+	{ -0.215304, 0.151883, -0.149352, 0x1FF00000 },
+	{ -0.233498, 0.147131, -0.149352, 0x1FF00000 },
+	{ -0.235319, 0.125273, -0.149352, 0x1FF00000 },
+	{ -0.250126, 0.140479, -0.149352, 0x1FF00000 },
+	{ -0.257859, 0.112601, -0.149352, 0x1FF00000 },
+	{ -0.265187, 0.131926, -0.149352, 0x1FF00000 },
+	{ -0.27511, 0.0948611, -0.149352, 0x1FF00000 },
+	{ -0.278682, 0.121471, -0.149352, 0x1FF00000 },
+	{ -0.29061, 0.109117, -0.149352, 0x1FF00000 },
+	{ -0.300972, 0.0948611, -0.149352, 0x1FF00000 },
+	{ -0.208749, 0.135271, -0.149352, 0x1FF00000 },
+	{ -0.195543, 0.154734, -0.149352, 0x1FF00000 },
+	{ -0.196406, 0.136368, -0.149352, 0x1FF00000 },
+	{ -0.184064, 0.135271, -0.149352, 0x1FF00000 },
+	{ -0.174216, 0.155685, -0.149352, 0x1FF00000 },
+	{ -0.174376, 0.13541, -0.149352, 0x1FF00000 },
+	{ -0.14119, 0.132876, -0.149352, 0x1FF00000 },
+	{ -0.152926, 0.154734, -0.149352, 0x1FF00000 },
+	{ -0.133198, 0.151883, -0.149352, 0x1FF00000 },
+	{ -0.113312, 0.125273, -0.149352, 0x1FF00000 },
+	{ -0.115031, 0.147131, -0.149352, 0x1FF00000 },
+	{ -0.0984257, 0.140479, -0.149352, 0x1FF00000 },
+	{ -0.0907429, 0.112601, -0.149352, 0x1FF00000 },
+	{ -0.0833819, 0.131926, -0.149352, 0x1FF00000 },
+	{ -0.0734815, 0.0948611, -0.149352, 0x1FF00000 },
+	{ -0.0698996, 0.121471, -0.149352, 0x1FF00000 },
+	{ -0.0476195, 0.0948611, -0.149352, 0x1FF00000 },
+	{ -0.0579788, 0.109117, -0.149352, 0x1FF00000 },
+	{ -0.0476195, 0.0948611, -0.179352, 0x20100000 },
+	{ -0.0698996, 0.121471, -0.179352, 0x20100000 },
+	{ -0.0579788, 0.109117, -0.179352, 0x20100000 },
+	{ -0.0734815, 0.0948611, -0.179352, 0x20100000 },
+	{ -0.0833819, 0.131926, -0.179352, 0x20100000 },
+	{ -0.0907429, 0.112601, -0.179352, 0x20100000 },
+	{ -0.0984257, 0.140479, -0.179352, 0x20100000 },
+	{ -0.113312, 0.125273, -0.179352, 0x20100000 },
+	{ -0.115031, 0.147131, -0.179352, 0x20100000 },
+	{ -0.133198, 0.151883, -0.179352, 0x20100000 },
+	{ -0.14119, 0.132876, -0.179352, 0x20100000 },
+	{ -0.152926, 0.154734, -0.179352, 0x20100000 },
+	{ -0.174216, 0.155685, -0.179352, 0x20100000 },
+	{ -0.174376, 0.13541, -0.179352, 0x20100000 },
+	{ -0.195543, 0.154734, -0.179352, 0x20100000 },
+	{ -0.207491, 0.132876, -0.179352, 0x20100000 },
+	{ -0.215304, 0.151883, -0.179352, 0x20100000 },
+	{ -0.233498, 0.147131, -0.179352, 0x20100000 },
+	{ -0.235319, 0.125273, -0.179352, 0x20100000 },
+	{ -0.250126, 0.140479, -0.179352, 0x20100000 },
+	{ -0.257859, 0.112601, -0.179352, 0x20100000 },
+	{ -0.265187, 0.131926, -0.179352, 0x20100000 },
+	{ -0.27511, 0.0948611, -0.179352, 0x20100000 },
+	{ -0.278682, 0.121471, -0.179352, 0x20100000 },
+	{ -0.29061, 0.109117, -0.179352, 0x20100000 },
+	{ -0.300972, 0.0948611, -0.179352, 0x20100000 },
+	{ -0.133522, -0.126451, -0.179352, 0x000AE279 },
+	{ -0.143884, -0.112195, -0.149352, 0x000B5263 },
+	{ -0.143884, -0.112195, -0.179352, 0x000B5263 },
+	{ -0.133522, -0.126451, -0.149352, 0x000AE279 },
+	{ -0.121594, -0.138806, -0.179352, 0x000A12AB },
+	{ -0.121594, -0.138806, -0.149352, 0x000A12AB },
+	{ -0.108099, -0.14926, -0.149352, 0x00095EE5 },
+	{ -0.108099, -0.14926, -0.179352, 0x00095EE5 },
+	{ -0.0930377, -0.157813, -0.149352, 0x0008D322 },
+	{ -0.0930377, -0.157813, -0.179352, 0x0008D322 },
+	{ -0.07641, -0.164466, -0.149352, 0x00086F60 },
+	{ -0.07641, -0.164466, -0.179352, 0x00086F60 },
+	{ -0.0582157, -0.169217, -0.149352, 0x00082F9B },
+	{ -0.0582157, -0.169217, -0.179352, 0x00082F9B },
+	{ -0.038455, -0.172069, -0.149352, 0x00080FD0 },
+	{ -0.038455, -0.172069, -0.179352, 0x00080FD0 },
+	{ -0.0171278, -0.173019, -0.149352, 0x00080400 },
+	{ -0.0171278, -0.173019, -0.179352, 0x00080400 },
+	{ 0.00416204, -0.172069, -0.149352, 0x00080C30 },
+	{ 0.00416204, -0.172069, -0.179352, 0x00080C30 },
+	{ 0.0238903, -0.169217, -0.149352, 0x00082C65 },
+	{ 0.0238903, -0.169217, -0.179352, 0x00082C65 },
+	{ 0.0420572, -0.164466, -0.149352, 0x00086CA0 },
+	{ 0.0420572, -0.164466, -0.179352, 0x00086CA0 },
+	{ 0.0586625, -0.157813, -0.149352, 0x0008D0DE },
+	{ 0.0586625, -0.157813, -0.179352, 0x0008D0DE },
+	{ 0.0737063, -0.14926, -0.149352, 0x00095D1C },
+	{ 0.0737063, -0.14926, -0.179352, 0x00095D1C },
+	{ 0.0871886, -0.138806, -0.149352, 0x000A1155 },
+	{ 0.0871886, -0.138806, -0.179352, 0x000A1155 },
+	{ 0.0991094, -0.126451, -0.179352, 0x000AE188 },
+	{ 0.0991094, -0.126451, -0.149352, 0x000AE188 },
+	{ 0.109469, -0.112195, -0.179352, 0x000B519D },
+	{ 0.109469, -0.112195, -0.149352, 0x000B519D },
+	{ 0.109469, -0.112195, -0.149352, 0x1FF00000 },
+	{ 0.0871886, -0.138806, -0.149352, 0x1FF00000 },
+	{ 0.0991094, -0.126451, -0.149352, 0x1FF00000 },
+	{ 0.0836066, -0.112195, -0.149352, 0x1FF00000 },
+	{ 0.0737063, -0.14926, -0.149352, 0x1FF00000 },
+	{ 0.0663452, -0.129935, -0.149352, 0x1FF00000 },
+	{ 0.0586625, -0.157813, -0.149352, 0x1FF00000 },
+	{ 0.0437758, -0.142607, -0.149352, 0x1FF00000 },
+	{ 0.0420572, -0.164466, -0.149352, 0x1FF00000 },
+	{ 0.0238903, -0.169217, -0.149352, 0x1FF00000 },
+	{ 0.0158982, -0.15021, -0.149352, 0x1FF00000 },
+	{ 0.00416204, -0.172069, -0.149352, 0x1FF00000 },
+	{ -0.0171278, -0.173019, -0.149352, 0x1FF00000 },
+	{ -0.0172874, -0.152744, -0.149352, 0x1FF00000 },
+	{ -0.038455, -0.172069, -0.149352, 0x1FF00000 },
+	{ -0.0504032, -0.15021, -0.149352, 0x1FF00000 },
+	{ -0.0582157, -0.169217, -0.149352, 0x1FF00000 },
+	{ -0.07641, -0.164466, -0.149352, 0x1FF00000 },
+	{ -0.0782309, -0.142607, -0.149352, 0x1FF00000 },
+	{ -0.0930377, -0.157813, -0.149352, 0x1FF00000 },
+	{ -0.10077, -0.129935, -0.149352, 0x1FF00000 },
+	{ -0.108099, -0.14926, -0.149352, 0x1FF00000 },
+	{ -0.118022, -0.112195, -0.149352, 0x1FF00000 },
+	{ -0.121594, -0.138806, -0.149352, 0x1FF00000 },
+	{ -0.133522, -0.126451, -0.149352, 0x1FF00000 },
+	{ -0.143884, -0.112195, -0.149352, 0x1FF00000 },
+	{ 0.0871886, -0.138806, -0.179352, 0x20100000 },
+	{ 0.109469, -0.112195, -0.179352, 0x20100000 },
+	{ 0.0991094, -0.126451, -0.179352, 0x20100000 },
+	{ 0.0836066, -0.112195, -0.179352, 0x20100000 },
+	{ 0.0737063, -0.14926, -0.179352, 0x20100000 },
+	{ 0.0663452, -0.129935, -0.179352, 0x20100000 },
+	{ 0.0586625, -0.157813, -0.179352, 0x20100000 },
+	{ 0.0437758, -0.142607, -0.179352, 0x20100000 },
+	{ 0.0420572, -0.164466, -0.179352, 0x20100000 },
+	{ 0.0238903, -0.169217, -0.179352, 0x20100000 },
+	{ 0.0158982, -0.15021, -0.179352, 0x20100000 },
+	{ 0.00416204, -0.172069, -0.179352, 0x20100000 },
+	{ -0.0171278, -0.173019, -0.179352, 0x20100000 },
+	{ -0.0172874, -0.152744, -0.179352, 0x20100000 },
+	{ -0.038455, -0.172069, -0.179352, 0x20100000 },
+	{ -0.0504032, -0.15021, -0.179352, 0x20100000 },
+	{ -0.0582157, -0.169217, -0.179352, 0x20100000 },
+	{ -0.07641, -0.164466, -0.179352, 0x20100000 },
+	{ -0.0782309, -0.142607, -0.179352, 0x20100000 },
+	{ -0.0930377, -0.157813, -0.179352, 0x20100000 },
+	{ -0.10077, -0.129935, -0.179352, 0x20100000 },
+	{ -0.108099, -0.14926, -0.179352, 0x20100000 },
+	{ -0.118022, -0.112195, -0.179352, 0x20100000 },
+	{ -0.121594, -0.138806, -0.179352, 0x20100000 },
+	{ -0.133522, -0.126451, -0.179352, 0x20100000 },
+	{ -0.143884, -0.112195, -0.179352, 0x20100000 },
+	{ 0.0274125, 0.0509594, -0.179352, 0x00080400 },
+	{ 0.041461, 0.0509594, -0.149352, 0x00080BE5 },
+	{ 0.0274125, 0.0509594, -0.149352, 0x00080400 },
+	{ 0.041461, 0.0509594, -0.179352, 0x00080BE5 },
+	{ 0.0539031, 0.0496224, -0.149352, 0x00083F8B },
+	{ 0.0539031, 0.0496224, -0.179352, 0x00083F8B },
+	{ 0.0647289, 0.0456114, -0.149352, 0x0008F70F },
+	{ 0.0647289, 0.0456114, -0.179352, 0x0008F70F },
+	{ 0.0739382, 0.0389264, -0.149352, 0x000A36A0 },
+	{ 0.0739382, 0.0389264, -0.179352, 0x000A36A0 },
+	{ 0.0815312, 0.0295673, -0.179352, 0x000BEA4A },
+	{ 0.0815312, 0.0295673, -0.149352, 0x000BEA4A },
+	{ 0.0901519, 0.00901337, -0.179352, 0x000DFE11 },
+	{ 0.0901519, 0.00901337, -0.149352, 0x000DFE11 },
+	{ 0.0930255, -0.0165693, -0.179352, 0x000FFE01 },
+	{ 0.0930255, -0.0165693, -0.149352, 0x000FFE01 },
+	{ 0.0902317, -0.0423516, -0.179352, 0x0001FE11 },
+	{ 0.0902317, -0.0423516, -0.149352, 0x0001FE11 },
+	{ 0.0818505, -0.0625463, -0.149352, 0x00041E4A },
+	{ 0.0818505, -0.0625463, -0.179352, 0x00041E4A },
+	{ 0.0742974, -0.0716958, -0.149352, 0x0005DEA4 },
+	{ 0.0742974, -0.0716958, -0.179352, 0x0005DEA4 },
+	{ 0.0650482, -0.0782312, -0.149352, 0x00071714 },
+	{ 0.0650482, -0.0782312, -0.179352, 0x00071714 },
+	{ 0.0541027, -0.0821524, -0.149352, 0x0007CB8F },
+	{ 0.0541027, -0.0821524, -0.179352, 0x0007CB8F },
+	{ 0.041461, -0.0834595, -0.149352, 0x0007FFFF },
+	{ 0.041461, -0.0834595, -0.179352, 0x0007FFFF },
+	{ 0.0276519, -0.0821025, -0.179352, 0x0007D465 },
+	{ 0.0276519, -0.0821025, -0.149352, 0x0007D465 },
+	{ 0.0144814, -0.0780317, -0.149352, 0x00075CC6 },
+	{ 0.0144814, -0.0780317, -0.179352, 0x00075CC6 },
+	{ 0.00194949, -0.0712468, -0.149352, 0x0006A91A },
+	{ 0.00194949, -0.0712468, -0.179352, 0x0006A91A },
+	{ -0.00994386, -0.0617481, -0.149352, 0x00063D3F },
+	{ -0.00994386, -0.0617481, -0.179352, 0x00063D3F },
+	{ 0.0574252, 0.075704, -0.149352, 0x0007B882 },
+	{ 0.0725713, 0.0717329, -0.179352, 0x00077CB1 },
+	{ 0.0574252, 0.075704, -0.179352, 0x0007B882 },
+	{ 0.0725713, 0.0717329, -0.149352, 0x00077CB1 },
+	{ 0.0859214, 0.0652474, -0.179352, 0x0006C90E },
+	{ 0.0859214, 0.0652474, -0.149352, 0x0006C90E },
+	{ 0.0974755, 0.0562476, -0.179352, 0x0005C562 },
+	{ 0.0974755, 0.0562476, -0.149352, 0x0005C562 },
+	{ 0.107234, 0.0447334, -0.149352, 0x000495A3 },
+	{ 0.107234, 0.0447334, -0.179352, 0x000495A3 },
+	{ 0.114637, 0.0317425, -0.149352, 0x00035DD0 },
+	{ 0.114637, 0.0317425, -0.179352, 0x00035DD0 },
+	{ 0.119925, 0.017195, -0.149352, 0x000225EC },
+	{ 0.119925, 0.017195, -0.179352, 0x000225EC },
+	{ 0.123098, 0.00109111, -0.149352, 0x000105FB },
+	{ 0.123098, 0.00109111, -0.179352, 0x000105FB },
+	{ 0.124156, -0.0165693, -0.149352, 0x000FFDFF },
+	{ 0.124156, -0.0165693, -0.179352, 0x000FFDFF },
+	{ 0.122929, -0.0363849, -0.149352, 0x000EF1FA },
+	{ 0.122929, -0.0363849, -0.179352, 0x000EF1FA },
+	{ 0.119247, -0.0540055, -0.149352, 0x000DB5E9 },
+	{ 0.119247, -0.0540055, -0.179352, 0x000DB5E9 },
+	{ 0.11311, -0.0694309, -0.149352, 0x000C55C6 },
+	{ 0.11311, -0.0694309, -0.179352, 0x000C55C6 },
+	{ 0.10452, -0.0826613, -0.149352, 0x000AF18B },
+	{ 0.10452, -0.0826613, -0.179352, 0x000AF18B },
+	{ 0.0924667, -0.094395, -0.179352, 0x0009A134 },
+	{ 0.0924667, -0.094395, -0.149352, 0x0009A134 },
+	{ 0.0778595, -0.102776, -0.179352, 0x0008A8C8 },
+	{ 0.0778595, -0.102776, -0.149352, 0x0008A8C8 },
+	{ 0.0606979, -0.107805, -0.179352, 0x0008285E },
+	{ 0.0606979, -0.107805, -0.149352, 0x0008285E },
+	{ 0.0409821, -0.109481, -0.179352, 0x000807F1 },
+	{ 0.0409821, -0.109481, -0.149352, 0x000807F1 },
+	{ 0.0166366, -0.105969, -0.179352, 0x00084782 },
+	{ 0.0166366, -0.105969, -0.149352, 0x00084782 },
+	{ -0.0116999, -0.0954327, -0.179352, 0x0008874E },
+	{ -0.0116999, -0.0954327, -0.149352, 0x0008874E },
+	{ 0.041461, 0.0509594, -0.149352, 0x1FF00000 },
+	{ 0.0274125, 0.142913, -0.149352, 0x1FF00000 },
+	{ 0.0274125, 0.0509594, -0.149352, 0x1FF00000 },
+	{ 0.0574252, 0.142913, -0.149352, 0x1FF00000 },
+	{ 0.0539031, 0.0496224, -0.149352, 0x1FF00000 },
+	{ 0.0574252, 0.075704, -0.149352, 0x1FF00000 },
+	{ 0.0647289, 0.0456114, -0.149352, 0x1FF00000 },
+	{ 0.0725713, 0.0717329, -0.149352, 0x1FF00000 },
+	{ 0.0739382, 0.0389264, -0.149352, 0x1FF00000 },
+	{ 0.0859214, 0.0652474, -0.149352, 0x1FF00000 },
+	{ 0.0815312, 0.0295673, -0.149352, 0x1FF00000 },
+	{ 0.0901519, 0.00901337, -0.149352, 0x1FF00000 },
+	{ 0.0974755, 0.0562476, -0.149352, 0x1FF00000 },
+	{ 0.0930255, -0.0165693, -0.149352, 0x1FF00000 },
+	{ 0.10452, -0.0826613, -0.149352, 0x1FF00000 },
+	{ 0.107234, 0.0447334, -0.149352, 0x1FF00000 },
+	{ 0.0924667, -0.094395, -0.149352, 0x1FF00000 },
+	{ 0.11311, -0.0694309, -0.149352, 0x1FF00000 },
+	{ 0.0902317, -0.0423516, -0.149352, 0x1FF00000 },
+	{ 0.114637, 0.0317425, -0.149352, 0x1FF00000 },
+	{ 0.0818505, -0.0625463, -0.149352, 0x1FF00000 },
+	{ 0.119247, -0.0540055, -0.149352, 0x1FF00000 },
+	{ 0.0778595, -0.102776, -0.149352, 0x1FF00000 },
+	{ 0.119925, 0.017195, -0.149352, 0x1FF00000 },
+	{ 0.0742974, -0.0716958, -0.149352, 0x1FF00000 },
+	{ 0.122929, -0.0363849, -0.149352, 0x1FF00000 },
+	{ 0.0650482, -0.0782312, -0.149352, 0x1FF00000 },
+	{ 0.123098, 0.00109111, -0.149352, 0x1FF00000 },
+	{ 0.124156, -0.0165693, -0.149352, 0x1FF00000 },
+	{ 0.0606979, -0.107805, -0.149352, 0x1FF00000 },
+	{ 0.0541027, -0.0821524, -0.149352, 0x1FF00000 },
+	{ 0.041461, -0.0834595, -0.149352, 0x1FF00000 },
+	{ 0.0409821, -0.109481, -0.149352, 0x1FF00000 },
+	{ 0.0276519, -0.0821025, -0.149352, 0x1FF00000 },
+	{ 0.0166366, -0.105969, -0.149352, 0x1FF00000 },
+	{ 0.0144814, -0.0780317, -0.149352, 0x1FF00000 },
+	{ 0.00194949, -0.0712468, -0.149352, 0x1FF00000 },
+	{ -0.00994386, -0.0617481, -0.149352, 0x1FF00000 },
+	{ -0.0116999, -0.0617481, -0.149352, 0x1FF00000 },
+	{ -0.0116999, -0.0954327, -0.149352, 0x1FF00000 },
+	{ -0.00994386, -0.0617481, -0.179352, 0x20100000 },
+	{ -0.0116999, -0.0954327, -0.179352, 0x20100000 },
+	{ -0.0116999, -0.0617481, -0.179352, 0x20100000 },
+	{ 0.0166366, -0.105969, -0.179352, 0x20100000 },
+	{ 0.00194949, -0.0712468, -0.179352, 0x20100000 },
+	{ 0.0144814, -0.0780317, -0.179352, 0x20100000 },
+	{ 0.0276519, -0.0821025, -0.179352, 0x20100000 },
+	{ 0.0409821, -0.109481, -0.179352, 0x20100000 },
+	{ 0.041461, -0.0834595, -0.179352, 0x20100000 },
+	{ 0.0606979, -0.107805, -0.179352, 0x20100000 },
+	{ 0.0541027, -0.0821524, -0.179352, 0x20100000 },
+	{ 0.0650482, -0.0782312, -0.179352, 0x20100000 },
+	{ 0.0778595, -0.102776, -0.179352, 0x20100000 },
+	{ 0.0742974, -0.0716958, -0.179352, 0x20100000 },
+	{ 0.0818505, -0.0625463, -0.179352, 0x20100000 },
+	{ 0.0924667, -0.094395, -0.179352, 0x20100000 },
+	{ 0.0902317, -0.0423516, -0.179352, 0x20100000 },
+	{ 0.0930255, -0.0165693, -0.179352, 0x20100000 },
+	{ 0.10452, -0.0826613, -0.179352, 0x20100000 },
+	{ 0.0974755, 0.0562476, -0.179352, 0x20100000 },
+	{ 0.0901519, 0.00901337, -0.179352, 0x20100000 },
+	{ 0.107234, 0.0447334, -0.179352, 0x20100000 },
+	{ 0.0859214, 0.0652474, -0.179352, 0x20100000 },
+	{ 0.11311, -0.0694309, -0.179352, 0x20100000 },
+	{ 0.0815312, 0.0295673, -0.179352, 0x20100000 },
+	{ 0.114637, 0.0317425, -0.179352, 0x20100000 },
+	{ 0.0739382, 0.0389264, -0.179352, 0x20100000 },
+	{ 0.119247, -0.0540055, -0.179352, 0x20100000 },
+	{ 0.0725713, 0.0717329, -0.179352, 0x20100000 },
+	{ 0.119925, 0.017195, -0.179352, 0x20100000 },
+	{ 0.0647289, 0.0456114, -0.179352, 0x20100000 },
+	{ 0.122929, -0.0363849, -0.179352, 0x20100000 },
+	{ 0.0574252, 0.075704, -0.179352, 0x20100000 },
+	{ 0.123098, 0.00109111, -0.179352, 0x20100000 },
+	{ 0.124156, -0.0165693, -0.179352, 0x20100000 },
+	{ 0.0539031, 0.0496224, -0.179352, 0x20100000 },
+	{ 0.0574252, 0.142913, -0.179352, 0x20100000 },
+	{ 0.041461, 0.0509594, -0.179352, 0x20100000 },
+	{ 0.0274125, 0.0509594, -0.179352, 0x20100000 },
+	{ 0.0274125, 0.142913, -0.179352, 0x20100000 },
+	{ 0.218489, 0.109117, -0.149352, 0x00052279 },
+	{ 0.208128, 0.0948611, -0.179352, 0x0004B263 },
+	{ 0.208128, 0.0948611, -0.149352, 0x0004B263 },
+	{ 0.218489, 0.109117, -0.179352, 0x00052279 },
+	{ 0.230418, 0.121471, -0.149352, 0x0005F2AB },
+	{ 0.230418, 0.121471, -0.179352, 0x0005F2AB },
+	{ 0.243912, 0.131926, -0.179352, 0x0006A6E5 },
+	{ 0.243912, 0.131926, -0.149352, 0x0006A6E5 },
+	{ 0.258974, 0.140479, -0.179352, 0x00073322 },
+	{ 0.258974, 0.140479, -0.149352, 0x00073322 },
+	{ 0.275602, 0.147131, -0.179352, 0x00079760 },
+	{ 0.275602, 0.147131, -0.149352, 0x00079760 },
+	{ 0.293796, 0.151883, -0.179352, 0x0007D79B },
+	{ 0.293796, 0.151883, -0.149352, 0x0007D79B },
+	{ 0.313556, 0.154734, -0.179352, 0x0007F7D0 },
+	{ 0.313556, 0.154734, -0.149352, 0x0007F7D0 },
+	{ 0.334884, 0.155685, -0.149352, 0x0007FC00 },
+	{ 0.334884, 0.155685, -0.179352, 0x0007FC00 },
+	{ 0.356174, 0.154734, -0.179352, 0x0007F430 },
+	{ 0.356174, 0.154734, -0.149352, 0x0007F430 },
+	{ 0.375902, 0.151883, -0.179352, 0x0007D465 },
+	{ 0.375902, 0.151883, -0.149352, 0x0007D465 },
+	{ 0.394069, 0.147131, -0.179352, 0x000794A0 },
+	{ 0.394069, 0.147131, -0.149352, 0x000794A0 },
+	{ 0.410674, 0.140479, -0.179352, 0x000730DE },
+	{ 0.404597, 0.142913, -0.149352, 0x000768BE },
+	{ 0.410674, 0.140479, -0.149352, 0x000730DE },
+	{ 0.425718, 0.131926, -0.179352, 0x0006A51C },
+	{ 0.425718, 0.131926, -0.149352, 0x0006A51C },
+	{ 0.4392, 0.121471, -0.179352, 0x0005F155 },
+	{ 0.4392, 0.121471, -0.149352, 0x0005F155 },
+	{ 0.451121, 0.109117, -0.149352, 0x00052188 },
+	{ 0.451121, 0.109117, -0.179352, 0x00052188 },
+	{ 0.46148, 0.0948611, -0.149352, 0x0004B19D },
+	{ 0.46148, 0.0948611, -0.179352, 0x0004B19D },
+	{ 0.252967, 0.0879765, -0.179352, 0x20100000 },
+	{ 0.252977, 0.0633018, -0.179352, 0x20100000 },
+	{ 0.25187, 0.075704, -0.179352, 0x20100000 },
+	{ 0.25626, 0.0992512, -0.179352, 0x20100000 },
+	{ 0.2563, 0.0519572, -0.179352, 0x20100000 },
+	{ 0.261748, 0.109528, -0.179352, 0x20100000 },
+	{ 0.261837, 0.0416702, -0.179352, 0x20100000 },
+	{ 0.26943, 0.118807, -0.179352, 0x20100000 },
+	{ 0.26959, 0.0324409, -0.179352, 0x20100000 },
+	{ 0.27872, 0.12649, -0.179352, 0x20100000 },
+	{ 0.276934, 0.075704, -0.179352, 0x20100000 },
+	{ 0.278929, 0.0248279, -0.179352, 0x20100000 },
+	{ 0.279488, 0.0898323, -0.179352, 0x20100000 },
+	{ 0.279548, 0.0613761, -0.179352, 0x20100000 },
+	{ 0.289026, 0.131978, -0.179352, 0x20100000 },
+	{ 0.289226, 0.0193901, -0.179352, 0x20100000 },
+	{ 0.287151, 0.101566, -0.179352, 0x20100000 },
+	{ 0.28739, 0.0496823, -0.179352, 0x20100000 },
+	{ 0.298645, 0.109468, -0.179352, 0x20100000 },
+	{ 0.298944, 0.0418997, -0.179352, 0x20100000 },
+	{ 0.300351, 0.135271, -0.179352, 0x20100000 },
+	{ 0.300481, 0.0161274, -0.179352, 0x20100000 },
+	{ 0.312693, 0.112102, -0.179352, 0x20100000 },
+	{ 0.312693, 0.0393055, -0.179352, 0x20100000 },
+	{ 0.312693, 0.136368, -0.179352, 0x20100000 },
+	{ 0.312693, 0.0150399, -0.179352, 0x20100000 },
+	{ 0.325036, 0.135271, -0.179352, 0x20100000 },
+	{ 0.326742, 0.0419596, -0.179352, 0x20100000 },
+	{ 0.326742, 0.109468, -0.179352, 0x20100000 },
+	{ 0.325036, 0.0161374, -0.179352, 0x20100000 },
+	{ 0.33636, 0.131978, -0.179352, 0x20100000 },
+	{ 0.33636, 0.01943, -0.179352, 0x20100000 },
+	{ 0.338236, 0.101566, -0.179352, 0x20100000 },
+	{ 0.338236, 0.0499217, -0.179352, 0x20100000 },
+	{ 0.346667, 0.12649, -0.179352, 0x20100000 },
+	{ 0.346667, 0.0249177, -0.179352, 0x20100000 },
+	{ 0.345899, 0.0898323, -0.179352, 0x20100000 },
+	{ 0.345899, 0.0616754, -0.179352, 0x20100000 },
+	{ 0.348453, 0.075704, -0.179352, 0x20100000 },
+	{ 0.355957, 0.118807, -0.179352, 0x20100000 },
+	{ 0.355957, 0.0326005, -0.179352, 0x20100000 },
+	{ 0.363639, 0.109528, -0.179352, 0x20100000 },
+	{ 0.363639, 0.0418797, -0.179352, 0x20100000 },
+	{ 0.369127, 0.0992512, -0.179352, 0x20100000 },
+	{ 0.369127, 0.0521567, -0.179352, 0x20100000 },
+	{ 0.37242, 0.0879765, -0.179352, 0x20100000 },
+	{ 0.37242, 0.0634315, -0.179352, 0x20100000 },
+	{ 0.373517, 0.075704, -0.179352, 0x20100000 },
+	{ 0.401455, 0.142913, -0.149352, 0x0007FC00 },
+	{ 0.438013, 0.142913, -0.179352, 0x0007FC00 },
+	{ 0.401455, 0.142913, -0.179352, 0x0007FC00 },
+	{ 0.438013, 0.142913, -0.149352, 0x0007FC00 },
+	{ 0.404597, 0.142913, -0.149352, 0x0007FC00 },
+	{ 0.435618, 0.0948611, -0.149352, 0x00080400 },
+	{ 0.46148, 0.0948611, -0.149352, 0x00080400 },
+	{ 0.439098, 0.0948611, -0.149352, 0x00080400 },
+	{ 0.435618, 0.0948611, -0.179352, 0x00080400 },
+	{ 0.46148, 0.0948611, -0.179352, 0x00080400 },
+	{ 0.46148, 0.0948611, -0.179352, 0x20100000 },
+	{ 0.4392, 0.121471, -0.179352, 0x20100000 },
+	{ 0.451121, 0.109117, -0.179352, 0x20100000 },
+	{ 0.435618, 0.0948611, -0.179352, 0x20100000 },
+	{ 0.425718, 0.131926, -0.179352, 0x20100000 },
+	{ 0.418357, 0.112601, -0.179352, 0x20100000 },
+	{ 0.410674, 0.140479, -0.179352, 0x20100000 },
+	{ 0.395787, 0.125273, -0.179352, 0x20100000 },
+	{ 0.394069, 0.147131, -0.179352, 0x20100000 },
+	{ 0.375902, 0.151883, -0.179352, 0x20100000 },
+	{ 0.36791, 0.132876, -0.179352, 0x20100000 },
+	{ 0.356174, 0.154734, -0.179352, 0x20100000 },
+	{ 0.334884, 0.155685, -0.179352, 0x20100000 },
+	{ 0.334724, 0.13541, -0.179352, 0x20100000 },
+	{ 0.313556, 0.154734, -0.179352, 0x20100000 },
+	{ 0.301608, 0.132876, -0.179352, 0x20100000 },
+	{ 0.293796, 0.151883, -0.179352, 0x20100000 },
+	{ 0.275602, 0.147131, -0.179352, 0x20100000 },
+	{ 0.273781, 0.125273, -0.179352, 0x20100000 },
+	{ 0.258974, 0.140479, -0.179352, 0x20100000 },
+	{ 0.251241, 0.112601, -0.179352, 0x20100000 },
+	{ 0.243912, 0.131926, -0.179352, 0x20100000 },
+	{ 0.23399, 0.0948611, -0.179352, 0x20100000 },
+	{ 0.230418, 0.121471, -0.179352, 0x20100000 },
+	{ 0.218489, 0.109117, -0.179352, 0x20100000 },
+	{ 0.208128, 0.0948611, -0.179352, 0x20100000 },
+	{ 0.426199, -0.142607, -0.179352, 0x20100000 },
+	{ 0.401455, -0.171263, -0.179352, 0x20100000 },
+	{ 0.401455, -0.169666, -0.179352, 0x20100000 },
+	{ 0.438013, -0.171263, -0.179352, 0x20100000 },
+	{ 0.437853, -0.125745, -0.179352, 0x20100000 },
+	{ 0.447911, -0.107246, -0.179352, 0x20100000 },
+	{ 0.462917, -0.137139, -0.179352, 0x20100000 },
+	{ 0.456791, -0.0860736, -0.179352, 0x20100000 },
+	{ 0.463635, -0.0637437, -0.179352, 0x20100000 },
+	{ 0.481755, -0.100861, -0.179352, 0x20100000 },
+	{ 0.468006, -0.0398971, -0.179352, 0x20100000 },
+	{ 0.469462, -0.0141747, -0.179352, 0x20100000 },
+	{ 0.481675, 0.0726708, -0.179352, 0x20100000 },
+	{ 0.467986, 0.0114479, -0.179352, 0x20100000 },
+	{ 0.463555, 0.0356337, -0.179352, 0x20100000 },
+	{ 0.488624, 0.0532942, -0.179352, 0x20100000 },
+	{ 0.462817, 0.10883, -0.179352, 0x20100000 },
+	{ 0.488669, -0.081434, -0.179352, 0x20100000 },
+	{ 0.456691, 0.0581832, -0.179352, 0x20100000 },
+	{ 0.493588, 0.0323611, -0.179352, 0x20100000 },
+	{ 0.447911, 0.0788968, -0.179352, 0x20100000 },
+	{ 0.493608, -0.0605109, -0.179352, 0x20100000 },
+	{ 0.438013, 0.142913, -0.179352, 0x20100000 },
+	{ 0.496567, 0.00987145, -0.179352, 0x20100000 },
+	{ 0.437534, 0.0976947, -0.179352, 0x20100000 },
+	{ 0.496572, -0.0380911, -0.179352, 0x20100000 },
+	{ 0.497559, -0.0141747, -0.179352, 0x20100000 },
+	{ 0.42588, 0.114497, -0.179352, 0x20100000 },
+	{ 0.401455, 0.141317, -0.179352, 0x20100000 },
+	{ 0.401455, 0.142913, -0.179352, 0x20100000 },
+	{ 0.462917, -0.137139, -0.179352, 0x000BCDB2 },
+	{ 0.438013, -0.171263, -0.149352, 0x000B4D9D },
+	{ 0.438013, -0.171263, -0.179352, 0x000B4D9D },
+	{ 0.462917, -0.137139, -0.149352, 0x000BCDB2 },
+	{ 0.481755, -0.100861, -0.179352, 0x000CD1D5 },
+	{ 0.481755, -0.100861, -0.149352, 0x000CD1D5 },
+	{ 0.488669, -0.081434, -0.179352, 0x000DBDEA },
+	{ 0.488669, -0.081434, -0.149352, 0x000DBDEA },
+	{ 0.493608, -0.0605109, -0.179352, 0x000E91F7 },
+	{ 0.493608, -0.0605109, -0.149352, 0x000E91F7 },
+	{ 0.496572, -0.0380911, -0.179352, 0x000F51FD },
+	{ 0.496572, -0.0380911, -0.149352, 0x000F51FD },
+	{ 0.497559, -0.0141747, -0.179352, 0x000001FF },
+	{ 0.497559, -0.0141747, -0.149352, 0x000001FF },
+	{ 0.496567, 0.00987145, -0.179352, 0x0000B1FD },
+	{ 0.496567, 0.00987145, -0.149352, 0x0000B1FD },
+	{ 0.493588, 0.0323611, -0.179352, 0x000175F7 },
+	{ 0.493588, 0.0323611, -0.149352, 0x000175F7 },
+	{ 0.488624, 0.0532942, -0.179352, 0x000245EA },
+	{ 0.488624, 0.0532942, -0.149352, 0x000245EA },
+	{ 0.481675, 0.0726708, -0.179352, 0x000335D4 },
+	{ 0.481675, 0.0726708, -0.149352, 0x000335D4 },
+	{ 0.462817, 0.10883, -0.179352, 0x000435B2 },
+	{ 0.462817, 0.10883, -0.149352, 0x000435B2 },
+	{ 0.438013, 0.142913, -0.179352, 0x0004B59D },
+	{ 0.438013, 0.142913, -0.149352, 0x0004B59D },
+	{ 0.426199, -0.142607, -0.149352, 0x0004FA70 },
+	{ 0.401455, -0.169666, -0.179352, 0x00056687 },
+	{ 0.401455, -0.169666, -0.149352, 0x00056687 },
+	{ 0.426199, -0.142607, -0.179352, 0x0004FA70 },
+	{ 0.437853, -0.125745, -0.149352, 0x0004324D },
+	{ 0.437853, -0.125745, -0.179352, 0x0004324D },
+	{ 0.447911, -0.107246, -0.149352, 0x00037633 },
+	{ 0.447911, -0.107246, -0.179352, 0x00037633 },
+	{ 0.456791, -0.0860736, -0.179352, 0x0002BA20 },
+	{ 0.456791, -0.0860736, -0.149352, 0x0002BA20 },
+	{ 0.463635, -0.0637437, -0.179352, 0x0001E610 },
+	{ 0.463635, -0.0637437, -0.149352, 0x0001E610 },
+	{ 0.468006, -0.0398971, -0.179352, 0x0000F605 },
+	{ 0.468006, -0.0398971, -0.149352, 0x0000F605 },
+	{ 0.469462, -0.0141747, -0.149352, 0x00000201 },
+	{ 0.469462, -0.0141747, -0.179352, 0x00000201 },
+	{ 0.467986, 0.0114479, -0.149352, 0x000F0E05 },
+	{ 0.467986, 0.0114479, -0.179352, 0x000F0E05 },
+	{ 0.463555, 0.0356337, -0.149352, 0x000E1E0F },
+	{ 0.463555, 0.0356337, -0.179352, 0x000E1E0F },
+	{ 0.456691, 0.0581832, -0.149352, 0x000D4A20 },
+	{ 0.456691, 0.0581832, -0.179352, 0x000D4A20 },
+	{ 0.447911, 0.0788968, -0.149352, 0x000C8634 },
+	{ 0.447911, 0.0788968, -0.179352, 0x000C8634 },
+	{ 0.439098, 0.0948611, -0.149352, 0x000C2641 },
+	{ 0.437534, 0.0976947, -0.179352, 0x000BCE4E },
+	{ 0.437534, 0.0976947, -0.149352, 0x000BCE4E },
+	{ 0.42588, 0.114497, -0.149352, 0x000B0A70 },
+	{ 0.42588, 0.114497, -0.179352, 0x000B0A70 },
+	{ 0.401455, 0.141317, -0.149352, 0x000AA286 },
+	{ 0.401455, 0.141317, -0.179352, 0x000AA286 },
+	{ 0.496567, 0.00987145, -0.149352, 0x1FF00000 },
+	{ 0.496572, -0.0380911, -0.149352, 0x1FF00000 },
+	{ 0.497559, -0.0141747, -0.149352, 0x1FF00000 },
+	{ 0.493608, -0.0605109, -0.149352, 0x1FF00000 },
+	{ 0.493588, 0.0323611, -0.149352, 0x1FF00000 },
+	{ 0.488669, -0.081434, -0.149352, 0x1FF00000 },
+	{ 0.488624, 0.0532942, -0.149352, 0x1FF00000 },
+	{ 0.481755, -0.100861, -0.149352, 0x1FF00000 },
+	{ 0.481675, 0.0726708, -0.149352, 0x1FF00000 },
+	{ 0.469462, -0.0141747, -0.149352, 0x1FF00000 },
+	{ 0.467986, 0.0114479, -0.149352, 0x1FF00000 },
+	{ 0.468006, -0.0398971, -0.149352, 0x1FF00000 },
+	{ 0.463555, 0.0356337, -0.149352, 0x1FF00000 },
+	{ 0.463635, -0.0637437, -0.149352, 0x1FF00000 },
+	{ 0.462817, 0.10883, -0.149352, 0x1FF00000 },
+	{ 0.462917, -0.137139, -0.149352, 0x1FF00000 },
+	{ 0.456791, -0.0860736, -0.149352, 0x1FF00000 },
+	{ 0.447911, -0.107246, -0.149352, 0x1FF00000 },
+	{ 0.438013, -0.171263, -0.149352, 0x1FF00000 },
+	{ 0.437853, -0.125745, -0.149352, 0x1FF00000 },
+	{ 0.426199, -0.142607, -0.149352, 0x1FF00000 },
+	{ 0.401455, -0.169666, -0.149352, 0x1FF00000 },
+	{ 0.401455, -0.171263, -0.149352, 0x1FF00000 },
+	{ 0.46148, 0.0948611, -0.149352, 0x1FF00000 },
+	{ 0.456691, 0.0581832, -0.149352, 0x1FF00000 },
+	{ 0.447911, 0.0788968, -0.149352, 0x1FF00000 },
+	{ 0.439098, 0.0948611, -0.149352, 0x1FF00000 },
+	{ 0.451121, 0.109117, -0.149352, 0x1FF00000 },
+	{ 0.4392, 0.121471, -0.149352, 0x1FF00000 },
+	{ 0.438013, 0.142913, -0.149352, 0x1FF00000 },
+	{ 0.437534, 0.0976947, -0.149352, 0x1FF00000 },
+	{ 0.435618, 0.0948611, -0.149352, 0x1FF00000 },
+	{ 0.425718, 0.131926, -0.149352, 0x1FF00000 },
+	{ 0.42588, 0.114497, -0.149352, 0x1FF00000 },
+	{ 0.418357, 0.112601, -0.149352, 0x1FF00000 },
+	{ 0.410674, 0.140479, -0.149352, 0x1FF00000 },
+	{ 0.404597, 0.142913, -0.149352, 0x1FF00000 },
+	{ 0.401455, 0.141317, -0.149352, 0x1FF00000 },
+	{ 0.395787, 0.125273, -0.149352, 0x1FF00000 },
+	{ 0.401455, 0.142913, -0.149352, 0x1FF00000 },
+	{ 0.394069, 0.147131, -0.149352, 0x1FF00000 },
+	{ 0.375902, 0.151883, -0.149352, 0x1FF00000 },
+	{ 0.36791, 0.132876, -0.149352, 0x1FF00000 },
+	{ 0.356174, 0.154734, -0.149352, 0x1FF00000 },
+	{ 0.334884, 0.155685, -0.149352, 0x1FF00000 },
+	{ 0.334724, 0.13541, -0.149352, 0x1FF00000 },
+	{ 0.326674, 0.134794, -0.149352, 0x1FF00000 },
+	{ 0.325036, 0.135271, -0.149352, 0x1FF00000 },
+	{ 0.313556, 0.154734, -0.149352, 0x1FF00000 },
+	{ 0.312693, 0.136368, -0.149352, 0x1FF00000 },
+	{ 0.300351, 0.135271, -0.149352, 0x1FF00000 },
+	{ 0.293796, 0.151883, -0.149352, 0x1FF00000 },
+	{ 0.301608, 0.132876, -0.149352, 0x1FF00000 },
+	{ 0.289026, 0.131978, -0.149352, 0x1FF00000 },
+	{ 0.279229, 0.126762, -0.149352, 0x1FF00000 },
+	{ 0.275602, 0.147131, -0.149352, 0x1FF00000 },
+	{ 0.273781, 0.125273, -0.149352, 0x1FF00000 },
+	{ 0.258974, 0.140479, -0.149352, 0x1FF00000 },
+	{ 0.251241, 0.112601, -0.149352, 0x1FF00000 },
+	{ 0.243912, 0.131926, -0.149352, 0x1FF00000 },
+	{ 0.23399, 0.0948611, -0.149352, 0x1FF00000 },
+	{ 0.230418, 0.121471, -0.149352, 0x1FF00000 },
+	{ 0.218489, 0.109117, -0.149352, 0x1FF00000 },
+	{ 0.208128, 0.0948611, -0.149352, 0x1FF00000 },
+	{ 0.279488, 0.0898323, -0.149352, 0x1FF00000 },
+	{ 0.27872, 0.12649, -0.149352, 0x1FF00000 },
+	{ 0.287151, 0.101566, -0.149352, 0x1FF00000 },
+	{ 0.298645, 0.109468, -0.149352, 0x1FF00000 },
+	{ 0.276934, 0.075704, -0.149352, 0x1FF00000 },
+	{ 0.312693, 0.112102, -0.149352, 0x1FF00000 },
+	{ 0.326742, 0.109468, -0.149352, 0x1FF00000 },
+	{ 0.33636, 0.131978, -0.149352, 0x1FF00000 },
+	{ 0.338236, 0.101566, -0.149352, 0x1FF00000 },
+	{ 0.346667, 0.12649, -0.149352, 0x1FF00000 },
+	{ 0.345899, 0.0898323, -0.149352, 0x1FF00000 },
+	{ 0.348453, 0.075704, -0.149352, 0x1FF00000 },
+	{ 0.355957, 0.118807, -0.149352, 0x1FF00000 },
+	{ 0.355957, 0.0326005, -0.149352, 0x1FF00000 },
+	{ 0.363639, 0.0418797, -0.149352, 0x1FF00000 },
+	{ 0.346667, 0.0249177, -0.149352, 0x1FF00000 },
+	{ 0.363639, 0.109528, -0.149352, 0x1FF00000 },
+	{ 0.345899, 0.0616754, -0.149352, 0x1FF00000 },
+	{ 0.369127, 0.0521567, -0.149352, 0x1FF00000 },
+	{ 0.338236, 0.0499217, -0.149352, 0x1FF00000 },
+	{ 0.369127, 0.0992512, -0.149352, 0x1FF00000 },
+	{ 0.33636, 0.01943, -0.149352, 0x1FF00000 },
+	{ 0.37242, 0.0634315, -0.149352, 0x1FF00000 },
+	{ 0.326742, 0.0419596, -0.149352, 0x1FF00000 },
+	{ 0.37242, 0.0879765, -0.149352, 0x1FF00000 },
+	{ 0.373517, 0.075704, -0.149352, 0x1FF00000 },
+	{ 0.325036, 0.0161374, -0.149352, 0x1FF00000 },
+	{ 0.312693, 0.0393055, -0.149352, 0x1FF00000 },
+	{ 0.312693, 0.0150399, -0.149352, 0x1FF00000 },
+	{ 0.300481, 0.0161274, -0.149352, 0x1FF00000 },
+	{ 0.298944, 0.0418997, -0.149352, 0x1FF00000 },
+	{ 0.289226, 0.0193901, -0.149352, 0x1FF00000 },
+	{ 0.28739, 0.0496823, -0.149352, 0x1FF00000 },
+	{ 0.279548, 0.0613761, -0.149352, 0x1FF00000 },
+	{ 0.278929, 0.0248279, -0.149352, 0x1FF00000 },
+	{ 0.26959, 0.0324409, -0.149352, 0x1FF00000 },
+	{ 0.26943, 0.118807, -0.149352, 0x1FF00000 },
+	{ 0.261837, 0.0416702, -0.149352, 0x1FF00000 },
+	{ 0.261748, 0.109528, -0.149352, 0x1FF00000 },
+	{ 0.2563, 0.0519572, -0.149352, 0x1FF00000 },
+	{ 0.25626, 0.0992512, -0.149352, 0x1FF00000 },
+	{ 0.252977, 0.0633018, -0.149352, 0x1FF00000 },
+	{ 0.252967, 0.0879765, -0.149352, 0x1FF00000 },
+	{ 0.25187, 0.075704, -0.149352, 0x1FF00000 },
+	{ -0.257859, 0.112601, -0.179352, 0x0009AD38 },
+	{ -0.27511, 0.0948611, -0.149352, 0x000A716E },
+	{ -0.27511, 0.0948611, -0.179352, 0x000A716E },
+	{ -0.257859, 0.112601, -0.149352, 0x0009AD38 },
+	{ -0.235319, 0.125273, -0.149352, 0x00089CC2 },
+	{ -0.235319, 0.125273, -0.179352, 0x00089CC2 },
+	{ -0.207491, 0.132876, -0.149352, 0x00082457 },
+	{ -0.22987, 0.126762, -0.149352, 0x00084C87 },
+	{ -0.207491, 0.132876, -0.179352, 0x00082457 },
+	{ -0.174376, 0.13541, -0.149352, 0x00080400 },
+	{ -0.182425, 0.134794, -0.149352, 0x00080827 },
+	{ -0.174376, 0.13541, -0.179352, 0x00080400 },
+	{ -0.14119, 0.132876, -0.149352, 0x000823A9 },
+	{ -0.14119, 0.132876, -0.179352, 0x000823A9 },
+	{ -0.113312, 0.125273, -0.149352, 0x00089F3E },
+	{ -0.113312, 0.125273, -0.179352, 0x00089F3E },
+	{ -0.0907429, 0.112601, -0.149352, 0x0009AEC9 },
+	{ -0.0907429, 0.112601, -0.179352, 0x0009AEC9 },
+	{ -0.0734815, 0.0948611, -0.179352, 0x000A7292 },
+	{ -0.0734815, 0.0948611, -0.149352, 0x000A7292 },
+	{ -0.10077, -0.129935, -0.149352, 0x00065538 },
+	{ -0.118022, -0.112195, -0.179352, 0x0005916E },
+	{ -0.118022, -0.112195, -0.149352, 0x0005916E },
+	{ -0.10077, -0.129935, -0.179352, 0x00065538 },
+	{ -0.0782309, -0.142607, -0.179352, 0x000764C2 },
+	{ -0.0782309, -0.142607, -0.149352, 0x000764C2 },
+	{ -0.0504032, -0.15021, -0.179352, 0x0007DC57 },
+	{ -0.0504032, -0.15021, -0.149352, 0x0007DC57 },
+	{ -0.0172874, -0.152744, -0.179352, 0x0007FC00 },
+	{ -0.0172874, -0.152744, -0.149352, 0x0007FC00 },
+	{ 0.0158982, -0.15021, -0.179352, 0x0007E3A9 },
+	{ 0.0158982, -0.15021, -0.149352, 0x0007E3A9 },
+	{ 0.0437758, -0.142607, -0.179352, 0x0007673E },
+	{ 0.0437758, -0.142607, -0.149352, 0x0007673E },
+	{ 0.0663452, -0.129935, -0.179352, 0x000656C9 },
+	{ 0.0663452, -0.129935, -0.149352, 0x000656C9 },
+	{ 0.0836066, -0.112195, -0.149352, 0x00059292 },
+	{ 0.0836066, -0.112195, -0.179352, 0x00059292 },
+	{ 0.251241, 0.112601, -0.179352, 0x0009AD38 },
+	{ 0.23399, 0.0948611, -0.149352, 0x000A716E },
+	{ 0.23399, 0.0948611, -0.179352, 0x000A716E },
+	{ 0.251241, 0.112601, -0.149352, 0x0009AD38 },
+	{ 0.273781, 0.125273, -0.149352, 0x00089CC2 },
+	{ 0.273781, 0.125273, -0.179352, 0x00089CC2 },
+	{ 0.301608, 0.132876, -0.149352, 0x00082457 },
+	{ 0.279229, 0.126762, -0.149352, 0x00084C87 },
+	{ 0.301608, 0.132876, -0.179352, 0x00082457 },
+	{ 0.334724, 0.13541, -0.149352, 0x00080400 },
+	{ 0.326674, 0.134794, -0.149352, 0x00080827 },
+	{ 0.334724, 0.13541, -0.179352, 0x00080400 },
+	{ 0.36791, 0.132876, -0.149352, 0x000823A9 },
+	{ 0.36791, 0.132876, -0.179352, 0x000823A9 },
+	{ 0.395787, 0.125273, -0.149352, 0x00089F3E },
+	{ 0.395787, 0.125273, -0.179352, 0x00089F3E },
+	{ 0.418357, 0.112601, -0.149352, 0x0009AEC9 },
+	{ 0.418357, 0.112601, -0.179352, 0x0009AEC9 },
+	{ 0.435618, 0.0948611, -0.179352, 0x000A7292 },
+	{ 0.435618, 0.0948611, -0.149352, 0x000A7292 },
+	{ -0.172739, 0.131978, -0.149352, 0x000764C0 },
+	{ -0.184064, 0.135271, -0.149352, 0x0007D85E },
+	{ -0.182425, 0.134794, -0.149352, 0x0007AC8F },
+	{ -0.184064, 0.135271, -0.179352, 0x0007D85E },
+	{ -0.196406, 0.136368, -0.149352, 0x0007FC00 },
+	{ -0.172739, 0.131978, -0.179352, 0x000764C0 },
+	{ -0.196406, 0.136368, -0.179352, 0x0007FC00 },
+	{ -0.162432, 0.12649, -0.179352, 0x0006A51C },
+	{ -0.208749, 0.135271, -0.149352, 0x0007DBA2 },
+	{ -0.162432, 0.12649, -0.149352, 0x0006A51C },
+	{ -0.208749, 0.135271, -0.179352, 0x0007DBA2 },
+	{ -0.153143, 0.118807, -0.179352, 0x0005A569 },
+	{ -0.220073, 0.131978, -0.149352, 0x00076740 },
+	{ -0.153143, 0.118807, -0.149352, 0x0005A569 },
+	{ -0.220073, 0.131978, -0.179352, 0x00076740 },
+	{ -0.14546, 0.109528, -0.149352, 0x000475A8 },
+	{ -0.14546, 0.109528, -0.179352, 0x000475A8 },
+	{ -0.139973, 0.0992512, -0.149352, 0x000305D9 },
+	{ -0.139973, 0.0992512, -0.179352, 0x000305D9 },
+	{ -0.13668, 0.0879765, -0.149352, 0x00017DF6 },
+	{ -0.13668, 0.0879765, -0.179352, 0x00017DF6 },
+	{ -0.135582, 0.075704, -0.149352, 0x000001FF },
+	{ -0.135582, 0.075704, -0.179352, 0x000001FF },
+	{ -0.13668, 0.0634315, -0.149352, 0x000E85F6 },
+	{ -0.13668, 0.0634315, -0.179352, 0x000E85F6 },
+	{ -0.139973, 0.0521567, -0.149352, 0x000CFDD9 },
+	{ -0.139973, 0.0521567, -0.179352, 0x000CFDD9 },
+	{ -0.14546, 0.0418797, -0.149352, 0x000B8DA8 },
+	{ -0.14546, 0.0418797, -0.179352, 0x000B8DA8 },
+	{ -0.153143, 0.0326005, -0.149352, 0x000A5D69 },
+	{ -0.153143, 0.0326005, -0.179352, 0x000A5D69 },
+	{ -0.162432, 0.0249177, -0.179352, 0x00095D1C },
+	{ -0.162432, 0.0249177, -0.149352, 0x00095D1C },
+	{ -0.172739, 0.01943, -0.179352, 0x00089CC0 },
+	{ -0.172739, 0.01943, -0.149352, 0x00089CC0 },
+	{ -0.184064, 0.0161374, -0.179352, 0x0008285E },
+	{ -0.184064, 0.0161374, -0.149352, 0x0008285E },
+	{ -0.196406, 0.0150399, -0.179352, 0x00080400 },
+	{ -0.196406, 0.0150399, -0.149352, 0x00080400 },
+	{ -0.208619, 0.0161274, -0.179352, 0x00082BA2 },
+	{ -0.208619, 0.0161274, -0.149352, 0x00082BA2 },
+	{ -0.219874, 0.0193901, -0.179352, 0x00089B41 },
+	{ -0.219874, 0.0193901, -0.149352, 0x00089B41 },
+	{ -0.230171, 0.0248279, -0.179352, 0x00095AE6 },
+	{ -0.230171, 0.0248279, -0.149352, 0x00095AE6 },
+	{ -0.23951, 0.0324409, -0.179352, 0x000A5299 },
+	{ -0.23951, 0.0324409, -0.149352, 0x000A5299 },
+	{ -0.247262, 0.0416702, -0.149352, 0x000B8659 },
+	{ -0.247262, 0.0416702, -0.179352, 0x000B8659 },
+	{ -0.2528, 0.0519572, -0.149352, 0x000CFA27 },
+	{ -0.2528, 0.0519572, -0.179352, 0x000CFA27 },
+	{ -0.256122, 0.0633018, -0.149352, 0x000E860A },
+	{ -0.256122, 0.0633018, -0.179352, 0x000E860A },
+	{ -0.25723, 0.075704, -0.149352, 0x00000201 },
+	{ -0.25723, 0.075704, -0.179352, 0x00000201 },
+	{ -0.256132, 0.0879765, -0.149352, 0x00017E0A },
+	{ -0.256132, 0.0879765, -0.179352, 0x00017E0A },
+	{ -0.25284, 0.0992512, -0.149352, 0x00030627 },
+	{ -0.25284, 0.0992512, -0.179352, 0x00030627 },
+	{ -0.247352, 0.109528, -0.149352, 0x00047658 },
+	{ -0.247352, 0.109528, -0.179352, 0x00047658 },
+	{ -0.239669, 0.118807, -0.149352, 0x0005A697 },
+	{ -0.239669, 0.118807, -0.179352, 0x0005A697 },
+	{ -0.23038, 0.12649, -0.179352, 0x0006A6E4 },
+	{ -0.23038, 0.12649, -0.149352, 0x0006A6E4 },
+	{ -0.22987, 0.126762, -0.149352, 0x00070F10 },
+	{ 0.33636, 0.131978, -0.149352, 0x000764C0 },
+	{ 0.325036, 0.135271, -0.149352, 0x0007D85E },
+	{ 0.326674, 0.134794, -0.149352, 0x0007AC8F },
+	{ 0.325036, 0.135271, -0.179352, 0x0007D85E },
+	{ 0.312693, 0.136368, -0.149352, 0x0007FC00 },
+	{ 0.33636, 0.131978, -0.179352, 0x000764C0 },
+	{ 0.312693, 0.136368, -0.179352, 0x0007FC00 },
+	{ 0.346667, 0.12649, -0.179352, 0x0006A51C },
+	{ 0.300351, 0.135271, -0.149352, 0x0007DBA2 },
+	{ 0.346667, 0.12649, -0.149352, 0x0006A51C },
+	{ 0.300351, 0.135271, -0.179352, 0x0007DBA2 },
+	{ 0.355957, 0.118807, -0.179352, 0x0005A569 },
+	{ 0.289026, 0.131978, -0.149352, 0x00076740 },
+	{ 0.355957, 0.118807, -0.149352, 0x0005A569 },
+	{ 0.289026, 0.131978, -0.179352, 0x00076740 },
+	{ 0.363639, 0.109528, -0.149352, 0x000475A8 },
+	{ 0.363639, 0.109528, -0.179352, 0x000475A8 },
+	{ 0.369127, 0.0992512, -0.149352, 0x000305D9 },
+	{ 0.369127, 0.0992512, -0.179352, 0x000305D9 },
+	{ 0.37242, 0.0879765, -0.149352, 0x00017DF6 },
+	{ 0.37242, 0.0879765, -0.179352, 0x00017DF6 },
+	{ 0.373517, 0.075704, -0.149352, 0x000001FF },
+	{ 0.373517, 0.075704, -0.179352, 0x000001FF },
+	{ 0.37242, 0.0634315, -0.149352, 0x000E85F6 },
+	{ 0.37242, 0.0634315, -0.179352, 0x000E85F6 },
+	{ 0.369127, 0.0521567, -0.149352, 0x000CFDD9 },
+	{ 0.369127, 0.0521567, -0.179352, 0x000CFDD9 },
+	{ 0.363639, 0.0418797, -0.149352, 0x000B8DA8 },
+	{ 0.363639, 0.0418797, -0.179352, 0x000B8DA8 },
+	{ 0.355957, 0.0326005, -0.149352, 0x000A5D69 },
+	{ 0.355957, 0.0326005, -0.179352, 0x000A5D69 },
+	{ 0.346667, 0.0249177, -0.179352, 0x00095D1C },
+	{ 0.346667, 0.0249177, -0.149352, 0x00095D1C },
+	{ 0.33636, 0.01943, -0.179352, 0x00089CC0 },
+	{ 0.33636, 0.01943, -0.149352, 0x00089CC0 },
+	{ 0.325036, 0.0161374, -0.179352, 0x0008285E },
+	{ 0.325036, 0.0161374, -0.149352, 0x0008285E },
+	{ 0.312693, 0.0150399, -0.179352, 0x00080400 },
+	{ 0.312693, 0.0150399, -0.149352, 0x00080400 },
+	{ 0.300481, 0.0161274, -0.179352, 0x00082BA2 },
+	{ 0.300481, 0.0161274, -0.149352, 0x00082BA2 },
+	{ 0.289226, 0.0193901, -0.179352, 0x00089B41 },
+	{ 0.289226, 0.0193901, -0.149352, 0x00089B41 },
+	{ 0.278929, 0.0248279, -0.179352, 0x00095AE6 },
+	{ 0.278929, 0.0248279, -0.149352, 0x00095AE6 },
+	{ 0.26959, 0.0324409, -0.179352, 0x000A5299 },
+	{ 0.26959, 0.0324409, -0.149352, 0x000A5299 },
+	{ 0.261837, 0.0416702, -0.149352, 0x000B8659 },
+	{ 0.261837, 0.0416702, -0.179352, 0x000B8659 },
+	{ 0.2563, 0.0519572, -0.149352, 0x000CFA27 },
+	{ 0.2563, 0.0519572, -0.179352, 0x000CFA27 },
+	{ 0.252977, 0.0633018, -0.149352, 0x000E860A },
+	{ 0.252977, 0.0633018, -0.179352, 0x000E860A },
+	{ 0.25187, 0.075704, -0.149352, 0x00000201 },
+	{ 0.25187, 0.075704, -0.179352, 0x00000201 },
+	{ 0.252967, 0.0879765, -0.149352, 0x00017E0A },
+	{ 0.252967, 0.0879765, -0.179352, 0x00017E0A },
+	{ 0.25626, 0.0992512, -0.149352, 0x00030627 },
+	{ 0.25626, 0.0992512, -0.179352, 0x00030627 },
+	{ 0.261748, 0.109528, -0.149352, 0x00047658 },
+	{ 0.261748, 0.109528, -0.179352, 0x00047658 },
+	{ 0.26943, 0.118807, -0.149352, 0x0005A697 },
+	{ 0.26943, 0.118807, -0.179352, 0x0005A697 },
+	{ 0.27872, 0.12649, -0.179352, 0x0006A6E4 },
+	{ 0.27872, 0.12649, -0.149352, 0x0006A6E4 },
+	{ 0.279229, 0.126762, -0.149352, 0x00070F10 },
+	{ -0.229612, 0.0898323, -0.149352, 0x000D0DDB },
+	{ -0.221949, 0.101566, -0.179352, 0x000A6D6E },
+	{ -0.221949, 0.101566, -0.149352, 0x000A6D6E },
+	{ -0.210455, 0.109468, -0.149352, 0x0008A0C4 },
+	{ -0.229612, 0.0898323, -0.179352, 0x000D0DDB },
+	{ -0.210455, 0.109468, -0.179352, 0x0008A0C4 },
+	{ -0.232166, 0.075704, -0.149352, 0x000001FF },
+	{ -0.196406, 0.112102, -0.149352, 0x00080400 },
+	{ -0.232166, 0.075704, -0.179352, 0x000001FF },
+	{ -0.196406, 0.112102, -0.179352, 0x00080400 },
+	{ -0.229552, 0.0613761, -0.149352, 0x000301D9 },
+	{ -0.182358, 0.109468, -0.149352, 0x0008A33C },
+	{ -0.229552, 0.0613761, -0.179352, 0x000301D9 },
+	{ -0.182358, 0.109468, -0.179352, 0x0008A33C },
+	{ -0.22171, 0.0496823, -0.149352, 0x0005A56A },
+	{ -0.170863, 0.101566, -0.149352, 0x000A6E92 },
+	{ -0.22171, 0.0496823, -0.179352, 0x0005A56A },
+	{ -0.170863, 0.101566, -0.179352, 0x000A6E92 },
+	{ -0.210155, 0.0418997, -0.179352, 0x000764C2 },
+	{ -0.163201, 0.0898323, -0.179352, 0x000D0E25 },
+	{ -0.210155, 0.0418997, -0.149352, 0x000764C2 },
+	{ -0.163201, 0.0898323, -0.149352, 0x000D0E25 },
+	{ -0.196406, 0.0393055, -0.179352, 0x0007FC00 },
+	{ -0.160646, 0.075704, -0.179352, 0x00000201 },
+	{ -0.196406, 0.0393055, -0.149352, 0x0007FC00 },
+	{ -0.160646, 0.075704, -0.149352, 0x00000201 },
+	{ -0.182358, 0.0419596, -0.179352, 0x00075F3B },
+	{ -0.163201, 0.0616754, -0.179352, 0x0002F625 },
+	{ -0.182358, 0.0419596, -0.149352, 0x00075F3B },
+	{ -0.163201, 0.0616754, -0.149352, 0x0002F625 },
+	{ -0.170863, 0.0499217, -0.179352, 0x00059292 },
+	{ -0.170863, 0.0499217, -0.149352, 0x00059292 },
+	{ 0.279488, 0.0898323, -0.149352, 0x000D0DDB },
+	{ 0.287151, 0.101566, -0.179352, 0x000A6D6E },
+	{ 0.287151, 0.101566, -0.149352, 0x000A6D6E },
+	{ 0.298645, 0.109468, -0.149352, 0x0008A0C4 },
+	{ 0.279488, 0.0898323, -0.179352, 0x000D0DDB },
+	{ 0.298645, 0.109468, -0.179352, 0x0008A0C4 },
+	{ 0.276934, 0.075704, -0.149352, 0x000001FF },
+	{ 0.312693, 0.112102, -0.149352, 0x00080400 },
+	{ 0.276934, 0.075704, -0.179352, 0x000001FF },
+	{ 0.312693, 0.112102, -0.179352, 0x00080400 },
+	{ 0.279548, 0.0613761, -0.149352, 0x000301D9 },
+	{ 0.326742, 0.109468, -0.149352, 0x0008A33C },
+	{ 0.279548, 0.0613761, -0.179352, 0x000301D9 },
+	{ 0.326742, 0.109468, -0.179352, 0x0008A33C },
+	{ 0.28739, 0.0496823, -0.149352, 0x0005A56A },
+	{ 0.338236, 0.101566, -0.149352, 0x000A6E92 },
+	{ 0.28739, 0.0496823, -0.179352, 0x0005A56A },
+	{ 0.338236, 0.101566, -0.179352, 0x000A6E92 },
+	{ 0.298944, 0.0418997, -0.179352, 0x000764C2 },
+	{ 0.345899, 0.0898323, -0.179352, 0x000D0E25 },
+	{ 0.298944, 0.0418997, -0.149352, 0x000764C2 },
+	{ 0.345899, 0.0898323, -0.149352, 0x000D0E25 },
+	{ 0.312693, 0.0393055, -0.179352, 0x0007FC00 },
+	{ 0.348453, 0.075704, -0.179352, 0x00000201 },
+	{ 0.312693, 0.0393055, -0.149352, 0x0007FC00 },
+	{ 0.348453, 0.075704, -0.149352, 0x00000201 },
+	{ 0.326742, 0.0419596, -0.179352, 0x00075F3B },
+	{ 0.345899, 0.0616754, -0.179352, 0x0002F625 },
+	{ 0.326742, 0.0419596, -0.149352, 0x00075F3B },
+	{ 0.345899, 0.0616754, -0.149352, 0x0002F625 },
+	{ 0.338236, 0.0499217, -0.179352, 0x00059292 },
+	{ 0.338236, 0.0499217, -0.149352, 0x00059292 },
+};
+
+const uint16_t lennyIndices[5958] =
+{
+	// LOD 0: 1115 triangles
+	0, 1, 2, 1, 0, 3, 4, 5, 6, 5, 4, 7,
+	8, 9, 10, 9, 8, 11, 12, 13, 14, 13, 12, 15,
+	16, 17, 18, 17, 16, 19, 20, 21, 22, 21, 20, 23,
+	24, 25, 26, 25, 24, 27, 28, 29, 30, 29, 28, 31,
+	32, 33, 34, 33, 32, 35, 36, 37, 38, 37, 36, 39,
+	40, 41, 42, 41, 40, 43, 44, 45, 46, 45, 44, 47,
+	48, 49, 50, 49, 48, 51, 52, 53, 54, 53, 52, 55,
+	56, 57, 58, 57, 56, 59, 60, 61, 62, 61, 60, 63,
+	64, 65, 66, 65, 64, 67, 68, 69, 70, 69, 68, 71,
+	69, 71, 72, 72, 71, 73, 72, 73, 74, 74, 73, 75,
+	74, 75, 76, 76, 75, 77, 76, 77, 78, 78, 79, 76,
+	78, 77, 80, 79, 78, 81, 80, 77, 82, 79, 81, 83,
+	82, 77, 84, 79, 83, 85, 84, 77, 86, 79, 85, 87,
+	84, 86, 88, 87, 85, 89, 88, 86, 90, 87, 89, 91,
+	90, 86, 92, 87, 91, 93, 92, 86, 94, 92, 94, 95,
+	87, 93, 96, 96, 93, 97, 98, 99, 100, 99, 98, 101,
+	101, 98, 102, 101, 102, 103, 103, 102, 104, 103, 104, 105,
+	105, 104, 106, 105, 106, 107, 107, 106, 108, 109, 108, 106,
+	107, 108, 110, 108, 109, 111, 107, 110, 112, 111, 109, 113,
+	107, 112, 114, 113, 109, 115, 107, 114, 116, 115, 109, 117,
+	116, 114, 118, 115, 117, 119, 116, 118, 120, 119, 117, 121,
+	116, 120, 122, 121, 117, 123, 116, 122, 124, 124, 122, 125,
+	123, 117, 126, 123, 126, 127, 128, 129, 130, 129, 128, 131,
+	132, 131, 128, 131, 132, 133, 132, 134, 133, 134, 132, 135,
+	135, 136, 134, 136, 135, 137, 137, 138, 136, 138, 137, 139,
+	140, 138, 139, 138, 140, 141, 142, 141, 140, 141, 142, 143,
+	144, 143, 142, 143, 144, 145, 146, 145, 144, 145, 146, 147,
+	148, 147, 146, 147, 148, 149, 150, 149, 148, 149, 150, 151,
+	152, 151, 150, 151, 152, 153, 154, 155, 156, 155, 154, 157,
+	158, 157, 154, 157, 158, 159, 160, 159, 158, 159, 160, 161,
+	162, 161, 160, 161, 162, 163, 164, 163, 162, 163, 164, 165,
+	166, 165, 164, 165, 166, 167, 168, 167, 166, 167, 168, 169,
+	170, 169, 168, 169, 170, 171, 172, 171, 170, 171, 172, 173,
+	174, 173, 172, 173, 174, 175, 176, 175, 174, 175, 176, 177,
+	176, 178, 177, 178, 176, 179, 180, 178, 179, 178, 180, 181,
+	182, 181, 180, 181, 182, 183, 184, 185, 186, 185, 184, 187,
+	188, 187, 184, 187, 188, 189, 188, 190, 189, 190, 188, 191,
+	191, 192, 190, 192, 191, 193, 193, 194, 192, 194, 193, 195,
+	195, 196, 194, 196, 195, 197, 197, 198, 196, 198, 197, 199,
+	200, 198, 199, 198, 200, 201, 200, 202, 201, 202, 200, 203,
+	203, 204, 202, 204, 203, 205, 205, 206, 204, 206, 205, 207,
+	207, 208, 206, 208, 207, 209, 209, 210, 208, 210, 209, 211,
+	211, 212, 210, 212, 211, 213, 214, 212, 213, 212, 214, 215,
+	216, 215, 214, 215, 216, 217, 218, 219, 220, 219, 218, 221,
+	219, 221, 222, 222, 221, 223, 222, 223, 224, 224, 223, 225,
+	224, 225, 226, 226, 225, 227, 226, 227, 228, 228, 229, 226,
+	228, 227, 230, 229, 228, 231, 230, 227, 232, 229, 231, 233,
+	230, 232, 234, 233, 231, 235, 234, 232, 236, 233, 235, 237,
+	236, 232, 238, 233, 237, 239, 236, 238, 240, 239, 237, 241,
+	240, 238, 242, 239, 241, 243, 240, 242, 244, 243, 241, 245,
+	240, 244, 246, 243, 245, 247, 246, 244, 248, 247, 245, 249,
+	246, 248, 250, 249, 245, 251, 250, 248, 252, 249, 251, 253,
+	250, 252, 254, 253, 251, 255, 254, 252, 256, 253, 255, 256,
+	256, 252, 257, 253, 256, 258, 258, 256, 257, 258, 257, 259,
+	258, 259, 260, 260, 259, 261, 260, 261, 262, 262, 261, 263,
+	262, 263, 264, 264, 263, 265, 266, 267, 268, 267, 266, 269,
+	269, 266, 270, 269, 270, 271, 271, 270, 272, 271, 272, 273,
+	273, 272, 274, 273, 274, 275, 275, 274, 276, 277, 276, 274,
+	275, 276, 278, 276, 277, 279, 275, 278, 280, 279, 277, 281,
+	279, 281, 282, 282, 281, 283, 283, 281, 284, 283, 284, 285,
+	285, 284, 286, 285, 286, 287, 285, 287, 288, 288, 287, 289,
+	288, 289, 290, 290, 289, 291, 290, 291, 292, 292, 291, 293,
+	293, 291, 294, 295, 293, 294, 295, 294, 296, 297, 293, 295,
+	295, 296, 298, 297, 299, 293, 298, 296, 300, 297, 301, 299,
+	298, 300, 302, 303, 301, 297, 302, 300, 304, 303, 305, 301,
+	302, 304, 306, 306, 304, 307, 308, 305, 303, 308, 309, 305,
+	310, 309, 308, 310, 311, 309, 310, 312, 311, 310, 278, 312,
+	280, 278, 310, 310, 313, 280, 314, 280, 313, 315, 280, 314,
+	315, 316, 280, 317, 316, 315, 317, 318, 316, 319, 318, 317,
+	319, 320, 318, 321, 320, 319, 322, 320, 321, 320, 322, 323,
+	314, 313, 324, 313, 310, 324, 314, 324, 325, 324, 310, 326,
+	325, 324, 326, 326, 310, 308, 325, 326, 327, 326, 308, 327,
+	325, 327, 328, 328, 327, 308, 328, 308, 329, 328, 329, 330,
+	328, 330, 331, 331, 330, 332, 332, 330, 333, 332, 333, 334,
+	334, 333, 335, 335, 333, 336, 335, 336, 337, 337, 336, 338,
+	337, 338, 339, 339, 338, 340, 339, 340, 341, 342, 343, 344,
+	345, 343, 342, 345, 346, 343, 347, 346, 345, 347, 348, 346,
+	349, 348, 347, 349, 350, 348, 349, 351, 350, 352, 351, 349,
+	352, 353, 351, 352, 354, 353, 355, 354, 352, 355, 356, 354,
+	357, 356, 355, 357, 358, 356, 357, 359, 358, 360, 359, 357,
+	360, 361, 359, 362, 361, 360, 362, 363, 361, 364, 363, 362,
+	364, 365, 363, 364, 366, 365, 366, 364, 367, 368, 369, 370,
+	369, 368, 371, 372, 371, 368, 371, 372, 373, 372, 374, 373,
+	374, 372, 375, 375, 376, 374, 376, 375, 377, 377, 378, 376,
+	378, 377, 379, 379, 380, 378, 380, 379, 381, 381, 382, 380,
+	382, 381, 383, 383, 384, 382, 384, 383, 385, 385, 386, 384,
+	386, 385, 387, 387, 388, 386, 388, 387, 389, 389, 390, 388,
+	390, 389, 391, 391, 392, 390, 392, 391, 393, 393, 394, 392,
+	394, 393, 395, 395, 396, 394, 396, 395, 397, 398, 396, 397,
+	396, 398, 399, 400, 399, 398, 399, 400, 401, 402, 403, 404,
+	405, 403, 402, 405, 406, 403, 407, 406, 405, 407, 408, 406,
+	409, 408, 407, 409, 410, 408, 409, 411, 410, 412, 411, 409,
+	412, 413, 411, 412, 414, 413, 415, 414, 412, 415, 416, 414,
+	417, 416, 415, 417, 418, 416, 417, 419, 418, 420, 419, 417,
+	420, 421, 419, 422, 421, 420, 422, 423, 421, 424, 423, 422,
+	424, 425, 423, 424, 426, 425, 426, 424, 427, 428, 429, 430,
+	428, 431, 429, 432, 431, 428, 432, 433, 431, 434, 433, 432,
+	434, 435, 433, 436, 435, 434, 437, 435, 436, 437, 438, 435,
+	439, 438, 437, 440, 438, 439, 440, 441, 438, 442, 441, 440,
+	442, 443, 441, 444, 443, 442, 445, 443, 444, 445, 446, 443,
+	447, 446, 445, 447, 448, 446, 449, 448, 447, 449, 450, 448,
+	451, 450, 449, 452, 450, 451, 450, 452, 453, 454, 455, 456,
+	455, 454, 457, 457, 458, 455, 458, 457, 459, 459, 460, 458,
+	460, 459, 461, 461, 462, 460, 462, 461, 463, 464, 462, 463,
+	462, 464, 465, 466, 465, 464, 465, 466, 467, 468, 467, 466,
+	467, 468, 469, 470, 469, 468, 469, 470, 471, 470, 472, 471,
+	472, 470, 473, 473, 474, 472, 474, 473, 475, 475, 476, 474,
+	476, 475, 477, 477, 478, 476, 478, 477, 479, 479, 480, 478,
+	480, 479, 481, 482, 480, 481, 480, 482, 483, 482, 484, 483,
+	484, 482, 485, 485, 486, 484, 486, 485, 487, 487, 488, 486,
+	488, 487, 489, 490, 491, 492, 491, 490, 493, 493, 494, 491,
+	494, 493, 495, 495, 496, 494, 496, 495, 497, 498, 496, 497,
+	496, 498, 499, 500, 499, 498, 499, 500, 501, 502, 501, 500,
+	501, 502, 503, 504, 503, 502, 503, 504, 505, 506, 505, 504,
+	505, 506, 507, 508, 507, 506, 507, 508, 509, 510, 509, 508,
+	509, 510, 511, 512, 511, 510, 511, 512, 513, 514, 513, 512,
+	513, 514, 515, 514, 516, 515, 516, 514, 517, 517, 518, 516,
+	518, 517, 519, 519, 520, 518, 520, 519, 521, 521, 522, 520,
+	522, 521, 523, 523, 524, 522, 524, 523, 525, 525, 526, 524,
+	526, 525, 527, 528, 529, 530, 529, 528, 531, 531, 528, 532,
+	531, 532, 533, 534, 533, 532, 533, 534, 535, 535, 534, 536,
+	535, 536, 537, 537, 536, 538, 537, 538, 539, 537, 539, 540,
+	540, 539, 541, 541, 542, 540, 540, 542, 543, 541, 544, 542,
+	543, 542, 545, 546, 544, 541, 543, 545, 547, 548, 544, 546,
+	547, 545, 549, 548, 550, 544, 547, 549, 551, 552, 550, 548,
+	551, 549, 553, 554, 550, 552, 551, 553, 555, 555, 553, 556,
+	554, 557, 550, 558, 557, 554, 559, 557, 558, 559, 560, 557,
+	561, 560, 559, 561, 562, 560, 563, 562, 561, 564, 562, 563,
+	565, 562, 564, 566, 562, 565, 562, 566, 567, 568, 569, 570,
+	569, 568, 571, 571, 568, 572, 571, 572, 573, 571, 573, 574,
+	571, 574, 575, 575, 574, 576, 575, 576, 577, 577, 576, 578,
+	577, 578, 579, 577, 579, 580, 580, 579, 581, 580, 581, 582,
+	580, 582, 583, 583, 582, 584, 583, 584, 585, 583, 585, 586,
+	586, 585, 587, 588, 587, 585, 586, 587, 589, 588, 590, 587,
+	586, 589, 591, 592, 590, 588, 591, 589, 593, 594, 590, 592,
+	591, 593, 595, 594, 596, 590, 595, 593, 597, 598, 596, 594,
+	595, 597, 599, 598, 600, 596, 599, 597, 601, 599, 601, 602,
+	603, 600, 598, 603, 604, 600, 605, 604, 603, 606, 604, 605,
+	604, 606, 607, 608, 609, 610, 609, 608, 611, 612, 611, 608,
+	611, 612, 613, 612, 614, 613, 614, 612, 615, 615, 616, 614,
+	616, 615, 617, 617, 618, 616, 618, 617, 619, 619, 620, 618,
+	620, 619, 621, 621, 622, 620, 622, 621, 623, 624, 622, 623,
+	622, 624, 625, 624, 626, 625, 626, 624, 627, 627, 628, 626,
+	628, 627, 629, 629, 630, 628, 630, 629, 631, 631, 632, 630,
+	632, 631, 633, 634, 632, 633, 634, 635, 632, 635, 634, 636,
+	636, 637, 635, 637, 636, 638, 639, 637, 638, 637, 639, 640,
+	641, 640, 639, 640, 641, 642, 643, 644, 645, 644, 643, 646,
+	644, 646, 647, 647, 646, 648, 647, 648, 649, 649, 648, 650,
+	649, 650, 651, 651, 650, 652, 651, 652, 653, 653, 654, 651,
+	653, 652, 655, 654, 653, 656, 655, 652, 657, 654, 656, 658,
+	655, 657, 659, 658, 656, 660, 659, 657, 661, 658, 660, 662,
+	661, 657, 663, 658, 662, 664, 661, 663, 665, 664, 662, 666,
+	665, 663, 667, 664, 666, 668, 665, 667, 669, 668, 666, 670,
+	665, 669, 671, 668, 670, 672, 671, 669, 673, 672, 670, 674,
+	671, 673, 675, 674, 670, 676, 675, 673, 677, 674, 676, 678,
+	675, 677, 679, 678, 676, 680, 679, 677, 681, 678, 680, 681,
+	681, 677, 682, 678, 681, 683, 683, 681, 682, 683, 682, 684,
+	683, 684, 685, 685, 684, 686, 685, 686, 687, 687, 686, 688,
+	687, 688, 689, 689, 688, 690, 691, 692, 693, 692, 691, 694,
+	694, 691, 695, 696, 697, 698, 699, 697, 696, 697, 699, 700,
+	701, 702, 703, 704, 702, 701, 704, 705, 702, 706, 705, 704,
+	706, 707, 705, 708, 707, 706, 708, 709, 707, 708, 710, 709,
+	711, 710, 708, 711, 712, 710, 711, 713, 712, 714, 713, 711,
+	714, 715, 713, 716, 715, 714, 716, 717, 715, 716, 718, 717,
+	719, 718, 716, 719, 720, 718, 721, 720, 719, 721, 722, 720,
+	723, 722, 721, 723, 724, 722, 723, 725, 724, 725, 723, 726,
+	727, 728, 729, 728, 727, 730, 730, 727, 731, 730, 731, 732,
+	730, 732, 733, 733, 732, 734, 733, 734, 735, 733, 735, 736,
+	736, 735, 737, 736, 737, 738, 736, 738, 739, 740, 739, 738,
+	741, 739, 740, 736, 739, 742, 741, 743, 739, 736, 742, 744,
+	745, 743, 741, 744, 742, 746, 747, 743, 745, 744, 746, 748,
+	747, 749, 743, 748, 746, 750, 751, 749, 747, 748, 750, 752,
+	752, 750, 753, 754, 749, 751, 755, 749, 754, 749, 755, 756,
+	757, 758, 759, 758, 757, 760, 761, 760, 757, 760, 761, 762,
+	763, 762, 761, 762, 763, 764, 765, 764, 763, 764, 765, 766,
+	767, 766, 765, 766, 767, 768, 769, 768, 767, 768, 769, 770,
+	771, 770, 769, 770, 771, 772, 773, 772, 771, 772, 773, 774,
+	775, 774, 773, 774, 775, 776, 777, 776, 775, 776, 777, 778,
+	779, 778, 777, 778, 779, 780, 781, 780, 779, 780, 781, 782,
+	783, 784, 785, 784, 783, 786, 787, 786, 783, 786, 787, 788,
+	789, 788, 787, 788, 789, 790, 789, 791, 790, 791, 789, 792,
+	792, 793, 791, 793, 792, 794, 794, 795, 793, 795, 794, 796,
+	797, 795, 796, 795, 797, 798, 799, 798, 797, 798, 799, 800,
+	801, 800, 799, 800, 801, 802, 803, 802, 801, 802, 803, 804,
+	805, 804, 803, 804, 805, 806, 807, 806, 805, 806, 807, 808,
+	808, 807, 809, 810, 808, 809, 808, 810, 811, 812, 811, 810,
+	811, 812, 813, 814, 815, 816, 814, 817, 815, 818, 817, 814,
+	818, 819, 817, 820, 819, 818, 820, 821, 819, 822, 821, 820,
+	823, 821, 822, 822, 824, 823, 825, 821, 823, 822, 826, 824,
+	827, 821, 825, 828, 826, 822, 827, 829, 821, 830, 829, 827,
+	831, 829, 830, 831, 832, 829, 833, 832, 831, 834, 832, 833,
+	835, 832, 834, 832, 835, 836, 837, 826, 828, 837, 838, 826,
+	837, 839, 838, 839, 837, 840, 828, 841, 837, 828, 842, 841,
+	842, 837, 841, 842, 840, 837, 843, 842, 828, 842, 844, 840,
+	844, 845, 840, 843, 846, 842, 847, 845, 844, 842, 847, 844,
+	846, 847, 842, 847, 848, 845, 843, 849, 846, 849, 847, 846,
+	849, 843, 850, 850, 847, 849, 851, 848, 847, 848, 851, 852,
+	853, 847, 850, 847, 853, 851, 853, 852, 851, 854, 853, 850,
+	854, 852, 853, 855, 852, 854, 855, 856, 852, 857, 856, 855,
+	858, 856, 857, 858, 859, 856, 858, 860, 859, 858, 861, 860,
+	862, 861, 858, 862, 863, 861, 863, 860, 861, 862, 864, 863,
+	865, 864, 862, 863, 866, 860, 864, 866, 863, 865, 867, 864,
+	867, 866, 864, 865, 868, 867, 866, 867, 868, 869, 868, 865,
+	869, 870, 868, 871, 870, 869, 871, 872, 870, 873, 872, 871,
+	873, 874, 872, 875, 874, 873, 876, 874, 875, 874, 876, 877,
+	868, 878, 866, 879, 878, 868, 866, 878, 880, 866, 880, 881,
+	879, 882, 878, 866, 881, 883, 866, 883, 860, 860, 883, 884,
+	860, 884, 885, 885, 884, 886, 885, 886, 887, 887, 886, 888,
+	887, 888, 889, 887, 889, 890, 890, 889, 891, 890, 891, 892,
+	889, 893, 891, 890, 892, 894, 895, 893, 889, 894, 892, 896,
+	897, 893, 895, 894, 896, 898, 897, 899, 893, 898, 896, 900,
+	901, 899, 897, 898, 900, 902, 902, 900, 903, 901, 904, 899,
+	905, 904, 901, 905, 906, 904, 905, 907, 906, 908, 907, 905,
+	908, 909, 907, 910, 909, 908, 911, 909, 910, 911, 912, 909,
+	882, 912, 911, 912, 882, 913, 879, 913, 882, 914, 913, 879,
+	914, 915, 913, 916, 915, 914, 916, 917, 915, 918, 917, 916,
+	918, 919, 917, 920, 919, 918, 919, 920, 921, 922, 923, 924,
+	923, 922, 925, 922, 926, 925, 926, 922, 927, 927, 928, 926,
+	926, 928, 929, 928, 927, 930, 930, 931, 928, 928, 931, 932,
+	931, 930, 933, 933, 934, 931, 934, 933, 935, 935, 936, 934,
+	936, 935, 937, 937, 938, 936, 938, 937, 939, 940, 938, 939,
+	938, 940, 941, 942, 943, 944, 943, 942, 945, 942, 946, 945,
+	946, 942, 947, 947, 948, 946, 948, 947, 949, 949, 950, 948,
+	950, 949, 951, 951, 952, 950, 952, 951, 953, 953, 954, 952,
+	954, 953, 955, 955, 956, 954, 956, 955, 957, 958, 956, 957,
+	956, 958, 959, 960, 961, 962, 961, 960, 963, 960, 964, 963,
+	964, 960, 965, 965, 966, 964, 964, 966, 967, 966, 965, 968,
+	968, 969, 966, 966, 969, 970, 969, 968, 971, 971, 972, 969,
+	972, 971, 973, 973, 974, 972, 974, 973, 975, 975, 976, 974,
+	976, 975, 977, 978, 976, 977, 976, 978, 979, 980, 981, 982,
+	980, 983, 981, 983, 984, 981, 983, 980, 985, 984, 983, 986,
+	980, 987, 985, 986, 988, 984, 987, 980, 989, 988, 986, 990,
+	989, 991, 987, 990, 992, 988, 991, 989, 993, 992, 990, 994,
+	995, 991, 993, 991, 995, 996, 997, 996, 995, 996, 997, 998,
+	999, 998, 997, 998, 999, 1000, 1001, 1000, 999, 1000, 1001, 1002,
+	1003, 1002, 1001, 1002, 1003, 1004, 1005, 1004, 1003, 1004, 1005, 1006,
+	1007, 1006, 1005, 1006, 1007, 1008, 1009, 1008, 1007, 1008, 1009, 1010,
+	1009, 1011, 1010, 1011, 1009, 1012, 1012, 1013, 1011, 1013, 1012, 1014,
+	1014, 1015, 1013, 1015, 1014, 1016, 1016, 1017, 1015, 1017, 1016, 1018,
+	1018, 1019, 1017, 1019, 1018, 1020, 1020, 1021, 1019, 1021, 1020, 1022,
+	1022, 1023, 1021, 1023, 1022, 1024, 1024, 1025, 1023, 1025, 1024, 1026,
+	1027, 1025, 1026, 1025, 1027, 1028, 1029, 1028, 1027, 1028, 1029, 1030,
+	1031, 1030, 1029, 1030, 1031, 1032, 1033, 1032, 1031, 1032, 1033, 1034,
+	1035, 1034, 1033, 1034, 1035, 1036, 1037, 1036, 1035, 1036, 1037, 1038,
+	1039, 1038, 1037, 1038, 1039, 1040, 1041, 1040, 1039, 1040, 1041, 1042,
+	1041, 1043, 1042, 1043, 1041, 1044, 992, 1043, 1044, 1043, 992, 994,
+	992, 1044, 1045, 1046, 1047, 1048, 1046, 1049, 1047, 1049, 1050, 1047,
+	1049, 1046, 1051, 1050, 1049, 1052, 1046, 1053, 1051, 1052, 1054, 1050,
+	1053, 1046, 1055, 1054, 1052, 1056, 1055, 1057, 1053, 1056, 1058, 1054,
+	1057, 1055, 1059, 1058, 1056, 1060, 1061, 1057, 1059, 1057, 1061, 1062,
+	1063, 1062, 1061, 1062, 1063, 1064, 1065, 1064, 1063, 1064, 1065, 1066,
+	1067, 1066, 1065, 1066, 1067, 1068, 1069, 1068, 1067, 1068, 1069, 1070,
+	1071, 1070, 1069, 1070, 1071, 1072, 1073, 1072, 1071, 1072, 1073, 1074,
+	1075, 1074, 1073, 1074, 1075, 1076, 1075, 1077, 1076, 1077, 1075, 1078,
+	1078, 1079, 1077, 1079, 1078, 1080, 1080, 1081, 1079, 1081, 1080, 1082,
+	1082, 1083, 1081, 1083, 1082, 1084, 1084, 1085, 1083, 1085, 1084, 1086,
+	1086, 1087, 1085, 1087, 1086, 1088, 1088, 1089, 1087, 1089, 1088, 1090,
+	1090, 1091, 1089, 1091, 1090, 1092, 1093, 1091, 1092, 1091, 1093, 1094,
+	1095, 1094, 1093, 1094, 1095, 1096, 1097, 1096, 1095, 1096, 1097, 1098,
+	1099, 1098, 1097, 1098, 1099, 1100, 1101, 1100, 1099, 1100, 1101, 1102,
+	1103, 1102, 1101, 1102, 1103, 1104, 1105, 1104, 1103, 1104, 1105, 1106,
+	1107, 1106, 1105, 1106, 1107, 1108, 1107, 1109, 1108, 1109, 1107, 1110,
+	1058, 1109, 1110, 1109, 1058, 1060, 1058, 1110, 1111, 1112, 1113, 1114,
+	1113, 1115, 1114, 1113, 1112, 1116, 1115, 1113, 1117, 1118, 1116, 1112,
+	1117, 1119, 1115, 1116, 1118, 1120, 1119, 1117, 1121, 1122, 1120, 1118,
+	1121, 1123, 1119, 1120, 1122, 1124, 1123, 1121, 1125, 1126, 1124, 1122,
+	1125, 1127, 1123, 1124, 1126, 1128, 1127, 1125, 1129, 1126, 1130, 1128,
+	1131, 1127, 1129, 1130, 1126, 1132, 1127, 1131, 1133, 1132, 1134, 1130,
+	1135, 1133, 1131, 1134, 1132, 1136, 1133, 1135, 1137, 1136, 1138, 1134,
+	1139, 1137, 1135, 1138, 1136, 1140, 1137, 1139, 1141, 1140, 1142, 1138,
+	1142, 1141, 1139, 1142, 1140, 1143, 1141, 1142, 1143, 1144, 1145, 1146,
+	1145, 1147, 1146, 1145, 1144, 1148, 1147, 1145, 1149, 1150, 1148, 1144,
+	1149, 1151, 1147, 1148, 1150, 1152, 1151, 1149, 1153, 1154, 1152, 1150,
+	1153, 1155, 1151, 1152, 1154, 1156, 1155, 1153, 1157, 1158, 1156, 1154,
+	1157, 1159, 1155, 1156, 1158, 1160, 1159, 1157, 1161, 1158, 1162, 1160,
+	1163, 1159, 1161, 1162, 1158, 1164, 1159, 1163, 1165, 1164, 1166, 1162,
+	1167, 1165, 1163, 1166, 1164, 1168, 1165, 1167, 1169, 1168, 1170, 1166,
+	1171, 1169, 1167, 1170, 1168, 1172, 1169, 1171, 1173, 1172, 1174, 1170,
+	1174, 1173, 1171, 1174, 1172, 1175, 1173, 1174, 1175,
+	// LOD 1: 752 triangles
+	122, 3, 1, 3, 5, 1, 5, 122, 1, 3, 122, 92,
+	5, 118, 122, 118, 92, 122, 92, 7, 3, 5, 3, 7,
+	92, 118, 88, 88, 7, 92, 5, 114, 118, 114, 88, 118,
+	84, 7, 88, 88, 114, 84, 77, 5, 7, 84, 77, 7,
+	107, 114, 5, 5, 77, 107, 112, 84, 114, 107, 112, 114,
+	84, 112, 82, 82, 77, 84, 110, 82, 112, 107, 110, 112,
+	82, 110, 80, 80, 77, 82, 108, 80, 110, 107, 108, 110,
+	78, 77, 80, 80, 108, 78, 75, 107, 77, 76, 77, 78,
+	76, 75, 77, 111, 78, 108, 107, 75, 105, 78, 111, 81,
+	107, 106, 108, 105, 106, 107, 108, 109, 111, 109, 108, 106,
+	113, 81, 111, 111, 109, 113, 79, 78, 81, 78, 79, 76,
+	81, 113, 83, 79, 81, 83, 79, 106, 76, 115, 83, 113,
+	113, 109, 115, 106, 79, 109, 83, 115, 85, 79, 83, 85,
+	106, 74, 76, 74, 75, 76, 74, 106, 104, 105, 104, 106,
+	74, 73, 75, 73, 105, 75, 104, 72, 74, 72, 73, 74,
+	103, 104, 105, 105, 73, 103, 72, 104, 102, 103, 102, 104,
+	72, 71, 73, 71, 103, 73, 102, 69, 72, 69, 71, 72,
+	101, 102, 103, 103, 71, 101, 69, 102, 98, 101, 98, 102,
+	69, 68, 71, 68, 101, 71, 100, 69, 98, 99, 98, 101,
+	98, 99, 100, 101, 68, 99, 69, 100, 70, 68, 69, 70,
+	99, 70, 100, 70, 99, 68, 8, 109, 79, 79, 85, 8,
+	109, 8, 10, 115, 109, 10, 119, 85, 115, 115, 10, 119,
+	8, 85, 89, 85, 119, 89, 8, 89, 93, 119, 93, 89,
+	119, 10, 123, 93, 119, 123, 123, 10, 14, 14, 93, 123,
+	8, 14, 10, 93, 14, 13, 14, 8, 13, 8, 93, 13,
+	184, 16, 18, 16, 17, 18, 17, 184, 18, 16, 184, 187,
+	17, 16, 19, 187, 19, 16, 184, 17, 191, 191, 187, 184,
+	19, 187, 190, 187, 191, 190, 223, 17, 19, 19, 190, 223,
+	191, 17, 271, 17, 223, 271, 191, 192, 190, 223, 190, 192,
+	192, 191, 193, 191, 271, 193, 193, 194, 192, 194, 193, 195,
+	227, 192, 194, 223, 192, 227, 193, 280, 195, 193, 271, 280,
+	195, 198, 194, 223, 280, 271, 198, 195, 199, 271, 227, 223,
+	195, 310, 199, 195, 280, 310, 227, 271, 280, 280, 223, 227,
+	218, 271, 223, 227, 310, 280, 271, 218, 267, 219, 218, 223,
+	219, 267, 218, 267, 266, 271, 267, 219, 266, 219, 223, 226,
+	226, 266, 219, 226, 223, 227, 271, 266, 274, 266, 226, 274,
+	271, 274, 280, 226, 277, 274, 280, 274, 276, 277, 276, 274,
+	280, 276, 310, 277, 226, 229, 357, 280, 310, 280, 357, 227,
+	228, 229, 226, 226, 227, 228, 227, 194, 357, 357, 194, 198,
+	310, 227, 357, 229, 281, 277, 240, 227, 357, 279, 277, 281,
+	276, 277, 279, 234, 227, 240, 228, 227, 234, 234, 276, 228,
+	279, 228, 276, 276, 234, 312, 310, 276, 312, 234, 309, 312,
+	310, 312, 309, 309, 234, 240, 228, 279, 231, 229, 228, 231,
+	229, 231, 233, 281, 229, 233, 279, 237, 231, 233, 231, 237,
+	279, 281, 283, 237, 279, 283, 233, 286, 281, 283, 281, 286,
+	233, 237, 243, 286, 233, 243, 283, 245, 237, 243, 237, 245,
+	283, 286, 289, 243, 289, 286, 245, 283, 288, 283, 289, 288,
+	243, 245, 249, 289, 243, 249, 288, 251, 245, 249, 245, 251,
+	288, 289, 290, 251, 288, 290, 249, 294, 289, 290, 289, 294,
+	249, 251, 258, 294, 249, 258, 292, 251, 290, 290, 294, 292,
+	251, 292, 255, 258, 251, 255, 293, 255, 292, 292, 294, 293,
+	258, 255, 256, 255, 293, 256, 262, 294, 258, 295, 293, 294,
+	294, 262, 300, 295, 294, 300, 258, 261, 262, 263, 300, 262,
+	262, 261, 263, 300, 263, 306, 261, 306, 263, 302, 300, 306,
+	306, 261, 302, 295, 300, 302, 258, 257, 261, 257, 302, 261,
+	302, 257, 295, 258, 256, 257, 257, 297, 295, 297, 293, 295,
+	256, 252, 257, 297, 257, 252, 305, 256, 293, 297, 305, 293,
+	256, 305, 246, 246, 252, 256, 305, 240, 246, 240, 305, 309,
+	240, 355, 246, 246, 355, 252, 240, 357, 355, 308, 309, 305,
+	308, 305, 297, 310, 309, 308, 310, 355, 357, 357, 308, 310,
+	355, 310, 308, 308, 357, 355, 199, 310, 308, 357, 198, 355,
+	200, 198, 199, 199, 308, 200, 355, 198, 201, 198, 200, 201,
+	355, 297, 308, 200, 308, 297, 308, 252, 355, 252, 308, 297,
+	355, 201, 252, 297, 355, 252, 200, 202, 201, 252, 201, 202,
+	200, 297, 203, 202, 200, 203, 252, 202, 204, 203, 204, 202,
+	203, 297, 205, 204, 203, 205, 252, 209, 297, 205, 297, 209,
+	252, 204, 208, 209, 252, 208, 205, 206, 204, 208, 204, 206,
+	206, 205, 207, 207, 208, 206, 205, 209, 207, 208, 207, 209,
+	208, 336, 209, 336, 208, 347, 209, 210, 208, 347, 208, 210,
+	209, 336, 211, 210, 209, 211, 20, 336, 347, 347, 210, 20,
+	211, 336, 22, 336, 20, 22, 211, 22, 21, 20, 21, 22,
+	214, 210, 211, 211, 21, 214, 20, 210, 23, 21, 20, 23,
+	210, 214, 215, 21, 215, 214, 23, 210, 215, 215, 21, 23,
+	608, 52, 54, 52, 53, 54, 53, 608, 54, 52, 608, 611,
+	615, 611, 608, 608, 53, 615, 611, 55, 52, 53, 52, 55,
+	611, 615, 614, 55, 611, 614, 615, 53, 872, 55, 614, 721,
+	53, 721, 872, 721, 53, 55, 615, 872, 617, 721, 617, 872,
+	615, 616, 614, 721, 614, 616, 616, 615, 617, 617, 721, 616,
+	920, 55, 53, 617, 618, 616, 55, 920, 643, 647, 53, 55,
+	643, 647, 55, 917, 920, 53, 53, 647, 917, 916, 643, 920,
+	920, 917, 916, 647, 643, 648, 643, 916, 648, 649, 917, 647,
+	647, 648, 649, 916, 917, 913, 917, 649, 913, 916, 657, 648,
+	649, 648, 657, 916, 913, 867, 657, 916, 867, 649, 908, 913,
+	649, 657, 653, 908, 882, 913, 867, 913, 882, 908, 649, 654,
+	653, 654, 649, 653, 657, 659, 659, 882, 653, 659, 657, 665,
+	911, 653, 882, 882, 659, 880, 882, 908, 911, 659, 883, 880,
+	883, 659, 665, 863, 882, 880, 863, 880, 883, 867, 882, 863,
+	653, 911, 656, 654, 653, 656, 911, 654, 656, 654, 911, 908,
+	654, 656, 658, 911, 907, 908, 907, 654, 658, 654, 907, 908,
+	658, 654, 666, 908, 666, 654, 908, 907, 905, 666, 908, 905,
+	658, 904, 907, 905, 907, 904, 658, 666, 668, 904, 658, 668,
+	905, 670, 666, 668, 666, 670, 905, 904, 901, 670, 905, 901,
+	668, 899, 904, 901, 904, 899, 899, 668, 674, 668, 670, 674,
+	674, 901, 899, 901, 674, 670, 897, 899, 901, 674, 670, 676,
+	676, 901, 897, 901, 676, 670, 897, 901, 889, 889, 676, 897,
+	670, 891, 901, 889, 901, 891, 670, 676, 681, 676, 889, 681,
+	891, 670, 683, 670, 681, 683, 687, 891, 683, 683, 681, 684,
+	683, 684, 687, 891, 687, 896, 687, 684, 688, 688, 896, 687,
+	894, 891, 896, 894, 889, 891, 896, 688, 902, 894, 896, 902,
+	684, 902, 688, 902, 684, 894, 885, 889, 894, 684, 885, 894,
+	884, 681, 889, 885, 884, 889, 681, 673, 684, 885, 684, 673,
+	681, 884, 671, 671, 673, 681, 884, 665, 671, 665, 884, 883,
+	885, 883, 884, 665, 667, 671, 671, 667, 673, 665, 657, 667,
+	863, 883, 885, 867, 667, 657, 667, 885, 863, 667, 867, 863,
+	885, 667, 673, 617, 863, 867, 616, 863, 617, 863, 616, 667,
+	616, 618, 667, 618, 617, 619, 619, 617, 867, 667, 618, 620,
+	619, 620, 618, 619, 867, 621, 620, 619, 621, 667, 620, 622,
+	621, 622, 620, 667, 622, 673, 621, 867, 623, 622, 621, 623,
+	623, 867, 863, 623, 863, 624, 624, 622, 623, 624, 863, 885,
+	673, 622, 625, 622, 624, 625, 673, 856, 885, 624, 885, 856,
+	673, 625, 711, 856, 673, 711, 624, 626, 625, 711, 625, 626,
+	624, 856, 627, 626, 624, 627, 711, 626, 628, 627, 628, 626,
+	627, 856, 629, 628, 627, 629, 711, 852, 856, 629, 856, 852,
+	711, 628, 708, 852, 711, 708, 629, 57, 628, 708, 628, 57,
+	629, 852, 633, 57, 629, 633, 708, 848, 852, 848, 633, 852,
+	708, 57, 706, 848, 708, 706, 751, 633, 57, 699, 848, 706,
+	706, 57, 635, 706, 635, 699, 57, 635, 751, 633, 635, 57,
+	751, 635, 699, 633, 848, 809, 633, 751, 809, 809, 848, 698,
+	848, 699, 698, 751, 698, 809, 699, 698, 751, 633, 809, 636,
+	636, 809, 698, 635, 633, 636, 745, 698, 699, 639, 635, 636,
+	698, 745, 803, 636, 698, 641, 636, 641, 639, 641, 698, 803,
+	699, 641, 698, 741, 803, 745, 641, 699, 642, 699, 635, 642,
+	641, 803, 801, 803, 741, 801, 641, 801, 639, 699, 743, 745,
+	699, 635, 743, 745, 743, 741, 642, 635, 743, 743, 641, 642,
+	635, 639, 743, 641, 743, 639, 778, 743, 639, 639, 801, 778,
+	741, 743, 739, 743, 778, 739, 740, 801, 741, 741, 739, 740,
+	801, 740, 799, 778, 801, 799, 738, 799, 740, 740, 739, 738,
+	778, 799, 797, 799, 738, 797, 776, 739, 778, 737, 797, 738,
+	736, 738, 739, 736, 737, 738, 797, 762, 778, 778, 762, 776,
+	797, 737, 796, 796, 762, 797, 737, 794, 796, 794, 762, 796,
+	794, 737, 735, 736, 735, 737, 735, 792, 794, 794, 760, 762,
+	792, 760, 794, 760, 736, 762, 792, 735, 734, 789, 760, 792,
+	734, 789, 792, 733, 734, 735, 733, 735, 736, 736, 760, 733,
+	789, 734, 732, 733, 732, 734, 789, 65, 760, 65, 733, 760,
+	67, 732, 733, 733, 65, 67, 731, 789, 732, 67, 731, 732,
+	789, 731, 787, 787, 65, 789, 62, 731, 67, 62, 787, 731,
+	65, 62, 67, 61, 65, 787, 62, 65, 61, 787, 62, 61,
+	744, 762, 736, 762, 744, 764, 776, 762, 764, 736, 742, 744,
+	736, 739, 742, 739, 776, 742, 774, 742, 776, 776, 764, 774,
+	744, 742, 746, 742, 774, 746, 748, 764, 744, 744, 746, 748,
+	774, 764, 766, 764, 748, 766, 772, 746, 774, 774, 766, 772,
+	748, 746, 750, 746, 772, 750, 752, 766, 748, 748, 750, 752,
+	772, 766, 768, 766, 752, 768, 770, 750, 772, 772, 768, 770,
+	752, 750, 753, 753, 768, 752, 750, 770, 753, 768, 753, 770,
+	44, 48, 46, 46, 525, 44, 48, 44, 50, 525, 50, 44,
+	46, 48, 524, 525, 46, 524, 50, 482, 48, 524, 48, 482,
+	50, 525, 483, 482, 50, 483, 524, 523, 525, 483, 525, 523,
+	524, 482, 522, 523, 524, 522, 478, 482, 483, 483, 523, 478,
+	522, 482, 479, 482, 478, 479, 522, 519, 523, 478, 523, 519,
+	522, 479, 520, 519, 522, 520, 478, 477, 479, 520, 479, 477,
+	477, 478, 476, 478, 519, 476, 476, 475, 477, 520, 477, 475,
+	475, 476, 474, 476, 519, 474, 520, 475, 473, 474, 473, 475,
+	474, 519, 472, 473, 474, 472, 520, 514, 519, 472, 519, 514,
+	520, 473, 515, 514, 520, 515, 472, 470, 473, 515, 473, 470,
+	470, 472, 471, 472, 514, 471, 469, 470, 471, 471, 514, 469,
+	515, 470, 468, 470, 469, 468, 511, 514, 515, 467, 468, 469,
+	469, 514, 497, 497, 467, 469, 468, 467, 466, 497, 465, 467,
+	465, 466, 467, 515, 468, 496, 466, 496, 468, 466, 465, 464,
+	464, 496, 466, 460, 464, 465, 497, 460, 465, 461, 496, 464,
+	464, 460, 461, 515, 496, 499, 515, 499, 511, 461, 491, 496,
+	511, 499, 503, 461, 34, 491, 511, 503, 509, 459, 34, 461,
+	460, 459, 461, 509, 510, 511, 514, 511, 510, 509, 503, 507,
+	498, 514, 510, 497, 514, 498, 510, 509, 508, 507, 508, 509,
+	498, 496, 497, 508, 507, 506, 503, 506, 507, 496, 498, 499,
+	506, 503, 502, 499, 502, 503, 502, 508, 506, 502, 499, 498,
+	502, 510, 508, 498, 510, 502, 496, 493, 497, 493, 496, 491,
+	493, 460, 497, 491, 33, 493, 33, 460, 493, 33, 491, 34,
+	460, 33, 458, 459, 460, 458, 32, 33, 34, 459, 32, 34,
+	35, 458, 33, 33, 32, 35, 458, 40, 459, 40, 32, 459,
+	37, 458, 35, 32, 37, 35, 40, 458, 43, 458, 37, 43,
+	37, 40, 43, 32, 40, 39, 40, 37, 39, 37, 32, 39,
+	368, 25, 27, 25, 24, 27, 24, 368, 27, 25, 368, 371,
+	371, 26, 25, 24, 25, 26, 368, 376, 371, 26, 371, 376,
+	368, 24, 377, 376, 368, 377, 422, 24, 26, 26, 376, 422,
+	377, 24, 448, 24, 422, 448, 377, 448, 446, 422, 446, 448,
+	377, 378, 376, 422, 376, 420, 420, 376, 378, 446, 422, 420,
+	378, 377, 379, 377, 446, 379, 420, 378, 380, 379, 380, 378,
+	420, 381, 446, 379, 446, 381, 381, 420, 380, 380, 379, 381,
+	381, 382, 380, 382, 381, 383, 380, 382, 384, 383, 384, 382,
+	380, 385, 381, 383, 381, 385, 385, 380, 384, 384, 383, 385,
+	385, 388, 384, 384, 389, 385, 389, 384, 388, 388, 385, 389,
+	389, 390, 388, 388, 435, 389, 390, 389, 391, 389, 435, 391,
+	409, 388, 390, 435, 388, 409, 391, 392, 390, 409, 390, 392,
+	391, 435, 393, 392, 391, 393, 409, 433, 435, 393, 435, 433,
+	409, 392, 407, 433, 409, 407, 407, 392, 28, 28, 433, 407,
+	393, 399, 392, 28, 392, 399, 393, 433, 30, 433, 28, 30,
+	393, 30, 398, 399, 393, 398, 398, 30, 29, 29, 399, 398,
+	28, 29, 30, 399, 29, 31, 29, 28, 31, 28, 399, 31,
+	// LOD 2: 119 triangles
+	612, 53, 52, 878, 917, 53, 654, 878, 917, 654, 870, 878,
+	917, 878, 870, 917, 870, 654, 654, 917, 907, 878, 870, 716,
+	907, 917, 908, 870, 618, 716, 618, 870, 623, 623, 870, 716,
+	716, 618, 623, 716, 623, 885, 885, 623, 627, 907, 908, 897,
+	908, 907, 893, 907, 897, 893, 908, 893, 897, 893, 897, 888,
+	893, 888, 885, 885, 627, 894, 893, 885, 894, 894, 627, 628,
+	885, 893, 896, 893, 894, 896, 885, 896, 894, 896, 894, 902,
+	894, 628, 634, 634, 628, 56, 692, 634, 56, 692, 634, 639,
+	634, 692, 698, 698, 634, 639, 692, 639, 743, 698, 692, 743,
+	743, 639, 698, 698, 743, 745, 698, 745, 799, 745, 743, 799,
+	698, 799, 743, 799, 743, 739, 799, 739, 738, 762, 738, 739,
+	762, 739, 742, 762, 742, 799, 762, 796, 738, 762, 799, 796,
+	796, 799, 753, 733, 796, 762, 733, 734, 796, 733, 789, 734,
+	67, 789, 733, 67, 61, 789, 188, 18, 318, 270, 267, 318,
+	270, 318, 226, 226, 318, 313, 318, 313, 196, 196, 313, 199,
+	226, 313, 278, 199, 313, 308, 278, 281, 226, 281, 278, 282,
+	281, 282, 288, 281, 288, 287, 287, 288, 294, 294, 288, 300,
+	199, 308, 295, 294, 295, 300, 301, 308, 295, 294, 300, 306,
+	301, 295, 306, 294, 306, 295, 300, 295, 306, 199, 295, 202,
+	202, 295, 209, 202, 209, 207, 211, 22, 23, 211, 23, 214,
+	398, 392, 396, 407, 392, 398, 483, 407, 476, 483, 524, 407,
+	44, 524, 483, 47, 524, 44, 476, 407, 517, 476, 517, 471,
+	471, 517, 469, 469, 517, 497, 497, 464, 469, 497, 517, 512,
+	497, 461, 464, 497, 512, 500, 500, 512, 508, 500, 508, 506,
+	32, 461, 34, 32, 43, 461, 39, 43, 32, 26, 373, 376,
+	26, 25, 373, 8, 119, 14, 8, 115, 119, 109, 115, 8,
+	109, 111, 115, 109, 100, 111, 100, 109, 104, 110, 111, 100,
+	111, 103, 104, 111, 110, 103, 104, 103, 105, 104, 105, 107,
+	104, 107, 100, 100, 107, 110, 110, 107, 114, 114, 107, 7,
+	114, 7, 118, 118, 7, 2, 2, 7, 3,
+};
+
+const lennyLod lennyLods[3] =
+{
+	{ 0, 3345 },
+	{ 3345, 2256 },
+	{ 5601, 357 },
+};
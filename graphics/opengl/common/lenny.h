@@ -0,0 +1,32 @@
+#pragma once
+#include <stdint.h>
+
+// Indexed lenny mesh, baked from tools/lenny_flat.c by tools/bake_mesh.py
+typedef struct
+{
+	float x, y, z;
+	uint32_t normal; // packed as GL_INT_2_10_10_10_REV
+} lennyVertex;
+
+// Range of lennyIndices drawing one level of detail, from full detail (0) to coarsest
+typedef struct
+{
+	uint32_t firstIndex;
+	uint32_t indexCount;
+} lennyLod;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+extern const lennyVertex lennyVertices[1176];
+extern const uint16_t lennyIndices[5958];
+extern const lennyLod lennyLods[3];
+
+#ifdef __cplusplus
+}
+#endif
+
+#define lennyVerticesCount (sizeof(lennyVertices)/sizeof(lennyVertices[0]))
+#define lennyIndicesCount (sizeof(lennyIndices)/sizeof(lennyIndices[0]))
+#define lennyLodsCount (sizeof(lennyLods)/sizeof(lennyLods[0]))
@@ -0,0 +1,179 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "shader_cache.h"
+
+#ifndef ENABLE_NXLINK
+#define TRACE(fmt,...) ((void)0)
+#else
+#define TRACE(fmt,...) printf("%s: " fmt "\n", __PRETTY_FUNCTION__, ## __VA_ARGS__)
+#endif
+
+static ShaderCacheStats s_stats;
+
+static uint64_t getDriverHash()
+{
+    static uint64_t hash;
+    if (!hash)
+    {
+        hash = shaderCacheDriverHash(
+            (const char*)glGetString(GL_VENDOR),
+            (const char*)glGetString(GL_RENDERER),
+            (const char*)glGetString(GL_VERSION),
+            (const char*)glGetString(GL_SHADING_LANGUAGE_VERSION));
+    }
+    return hash;
+}
+
+static GLuint compileShader(const ShaderStage* stage, const char* defines)
+{
+    GLuint handle = glCreateShader(stage->type);
+    if (!handle)
+    {
+        TRACE("%u: cannot create shader", stage->type);
+        return 0;
+    }
+
+    // The defines have to come after the #version line, which must be the first one
+    const char* source = stage->source;
+    const char* body = strstr(source, "#version");
+    body = body ? strchr(body, '\n') : nullptr;
+    body = body ? body + 1 : source;
+    const GLchar* strings[] = { source, defines ? defines : "", body };
+    const GLint lengths[] = { GLint(body - source), -1, -1 };
+    glShaderSource(handle, 3, strings, lengths);
+    glCompileShader(handle);
+
+    GLint success;
+    glGetShaderiv(handle, GL_COMPILE_STATUS, &success);
+    if (!success)
+    {
+        GLchar msg[512];
+        glGetShaderInfoLog(handle, sizeof(msg), nullptr, msg);
+        TRACE("%u: %s", stage->type, msg);
+        glDeleteShader(handle);
+        return 0;
+    }
+
+    return handle;
+}
+
+static bool linkProgram(GLuint program, const ShaderStage* stages, unsigned numStages, const char* defines)
+{
+    GLuint shaders[8];
+    unsigned numShaders = 0;
+    bool ok = numStages <= sizeof(shaders)/sizeof(shaders[0]);
+
+    for (unsigned i = 0; ok && i < numStages; i ++)
+    {
+        shaders[numShaders] = compileShader(&stages[i], defines);
+        ok = shaders[numShaders] != 0;
+        if (ok)
+            glAttachShader(program, shaders[numShaders++]);
+    }
+
+    if (ok)
+    {
+        glLinkProgram(program);
+
+        GLint success;
+        glGetProgramiv(program, GL_LINK_STATUS, &success);
+        if (!success)
+        {
+            char msg[512];
+            glGetProgramInfoLog(program, sizeof(msg), nullptr, msg);
+            TRACE("link error: %s", msg);
+            ok = false;
+        }
+    }
+
+    // The shaders aren't needed anymore once the program is linked
+    for (unsigned i = 0; i < numShaders; i ++)
+    {
+        glDetachShader(program, shaders[i]);
+        glDeleteShader(shaders[i]);
+    }
+    return ok;
+}
+
+static bool loadProgram(GLuint program, uint64_t key)
+{
+    uint32_t format;
+    size_t size;
+    void* data = shaderCacheFileRead(SHADERCACHE_DIR, key, &format, &size);
+    if (!data)
+        return false;
+
+    glProgramBinary(program, format, data, size);
+    free(data);
+
+    GLint success;
+    glGetProgramiv(program, GL_LINK_STATUS, &success);
+    if (!success)
+    {
+        // Remove the stale binary, it gets replaced once the program is compiled
+        s_stats.rejected ++;
+        shaderCacheFileRemove(SHADERCACHE_DIR, key);
+        return false;
+    }
+
+    return true;
+}
+
+static void saveProgram(GLuint program, uint64_t key)
+{
+    GLint size = 0;
+    glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &size);
+    if (size <= 0)
+        return;
+
+    void* data = malloc(size);
+    if (!data)
+        return;
+
+    GLenum format;
+    GLsizei length = 0;
+    glGetProgramBinary(program, size, &length, &format, data);
+    if (length > 0)
+        shaderCacheFileWrite(SHADERCACHE_DIR, key, format, data, length);
+    free(data);
+}
+
+GLuint shaderCacheBuildProgram(const ShaderStage* stages, unsigned numStages, const char* defines, bool separable)
+{
+    GLint numFormats = 0;
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &numFormats);
+    uint64_t key = numFormats > 0 ? shaderCacheProgramKey(getDriverHash(), stages, numStages, defines, separable) : 0;
+
+    GLuint program = glCreateProgram();
+    if (!program)
+        return 0;
+    if (separable)
+        glProgramParameteri(program, GL_PROGRAM_SEPARABLE, GL_TRUE);
+
+    if (key && loadProgram(program, key))
+    {
+        s_stats.hits ++;
+        return program;
+    }
+
+    // A rejected binary merely leaves the program unlinked, so it can be linked from the sources instead
+    s_stats.misses ++;
+    if (key)
+        glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    if (!linkProgram(program, stages, numStages, defines))
+    {
+        glDeleteProgram(program);
+        return 0;
+    }
+
+    if (key)
+        saveProgram(program, key);
+    return program;
+}
+
+ShaderCacheStats shaderCacheGetStats()
+{
+    return s_stats;
+}
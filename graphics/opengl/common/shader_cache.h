@@ -0,0 +1,27 @@
+#pragma once
+#include <glad/glad.h>
+
+#include "shader_cache_file.h"
+
+// Shader cache shared by the OpenGL examples.
+// Linked programs are saved to the SD card (with glGetProgramBinary), keyed by a hash of their
+// sources, defines and the driver version, and reloaded (with glProgramBinary) on later launches
+// instead of being compiled again. Programs are compiled as usual whenever the driver rejects a
+// cached binary or doesn't support program binaries at all.
+
+#define SHADERCACHE_DIR "sdmc:/switch/.shadercache"
+
+struct ShaderCacheStats
+{
+    unsigned hits;     // programs loaded from the cache
+    unsigned misses;   // programs compiled (and cached if possible)
+    unsigned rejected; // cached binaries the driver refused, e.g. after an update
+};
+
+// Builds a program out of the given stages, returning 0 if it fails to compile or link (the errors
+// are printed when building with ENABLE_NXLINK, like the TRACE output of the examples).
+// The defines (if any) are inserted after the #version line of each stage. Separable programs
+// can be used in program pipelines.
+GLuint shaderCacheBuildProgram(const ShaderStage* stages, unsigned numStages, const char* defines, bool separable);
+
+ShaderCacheStats shaderCacheGetStats();
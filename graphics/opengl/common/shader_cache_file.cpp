@@ -0,0 +1,128 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+#include "shader_cache_file.h"
+
+constexpr uint32_t FILEMAGIC = 0x43444853; // "SHDC"
+constexpr uint32_t FILEVERSION = 1;
+
+struct FileHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    uint64_t key;
+    uint32_t format;
+    uint32_t size;
+    uint64_t checksum;
+};
+
+static uint64_t hashBytes(uint64_t hash, const void* data, size_t size)
+{
+    const uint8_t* p = (const uint8_t*)data;
+    for (size_t i = 0; i < size; i ++)
+        hash = (hash ^ p[i]) * 0x100000001b3ull;
+    return hash;
+}
+
+uint64_t shaderCacheHashString(uint64_t hash, const char* str)
+{
+    return hashBytes(hash, str, strlen(str)+1);
+}
+
+uint64_t shaderCacheHashU32(uint64_t hash, uint32_t value)
+{
+    return hashBytes(hash, &value, sizeof(value));
+}
+
+uint64_t shaderCacheDriverHash(const char* vendor, const char* renderer, const char* version, const char* glslVersion)
+{
+    const char* strings[] = { vendor, renderer, version, glslVersion };
+    uint64_t hash = SHADERCACHE_HASH_INIT;
+    for (const char* str : strings)
+        hash = shaderCacheHashString(hash, str ? str : "");
+    return hash;
+}
+
+uint64_t shaderCacheProgramKey(uint64_t driverHash, const ShaderStage* stages, unsigned numStages, const char* defines, bool separable)
+{
+    uint64_t key = shaderCacheHashString(driverHash, defines ? defines : "");
+    key = shaderCacheHashU32(key, separable);
+    for (unsigned i = 0; i < numStages; i ++)
+    {
+        key = shaderCacheHashU32(key, stages[i].type);
+        key = shaderCacheHashString(key, stages[i].source);
+    }
+    return key;
+}
+
+static void getPath(char* out, size_t outSize, const char* dir, uint64_t key, const char* ext)
+{
+    snprintf(out, outSize, "%s/%016llx%s", dir, (unsigned long long)key, ext);
+}
+
+void* shaderCacheFileRead(const char* dir, uint64_t key, uint32_t* format, size_t* size)
+{
+    char path[256];
+    getPath(path, sizeof(path), dir, key, ".bin");
+    FILE* f = fopen(path, "rb");
+    if (!f)
+        return nullptr;
+
+    // The key is checked as well, in case of a (very unlikely) clash in the file names
+    FileHeader hdr;
+    void* data = nullptr;
+    if (fread(&hdr, sizeof(hdr), 1, f) == 1 && hdr.magic == FILEMAGIC && hdr.version == FILEVERSION && hdr.key == key && hdr.size)
+    {
+        data = malloc(hdr.size);
+        if (data && (fread(data, hdr.size, 1, f) != 1 || hashBytes(SHADERCACHE_HASH_INIT, data, hdr.size) != hdr.checksum))
+        {
+            free(data);
+            data = nullptr;
+        }
+    }
+    fclose(f);
+
+    if (data)
+    {
+        *format = hdr.format;
+        *size = hdr.size;
+    }
+    return data;
+}
+
+bool shaderCacheFileWrite(const char* dir, uint64_t key, uint32_t format, const void* data, size_t size)
+{
+    // The directory usually exists already, in which case this fails harmlessly
+    mkdir(dir, 0777);
+
+    // Write to a temporary file first, so that an interrupted write never leaves a truncated binary behind
+    char path[256], tmpPath[256];
+    getPath(path, sizeof(path), dir, key, ".bin");
+    getPath(tmpPath, sizeof(tmpPath), dir, key, ".tmp");
+    FILE* f = fopen(tmpPath, "wb");
+    if (!f)
+        return false;
+
+    FileHeader hdr = { FILEMAGIC, FILEVERSION, key, format, (uint32_t)size, hashBytes(SHADERCACHE_HASH_INIT, data, size) };
+    bool ok = fwrite(&hdr, sizeof(hdr), 1, f) == 1 && fwrite(data, size, 1, f) == 1;
+    ok = fclose(f) == 0 && ok;
+
+    // rename doesn't replace existing files everywhere, so make way for the new one
+    if (ok)
+    {
+        remove(path);
+        ok = rename(tmpPath, path) == 0;
+    }
+    if (!ok)
+        remove(tmpPath);
+    return ok;
+}
+
+void shaderCacheFileRemove(const char* dir, uint64_t key)
+{
+    char path[256];
+    getPath(path, sizeof(path), dir, key, ".bin");
+    remove(path);
+}
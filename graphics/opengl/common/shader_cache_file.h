@@ -0,0 +1,38 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+// Keys and storage of the shader cache (see shader_cache.h): one file per program, named after its key.
+// This part doesn't depend on GL or libnx, so it can be built and tried out on a host as well.
+
+#define SHADERCACHE_HASH_INIT 0xcbf29ce484222325ull
+
+struct ShaderStage
+{
+    uint32_t type; // GL_VERTEX_SHADER, GL_FRAGMENT_SHADER...
+    const char* source;
+};
+
+// Adds a string (including its terminator, so that consecutive strings can't be confused) to a 64-bit FNV-1a hash
+uint64_t shaderCacheHashString(uint64_t hash, const char* str);
+
+// Adds an integer to a 64-bit FNV-1a hash
+uint64_t shaderCacheHashU32(uint64_t hash, uint32_t value);
+
+// Hashes the strings identifying the driver (GL_VENDOR, GL_RENDERER, GL_VERSION and
+// GL_SHADING_LANGUAGE_VERSION), since binaries are only valid for the driver that produced them.
+// Null strings (which glGetString returns on errors) count as empty ones.
+uint64_t shaderCacheDriverHash(const char* vendor, const char* renderer, const char* version, const char* glslVersion);
+
+// Computes the key of a program built by a driver, from everything that goes into building it
+uint64_t shaderCacheProgramKey(uint64_t driverHash, const ShaderStage* stages, unsigned numStages, const char* defines, bool separable);
+
+// Reads the program binary stored under a key, returning it (to be freed with free) and its format,
+// or nullptr if there is none or the file is damaged
+void* shaderCacheFileRead(const char* dir, uint64_t key, uint32_t* format, size_t* size);
+
+// Stores a program binary under a key, creating the directory if needed
+bool shaderCacheFileWrite(const char* dir, uint64_t key, uint32_t format, const void* data, size_t size);
+
+// Removes the binary stored under a key (e.g. after the driver rejected it)
+void shaderCacheFileRemove(const char* dir, uint64_t key);
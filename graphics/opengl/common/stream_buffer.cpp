@@ -0,0 +1,133 @@
+#include <string.h>
+
+#include "gl_state.h"
+#include "stream_buffer.h"
+
+constexpr GLbitfield MAPFLAGS = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+static StreamBufferRegion* getRegion(StreamBuffer* sb, unsigned i)
+{
+    return &sb->regions[(sb->firstRegion + i) % STREAMBUFFER_MAXREGIONS];
+}
+
+// Removes the oldest regions, up to and including the i-th one, waiting for the GPU to be done with them
+static void retireRegions(StreamBuffer* sb, unsigned i)
+{
+    // Commands complete in order, so once the newest of these regions is free, the older ones are too
+    StreamBufferRegion* newest = getRegion(sb, i);
+    if (glClientWaitSync(newest->fence, 0, 0) == GL_TIMEOUT_EXPIRED)
+    {
+        sb->syncWaits ++;
+        glClientWaitSync(newest->fence, GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED);
+    }
+
+    for (unsigned j = 0; j <= i; j ++)
+        glDeleteSync(getRegion(sb, j)->fence);
+    sb->firstRegion = (sb->firstRegion + i + 1) % STREAMBUFFER_MAXREGIONS;
+    sb->numRegions -= i + 1;
+}
+
+// Checks whether a region of the ring overlaps a range of the buffer
+static bool regionOverlaps(const StreamBuffer* sb, const StreamBufferRegion* region, GLintptr begin, GLintptr end)
+{
+    GLintptr regionEnd = region->begin + region->length;
+    if (begin < regionEnd && region->begin < end)
+        return true;
+
+    // Part of the region that wrapped around to the start of the buffer
+    return regionEnd > sb->size && begin < regionEnd - sb->size;
+}
+
+bool streamBufferInit(StreamBuffer* sb, GLsizeiptr size)
+{
+    memset(sb, 0, sizeof(*sb));
+
+    // Immutable storage is required for persistent mapping
+    glGenBuffers(1, &sb->buffer);
+    glStateBindBuffer(GL_COPY_WRITE_BUFFER, sb->buffer);
+    glBufferStorage(GL_COPY_WRITE_BUFFER, size, nullptr, MAPFLAGS);
+    sb->mapping = (uint8_t*)glMapBufferRange(GL_COPY_WRITE_BUFFER, 0, size, MAPFLAGS);
+    if (!sb->mapping)
+    {
+        glStateDeleteBuffers(1, &sb->buffer);
+        sb->buffer = 0;
+        return false;
+    }
+
+    sb->size = size;
+    return true;
+}
+
+void streamBufferExit(StreamBuffer* sb)
+{
+    if (sb->numRegions)
+        retireRegions(sb, sb->numRegions - 1);
+
+    if (sb->buffer)
+    {
+        glStateBindBuffer(GL_COPY_WRITE_BUFFER, sb->buffer);
+        glUnmapBuffer(GL_COPY_WRITE_BUFFER);
+        glStateDeleteBuffers(1, &sb->buffer);
+    }
+    memset(sb, 0, sizeof(*sb));
+}
+
+void* streamBufferAlloc(StreamBuffer* sb, GLsizeiptr size, GLsizeiptr alignment, GLintptr* offset)
+{
+    // Go back to the start of the buffer if the data doesn't fit before its end
+    GLintptr begin = (sb->head + alignment - 1) / alignment * alignment;
+    if (begin + size > sb->size)
+        begin = 0;
+    GLintptr end = begin + size;
+
+    // The current frame isn't fenced yet, so it can't wrap around onto itself
+    GLsizeiptr consumed = begin >= sb->head ? end - sb->head : sb->size - sb->head + end;
+    if (size > sb->size || sb->frameLength + consumed > sb->size)
+        return nullptr;
+
+    // Wait for the newest frame still using this range (if any) to be done with it
+    for (unsigned i = sb->numRegions; i --; )
+    {
+        if (regionOverlaps(sb, getRegion(sb, i), begin, end))
+        {
+            retireRegions(sb, i);
+            break;
+        }
+    }
+
+    sb->head = end;
+    sb->frameLength += consumed;
+    sb->bytesWritten += size;
+
+    *offset = begin;
+    return sb->mapping + begin;
+}
+
+bool streamBufferRetain(StreamBuffer* sb, GLintptr offset)
+{
+    // Extend the current frame backwards, so that its fence covers the retained data too
+    GLsizeiptr length = (sb->frameBegin - offset + sb->size) % sb->size;
+    if (sb->frameLength + length > sb->size)
+        return false;
+
+    sb->frameBegin = offset;
+    sb->frameLength += length;
+    return true;
+}
+
+void streamBufferEndFrame(StreamBuffer* sb)
+{
+    if (!sb->frameLength)
+        return;
+
+    if (sb->numRegions == STREAMBUFFER_MAXREGIONS)
+        retireRegions(sb, 0);
+
+    StreamBufferRegion* region = getRegion(sb, sb->numRegions++);
+    region->fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    region->begin = sb->frameBegin;
+    region->length = sb->frameLength;
+
+    sb->frameBegin = sb->head;
+    sb->frameLength = 0;
+}
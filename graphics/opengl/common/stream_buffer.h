@@ -0,0 +1,57 @@
+#pragma once
+#include <stdint.h>
+#include <glad/glad.h>
+
+// Streaming buffer for data the CPU writes every frame (vertices, instances...).
+// The buffer's storage is mapped once, persistently, and used as a ring: each write goes after the
+// previous one, and the range written during a frame is protected by a fence once the frame has
+// been submitted. Unlike updating a buffer the GPU may still be reading with glBufferSubData or
+// glMapBufferRange, which makes the driver synchronize (or copy) behind the scenes, a write only
+// ever waits when the ring has wrapped around onto a frame that the GPU hasn't finished yet.
+
+#define STREAMBUFFER_MAXREGIONS 8
+
+struct StreamBufferRegion
+{
+    GLsync fence;
+    GLintptr begin;
+    GLsizeiptr length; // may extend past the end of the buffer, continuing at its start
+};
+
+struct StreamBuffer
+{
+    GLuint buffer;
+    uint8_t* mapping;
+    GLsizeiptr size;
+
+    // Where the next write goes, and the part of the ring written during the current frame
+    GLintptr head;
+    GLintptr frameBegin;
+    GLsizeiptr frameLength;
+
+    // Frames the GPU may still be reading from, oldest first
+    StreamBufferRegion regions[STREAMBUFFER_MAXREGIONS];
+    unsigned firstRegion;
+    unsigned numRegions;
+
+    // Statistics
+    uint64_t bytesWritten;
+    uint32_t syncWaits; // writes that had to wait for the GPU, should stay at 0 with a large enough ring
+};
+
+bool streamBufferInit(StreamBuffer* sb, GLsizeiptr size);
+void streamBufferExit(StreamBuffer* sb);
+
+// Reserves size bytes at an offset that is a multiple of alignment (which doesn't have to be a
+// power of two), returning where to write them, or nullptr if they don't fit in the ring along
+// with the rest of the current frame. The offset in the buffer is returned through *offset.
+void* streamBufferAlloc(StreamBuffer* sb, GLsizeiptr size, GLsizeiptr alignment, GLintptr* offset);
+
+// Keeps the data written from offset up to the start of the current frame (during the previous frames)
+// from being overwritten until the current frame is done, for commands of this frame that read it again,
+// such as a glCopyBufferSubData into the current frame's data. Returns false if part of it was already
+// overwritten by the current frame, in which case it mustn't be read.
+bool streamBufferRetain(StreamBuffer* sb, GLintptr offset);
+
+// Fences the writes of the current frame. Must be called after the commands reading them were issued.
+void streamBufferEndFrame(StreamBuffer* sb);
@@ -0,0 +1,206 @@
+#!/usr/bin/env python3
+# Bakes a flat (non-indexed) triangle list, as found in tools/lenny_flat.c, into an indexed mesh:
+#  - normals are packed as GL_INT_2_10_10_10_REV, and identical vertices are welded together
+#  - triangles are reordered for the post-transform vertex cache (Tom Forsyth's linear-speed algorithm)
+#  - vertices are renumbered in order of first use, so that vertex fetches walk through memory
+#  - lower detail levels are derived by vertex clustering; they reuse the vertices of the full mesh,
+#    so that all levels share one vertex buffer and only differ in their range of indices
+# Usage: bake_mesh.py <input.c> <output.c> <name>
+import re
+import sys
+
+CACHE_SIZE = 32
+
+# Cluster cell size of each lower detail level, relative to the largest extent of the mesh
+LOD_CELLS = [1/40, 1/28]
+
+def parse_flat(path):
+    text = open(path).read()
+    body = text[text.index('{', text.index('=')) + 1 : text.rindex('}')]
+    verts = []
+    for entry in re.findall(r'\{([^{}]*)\}', body):
+        values = [float(v) for v in entry.split(',') if v.strip()]
+        if len(values) != 6:
+            raise ValueError('expected 6 values per vertex, got %r' % entry)
+        verts.append(tuple(values))
+    if len(verts) % 3:
+        raise ValueError('vertex count is not a multiple of 3')
+    return verts
+
+def pack_snorm10(v):
+    v = max(-1.0, min(1.0, v))
+    return int(round(v * 511.0)) & 0x3FF
+
+def pack_normal(nx, ny, nz):
+    length = (nx*nx + ny*ny + nz*nz) ** 0.5 or 1.0
+    return pack_snorm10(nx/length) | pack_snorm10(ny/length) << 10 | pack_snorm10(nz/length) << 20
+
+def weld(flat):
+    lookup = {}
+    verts = []
+    indices = []
+    for x, y, z, nx, ny, nz in flat:
+        key = (x, y, z, pack_normal(nx, ny, nz))
+        index = lookup.get(key)
+        if index is None:
+            index = lookup[key] = len(verts)
+            verts.append(key)
+        indices.append(index)
+    return verts, indices
+
+def forsyth_order(indices, num_verts):
+    # Vertex scores as described in "Linear-Speed Vertex Cache Optimisation" (Tom Forsyth, 2006)
+    def score(cache_pos, remaining):
+        if remaining == 0:
+            return -1.0
+        s = 0.0
+        if cache_pos >= 0:
+            s = 0.75 if cache_pos < 3 else (1.0 - (cache_pos - 3) / (CACHE_SIZE - 3)) ** 1.5
+        return s + 2.0 * remaining ** -0.5
+
+    num_tris = len(indices) // 3
+    vert_tris = [[] for _ in range(num_verts)]
+    for t in range(num_tris):
+        for v in indices[3*t:3*t+3]:
+            vert_tris[v].append(t)
+
+    remaining = [len(tris) for tris in vert_tris]
+    cache_pos = [-1] * num_verts
+    vert_score = [score(-1, remaining[v]) for v in range(num_verts)]
+    tri_score = [sum(vert_score[v] for v in indices[3*t:3*t+3]) for t in range(num_tris)]
+    tri_added = [False] * num_tris
+    cache = []
+    order = []
+    best = max(range(num_tris), key=lambda t: tri_score[t])
+
+    while best is not None:
+        tri_added[best] = True
+        order.append(best)
+        tri_verts = indices[3*best:3*best+3]
+        for v in tri_verts:
+            remaining[v] -= 1
+            vert_tris[v].remove(best)
+
+        # Move the vertices of the triangle to the front of the cache
+        cache = tri_verts + [v for v in cache if v not in tri_verts]
+        evicted = cache[CACHE_SIZE:]
+        cache = cache[:CACHE_SIZE]
+        for v in evicted:
+            cache_pos[v] = -1
+        for pos, v in enumerate(cache):
+            cache_pos[v] = pos
+
+        # Rescore the vertices that are (or were) in the cache, and pick the best triangle using them
+        touched = set()
+        for v in cache + evicted:
+            vert_score[v] = score(cache_pos[v], remaining[v])
+            touched.update(vert_tris[v])
+        best = None
+        best_score = -1.0
+        for t in touched:
+            tri_score[t] = sum(vert_score[v] for v in indices[3*t:3*t+3])
+            if tri_score[t] > best_score:
+                best, best_score = t, tri_score[t]
+
+        # If the cache holds no candidates, fall back to the best remaining triangle
+        if best is None and len(order) < num_tris:
+            best = max((t for t in range(num_tris) if not tri_added[t]), key=lambda t: tri_score[t])
+
+    return [v for t in order for v in indices[3*t:3*t+3]]
+
+def cluster(verts, indices, cell):
+    # Snap vertices to a grid, each cell being represented by its vertex closest to the cell's centroid.
+    # Triangles that collapse, or that end up identical to another one, are dropped.
+    lo = [min(v[k] for v in verts) for k in range(3)]
+    hi = [max(v[k] for v in verts) for k in range(3)]
+    size = cell * max(h - l for l, h in zip(lo, hi))
+    cells = {}
+    for i, v in enumerate(verts):
+        key = tuple(int((v[k] - lo[k]) // size) for k in range(3))
+        cells.setdefault(key, []).append(i)
+
+    rep = [0] * len(verts)
+    for members in cells.values():
+        centroid = [sum(verts[i][k] for i in members) / len(members) for k in range(3)]
+        best = min(members, key=lambda i: sum((verts[i][k] - centroid[k]) ** 2 for k in range(3)))
+        for i in members:
+            rep[i] = best
+
+    seen = set()
+    out = []
+    for t in range(0, len(indices), 3):
+        tri = [rep[v] for v in indices[t:t+3]]
+        key = frozenset(tri)
+        if len(key) == 3 and key not in seen:
+            seen.add(key)
+            out += tri
+    return out
+
+def acmr(indices):
+    # Average cache miss ratio (transformed vertices per triangle) with a FIFO cache
+    cache = []
+    misses = 0
+    for v in indices:
+        if v not in cache:
+            misses += 1
+            cache.append(v)
+            if len(cache) > CACHE_SIZE:
+                cache.pop(0)
+    return misses / (len(indices) // 3)
+
+def renumber(verts, indices):
+    remap = {}
+    for v in indices:
+        if v not in remap:
+            remap[v] = len(remap)
+    new_verts = [None] * len(remap)
+    for old, new in remap.items():
+        new_verts[new] = verts[old]
+    return new_verts, [remap[v] for v in indices]
+
+def main():
+    if len(sys.argv) != 4:
+        sys.exit('usage: bake_mesh.py <input.c> <output.c> <name>')
+    src, dst, name = sys.argv[1:]
+
+    flat = parse_flat(src)
+    verts, indices = weld(flat)
+    acmr_before = acmr(indices)
+    indices = forsyth_order(indices, len(verts))
+    verts, indices = renumber(verts, indices)
+    if len(verts) > 0x10000:
+        sys.exit('too many vertices for 16-bit indices')
+
+    lods = [indices]
+    for cell in LOD_CELLS:
+        lods.append(forsyth_order(cluster(verts, indices, cell), len(verts)))
+
+    with open(dst, 'w') as f:
+        f.write('// Generated by tools/bake_mesh.py from tools/%s_flat.c, do not edit.\n' % name)
+        f.write('// %u flat vertices welded into %u unique ones; ACMR (%u-entry FIFO) %.3f -> %.3f\n' %
+            (len(flat), len(verts), CACHE_SIZE, acmr_before, acmr(indices)))
+        f.write('#include "%s.h"\n\n' % name)
+        f.write('const %sVertex %sVertices[%u] =\n{\n' % (name, name, len(verts)))
+        for x, y, z, n in verts:
+            f.write('\t{ %.9g, %.9g, %.9g, 0x%08X },\n' % (x, y, z, n))
+        f.write('};\n\n')
+        f.write('const uint16_t %sIndices[%u] =\n{\n' % (name, sum(len(lod) for lod in lods)))
+        for level, lod in enumerate(lods):
+            f.write('\t// LOD %u: %u triangles\n' % (level, len(lod) // 3))
+            for i in range(0, len(lod), 12):
+                f.write('\t' + ' '.join('%u,' % v for v in lod[i:i+12]) + '\n')
+        f.write('};\n\n')
+        f.write('const %sLod %sLods[%u] =\n{\n' % (name, name, len(lods)))
+        first = 0
+        for lod in lods:
+            f.write('\t{ %u, %u },\n' % (first, len(lod)))
+            first += len(lod)
+        f.write('};\n')
+
+    print('%s: %u flat vertices -> %u unique, %u indices; ACMR %.3f -> %.3f' %
+        (name, len(flat), len(verts), len(indices), acmr_before, acmr(indices)))
+    for level, lod in enumerate(lods[1:], 1):
+        print('  LOD %u: %u triangles, ACMR %.3f' % (level, len(lod) // 3, acmr(lod)))
+
+if __name__ == '__main__':
+    main()
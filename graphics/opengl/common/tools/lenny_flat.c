@@ -1,6 +1,6 @@
-#include "lenny.h"
+// Flat triangle list (position and normal of each vertex) the lenny mesh is baked from; not compiled.
 
-const lennyVertex lennyVertices[3345] = 
+const float lennyFlatVertices[3345][6] =
 {
 	{ -0.48246, 0.00967688, -0.179352, 0, -1.85661e-012, -1, },
 	{ -0.48245, -0.0384802, -0.179352, 0, -1.85661e-012, -1, },
@@ -0,0 +1,157 @@
+/*
+ * Checks the GL-independent part of the shader cache (shader_cache_file.cpp): how program keys are
+ * derived, and how binaries are stored, in a temporary directory standing in for the SD card.
+ *
+ * Keys must change with every input (driver strings, stages, defines, separable), and strings
+ * must not run into each other. Stored binaries must read back as written, and be replaced when
+ * written again; a missing, corrupted or truncated file must read as no binary at all, and writes
+ * must not leave temporary files behind.
+ *
+ * This is a host tool, not part of the Switch build:
+ *   c++ -std=gnu++17 -O2 -I.. shader_cache_check.cpp ../shader_cache_file.cpp -o shader_cache_check
+ *   ./shader_cache_check
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <dirent.h>
+#include <unistd.h>
+
+#include "shader_cache_file.h"
+
+static unsigned s_failures;
+
+static void check(bool ok, const char* what)
+{
+    if (!ok)
+    {
+        fprintf(stderr, "FAILED: %s\n", what);
+        s_failures ++;
+    }
+}
+
+static void checkKeys(void)
+{
+    const char* drv[4] = { "NVIDIA Corporation", "NVIDIA Tegra X1 (nvgpu)/integrated", "4.6.0 NVIDIA 1.0", "4.60 NVIDIA" };
+    const ShaderStage stages[2] =
+    {
+        { 0x8B31, "#version 460\nvoid main() { }" },                                 // GL_VERTEX_SHADER
+        { 0x8B30, "#version 460\nout vec4 color;\nvoid main() { color = vec4(1); }" }, // GL_FRAGMENT_SHADER
+    };
+    const ShaderStage swapped[2] = { stages[1], stages[0] };
+
+    uint64_t driver = shaderCacheDriverHash(drv[0], drv[1], drv[2], drv[3]);
+    uint64_t key = shaderCacheProgramKey(driver, stages, 2, "#define X 1\n", false);
+    check(shaderCacheProgramKey(driver, stages, 2, "#define X 1\n", false) == key, "keys are deterministic");
+
+    check(shaderCacheProgramKey(shaderCacheDriverHash(drv[0], drv[1], "4.6.0 NVIDIA 1.1", drv[3]), stages, 2, "#define X 1\n", false) != key, "the driver version changes the key");
+    check(shaderCacheProgramKey(driver, stages, 1, "#define X 1\n", false) != key, "the number of stages changes the key");
+    check(shaderCacheProgramKey(driver, swapped, 2, "#define X 1\n", false) != key, "the order of stages changes the key");
+    check(shaderCacheProgramKey(driver, stages, 2, "#define X 2\n", false) != key, "defines change the key");
+    check(shaderCacheProgramKey(driver, stages, 2, "#define X 1\n", true) != key, "separable changes the key");
+    check(shaderCacheProgramKey(driver, stages, 2, nullptr, false) == shaderCacheProgramKey(driver, stages, 2, "", false), "no defines are empty defines");
+
+    check(shaderCacheDriverHash("ab", "c", "", "") != shaderCacheDriverHash("a", "bc", "", ""), "driver strings don't run into each other");
+    check(shaderCacheDriverHash(nullptr, nullptr, nullptr, nullptr) == shaderCacheDriverHash("", "", "", ""), "null driver strings are empty ones");
+}
+
+static unsigned countFiles(const char* dir)
+{
+    DIR* d = opendir(dir);
+    if (!d)
+        return 0;
+    unsigned count = 0;
+    while (struct dirent* entry = readdir(d))
+        count += entry->d_name[0] != '.';
+    closedir(d);
+    return count;
+}
+
+static bool readsAs(const char* dir, uint64_t key, uint32_t format, const void* data, size_t size)
+{
+    uint32_t readFormat;
+    size_t readSize;
+    void* read = shaderCacheFileRead(dir, key, &readFormat, &readSize);
+    bool ok = read && readFormat == format && readSize == size && !memcmp(read, data, size);
+    free(read);
+    return ok;
+}
+
+static bool readsAsNothing(const char* dir, uint64_t key)
+{
+    uint32_t format;
+    size_t size;
+    void* read = shaderCacheFileRead(dir, key, &format, &size);
+    free(read);
+    return !read;
+}
+
+static void checkFiles(const char* root)
+{
+    // The cache directory doesn't exist yet: the first write creates it
+    char dir[256];
+    snprintf(dir, sizeof(dir), "%s/shaders", root);
+
+    uint8_t blob[1000];
+    for (unsigned i = 0; i < sizeof(blob); i ++)
+        blob[i] = i*7;
+    uint64_t key = 0x0123456789abcdefull, other = key ^ 1;
+    char path[300];
+    snprintf(path, sizeof(path), "%s/%016llx.bin", dir, (unsigned long long)key);
+
+    check(readsAsNothing(dir, key), "nothing reads from a missing directory");
+    check(shaderCacheFileWrite(dir, key, 0x1234, blob, sizeof(blob)), "write");
+    check(readsAs(dir, key, 0x1234, blob, sizeof(blob)), "round trip");
+    check(readsAsNothing(dir, other), "a missing key reads as nothing");
+
+    blob[0] = 42;
+    check(shaderCacheFileWrite(dir, key, 0x5678, blob, 500), "overwrite");
+    check(readsAs(dir, key, 0x5678, blob, 500), "an overwritten binary reads as the new one");
+    check(countFiles(dir) == 1, "writes leave no temporary files behind");
+
+    // Flip a byte of the binary
+    FILE* f = fopen(path, "r+b");
+    if (f)
+    {
+        fseek(f, -10, SEEK_END);
+        int c = fgetc(f);
+        fseek(f, -10, SEEK_END);
+        fputc(c ^ 0x55, f);
+        fclose(f);
+    }
+    check(f && readsAsNothing(dir, key), "a corrupted binary reads as nothing");
+
+    // Cut the file in the binary, then in the header
+    check(shaderCacheFileWrite(dir, key, 1, blob, 500), "rewrite");
+    check(truncate(path, 200) == 0 && readsAsNothing(dir, key), "a truncated binary reads as nothing");
+    check(truncate(path, 8) == 0 && readsAsNothing(dir, key), "a truncated header reads as nothing");
+
+    // A binary stored under another key (as after a clash in the file names) isn't returned
+    check(shaderCacheFileWrite(dir, other, 1, blob, 500), "write another key");
+    char otherPath[300];
+    snprintf(otherPath, sizeof(otherPath), "%s/%016llx.bin", dir, (unsigned long long)other);
+    check(rename(otherPath, path) == 0 && readsAsNothing(dir, key), "a binary stored under another key reads as nothing");
+
+    shaderCacheFileRemove(dir, key);
+    check(countFiles(dir) == 0, "remove");
+    shaderCacheFileRemove(dir, key); // removing nothing is harmless
+    rmdir(dir);
+}
+
+int main(void)
+{
+    char root[] = "/tmp/shader_cache_check.XXXXXX";
+    if (!mkdtemp(root))
+    {
+        perror("mkdtemp");
+        return 1;
+    }
+
+    checkKeys();
+    checkFiles(root);
+    rmdir(root);
+
+    printf("Shader cache keys and files: %s\n", s_failures ? "FAILED" : "ok");
+    return s_failures ? 1 : 0;
+}
@@ -14,15 +14,28 @@
 #include <glm/vec4.hpp>
 #include <glm/mat4x4.hpp>
 #include <glm/gtc/type_ptr.hpp>
+#include <glm/gtc/matrix_access.hpp>
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtx/rotate_vector.hpp>
 
+#include "gl_state.h"
+#include "shader_cache.h"
+#include "stream_buffer.h"
+
 // ( ͡° ͜ʖ ͡°) mesh data
 #include "lenny.h"
 
-constexpr uint32_t NUMOBJECTS = 64;
+constexpr uint32_t GRIDSIZE = 64;
+constexpr uint32_t NUMOBJECTS = GRIDSIZE*GRIDSIZE;
+constexpr float GRIDSPACING = 2.5f;
 constexpr auto TAU = glm::two_pi<float>();
 
+// Number of frames of visible instances the streaming ring can hold
+constexpr uint32_t INSTANCERINGFRAMES = 3;
+
+// Distances from the camera beyond which each coarser level of detail is used
+static const float s_lodDistances[lennyLodsCount-1] = { 12.0f, 30.0f };
+
 //-----------------------------------------------------------------------------
 // nxlink support
 //-----------------------------------------------------------------------------
@@ -274,66 +287,58 @@ static const char* const fragmentShaderSource = R"text(
     }
 )text";
 
-static GLuint createAndCompileShader(GLenum type, const char* source)
+// Per-instance data
+struct Instance
 {
-    GLint success;
-    GLchar msg[512];
-
-    GLuint handle = glCreateShader(type);
-    if (!handle)
-    {
-        TRACE("%u: cannot create shader", type);
-        return 0;
-    }
-    glShaderSource(handle, 1, &source, nullptr);
-    glCompileShader(handle);
-    glGetShaderiv(handle, GL_COMPILE_STATUS, &success);
+    glm::mat4 mdlMtx;
+};
 
-    if (success == GL_FALSE)
-    {
-        glGetShaderInfoLog(handle, sizeof(msg), nullptr, msg);
-        TRACE("%u: %s\n", type, msg);
-        glDeleteShader(handle);
-        return 0;
-    }
+// 4-wide vectors, which GCC compiles to NEON instructions
+typedef float v4f __attribute__((vector_size(16)));
+typedef int32_t v4i __attribute__((vector_size(16)));
+typedef uint8_t v4u8 __attribute__((vector_size(4)));
 
-    return handle;
-}
+static_assert(NUMOBJECTS % 4 == 0, "instances are culled 4 at a time");
 
-// Per-instance data
-struct Instance
+// Bounding spheres of the instances, stored as separate arrays so that they can be loaded 4 at a time
+struct InstanceBounds
 {
-    glm::mat4 mdlMtx;
+    alignas(16) float x[NUMOBJECTS];
+    alignas(16) float y[NUMOBJECTS];
+    alignas(16) float z[NUMOBJECTS];
+    alignas(16) float radius[NUMOBJECTS];
 };
 
+constexpr uint8_t LOD_CULLED = 0xFF;
+
+static Instance s_instances[NUMOBJECTS];
+static InstanceBounds s_bounds;
+alignas(4) static uint8_t s_instanceLods[NUMOBJECTS];
+
+// Range of the streaming instance buffer holding the visible instances of each level of detail
+static uint32_t s_lodFirstInstance[lennyLodsCount];
+static uint32_t s_lodNumInstances[lennyLodsCount];
+
 static GLuint s_program;
-static GLuint s_vao, s_vbo, s_instance_vbo;
+static GLuint s_vao, s_vbo, s_ebo;
+static StreamBuffer s_instanceStream;
 
 static GLint loc_mdlvMtx, loc_projMtx;
 static GLint loc_lightPos, loc_ambient, loc_diffuse, loc_specular;
 
 static u64 s_startTicks;
+static glm::mat4 s_projMtx;
 
-static void sceneInit()
+static bool sceneInit()
 {
-    GLint vsh = createAndCompileShader(GL_VERTEX_SHADER, vertexShaderSource);
-    GLint fsh = createAndCompileShader(GL_FRAGMENT_SHADER, fragmentShaderSource);
-
-    s_program = glCreateProgram();
-    glAttachShader(s_program, vsh);
-    glAttachShader(s_program, fsh);
-    glLinkProgram(s_program);
-
-    GLint success;
-    glGetProgramiv(s_program, GL_LINK_STATUS, &success);
-    if (success == GL_FALSE)
+    // Build the program, or load it from the shader cache
+    static const ShaderStage stages[] =
     {
-        char buf[512];
-        glGetProgramInfoLog(s_program, sizeof(buf), nullptr, buf);
-        TRACE("Link error: %s", buf);
-    }
-    glDeleteShader(vsh);
-    glDeleteShader(fsh);
+        { GL_VERTEX_SHADER,   vertexShaderSource },
+        { GL_FRAGMENT_SHADER, fragmentShaderSource },
+    };
+    s_program = shaderCacheBuildProgram(stages, 2, nullptr, false);
+    TRACE("Shader cache: %u hits, %u misses, %u rejected", shaderCacheGetStats().hits, shaderCacheGetStats().misses, shaderCacheGetStats().rejected);
 
     loc_mdlvMtx = glGetUniformLocation(s_program, "mdlvMtx");
     loc_projMtx = glGetUniformLocation(s_program, "projMtx");
@@ -347,34 +352,62 @@ static void sceneInit()
 
     glGenVertexArrays(1, &s_vao);
     glGenBuffers(1, &s_vbo);
+    glGenBuffers(1, &s_ebo);
     // bind the Vertex Array Object first, then bind and set vertex buffer(s), and then configure vertex attributes(s).
-    glBindVertexArray(s_vao);
+    glStateBindVertexArray(s_vao);
 
-    glBindBuffer(GL_ARRAY_BUFFER, s_vbo);
+    glStateBindBuffer(GL_ARRAY_BUFFER, s_vbo);
     glBufferData(GL_ARRAY_BUFFER, sizeof(lennyVertices), lennyVertices, GL_STATIC_DRAW);
 
     glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(lennyVertex), (void*)offsetof(lennyVertex, x));
     glEnableVertexAttribArray(0);
 
-    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(lennyVertex), (void*)offsetof(lennyVertex, nx));
+    // The normals are packed into 10 bits per component
+    glVertexAttribPointer(1, 4, GL_INT_2_10_10_10_REV, GL_TRUE, sizeof(lennyVertex), (void*)offsetof(lennyVertex, normal));
     glEnableVertexAttribArray(1);
 
-    glGenBuffers(1, &s_instance_vbo);
-    glBindBuffer(GL_ARRAY_BUFFER, s_instance_vbo);
+    // The element buffer binding is part of the VAO state, so it stays bound for drawing
+    glStateBindBuffer(GL_ELEMENT_ARRAY_BUFFER, s_ebo);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(lennyIndices), lennyIndices, GL_STATIC_DRAW);
+
+    // Calculate a bounding sphere for the mesh
+    glm::vec3 meshMin{lennyVertices[0].x, lennyVertices[0].y, lennyVertices[0].z}, meshMax = meshMin;
+    for (size_t i = 1; i < lennyVerticesCount; i ++)
+    {
+        glm::vec3 pos{lennyVertices[i].x, lennyVertices[i].y, lennyVertices[i].z};
+        meshMin = glm::min(meshMin, pos);
+        meshMax = glm::max(meshMax, pos);
+    }
+    glm::vec3 meshCenter = (meshMin + meshMax) * 0.5f;
+    float meshRadius = 0.0f;
+    for (size_t i = 0; i < lennyVerticesCount; i ++)
+        meshRadius = glm::max(meshRadius, glm::distance(meshCenter, glm::vec3{lennyVertices[i].x, lennyVertices[i].y, lennyVertices[i].z}));
 
-    // Generate the per-instance data: the instances will form a sine wave.
-    Instance* instances = new Instance[NUMOBJECTS];
+    // Generate the per-instance data: the instances will form a grid rippling in a sine wave around its center.
     for (size_t i = 0; i < NUMOBJECTS; i ++)
     {
-        float x = float(i) / (NUMOBJECTS-1);
-        float a = x*2.0f-1.0f;
-        instances[i].mdlMtx = glm::translate(glm::mat4{1.0f}, glm::vec3{a*4.0f, 1.5f*sinf(x*TAU), a});
-        instances[i].mdlMtx = glm::scale(instances[i].mdlMtx, glm::vec3{2.0f});
+        float x = (float(i % GRIDSIZE) - (GRIDSIZE-1)/2.0f) * GRIDSPACING;
+        float z = (float(i / GRIDSIZE) - (GRIDSIZE-1)/2.0f) * GRIDSPACING;
+        float y = 1.5f*sinf(sqrtf(x*x + z*z) * TAU / 16.0f) - 3.0f;
+        s_instances[i].mdlMtx = glm::translate(glm::mat4{1.0f}, glm::vec3{x, y, z});
+        s_instances[i].mdlMtx = glm::scale(s_instances[i].mdlMtx, glm::vec3{2.0f});
+
+        glm::vec4 center = s_instances[i].mdlMtx * glm::vec4{meshCenter, 1.0f};
+        s_bounds.x[i] = center.x;
+        s_bounds.y[i] = center.y;
+        s_bounds.z[i] = center.z;
+        s_bounds.radius[i] = meshRadius * 2.0f;
     }
 
-    // Upload the instance data
-    glBufferData(GL_ARRAY_BUFFER, sizeof(Instance)*NUMOBJECTS, instances, GL_STATIC_DRAW);
-    delete[] instances;
+    // The visible instances are written to this ring every frame. The attributes point at its start,
+    // and each frame's instances are reached through the base instance of the draws.
+    if (!streamBufferInit(&s_instanceStream, sizeof(Instance)*NUMOBJECTS*INSTANCERINGFRAMES))
+    {
+        TRACE("Cannot create the instance ring");
+        glStateBindVertexArray(0);
+        return false;
+    }
+    glStateBindBuffer(GL_ARRAY_BUFFER, s_instanceStream.buffer);
 
     // Set up per-instance attributes
     glVertexAttribPointer(2, 4, GL_FLOAT, GL_FALSE, sizeof(Instance), (void*)(offsetof(Instance, mdlMtx)+0*sizeof(glm::vec4)));
@@ -391,21 +424,22 @@ static void sceneInit()
     glEnableVertexAttribArray(5);
 
     // note that this is allowed, the call to glVertexAttribPointer registered VBO as the vertex attribute's bound vertex buffer object so afterwards we can safely unbind
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glStateBindBuffer(GL_ARRAY_BUFFER, 0);
 
     // You can unbind the VAO afterwards so other VAO calls won't accidentally modify this VAO, but this rarely happens. Modifying other
     // VAOs requires a call to glBindVertexArray anyways so we generally don't unbind VAOs (nor VBOs) when it's not directly necessary.
-    glBindVertexArray(0);
+    glStateBindVertexArray(0);
 
     // Uniforms
-    glUseProgram(s_program);
-    auto projMtx = glm::perspective(40.0f*TAU/360.0f, 16.0f/9.0f, 0.01f, 1000.0f);
-    glUniformMatrix4fv(loc_projMtx, 1, GL_FALSE, glm::value_ptr(projMtx));
-    glUniform4f(loc_lightPos, 0.0f, 0.0f, -0.5f, 1.0f);
-    glUniform3f(loc_ambient, 0.1f, 0.1f, 0.1f);
-    glUniform3f(loc_diffuse, 0.4f, 0.4f, 0.4f);
-    glUniform4f(loc_specular, 0.5f, 0.5f, 0.5f, 20.0f);
+    glStateUseProgram(s_program);
+    s_projMtx = glm::perspective(40.0f*TAU/360.0f, 16.0f/9.0f, 0.01f, 1000.0f);
+    glStateUniformMatrix4fv(loc_projMtx, 1, GL_FALSE, glm::value_ptr(s_projMtx));
+    glStateUniform4f(loc_lightPos, 0.0f, 0.0f, -0.5f, 1.0f);
+    glStateUniform3f(loc_ambient, 0.1f, 0.1f, 0.1f);
+    glStateUniform3f(loc_diffuse, 0.4f, 0.4f, 0.4f);
+    glStateUniform4f(loc_specular, 0.5f, 0.5f, 0.5f, 20.0f);
     s_startTicks = armGetSystemTick();
+    return true;
 }
 
 static float getTime()
@@ -424,6 +458,112 @@ static inline T fract(T x)
     return x - std::floor(x);
 }
 
+// Marks each instance with the level of detail it should be drawn with, or LOD_CULLED
+// if its bounding sphere is outside of the view frustum. Returns the number of instances using each level.
+static void classifyInstances(const glm::mat4& viewProjMtx, const glm::vec3& eye, uint32_t lodCounts[lennyLodsCount])
+{
+    // Extract the frustum planes from the view-projection matrix (Gribb & Hartmann),
+    // normalized so that plane distances can be compared against the sphere radii
+    glm::vec4 frustum[6] =
+    {
+        glm::row(viewProjMtx, 3) + glm::row(viewProjMtx, 0), // left
+        glm::row(viewProjMtx, 3) - glm::row(viewProjMtx, 0), // right
+        glm::row(viewProjMtx, 3) + glm::row(viewProjMtx, 1), // bottom
+        glm::row(viewProjMtx, 3) - glm::row(viewProjMtx, 1), // top
+        glm::row(viewProjMtx, 3) + glm::row(viewProjMtx, 2), // near
+        glm::row(viewProjMtx, 3) - glm::row(viewProjMtx, 2), // far
+    };
+
+    // Broadcast all constants to vectors beforehand
+    v4f planes[6][4];
+    for (size_t i = 0; i < 6; i ++)
+    {
+        glm::vec4 plane = frustum[i] / glm::length(glm::vec3{frustum[i]});
+        for (size_t j = 0; j < 4; j ++)
+            planes[i][j] = v4f{} + plane[j];
+    }
+
+    v4f lodDistancesSq[lennyLodsCount-1];
+    for (size_t i = 0; i < lennyLodsCount-1; i ++)
+        lodDistancesSq[i] = v4f{} + s_lodDistances[i]*s_lodDistances[i];
+
+    v4i counts[lennyLodsCount] = {};
+
+    for (size_t i = 0; i < NUMOBJECTS; i += 4)
+    {
+        v4f x = *(const v4f*)&s_bounds.x[i];
+        v4f y = *(const v4f*)&s_bounds.y[i];
+        v4f z = *(const v4f*)&s_bounds.z[i];
+        v4f radius = *(const v4f*)&s_bounds.radius[i];
+
+        // A sphere is visible unless it lies entirely behind one of the planes
+        v4i visible = ~v4i{};
+        for (const auto& plane : planes)
+            visible &= x*plane[0] + y*plane[1] + z*plane[2] + plane[3] > -radius;
+
+        // Each distance threshold that is exceeded moves to the next level of detail (comparisons yield -1 when true)
+        v4f dx = x - eye.x, dy = y - eye.y, dz = z - eye.z;
+        v4f distSq = dx*dx + dy*dy + dz*dz;
+        v4i lod = v4i{};
+        for (const auto& threshold : lodDistancesSq)
+            lod -= distSq > threshold;
+        lod = (lod & visible) | (~visible & LOD_CULLED);
+
+        for (size_t j = 0; j < lennyLodsCount; j ++)
+            counts[j] -= lod == int32_t(j);
+        *(v4u8*)&s_instanceLods[i] = __builtin_convertvector(lod, v4u8);
+    }
+
+    for (size_t i = 0; i < lennyLodsCount; i ++)
+        lodCounts[i] = counts[i][0] + counts[i][1] + counts[i][2] + counts[i][3];
+}
+
+// Writes the visible instances to the streaming instance buffer, grouped by level of detail
+static void streamInstances(const uint32_t lodCounts[lennyLodsCount])
+{
+    uint32_t numVisible = 0;
+    for (size_t i = 0; i < lennyLodsCount; i ++)
+    {
+        s_lodNumInstances[i] = 0;
+        numVisible += lodCounts[i];
+    }
+    if (!numVisible)
+        return;
+
+    // Write straight into the persistently mapped ring, aligned to whole instances so that the offset
+    // can be expressed as a base instance
+    GLintptr offset;
+    Instance* out = (Instance*)streamBufferAlloc(&s_instanceStream, sizeof(Instance)*numVisible, sizeof(Instance), &offset);
+    if (!out)
+        return;
+
+    uint32_t next[lennyLodsCount];
+    uint32_t baseInstance = offset / sizeof(Instance);
+    for (uint32_t i = 0, first = 0; i < lennyLodsCount; i ++)
+    {
+        s_lodFirstInstance[i] = baseInstance + first;
+        s_lodNumInstances[i] = lodCounts[i];
+        next[i] = first;
+        first += lodCounts[i];
+    }
+
+    for (size_t i = 0; i < NUMOBJECTS; i ++)
+    {
+        uint8_t lod = s_instanceLods[i];
+        if (lod != LOD_CULLED)
+            out[next[lod]++] = s_instances[i];
+    }
+
+#ifdef ENABLE_NXLINK
+    static uint32_t frameCount;
+    if (++frameCount % 60 == 0)
+    {
+        TRACE("%u/%u instances visible, per LOD: %u %u %u", numVisible, NUMOBJECTS, lodCounts[0], lodCounts[1], lodCounts[2]);
+        TRACE("instance ring: %u sync waits", s_instanceStream.syncWaits);
+    }
+#endif
+}
+
 static void sceneUpdate(u32 kHeld)
 {
     float curTime = getTime();
@@ -447,10 +587,103 @@ static void sceneUpdate(u32 kHeld)
     mdlvMtx = glm::rotate(mdlvMtx, s_cameraAngle * TAU, glm::vec3{0.0f, 1.0f, 0.0f});
     mdlvMtx = glm::translate(mdlvMtx, -s_cameraPos);
 
-    glUniformMatrix4fv(loc_mdlvMtx, 1, GL_FALSE, glm::value_ptr(mdlvMtx));
+    glStateUniformMatrix4fv(loc_mdlvMtx, 1, GL_FALSE, glm::value_ptr(mdlvMtx));
+
+    // Cull the instances against the view frustum, and stream the visible ones to the GPU
+    uint32_t lodCounts[lennyLodsCount];
+    classifyInstances(s_projMtx * mdlvMtx, s_cameraPos, lodCounts);
+    streamInstances(lodCounts);
+}
+
+//-----------------------------------------------------------------------------
+// Dynamic resolution controller
+//-----------------------------------------------------------------------------
+
+// Bounds of the resolution scale, relative to the native resolution
+constexpr float DYNRES_MIN_SCALE = 0.5f;
+constexpr float DYNRES_MAX_SCALE = 1.0f;
+
+// GPU time per frame the controller aims for, which leaves some headroom within a 60 fps frame.
+// The scale is left alone while the measured time stays within the band around it (hysteresis).
+constexpr float DYNRES_TARGET_MS = 13.5f;
+constexpr float DYNRES_BAND_LOW = 0.85f;
+constexpr float DYNRES_BAND_HIGH = 1.05f;
+
+// Largest change of the scale in a single step, weight of each new measurement in the average,
+// and number of measurements that need to be averaged at a given scale before changing it again
+constexpr float DYNRES_MAX_STEP = 0.1f;
+constexpr float DYNRES_SMOOTHING = 0.25f;
+constexpr uint32_t DYNRES_MIN_SAMPLES = 4;
+
+// Timer queries are read back this many frames later, so that the CPU never waits on the GPU
+constexpr uint32_t NUMTIMERQUERIES = 4;
+
+static GLuint s_timerQueries[NUMTIMERQUERIES];
+static float s_timerQueryScales[NUMTIMERQUERIES];
+static uint32_t s_frameIndex;
+static float s_gpuTimeMs;
+static uint32_t s_numSamples;
+static float s_resScale = DYNRES_MAX_SCALE;
+
+static void dynresInit()
+{
+    glGenQueries(NUMTIMERQUERIES, s_timerQueries);
+}
+
+static void dynresExit()
+{
+    glDeleteQueries(NUMTIMERQUERIES, s_timerQueries);
+}
+
+static void dynresUpdate(float frameMs, float frameScale)
+{
+    TRACE("GPU %.2f ms at scale %.3f", frameMs, frameScale);
+
+    // Ignore the frames that weren't rendered at the current scale, such as those still in flight after a change
+    if (frameScale != s_resScale)
+        return;
+
+    s_gpuTimeMs = s_numSamples++ ? glm::mix(s_gpuTimeMs, frameMs, DYNRES_SMOOTHING) : frameMs;
+    if (s_numSamples < DYNRES_MIN_SAMPLES)
+        return;
+
+    if (s_gpuTimeMs > DYNRES_TARGET_MS*DYNRES_BAND_HIGH || s_gpuTimeMs < DYNRES_TARGET_MS*DYNRES_BAND_LOW)
+    {
+        // The GPU time is mostly proportional to the number of pixels, i.e. the square of the scale
+        float scale = s_resScale * sqrtf(DYNRES_TARGET_MS / s_gpuTimeMs);
+        scale = glm::clamp(scale, s_resScale - DYNRES_MAX_STEP, s_resScale + DYNRES_MAX_STEP);
+        scale = glm::clamp(scale, DYNRES_MIN_SCALE, DYNRES_MAX_SCALE);
+        if (fabsf(scale - s_resScale) >= 0.01f)
+        {
+            s_resScale = scale;
+            s_numSamples = 0;
+        }
+    }
+}
+
+static void dynresBeginFrame(float scale)
+{
+    // Retrieve the result of the query about to be reused. It was issued NUMTIMERQUERIES frames ago,
+    // which is more than the number of frames the GPU can lag behind, so this doesn't stall.
+    GLuint query = s_timerQueries[s_frameIndex % NUMTIMERQUERIES];
+    if (s_frameIndex >= NUMTIMERQUERIES)
+    {
+        GLuint64 elapsedNs;
+        glGetQueryObjectui64v(query, GL_QUERY_RESULT, &elapsedNs);
+        dynresUpdate(elapsedNs / 1000000.0f, s_timerQueryScales[s_frameIndex % NUMTIMERQUERIES]);
+    }
+
+    s_timerQueryScales[s_frameIndex % NUMTIMERQUERIES] = scale;
+    glBeginQuery(GL_TIME_ELAPSED, query);
+}
+
+static void dynresEndFrame()
+{
+    glEndQuery(GL_TIME_ELAPSED);
+    s_frameIndex++;
 }
 
-static void configureResolution(NWindow* win, bool halved)
+static void configureResolution(NWindow* win, float scale)
 {
     int width, height;
 
@@ -470,14 +703,9 @@ static void configureResolution(NWindow* win, bool halved)
             break;
     }
 
-    // As an additional demonstration, we also demonstrate what happens
-    // when the rendering resolution doesn't match the native display resolution
-    // by allowing the user to hold A to halve the rendering resolution.
-    if (halved)
-    {
-        width /= 2;
-        height /= 2;
-    }
+    // Scale the resolution down as requested, keeping the dimensions even.
+    width = int(width*scale) & ~1;
+    height = int(height*scale) & ~1;
 
     // Apply the resolution, and configure the correct GL viewport.
     // We want to render to the top left corner of the framebuffer (other areas will
@@ -486,6 +714,9 @@ static void configureResolution(NWindow* win, bool halved)
     // the viewport, so we have to calculate that too.
     nwindowSetCrop(win, 0, 0, width, height);
     glViewport(0, 1080-height, width, height);
+
+    // Restrict clears to the same area, so that their cost also scales with the resolution
+    glScissor(0, 1080-height, width, height);
 }
 
 static void sceneRender()
@@ -494,16 +725,28 @@ static void sceneRender()
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
     // draw our ( ͡° ͜ʖ ͡°) world
-    glBindVertexArray(s_vao); // seeing as we only have a single VAO there's no need to bind it every time, but we'll do so to keep things a bit more organized
-    glDrawArraysInstanced(GL_TRIANGLES, 0, lennyVerticesCount, NUMOBJECTS);
+    glStateBindVertexArray(s_vao); // the state tracker skips this while the VAO is still bound, so there's no harm in binding it every time
+    for (size_t i = 0; i < lennyLodsCount; i ++)
+    {
+        if (!s_lodNumInstances[i])
+            continue;
+
+        // Each level of detail is a range of the index buffer, drawn for its own range of instances
+        glDrawElementsInstancedBaseInstance(GL_TRIANGLES, lennyLods[i].indexCount, GL_UNSIGNED_SHORT,
+            (void*)(lennyLods[i].firstIndex*sizeof(uint16_t)), s_lodNumInstances[i], s_lodFirstInstance[i]);
+    }
+
+    // The instances written this frame must stay untouched until these draws are done
+    streamBufferEndFrame(&s_instanceStream);
 }
 
 static void sceneExit()
 {
-    glDeleteBuffers(1, &s_instance_vbo);
-    glDeleteBuffers(1, &s_vbo);
-    glDeleteVertexArrays(1, &s_vao);
-    glDeleteProgram(s_program);
+    streamBufferExit(&s_instanceStream);
+    glStateDeleteBuffers(1, &s_ebo);
+    glStateDeleteBuffers(1, &s_vbo);
+    glStateDeleteVertexArrays(1, &s_vao);
+    glStateDeleteProgram(s_program);
 }
 
 int main(int argc, char* argv[])
@@ -523,7 +766,14 @@ int main(int argc, char* argv[])
     gladLoadGL();
 
     // Initialize our scene
-    sceneInit();
+    if (!sceneInit())
+    {
+        sceneExit();
+        deinitEgl();
+        return EXIT_FAILURE;
+    }
+    dynresInit();
+    glEnable(GL_SCISSOR_TEST);
 
     // Configure our supported input layout: a single player with standard controller styles
     padConfigureInput(1, HidNpadStyleSet_NpadStandard);
@@ -533,6 +783,7 @@ int main(int argc, char* argv[])
     padInitializeDefault(&pad);
 
     // Main graphics loop
+    u32 frameCount = 0;
     while (appletMainLoop())
     {
         // Get and process input
@@ -542,23 +793,32 @@ int main(int argc, char* argv[])
         if (kDown & HidNpadButton_Plus)
             break;
 
-        bool shouldHalveResolution = !!(kHeld & HidNpadButton_A);
+        bool shouldForceNative = !!(kHeld & HidNpadButton_A);
 
         // Configure the resolution used to render the scene, which
         // will be different in handheld mode/docked mode.
-        // As an additional demonstration, when holding A we render the scene
-        // at half the original resolution.
-        configureResolution(win, shouldHalveResolution);
+        // The resolution is scaled down whenever the GPU can't keep up with 60 fps,
+        // which can be compared against the native resolution by holding A.
+        float scale = shouldForceNative ? DYNRES_MAX_SCALE : s_resScale;
+        configureResolution(win, scale);
 
         // Update our scene
         sceneUpdate(kHeld);
 
-        // Render stuff!
+        // Render stuff, measuring how long the GPU takes to do so
+        dynresBeginFrame(scale);
         sceneRender();
+        dynresEndFrame();
         eglSwapBuffers(s_display, s_surface);
+
+        // Count the GL calls of this frame, reporting them about once per second
+        glStateEndFrame();
+        if (++frameCount % 60 == 0)
+            TRACE("GL state calls: %u issued, %u skipped", glStateGetFrameStats().issued, glStateGetFrameStats().skipped);
     }
 
     // Deinitialize our scene
+    dynresExit();
     sceneExit();
 
     // Deinitialize EGL
@@ -39,17 +39,27 @@
  * Ported to Nintendo Switch using mesa/nouveau and EGL.
  * Armada & fincs
  * September 9th, 2018
+ *
+ * Draw all gears of the same shape with a single instanced draw:
+ *   * Convert the triangle strips to one indexed triangle list per gear.
+ *   * Share a single vertex/index buffer between all gears.
+ *   * Animate the gears in the vertex shader from per-instance attributes.
+ *   * Add a stress mode with hundreds of gears (press A).
+ * Requires OpenGL ES 3.0 for instancing.
  */
 
 #define _GNU_SOURCE
 #include <stdio.h>
+#include <stddef.h>
 #include <stdlib.h>
 #include <string.h>
 #include <math.h>
 #include <switch.h>
 
 #include <EGL/egl.h>    // EGL library
-#include <GLES2/gl2.h>  // OpenGL ES 2.0 library
+#include <GLES3/gl3.h>  // OpenGL ES 3.0 library
+
+#include "matrix.h"
 
 //-----------------------------------------------------------------------------
 // nxlink support
@@ -149,7 +159,7 @@ static bool initEgl(NWindow* win)
     // Create an EGL rendering context
     static const EGLint contextAttributeList[] =
     {
-        EGL_CONTEXT_CLIENT_VERSION, 2, // request OpenGL ES 2.x
+        EGL_CONTEXT_CLIENT_VERSION, 3, // request OpenGL ES 3.x
         EGL_NONE
     };
     s_context = eglCreateContext(s_display, config, EGL_NO_CONTEXT, contextAttributeList);
@@ -213,50 +223,97 @@ static void setMesaConfig()
     //setenv("NV50_PROG_CHIPSET", "0x120", 1);
 }
 
-#define STRIPS_PER_TOOTH 7
 #define VERTICES_PER_TOOTH 34
+#define INDICES_PER_TOOTH 60
 #define GEAR_VERTEX_STRIDE 6
 
-/**
- * Struct describing the vertices in triangle strip
- */
-struct vertex_strip {
-   /** The first vertex in the strip */
-   GLint first;
-   /** The number of consecutive vertices in the strip after the first */
-   GLint count;
-};
+/** The file caching the generated gear geometry, next to the executable */
+#define GEAR_CACHE_PATH "es2gears.cache"
+#define GEAR_CACHE_MAGIC 0x52414547 /* "GEAR" */
+#define GEAR_CACHE_VERSION 1
 
 /* Each vertex consist of GEAR_VERTEX_STRIDE GLfloat attributes */
 typedef GLfloat GearVertex[GEAR_VERTEX_STRIDE];
 
 /**
- * Struct representing a gear.
+ * Struct describing the shape of a gear.
+ */
+struct gear_params {
+   /** The radius of the hole at the center */
+   GLfloat inner_radius;
+   /** The radius at the center of the teeth */
+   GLfloat outer_radius;
+   /** The width of the gear */
+   GLfloat width;
+   /** The number of teeth */
+   GLint teeth;
+   /** The depth of the teeth */
+   GLfloat tooth_depth;
+};
+
+/**
+ * Struct representing a gear shape.
  */
 struct gear {
-   /** The array of vertices comprising the gear */
-   GearVertex *vertices;
+   /** The shape of the gear */
+   struct gear_params params;
+   /** The hash of the shape, identifying the gear in the cache */
+   uint64_t hash;
    /** The number of vertices comprising the gear */
    int nvertices;
-   /** The array of triangle strips comprising the gear */
-   struct vertex_strip *strips;
-   /** The number of triangle strips comprising the gear */
-   int nstrips;
-   /** The Vertex Buffer Object holding the vertices in the graphics card */
-   GLuint vbo;
+   /** The offset (in bytes) of the gear's vertices in the shared vertex buffer */
+   GLintptr vertex_offset;
+   /** The first index of the gear's triangle list in the shared index buffer */
+   GLint first_index;
+   /** The number of indices in the gear's triangle list */
+   GLsizei nindices;
+   /** The first instance of this gear in the instance buffer */
+   GLint first_instance;
+   /** The number of instances of this gear */
+   GLsizei ninstances;
 };
 
+/**
+ * Per-instance attributes of a gear.
+ */
+struct gear_instance {
+   /** The position of the center of the gear [x, y, z] */
+   GLfloat position[3];
+   /** The angle of the gear when the base rotation angle is 0 (in degrees) */
+   GLfloat phase;
+   /** The rotation speed of the gear, relative to the base rotation angle */
+   GLfloat speed;
+   /** The color of the gear */
+   GLfloat color[4];
+};
+
+#define NUM_GEARS 3
+
+/** Number of copies of the three gears in stress mode, horizontally and vertically */
+#define STRESS_COLUMNS 12
+#define STRESS_ROWS 9
+
 /** The view rotation [x, y, z] */
 static GLfloat view_rot[3] = { 20.0, 30.0, 0.0 };
 /** The gears */
-static struct gear *gear1, *gear2, *gear3;
+static struct gear gears[NUM_GEARS] = {
+   { .params = { 1.0, 4.0, 1.0, 20, 0.7 } },
+   { .params = { 0.5, 2.0, 2.0, 10, 0.7 } },
+   { .params = { 1.3, 2.0, 0.5, 10, 0.7 } },
+};
+/** The buffers shared by all gears */
+static GLuint vao, vbo, ibo, instance_vbo;
+/** Whether many copies of the gears are drawn */
+static bool stress_mode = false;
+/** The number of draws issued in the last frame */
+static int draw_count;
 /** The current gear rotation angle */
 static GLfloat angle = 0.0;
 /** The location of the shader uniforms */
-static GLuint ModelViewProjectionMatrix_location,
+static GLuint ViewProjectionMatrix_location,
               NormalMatrix_location,
               LightSourcePosition_location,
-              MaterialColor_location;
+              Angle_location;
 /** The projection matrix */
 static GLfloat ProjectionMatrix[16];
 /** The direction of the directional light for the scene */
@@ -287,49 +344,60 @@ vert(GearVertex *v, GLfloat x, GLfloat y, GLfloat z, GLfloat n[3])
 }
 
 /**
- *  Create a gear wheel.
+ * Appends the triangles of a triangle strip to an index list.
  *
- *  @param inner_radius radius of hole at center
- *  @param outer_radius radius at center of teeth
- *  @param width width of gear
- *  @param teeth number of teeth
- *  @param tooth_depth depth of tooth
+ * Every other triangle of a strip has the opposite winding, so its first two
+ * vertices are swapped.
  *
- *  @return pointer to the constructed struct gear
+ * @param indices the index list to append to
+ * @param first the first vertex in the strip
+ * @param count the number of vertices in the strip
+ *
+ * @return the end of the index list
  */
-static struct gear *
-create_gear(GLfloat inner_radius, GLfloat outer_radius, GLfloat width,
-      GLint teeth, GLfloat tooth_depth)
+static GLushort *
+strip_to_triangles(GLushort *indices, GLint first, GLint count)
+{
+   int k;
+
+   for (k = 0; k < count - 2; k++) {
+      *indices++ = first + k + (k & 1);
+      *indices++ = first + k + 1 - (k & 1);
+      *indices++ = first + k + 2;
+   }
+
+   return indices;
+}
+
+/**
+ *  Generates the geometry of a gear wheel.
+ *
+ *  @param params the shape of the gear
+ *  @param vertices the array receiving VERTICES_PER_TOOTH vertices per tooth
+ *  @param indices the array receiving INDICES_PER_TOOTH indices per tooth,
+ *                 forming a triangle list
+ */
+static void
+generate_gear(const struct gear_params *params, GearVertex *vertices, GLushort *indices)
 {
    GLfloat r0, r1, r2;
    GLfloat da;
-   GearVertex *v;
-   struct gear *gear;
+   GLfloat width = params->width;
+   GearVertex *v = vertices;
+   GLushort *idx = indices;
+   GLint strip_first = 0;
    double s[5], c[5];
    GLfloat normal[3];
-   int cur_strip = 0;
+   int teeth = params->teeth;
    int i;
 
-   /* Allocate memory for the gear */
-   gear = malloc(sizeof *gear);
-   if (gear == NULL)
-      return NULL;
-
    /* Calculate the radii used in the gear */
-   r0 = inner_radius;
-   r1 = outer_radius - tooth_depth / 2.0;
-   r2 = outer_radius + tooth_depth / 2.0;
+   r0 = params->inner_radius;
+   r1 = params->outer_radius - params->tooth_depth / 2.0;
+   r2 = params->outer_radius + params->tooth_depth / 2.0;
 
    da = 2.0 * M_PI / teeth / 4.0;
 
-   /* Allocate memory for the triangle strip information */
-   gear->nstrips = STRIPS_PER_TOOTH * teeth;
-   gear->strips = calloc(gear->nstrips, sizeof (*gear->strips));
-
-   /* Allocate memory for the vertices */
-   gear->vertices = calloc(VERTICES_PER_TOOTH * teeth, sizeof(*gear->vertices));
-   v = gear->vertices;
-
    for (i = 0; i < teeth; i++) {
       /* Calculate needed sin/cos for varius angles */
       sincos(i * 2.0 * M_PI / teeth, &s[0], &c[0]);
@@ -347,13 +415,11 @@ create_gear(GLfloat inner_radius, GLfloat outer_radius, GLfloat width,
 #define  GEAR_VERT(v, point, sign) vert((v), p[(point)].x, p[(point)].y, (sign) * width * 0.5, normal)
 
 #define START_STRIP do { \
-   gear->strips[cur_strip].first = v - gear->vertices; \
-} while(0);
+   strip_first = v - vertices; \
+} while(0)
 
 #define END_STRIP do { \
-   int _tmp = (v - gear->vertices); \
-   gear->strips[cur_strip].count = _tmp - gear->strips[cur_strip].first; \
-   cur_strip++; \
+   idx = strip_to_triangles(idx, strip_first, (v - vertices) - strip_first); \
 } while (0)
 
 #define QUAD_WITH_NORMAL(p1, p2) do { \
@@ -426,147 +492,288 @@ create_gear(GLfloat inner_radius, GLfloat outer_radius, GLfloat width,
       QUAD_WITH_NORMAL(5, 3);
       END_STRIP;
    }
+}
 
-   gear->nvertices = (v - gear->vertices);
+/**
+ * Hashes the shape of a gear (64-bit FNV-1a), along with the version of the
+ * cache format so that changes to the generator invalidate old caches.
+ */
+static uint64_t
+hash_gear_params(const struct gear_params *params)
+{
+   const GLfloat floats[4] = {
+      params->inner_radius, params->outer_radius, params->width, params->tooth_depth
+   };
+   const uint32_t ints[2] = { params->teeth, GEAR_CACHE_VERSION };
+   uint64_t hash = 0xcbf29ce484222325ull;
+   const uint8_t *p;
+   size_t i;
 
-   /* Store the vertices in a vertex buffer object (VBO) */
-   glGenBuffers(1, &gear->vbo);
-   glBindBuffer(GL_ARRAY_BUFFER, gear->vbo);
-   glBufferData(GL_ARRAY_BUFFER, gear->nvertices * sizeof(GearVertex),
-         gear->vertices, GL_STATIC_DRAW);
+   for (p = (const uint8_t *) floats, i = 0; i < sizeof(floats); i++)
+      hash = (hash ^ p[i]) * 0x100000001b3ull;
+   for (p = (const uint8_t *) ints, i = 0; i < sizeof(ints); i++)
+      hash = (hash ^ p[i]) * 0x100000001b3ull;
 
-   return gear;
+   return hash;
 }
 
 /**
- * Multiplies two 4x4 matrices.
- *
- * The result is stored in matrix m.
+ * Layout of the gear cache file: a header and one entry per gear, followed by
+ * the vertices of all gears and then by their indices, in the same order as
+ * the shared vertex and index buffers.
+ */
+struct gear_cache_header {
+   uint32_t magic;
+   uint32_t version;
+   uint32_t ngears;
+   uint32_t vertex_bytes;
+   uint32_t index_bytes;
+};
+
+struct gear_cache_entry {
+   uint64_t hash;
+   uint32_t nvertices;
+   uint32_t nindices;
+};
+
+/**
+ * Reads a block of the cache file straight into a buffer object.
+ */
+static bool
+read_into_buffer(FILE *f, GLenum target, GLsizeiptr size)
+{
+   void *dst = glMapBufferRange(target, 0, size, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+   bool ok;
+
+   if (!dst)
+      return false;
+   ok = fread(dst, 1, size, f) == (size_t) size;
+   return glUnmapBuffer(target) && ok;
+}
+
+/**
+ * Loads the geometry of all gears from the cache file into the bound vertex
+ * and index buffers.
  *
- * @param m the first matrix to multiply
- * @param n the second matrix to multiply
+ * @return whether the cache exists and matches the current gears
  */
-static void
-multiply(GLfloat *m, const GLfloat *n)
+static bool
+load_gear_cache(GLsizeiptr vertex_bytes, GLsizeiptr index_bytes)
 {
-   GLfloat tmp[16];
-   const GLfloat *row, *column;
-   div_t d;
-   int i, j;
-
-   for (i = 0; i < 16; i++) {
-      tmp[i] = 0;
-      d = div(i, 4);
-      row = n + d.quot * 4;
-      column = m + d.rem;
-      for (j = 0; j < 4; j++)
-         tmp[i] += row[j] * column[j * 4];
+   struct gear_cache_header header;
+   struct gear_cache_entry entries[NUM_GEARS];
+   bool ok = false;
+   int i;
+
+   FILE *f = fopen(GEAR_CACHE_PATH, "rb");
+   if (!f)
+      return false;
+
+   if (fread(&header, sizeof(header), 1, f) != 1 ||
+       header.magic != GEAR_CACHE_MAGIC || header.version != GEAR_CACHE_VERSION ||
+       header.ngears != NUM_GEARS || header.vertex_bytes != vertex_bytes ||
+       header.index_bytes != index_bytes ||
+       fread(entries, sizeof(entries), 1, f) != 1)
+      goto out;
+
+   for (i = 0; i < NUM_GEARS; i++) {
+      if (entries[i].hash != gears[i].hash ||
+          entries[i].nvertices != gears[i].nvertices ||
+          entries[i].nindices != gears[i].nindices)
+         goto out;
    }
-   memcpy(m, &tmp, sizeof tmp);
+
+   ok = read_into_buffer(f, GL_ARRAY_BUFFER, vertex_bytes) &&
+        read_into_buffer(f, GL_ELEMENT_ARRAY_BUFFER, index_bytes);
+
+out:
+   fclose(f);
+   return ok;
 }
 
 /**
- * Rotates a 4x4 matrix.
- *
- * @param[in,out] m the matrix to rotate
- * @param angle the angle to rotate
- * @param x the x component of the direction to rotate to
- * @param y the y component of the direction to rotate to
- * @param z the z component of the direction to rotate to
+ * Writes the geometry of all gears to the cache file.
  */
 static void
-rotate(GLfloat *m, GLfloat angle, GLfloat x, GLfloat y, GLfloat z)
+save_gear_cache(const GearVertex *vertices, GLsizeiptr vertex_bytes,
+      const GLushort *indices, GLsizeiptr index_bytes)
 {
-   double s, c;
-
-   sincos(angle, &s, &c);
-   GLfloat r[16] = {
-      x * x * (1 - c) + c,     y * x * (1 - c) + z * s, x * z * (1 - c) - y * s, 0,
-      x * y * (1 - c) - z * s, y * y * (1 - c) + c,     y * z * (1 - c) + x * s, 0,
-      x * z * (1 - c) + y * s, y * z * (1 - c) - x * s, z * z * (1 - c) + c,     0,
-      0, 0, 0, 1
+   struct gear_cache_header header = {
+      GEAR_CACHE_MAGIC, GEAR_CACHE_VERSION, NUM_GEARS, vertex_bytes, index_bytes
    };
+   struct gear_cache_entry entries[NUM_GEARS];
+   bool ok;
+   int i;
 
-   multiply(m, r);
-}
+   FILE *f = fopen(GEAR_CACHE_PATH, "wb");
+   if (!f)
+      return;
 
+   for (i = 0; i < NUM_GEARS; i++) {
+      entries[i].hash = gears[i].hash;
+      entries[i].nvertices = gears[i].nvertices;
+      entries[i].nindices = gears[i].nindices;
+   }
+
+   ok = fwrite(&header, sizeof(header), 1, f) == 1 &&
+        fwrite(entries, sizeof(entries), 1, f) == 1 &&
+        fwrite(vertices, vertex_bytes, 1, f) == 1 &&
+        fwrite(indices, index_bytes, 1, f) == 1;
+   fclose(f);
+
+   /* Don't leave a truncated cache behind */
+   if (!ok)
+      remove(GEAR_CACHE_PATH);
+}
 
 /**
- * Translates a 4x4 matrix.
- *
- * @param[in,out] m the matrix to translate
- * @param x the x component of the direction to translate to
- * @param y the y component of the direction to translate to
- * @param z the z component of the direction to translate to
+ * Work item for generating a gear on a worker thread.
  */
+struct gear_job {
+   const struct gear_params *params;
+   GearVertex *vertices;
+   GLushort *indices;
+};
+
 static void
-translate(GLfloat *m, GLfloat x, GLfloat y, GLfloat z)
+gear_job_run(void *arg)
 {
-   GLfloat t[16] = { 1, 0, 0, 0,  0, 1, 0, 0,  0, 0, 1, 0,  x, y, z, 1 };
-
-   multiply(m, t);
+   struct gear_job *job = arg;
+   generate_gear(job->params, job->vertices, job->indices);
 }
 
 /**
- * Creates an identity 4x4 matrix.
- *
- * @param m the matrix make an identity matrix
+ * Generates the geometry of all gears, spreading the gears over the CPU cores.
  */
 static void
-identity(GLfloat *m)
+generate_gears(GearVertex *vertices, GLushort *indices)
 {
-   GLfloat t[16] = {
-      1.0, 0.0, 0.0, 0.0,
-      0.0, 1.0, 0.0, 0.0,
-      0.0, 0.0, 1.0, 0.0,
-      0.0, 0.0, 0.0, 1.0,
-   };
+   struct gear_job jobs[NUM_GEARS];
+   Thread threads[NUM_GEARS];
+   bool started[NUM_GEARS];
+   int i;
+
+   for (i = 0; i < NUM_GEARS; i++) {
+      jobs[i].params = &gears[i].params;
+      jobs[i].vertices = vertices + gears[i].vertex_offset / sizeof(GearVertex);
+      jobs[i].indices = indices + gears[i].first_index;
+
+      /* The main thread runs on core 0, so give it the last gear and hand out the rest to cores 1 and 2 */
+      started[i] = i != NUM_GEARS - 1 &&
+         R_SUCCEEDED(threadCreate(&threads[i], gear_job_run, &jobs[i], NULL, 0x4000, 0x2C, 1 + i % 2));
+      if (started[i] && R_FAILED(threadStart(&threads[i]))) {
+         threadClose(&threads[i]);
+         started[i] = false;
+      }
+   }
+
+   for (i = 0; i < NUM_GEARS; i++) {
+      if (!started[i])
+         gear_job_run(&jobs[i]);
+   }
 
-   memcpy(m, t, sizeof(t));
+   for (i = 0; i < NUM_GEARS; i++) {
+      if (started[i]) {
+         threadWaitForExit(&threads[i]);
+         threadClose(&threads[i]);
+      }
+   }
 }
 
 /**
- * Transposes a 4x4 matrix.
- *
- * @param m the matrix to transpose
+ * Fills the vertex and index buffers shared by all gears, from the cache if
+ * possible, or else by generating the gears (and caching them).
  */
 static void
-transpose(GLfloat *m)
+upload_gears(void)
 {
-   GLfloat t[16] = {
-      m[0], m[4], m[8],  m[12],
-      m[1], m[5], m[9],  m[13],
-      m[2], m[6], m[10], m[14],
-      m[3], m[7], m[11], m[15]};
+   GLsizeiptr vertex_bytes = 0, index_bytes = 0;
+   int i;
+
+   /* Lay out the gears in the shared buffers */
+   for (i = 0; i < NUM_GEARS; i++) {
+      struct gear *gear = &gears[i];
+
+      gear->hash = hash_gear_params(&gear->params);
+      gear->nvertices = VERTICES_PER_TOOTH * gear->params.teeth;
+      gear->nindices = INDICES_PER_TOOTH * gear->params.teeth;
+      gear->vertex_offset = vertex_bytes;
+      gear->first_index = index_bytes / sizeof(GLushort);
+      vertex_bytes += gear->nvertices * sizeof(GearVertex);
+      index_bytes += gear->nindices * sizeof(GLushort);
+   }
+
+   glBindVertexArray(vao);
+
+   /* The index buffer binding is part of the vertex array object */
+   glBindBuffer(GL_ARRAY_BUFFER, vbo);
+   glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ibo);
+   glBufferData(GL_ARRAY_BUFFER, vertex_bytes, NULL, GL_STATIC_DRAW);
+   glBufferData(GL_ELEMENT_ARRAY_BUFFER, index_bytes, NULL, GL_STATIC_DRAW);
 
-   memcpy(m, t, sizeof(t));
+   if (!load_gear_cache(vertex_bytes, index_bytes)) {
+      GearVertex *vertices = malloc(vertex_bytes);
+      GLushort *indices = malloc(index_bytes);
+
+      printf("Generating gears (no valid cache)\n");
+      generate_gears(vertices, indices);
+      glBufferSubData(GL_ARRAY_BUFFER, 0, vertex_bytes, vertices);
+      glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, 0, index_bytes, indices);
+      save_gear_cache(vertices, vertex_bytes, indices, index_bytes);
+
+      free(vertices);
+      free(indices);
+   }
+
+   /* The vertex and instance attributes are pointed at each gear's data when drawing */
+   glEnableVertexAttribArray(0);
+   glEnableVertexAttribArray(1);
+   glVertexAttribDivisor(2, 1);
+   glVertexAttribDivisor(3, 1);
+   glVertexAttribDivisor(4, 1);
+   glEnableVertexAttribArray(2);
+   glEnableVertexAttribArray(3);
+   glEnableVertexAttribArray(4);
+
+   glBindVertexArray(0);
+   glBindBuffer(GL_ARRAY_BUFFER, 0);
 }
 
 /**
- * Inverts a 4x4 matrix.
- *
- * This function can currently handle only pure translation-rotation matrices.
- * Read http://www.gamedev.net/community/forums/topic.asp?topic_id=425118
- * for an explanation.
+ * Fills the instance buffer with the gears to draw: the three classic
+ * gears, or a grid of copies of them in stress mode.
  */
 static void
-invert(GLfloat *m)
+place_gears(void)
 {
-   GLfloat t[16];
-   identity(t);
-
-   // Extract and invert the translation part 't'. The inverse of a
-   // translation matrix can be calculated by negating the translation
-   // coordinates.
-   t[12] = -m[12]; t[13] = -m[13]; t[14] = -m[14];
-
-   // Invert the rotation part 'r'. The inverse of a rotation matrix is
-   // equal to its transpose.
-   m[12] = m[13] = m[14] = 0;
-   transpose(m);
+   static const struct gear_instance classic[NUM_GEARS] = {
+      { { -3.0, -2.0, 0.0 },   0.0,  1.0, { 0.8, 0.1, 0.0, 1.0 } },
+      { {  3.1, -2.0, 0.0 },  -9.0, -2.0, { 0.0, 0.8, 0.2, 1.0 } },
+      { { -3.1,  4.2, 0.0 }, -25.0, -2.0, { 0.2, 0.2, 1.0, 1.0 } },
+   };
+   const GLfloat spacing = 14.0;
+   int copies = stress_mode ? STRESS_COLUMNS * STRESS_ROWS : 1;
+   struct gear_instance *instances = malloc(NUM_GEARS * copies * sizeof(*instances));
+   int i, n;
+
+   /* The instances of each gear are stored next to each other, so that they can be drawn at once */
+   for (i = 0; i < NUM_GEARS; i++) {
+      gears[i].first_instance = i * copies;
+      gears[i].ninstances = copies;
+      for (n = 0; n < copies; n++) {
+         struct gear_instance *inst = &instances[i * copies + n];
+         *inst = classic[i];
+         if (stress_mode) {
+            inst->position[0] += (n % STRESS_COLUMNS - (STRESS_COLUMNS - 1) / 2.0) * spacing;
+            inst->position[1] += (n / STRESS_COLUMNS - (STRESS_ROWS - 1) / 2.0) * spacing;
+         }
+      }
+   }
 
-   // inv(m) = inv(r) * inv(t)
-   multiply(m, t);
+   glBindBuffer(GL_ARRAY_BUFFER, instance_vbo);
+   glBufferData(GL_ARRAY_BUFFER, NUM_GEARS * copies * sizeof(*instances), instances, GL_STATIC_DRAW);
+   glBindBuffer(GL_ARRAY_BUFFER, 0);
+   free(instances);
 }
 
 /**
@@ -581,7 +788,7 @@ invert(GLfloat *m)
 void perspective(GLfloat *m, GLfloat fovy, GLfloat aspect, GLfloat zNear, GLfloat zFar)
 {
    GLfloat tmp[16];
-   identity(tmp);
+   mat4_identity(tmp);
 
    double sine, cosine, cotangent, deltaZ;
    GLfloat radians = fovy / 2 * M_PI / 180;
@@ -605,68 +812,33 @@ void perspective(GLfloat *m, GLfloat fovy, GLfloat aspect, GLfloat zNear, GLfloa
 }
 
 /**
- * Draws a gear.
+ * Draws all instances of a gear.
  *
  * @param gear the gear to draw
- * @param transform the current transformation matrix
- * @param x the x position to draw the gear at
- * @param y the y position to draw the gear at
- * @param angle the rotation angle of the gear
- * @param color the color of the gear
  */
 static void
-draw_gear(struct gear *gear, GLfloat *transform,
-      GLfloat x, GLfloat y, GLfloat angle, const GLfloat color[4])
+draw_gear(struct gear *gear)
 {
-   GLfloat model_view[16];
-   GLfloat normal_matrix[16];
-   GLfloat model_view_projection[16];
-
-   /* Translate and rotate the gear */
-   memcpy(model_view, transform, sizeof (model_view));
-   translate(model_view, x, y, 0);
-   rotate(model_view, 2 * M_PI * angle / 360.0, 0, 0, 1);
-
-   /* Create and set the ModelViewProjectionMatrix */
-   memcpy(model_view_projection, ProjectionMatrix, sizeof(model_view_projection));
-   multiply(model_view_projection, model_view);
-
-   glUniformMatrix4fv(ModelViewProjectionMatrix_location, 1, GL_FALSE,
-                      model_view_projection);
-
-   /*
-    * Create and set the NormalMatrix. It's the inverse transpose of the
-    * ModelView matrix.
-    */
-   memcpy(normal_matrix, model_view, sizeof (normal_matrix));
-   invert(normal_matrix);
-   transpose(normal_matrix);
-   glUniformMatrix4fv(NormalMatrix_location, 1, GL_FALSE, normal_matrix);
-
-   /* Set the gear color */
-   glUniform4fv(MaterialColor_location, 1, color);
-
-   /* Set the vertex buffer object to use */
-   glBindBuffer(GL_ARRAY_BUFFER, gear->vbo);
-
-   /* Set up the position of the attributes in the vertex buffer object */
-   glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE,
-         6 * sizeof(GLfloat), NULL);
-   glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE,
-         6 * sizeof(GLfloat), (GLfloat *) 0 + 3);
-
-   /* Enable the attributes */
-   glEnableVertexAttribArray(0);
-   glEnableVertexAttribArray(1);
-
-   /* Draw the triangle strips that comprise the gear */
-   int n;
-   for (n = 0; n < gear->nstrips; n++)
-      glDrawArrays(GL_TRIANGLE_STRIP, gear->strips[n].first, gear->strips[n].count);
-
-   /* Disable the attributes */
-   glDisableVertexAttribArray(1);
-   glDisableVertexAttribArray(0);
+   /* Point the vertex attributes at the vertices of this gear, so that its indices can start at 0 */
+   glBindBuffer(GL_ARRAY_BUFFER, vbo);
+   glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(GearVertex),
+         (const GLubyte *) gear->vertex_offset);
+   glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(GearVertex),
+         (const GLubyte *) gear->vertex_offset + 3 * sizeof(GLfloat));
+
+   /* Point the instance attributes at the instances of this gear (the position and phase are read as one vec4) */
+   const GLintptr offset = gear->first_instance * sizeof(struct gear_instance);
+   glBindBuffer(GL_ARRAY_BUFFER, instance_vbo);
+   glVertexAttribPointer(2, 4, GL_FLOAT, GL_FALSE, sizeof(struct gear_instance),
+         (const GLubyte *) offset + offsetof(struct gear_instance, position));
+   glVertexAttribPointer(3, 1, GL_FLOAT, GL_FALSE, sizeof(struct gear_instance),
+         (const GLubyte *) offset + offsetof(struct gear_instance, speed));
+   glVertexAttribPointer(4, 4, GL_FLOAT, GL_FALSE, sizeof(struct gear_instance),
+         (const GLubyte *) offset + offsetof(struct gear_instance, color));
+
+   glDrawElementsInstanced(GL_TRIANGLES, gear->nindices, GL_UNSIGNED_SHORT,
+         (const GLushort *) 0 + gear->first_index, gear->ninstances);
+   draw_count++;
 }
 
 /**
@@ -675,25 +847,42 @@ draw_gear(struct gear *gear, GLfloat *transform,
 static void
 gears_draw(void)
 {
-   const static GLfloat red[4] = { 0.8, 0.1, 0.0, 1.0 };
-   const static GLfloat green[4] = { 0.0, 0.8, 0.2, 1.0 };
-   const static GLfloat blue[4] = { 0.2, 0.2, 1.0, 1.0 };
    GLfloat transform[16];
-   identity(transform);
+   GLfloat view_projection[16];
+   int i;
+   mat4_identity(transform);
 
    glClearColor(0.0, 0.0, 0.0, 0.0);
    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
    /* Translate and rotate the view */
-   translate(transform, 0, 0, -20);
-   rotate(transform, 2 * M_PI * view_rot[0] / 360.0, 1, 0, 0);
-   rotate(transform, 2 * M_PI * view_rot[1] / 360.0, 0, 1, 0);
-   rotate(transform, 2 * M_PI * view_rot[2] / 360.0, 0, 0, 1);
+   mat4_translate(transform, 0, 0, stress_mode ? -120 : -20);
+   mat4_rotate(transform, 2 * M_PI * view_rot[0] / 360.0, 1, 0, 0);
+   mat4_rotate(transform, 2 * M_PI * view_rot[1] / 360.0, 0, 1, 0);
+   mat4_rotate(transform, 2 * M_PI * view_rot[2] / 360.0, 0, 0, 1);
+
+   /* Create and set the ViewProjectionMatrix */
+   memcpy(view_projection, ProjectionMatrix, sizeof(view_projection));
+   mat4_multiply(view_projection, transform);
+   glUniformMatrix4fv(ViewProjectionMatrix_location, 1, GL_FALSE, view_projection);
+
+   /*
+    * Set the NormalMatrix. The view and the gears are only rotated and
+    * translated, so the rotation part of the view is its own inverse
+    * transpose; the shader only uses the upper 3x3 part.
+    */
+   glUniformMatrix4fv(NormalMatrix_location, 1, GL_FALSE, transform);
+
+   /* The gears are rotated by the shader, according to the current angle */
+   glUniform1f(Angle_location, angle);
 
    /* Draw the gears */
-   draw_gear(gear1, transform, -3.0, -2.0, angle, red);
-   draw_gear(gear2, transform, 3.1, -2.0, -2 * angle - 9.0, green);
-   draw_gear(gear3, transform, -3.1, 4.2, -2 * angle - 25.0, blue);
+   draw_count = 0;
+   glBindVertexArray(vao);
+   for (i = 0; i < NUM_GEARS; i++)
+      draw_gear(&gears[i]);
+   glBindBuffer(GL_ARRAY_BUFFER, 0);
+   glBindVertexArray(0);
 }
 
 /**
@@ -743,28 +932,40 @@ gears_idle(void)
    if (t - tRate0 >= 5.0) {
       GLfloat seconds = t - tRate0;
       GLfloat fps = frames / seconds;
-      printf("%d frames in %3.1f seconds = %6.3f FPS\n", frames, seconds,
-            fps);
+      printf("%d frames in %3.1f seconds = %6.3f FPS (%.2f ms per frame), %d gears in %d draws\n",
+            frames, seconds, fps, 1000.0 * seconds / frames,
+            NUM_GEARS * gears[0].ninstances, draw_count);
       tRate0 = t;
       frames = 0;
    }
 }
 
 static const char vertex_shader[] =
-"attribute vec3 position;\n"
-"attribute vec3 normal;\n"
+"#version 300 es\n"
+"layout(location = 0) in vec3 position;\n"
+"layout(location = 1) in vec3 normal;\n"
 "\n"
-"uniform mat4 ModelViewProjectionMatrix;\n"
+"// Per-instance attributes: position (xyz) and phase (w), rotation speed and color\n"
+"layout(location = 2) in vec4 placement;\n"
+"layout(location = 3) in float speed;\n"
+"layout(location = 4) in vec4 MaterialColor;\n"
+"\n"
+"uniform mat4 ViewProjectionMatrix;\n"
 "uniform mat4 NormalMatrix;\n"
 "uniform vec4 LightSourcePosition;\n"
-"uniform vec4 MaterialColor;\n"
+"uniform float Angle;\n"
 "\n"
-"varying vec4 Color;\n"
+"out vec4 Color;\n"
 "\n"
 "void main(void)\n"
 "{\n"
+"    // Rotate the gear around its axis\n"
+"    float a = radians(Angle * speed + placement.w);\n"
+"    mat2 rotation = mat2(cos(a), sin(a), -sin(a), cos(a));\n"
+"    vec3 pos = vec3(rotation * position.xy, position.z) + placement.xyz;\n"
+"\n"
 "    // Transform the normal to eye coordinates\n"
-"    vec3 N = normalize(vec3(NormalMatrix * vec4(normal, 1.0)));\n"
+"    vec3 N = normalize(mat3(NormalMatrix) * vec3(rotation * normal.xy, normal.z));\n"
 "\n"
 "    // The LightSourcePosition is actually its direction for directional light\n"
 "    vec3 L = normalize(LightSourcePosition.xyz);\n"
@@ -775,16 +976,18 @@ static const char vertex_shader[] =
 "    Color = diffuse * MaterialColor;\n"
 "\n"
 "    // Transform the position to clip coordinates\n"
-"    gl_Position = ModelViewProjectionMatrix * vec4(position, 1.0);\n"
+"    gl_Position = ViewProjectionMatrix * vec4(pos, 1.0);\n"
 "}";
 
 static const char fragment_shader[] =
+"#version 300 es\n"
 "precision mediump float;\n"
-"varying vec4 Color;\n"
+"in vec4 Color;\n"
+"out vec4 FragColor;\n"
 "\n"
 "void main(void)\n"
 "{\n"
-"    gl_FragColor = Color;\n"
+"    FragColor = Color;\n"
 "}";
 
 static void
@@ -817,8 +1020,6 @@ gears_init(void)
    program = glCreateProgram();
    glAttachShader(program, v);
    glAttachShader(program, f);
-   glBindAttribLocation(program, 0, "position");
-   glBindAttribLocation(program, 1, "normal");
 
    glLinkProgram(program);
    glGetProgramInfoLog(program, sizeof msg, NULL, msg);
@@ -828,18 +1029,21 @@ gears_init(void)
    glUseProgram(program);
 
    /* Get the locations of the uniforms so we can access them */
-   ModelViewProjectionMatrix_location = glGetUniformLocation(program, "ModelViewProjectionMatrix");
+   ViewProjectionMatrix_location = glGetUniformLocation(program, "ViewProjectionMatrix");
    NormalMatrix_location = glGetUniformLocation(program, "NormalMatrix");
    LightSourcePosition_location = glGetUniformLocation(program, "LightSourcePosition");
-   MaterialColor_location = glGetUniformLocation(program, "MaterialColor");
+   Angle_location = glGetUniformLocation(program, "Angle");
 
    /* Set the LightSourcePosition uniform which is constant throught the program */
    glUniform4fv(LightSourcePosition_location, 1, LightSourcePosition);
 
-   /* make the gears */
-   gear1 = create_gear(1.0, 4.0, 1.0, 20, 0.7);
-   gear2 = create_gear(0.5, 2.0, 2.0, 10, 0.7);
-   gear3 = create_gear(1.3, 2.0, 0.5, 10, 0.7);
+   /* make the gears, putting them all in the same buffers */
+   glGenVertexArrays(1, &vao);
+   glGenBuffers(1, &vbo);
+   glGenBuffers(1, &ibo);
+   glGenBuffers(1, &instance_vbo);
+   upload_gears();
+   place_gears();
 }
 
 int main(int argc, char* argv[])
@@ -871,6 +1075,13 @@ int main(int argc, char* argv[])
         if (kDown & HidNpadButton_Plus)
             break;
 
+        // Toggle between the classic three gears and hundreds of them
+        if (kDown & HidNpadButton_A)
+        {
+            stress_mode = !stress_mode;
+            place_gears();
+        }
+
         // Render stuff!
         gears_draw();
         eglSwapBuffers(s_display, s_surface);
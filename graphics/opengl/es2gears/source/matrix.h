@@ -0,0 +1,160 @@
+/*
+ * 4x4 matrix routines used by es2gears.
+ *
+ * Matrices are arrays of 16 GLfloats in column-major order, as expected by
+ * glUniformMatrix4fv, and need no particular alignment. Each column is
+ * handled as a 4-wide vector using GCC vector extensions, which compile to
+ * NEON on the Switch (and to SSE on x86 hosts).
+ */
+
+#pragma once
+#include <math.h>
+#include <string.h>
+
+/* A column of a matrix, which may be read from and written to any array of floats */
+typedef float mat4_col __attribute__((vector_size(16), aligned(4), may_alias));
+typedef int mat4_mask __attribute__((vector_size(16)));
+
+/**
+ * Creates an identity 4x4 matrix.
+ *
+ * @param m the matrix make an identity matrix
+ */
+static inline void
+mat4_identity(float *m)
+{
+   static const float t[16] = {
+      1.0, 0.0, 0.0, 0.0,
+      0.0, 1.0, 0.0, 0.0,
+      0.0, 0.0, 1.0, 0.0,
+      0.0, 0.0, 0.0, 1.0,
+   };
+
+   memcpy(m, t, sizeof(t));
+}
+
+/**
+ * Multiplies two 4x4 matrices.
+ *
+ * The result (m * n) is stored in matrix m.
+ *
+ * @param m the first matrix to multiply
+ * @param n the second matrix to multiply
+ */
+static inline void
+mat4_multiply(float *m, const float *n)
+{
+   mat4_col a0 = *(const mat4_col *) (m + 0);
+   mat4_col a1 = *(const mat4_col *) (m + 4);
+   mat4_col a2 = *(const mat4_col *) (m + 8);
+   mat4_col a3 = *(const mat4_col *) (m + 12);
+   mat4_col r[4];
+   int i;
+
+   /* Each column of the result combines the columns of m, weighted by a column of n */
+   for (i = 0; i < 4; i++)
+      r[i] = a0 * n[i * 4 + 0] + a1 * n[i * 4 + 1] + a2 * n[i * 4 + 2] + a3 * n[i * 4 + 3];
+
+   for (i = 0; i < 4; i++)
+      *(mat4_col *) (m + i * 4) = r[i];
+}
+
+/**
+ * Rotates a 4x4 matrix.
+ *
+ * @param[in,out] m the matrix to rotate
+ * @param angle the angle to rotate
+ * @param x the x component of the direction to rotate to
+ * @param y the y component of the direction to rotate to
+ * @param z the z component of the direction to rotate to
+ */
+static inline void
+mat4_rotate(float *m, float angle, float x, float y, float z)
+{
+   float s = sinf(angle), c = cosf(angle);
+   const float r[16] = {
+      x * x * (1 - c) + c,     y * x * (1 - c) + z * s, x * z * (1 - c) - y * s, 0,
+      x * y * (1 - c) - z * s, y * y * (1 - c) + c,     y * z * (1 - c) + x * s, 0,
+      x * z * (1 - c) + y * s, y * z * (1 - c) - x * s, z * z * (1 - c) + c,     0,
+      0, 0, 0, 1
+   };
+
+   mat4_multiply(m, r);
+}
+
+/**
+ * Translates a 4x4 matrix.
+ *
+ * Only the last column changes, so this is cheaper than a full multiplication.
+ *
+ * @param[in,out] m the matrix to translate
+ * @param x the x component of the direction to translate to
+ * @param y the y component of the direction to translate to
+ * @param z the z component of the direction to translate to
+ */
+static inline void
+mat4_translate(float *m, float x, float y, float z)
+{
+   mat4_col *col = (mat4_col *) m;
+
+   col[3] = col[0] * x + col[1] * y + col[2] * z + col[3];
+}
+
+/**
+ * Transposes a 4x4 matrix.
+ *
+ * @param m the matrix to transpose
+ */
+static inline void
+mat4_transpose(float *m)
+{
+   mat4_col a0 = *(const mat4_col *) (m + 0);
+   mat4_col a1 = *(const mat4_col *) (m + 4);
+   mat4_col a2 = *(const mat4_col *) (m + 8);
+   mat4_col a3 = *(const mat4_col *) (m + 12);
+
+   /* Interleave pairs of columns, then pairs of pairs */
+   mat4_col t0 = __builtin_shuffle(a0, a1, (mat4_mask) { 0, 4, 1, 5 });
+   mat4_col t1 = __builtin_shuffle(a2, a3, (mat4_mask) { 0, 4, 1, 5 });
+   mat4_col t2 = __builtin_shuffle(a0, a1, (mat4_mask) { 2, 6, 3, 7 });
+   mat4_col t3 = __builtin_shuffle(a2, a3, (mat4_mask) { 2, 6, 3, 7 });
+
+   *(mat4_col *) (m + 0) = __builtin_shuffle(t0, t1, (mat4_mask) { 0, 1, 4, 5 });
+   *(mat4_col *) (m + 4) = __builtin_shuffle(t0, t1, (mat4_mask) { 2, 3, 6, 7 });
+   *(mat4_col *) (m + 8) = __builtin_shuffle(t2, t3, (mat4_mask) { 0, 1, 4, 5 });
+   *(mat4_col *) (m + 12) = __builtin_shuffle(t2, t3, (mat4_mask) { 2, 3, 6, 7 });
+}
+
+/**
+ * Inverts a 4x4 matrix.
+ *
+ * This function can currently handle only pure translation-rotation matrices:
+ * the inverse of [R t] is [transpose(R) -transpose(R)*t], which needs no
+ * general matrix inversion.
+ *
+ * @param m the matrix to invert
+ */
+static inline void
+mat4_invert_rigid(float *m)
+{
+   mat4_col a0 = *(const mat4_col *) (m + 0);
+   mat4_col a1 = *(const mat4_col *) (m + 4);
+   mat4_col a2 = *(const mat4_col *) (m + 8);
+   const mat4_col zero = { 0, 0, 0, 0 };
+   float tx = m[12], ty = m[13], tz = m[14];
+
+   /* Transpose the matrix with its translation removed, i.e. with a fourth column of (0, 0, 0, 1) */
+   mat4_col t0 = __builtin_shuffle(a0, a1, (mat4_mask) { 0, 4, 1, 5 });
+   mat4_col t1 = __builtin_shuffle(a2, zero, (mat4_mask) { 0, 4, 1, 5 });
+   mat4_col t2 = __builtin_shuffle(a0, a1, (mat4_mask) { 2, 6, 3, 7 });
+   mat4_col t3 = __builtin_shuffle(a2, zero, (mat4_mask) { 2, 6, 3, 7 });
+   mat4_col r0 = __builtin_shuffle(t0, t1, (mat4_mask) { 0, 1, 4, 5 });
+   mat4_col r1 = __builtin_shuffle(t0, t1, (mat4_mask) { 2, 3, 6, 7 });
+   mat4_col r2 = __builtin_shuffle(t2, t3, (mat4_mask) { 0, 1, 4, 5 });
+   mat4_col r3 = __builtin_shuffle(t2, t3, (mat4_mask) { 2, 3, 6, 7 }) + (mat4_col) { 0, 0, 0, 1 };
+
+   *(mat4_col *) (m + 0) = r0;
+   *(mat4_col *) (m + 4) = r1;
+   *(mat4_col *) (m + 8) = r2;
+   *(mat4_col *) (m + 12) = r3 - (r0 * tx + r1 * ty + r2 * tz);
+}
@@ -0,0 +1,324 @@
+/*
+ * Validates the vectorized matrix routines of es2gears (source/matrix.h)
+ * against the original scalar ones, and measures both.
+ *
+ * This is a host tool, not part of the Switch build:
+ *   cc -O2 -I../source matrix_bench.c -o matrix_bench -lm && ./matrix_bench
+ */
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#include "matrix.h"
+
+#define ITERATIONS 1000000
+#define NUM_MATRICES 64
+
+/*
+ * Original scalar implementations, used as the reference
+ */
+
+/**
+ * Multiplies two 4x4 matrices.
+ *
+ * The result is stored in matrix m.
+ *
+ * @param m the first matrix to multiply
+ * @param n the second matrix to multiply
+ */
+static void
+ref_multiply(float *m, const float *n)
+{
+   float tmp[16];
+   const float *row, *column;
+   div_t d;
+   int i, j;
+
+   for (i = 0; i < 16; i++) {
+      tmp[i] = 0;
+      d = div(i, 4);
+      row = n + d.quot * 4;
+      column = m + d.rem;
+      for (j = 0; j < 4; j++)
+         tmp[i] += row[j] * column[j * 4];
+   }
+   memcpy(m, &tmp, sizeof tmp);
+}
+
+/**
+ * Rotates a 4x4 matrix.
+ *
+ * @param[in,out] m the matrix to rotate
+ * @param angle the angle to rotate
+ * @param x the x component of the direction to rotate to
+ * @param y the y component of the direction to rotate to
+ * @param z the z component of the direction to rotate to
+ */
+static void
+ref_rotate(float *m, float angle, float x, float y, float z)
+{
+   double s, c;
+
+   sincos(angle, &s, &c);
+   float r[16] = {
+      x * x * (1 - c) + c,     y * x * (1 - c) + z * s, x * z * (1 - c) - y * s, 0,
+      x * y * (1 - c) - z * s, y * y * (1 - c) + c,     y * z * (1 - c) + x * s, 0,
+      x * z * (1 - c) + y * s, y * z * (1 - c) - x * s, z * z * (1 - c) + c,     0,
+      0, 0, 0, 1
+   };
+
+   ref_multiply(m, r);
+}
+
+
+/**
+ * Translates a 4x4 matrix.
+ *
+ * @param[in,out] m the matrix to translate
+ * @param x the x component of the direction to translate to
+ * @param y the y component of the direction to translate to
+ * @param z the z component of the direction to translate to
+ */
+static void
+ref_translate(float *m, float x, float y, float z)
+{
+   float t[16] = { 1, 0, 0, 0,  0, 1, 0, 0,  0, 0, 1, 0,  x, y, z, 1 };
+
+   ref_multiply(m, t);
+}
+
+/**
+ * Creates an identity 4x4 matrix.
+ *
+ * @param m the matrix make an identity matrix
+ */
+static void
+ref_identity(float *m)
+{
+   float t[16] = {
+      1.0, 0.0, 0.0, 0.0,
+      0.0, 1.0, 0.0, 0.0,
+      0.0, 0.0, 1.0, 0.0,
+      0.0, 0.0, 0.0, 1.0,
+   };
+
+   memcpy(m, t, sizeof(t));
+}
+
+/**
+ * Transposes a 4x4 matrix.
+ *
+ * @param m the matrix to transpose
+ */
+static void
+ref_transpose(float *m)
+{
+   float t[16] = {
+      m[0], m[4], m[8],  m[12],
+      m[1], m[5], m[9],  m[13],
+      m[2], m[6], m[10], m[14],
+      m[3], m[7], m[11], m[15]};
+
+   memcpy(m, t, sizeof(t));
+}
+
+/**
+ * Inverts a 4x4 matrix.
+ *
+ * This function can currently handle only pure translation-rotation matrices.
+ * Read http://www.gamedev.net/community/forums/topic.asp?topic_id=425118
+ * for an explanation.
+ */
+static void
+ref_invert(float *m)
+{
+   float t[16];
+   ref_identity(t);
+
+   // Extract and invert the translation part 't'. The inverse of a
+   // translation matrix can be calculated by negating the translation
+   // coordinates.
+   t[12] = -m[12]; t[13] = -m[13]; t[14] = -m[14];
+
+   // Invert the rotation part 'r'. The inverse of a rotation matrix is
+   // equal to its transpose.
+   m[12] = m[13] = m[14] = 0;
+   ref_transpose(m);
+
+   // inv(m) = inv(r) * inv(t)
+   ref_multiply(m, t);
+}
+
+/*
+ * Validation
+ */
+
+static float
+random_float(void)
+{
+   return rand() / (float) RAND_MAX * 2.0f - 1.0f;
+}
+
+static void
+random_matrix(float *m)
+{
+   int i;
+   for (i = 0; i < 16; i++)
+      m[i] = random_float() * 10.0f;
+}
+
+/* A random rotation (about a random unit axis) followed by a random translation */
+static void
+random_rigid(float *m)
+{
+   float x = random_float(), y = random_float(), z = random_float();
+   float len = sqrtf(x * x + y * y + z * z);
+
+   ref_identity(m);
+   ref_translate(m, random_float() * 10.0f, random_float() * 10.0f, random_float() * 10.0f);
+   ref_rotate(m, random_float() * M_PI, x / len, y / len, z / len);
+}
+
+static float
+max_error(const float *a, const float *b)
+{
+   float err = 0.0f;
+   int i;
+   for (i = 0; i < 16; i++)
+      err = fmaxf(err, fabsf(a[i] - b[i]) / fmaxf(1.0f, fabsf(b[i])));
+   return err;
+}
+
+static int
+check(const char *name, float err, float tolerance)
+{
+   printf("  %-10s max relative error %.3g %s\n", name, err, err <= tolerance ? "ok" : "FAILED");
+   return err <= tolerance;
+}
+
+static int
+validate(void)
+{
+   float err_mul = 0, err_rot = 0, err_trans = 0, err_transp = 0, err_inv = 0, err_roundtrip = 0;
+   int i;
+
+   for (i = 0; i < 10000; i++) {
+      float a[16], b[16], n[16], ref[16], x, y, z, angle;
+
+      random_matrix(a);
+      random_matrix(n);
+      memcpy(ref, a, sizeof(a));
+      ref_multiply(ref, n);
+      memcpy(b, a, sizeof(a));
+      mat4_multiply(b, n);
+      err_mul = fmaxf(err_mul, max_error(b, ref));
+
+      x = random_float(); y = random_float(); z = random_float();
+      angle = random_float() * 2 * M_PI;
+      memcpy(ref, a, sizeof(a));
+      ref_rotate(ref, angle, x, y, z);
+      memcpy(b, a, sizeof(a));
+      mat4_rotate(b, angle, x, y, z);
+      err_rot = fmaxf(err_rot, max_error(b, ref));
+
+      memcpy(ref, a, sizeof(a));
+      ref_translate(ref, x, y, z);
+      memcpy(b, a, sizeof(a));
+      mat4_translate(b, x, y, z);
+      err_trans = fmaxf(err_trans, max_error(b, ref));
+
+      memcpy(ref, a, sizeof(a));
+      ref_transpose(ref);
+      memcpy(b, a, sizeof(a));
+      mat4_transpose(b);
+      err_transp = fmaxf(err_transp, max_error(b, ref));
+
+      random_rigid(a);
+      memcpy(ref, a, sizeof(a));
+      ref_invert(ref);
+      memcpy(b, a, sizeof(a));
+      mat4_invert_rigid(b);
+      err_inv = fmaxf(err_inv, max_error(b, ref));
+
+      /* m * inverse(m) must be the identity */
+      mat4_multiply(b, a);
+      ref_identity(ref);
+      err_roundtrip = fmaxf(err_roundtrip, max_error(b, ref));
+   }
+
+   printf("Validation against the scalar routines (10000 random cases):\n");
+   return check("multiply", err_mul, 1e-5f)
+        & check("rotate", err_rot, 1e-5f)
+        & check("translate", err_trans, 1e-5f)
+        & check("transpose", err_transp, 0.0f)
+        & check("invert", err_inv, 1e-5f)
+        & check("m*inv(m)", err_roundtrip, 1e-5f);
+}
+
+/*
+ * Benchmark
+ */
+
+static double
+now(void)
+{
+   struct timespec ts;
+   clock_gettime(CLOCK_MONOTONIC, &ts);
+   return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/* Runs an operation over a set of matrices, returning the time per operation in nanoseconds */
+#define BENCH(result, matrices, op) do { \
+   double _start = now(); \
+   int _i; \
+   for (_i = 0; _i < ITERATIONS; _i++) { \
+      float *m = matrices[_i % NUM_MATRICES]; \
+      op; \
+      __asm__ volatile("" :: "r"(m) : "memory"); \
+   } \
+   result = (now() - _start) * 1e9 / ITERATIONS; \
+} while (0)
+
+int
+main(void)
+{
+   static float matrices[NUM_MATRICES][16];
+   static float n[16];
+   double scalar, simd;
+   int i, ok;
+
+   srand(1);
+   ok = validate();
+
+   for (i = 0; i < NUM_MATRICES; i++)
+      random_rigid(matrices[i]);
+   random_rigid(n);
+
+   printf("\nTime per operation (ns), scalar vs vectorized:\n");
+
+   BENCH(scalar, matrices, ref_multiply(m, n));
+   BENCH(simd, matrices, mat4_multiply(m, n));
+   printf("  %-10s %7.2f %7.2f  (x%.1f)\n", "multiply", scalar, simd, scalar / simd);
+
+   BENCH(scalar, matrices, ref_rotate(m, 0.01f, 0, 0, 1));
+   BENCH(simd, matrices, mat4_rotate(m, 0.01f, 0, 0, 1));
+   printf("  %-10s %7.2f %7.2f  (x%.1f)\n", "rotate", scalar, simd, scalar / simd);
+
+   BENCH(scalar, matrices, ref_translate(m, 0.01f, 0.02f, 0.03f));
+   BENCH(simd, matrices, mat4_translate(m, 0.01f, 0.02f, 0.03f));
+   printf("  %-10s %7.2f %7.2f  (x%.1f)\n", "translate", scalar, simd, scalar / simd);
+
+   BENCH(scalar, matrices, ref_transpose(m));
+   BENCH(simd, matrices, mat4_transpose(m));
+   printf("  %-10s %7.2f %7.2f  (x%.1f)\n", "transpose", scalar, simd, scalar / simd);
+
+   BENCH(scalar, matrices, ref_invert(m));
+   BENCH(simd, matrices, mat4_invert_rigid(m));
+   printf("  %-10s %7.2f %7.2f  (x%.1f)\n", "invert", scalar, simd, scalar / simd);
+
+   return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
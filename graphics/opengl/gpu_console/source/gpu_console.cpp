@@ -6,12 +6,21 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <new>
 #include <switch.h>
 
 #include <EGL/egl.h>    // EGL library
 #include <EGL/eglext.h> // EGL extensions
 #include <glad/glad.h>  // glad library (OpenGL loader)
 
+#include "gl_state.h"
+#include "shader_cache.h"
+#include "stream_buffer.h"
+#include "glyph_cache.h"
+#include "gpu_console.h"
+#include "scrollback.h"
+#include "shared_font.h"
+
 #define TRACE(...) ((void)0)
 
 static const char* const vertexShaderSource = R"text(
@@ -24,12 +33,13 @@ out gl_PerVertex
 	vec4 gl_Position;
 };
 
-layout (location = 0) in int inAttr;
+layout (location = 0) in uint inAttr;
 
 layout (location = 0) out vec4 outColor;
 layout (location = 1) out vec3 outUV;
 
 uniform ivec2 dimensions;
+uniform int rowOffset;
 uniform vec4 palettes[16] = vec4[](
 	vec4(0.0, 0.0, 0.0, 1.0),
 	vec4(0.5, 0.0, 0.0, 1.0),
@@ -61,16 +71,17 @@ const vec2 builtin_vertices[] = vec2[](
 void main()
 {
 	// Extract data from the attribute
-	float tileId = float(inAttr & 0x3FF);
-	bool hFlip = ((inAttr >> 10) & 1) != 0;
-	bool vFlip = ((inAttr >> 11) & 1) != 0;
-	int palId = (inAttr >> 12) & 0xF;
+	float tileId = float(inAttr & 0xFFFFu);
+	bool hFlip = ((inAttr >> 16) & 1u) != 0u;
+	bool vFlip = ((inAttr >> 17) & 1u) != 0u;
+	uint palId = (inAttr >> 20) & 0xFu;
 
 	vec2 vtxData = builtin_vertices[gl_VertexID];
 
-	// Position
-	float tileRow = floor(float(gl_InstanceID) / dimensions.x);
-	float tileCol = float(gl_InstanceID) - tileRow*dimensions.x;
+	// Position (the rows of the tilemap form a ring, which starts at rowOffset)
+	float physRow = floor(float(gl_InstanceID) / dimensions.x);
+	float tileCol = float(gl_InstanceID) - physRow*dimensions.x;
+	float tileRow = mod(physRow - float(rowOffset), float(dimensions.y));
 	vec2 basePos;
 	basePos.x = 2.0 * tileCol / dimensions.x - 1.0;
 	basePos.y = 2.0 * (1.0 - tileRow / dimensions.y) - 1.0;
@@ -116,14 +127,24 @@ void main()
 namespace
 {
 
+// Tilemap entries hold a 16-bit tile ID (leaving room for the glyph cache tiles), the flip flags and the palette
+using TilemapEntry = uint32_t;
+
+// Number of frames of tilemap copies the streaming ring can hold
+constexpr unsigned TILEMAPRINGFRAMES = 4;
+
 struct GpuConsole : public ConsoleRenderer
 {
 	constexpr GpuConsole() :
 		ConsoleRenderer{ _init, _deinit, _drawChar, _scrollWindow, _flushAndSwap },
 		s_display{}, s_context{}, s_surface{},
 		s_tilemapVsh{}, s_tilemapFsh{}, s_tilemapPipeline{},
-		s_tilemapVao{}, s_tilemapVbo{}, s_tilemap{},
-		s_tilesetTex{}
+		s_tilemapVao{}, s_tilemapStream{}, s_tilemap{},
+		s_rowOffsetLoc{}, s_rowOffset{},
+		s_dirtyRows{}, s_dirty{}, s_lastLiveCopy{},
+		s_history{}, s_historyRow{}, s_viewOffset{}, s_composing{},
+		s_tilesetTex{}, s_numTiles{},
+		s_glyphs{}, s_utf8{}
 	{ }
 
 	bool init(PrintConsole* con);
@@ -132,6 +153,10 @@ struct GpuConsole : public ConsoleRenderer
 	void scrollWindow(PrintConsole* con);
 	void flushAndSwap(PrintConsole* con);
 
+	void scrollback(int lines);
+	void scrollbackReset();
+	bool scrollbackFind(const char* needle);
+
 private:
 	static GpuConsole* _get(PrintConsole* con)
 	{
@@ -163,6 +188,12 @@ private:
 		_get(con)->flushAndSwap(con);
 	}
 
+	static void _collectPins(void* user, GlyphCache* gc)
+	{
+		PrintConsole* con = static_cast<PrintConsole*>(user);
+		_get(con)->collectPins(con, gc);
+	}
+
 	EGLDisplay s_display;
 	EGLContext s_context;
 	EGLSurface s_surface;
@@ -172,40 +203,79 @@ private:
 
 	GLuint s_tilemapVsh, s_tilemapFsh;
 	GLuint s_tilemapPipeline;
-	GLuint s_tilemapVao, s_tilemapVbo;
-	uint16_t* s_tilemap;
+	GLuint s_tilemapVao;
+	StreamBuffer s_tilemapStream;
+	TilemapEntry* s_tilemap;
+
+	GLint s_rowOffsetLoc;
+	int s_rowOffset;
+
+	// Rows of the tilemap that changed since it was last copied to the streaming ring, and whether
+	// anything at all needs to be redrawn
+	bool* s_dirtyRows;
+	bool s_dirty;
+
+	// Offset in the streaming ring of the last copy of the tilemap, or -1 if the last frame drawn
+	// showed the history instead
+	GLintptr s_lastLiveCopy;
+
+	void copyTilemap(PrintConsole* con, TilemapEntry* out, GLintptr outOffset);
+
+	unsigned physRow(PrintConsole* con, int y) const
+	{
+		return (y + s_rowOffset) % con->consoleHeight;
+	}
+
+	// Lines that scrolled off the screen. When s_viewOffset is non-zero, the screen shows the history
+	// scrolled back by that many lines.
+	Scrollback s_history;
+	ScrollbackCell* s_historyRow;
+	unsigned s_viewOffset;
+	TilemapEntry* s_composing; // view being composed, if any
+
+	void composeView(PrintConsole* con, TilemapEntry* out);
 
 	GLuint s_tilesetTex;
+	unsigned s_numTiles;
+
+	// Characters outside of the built-in font are rasterized on demand into the tiles following it
+	GlyphCache s_glyphs;
+	Utf8Decoder s_utf8;
+
+	unsigned getTile(PrintConsole* con, uint32_t codepoint);
+	uint16_t getTileChar(PrintConsole* con, unsigned tile);
+	void collectPins(PrintConsole* con, GlyphCache* gc);
+	TilemapEntry makeCharEntry(PrintConsole* con, unsigned tile, unsigned palId);
+	void uploadGlyphs(PrintConsole* con);
 };
 
-constexpr uint16_t MakeTilemapEntry(unsigned tileId, bool hFlip, bool vFlip, unsigned palId)
+constexpr TilemapEntry MakeTilemapEntry(unsigned tileId, bool hFlip, bool vFlip, unsigned palId)
 {
-	uint16_t ent = 0;
-	ent |= (tileId & 0x3FF);
+	TilemapEntry ent = 0;
+	ent |= (tileId & 0xFFFF);
 	if (hFlip)
-		ent |= 1u << 10;
+		ent |= 1u << 16;
 	if (vFlip)
-		ent |= 1u << 11;
-	ent |= (palId & 0xF) << 12;
+		ent |= 1u << 17;
+	ent |= (palId & 0xF) << 20;
 	return ent;
 }
 
-GLuint loadShaderProgram(GLenum type, const char* source)
+constexpr unsigned GetTilemapEntryTile(TilemapEntry ent)
 {
-	GLint success;
-	GLchar msg[512];
+	return ent & 0xFFFF;
+}
 
-	GLuint handle = glCreateShaderProgramv(type, 1, &source);
-	glGetProgramiv(handle, GL_LINK_STATUS, &success);
-	if (success == GL_FALSE)
-	{
-		glGetProgramInfoLog(handle, sizeof(msg), nullptr, msg);
-		TRACE("Shader error: %s", msg);
-		glDeleteProgram(handle);
-		handle = 0;
-	}
+constexpr unsigned GetTilemapEntryPalette(TilemapEntry ent)
+{
+	return (ent >> 20) & 0xF;
+}
 
-	return handle;
+GLuint loadShaderProgram(GLenum type, const char* source)
+{
+	// Separable single-stage program (like glCreateShaderProgramv makes), loaded from the shader cache if possible
+	const ShaderStage stage = { type, source };
+	return shaderCacheBuildProgram(&stage, 1, nullptr, true);
 }
 
 }
@@ -222,10 +292,15 @@ bool GpuConsole::init(PrintConsole* con)
 	s_tilemapFsh = loadShaderProgram(GL_FRAGMENT_SHADER, fragmentShaderSource);
 
 	// Configure tilemap dimensions
-	glProgramUniform2i(s_tilemapVsh, glGetUniformLocation(s_tilemapVsh, "dimensions"),
+	glStateProgramUniform2i(s_tilemapVsh, glGetUniformLocation(s_tilemapVsh, "dimensions"),
 		con->consoleWidth, con->consoleHeight
 	);
 
+	// Configure the start of the tilemap ring
+	s_rowOffset = 0;
+	s_rowOffsetLoc = glGetUniformLocation(s_tilemapVsh, "rowOffset");
+	glStateProgramUniform1i(s_tilemapVsh, s_rowOffsetLoc, s_rowOffset);
+
 	// Create a program pipeline and attach the programs to their respective stages
 	glGenProgramPipelines(1, &s_tilemapPipeline);
 	glUseProgramStages(s_tilemapPipeline, GL_VERTEX_SHADER_BIT,   s_tilemapVsh);
@@ -233,25 +308,57 @@ bool GpuConsole::init(PrintConsole* con)
 
 	// Create a VAO and a VBO for the tilemap
 	glGenVertexArrays(1, &s_tilemapVao);
-	glBindVertexArray(s_tilemapVao);
+	glStateBindVertexArray(s_tilemapVao);
 
-	// Allocate the tilemap data
-	glGenBuffers(1, &s_tilemapVbo);
-	glBindBuffer(GL_ARRAY_BUFFER, s_tilemapVbo);
-	glBufferData(GL_ARRAY_BUFFER, sizeof(uint16_t)*con->consoleWidth*con->consoleHeight, nullptr, GL_DYNAMIC_DRAW);
+	// The tilemap is copied to a streaming ring for each frame drawn. The attribute points at the start
+	// of the ring, and each frame's copy is reached through the base instance of the draw.
+	if (!streamBufferInit(&s_tilemapStream, sizeof(TilemapEntry)*con->consoleWidth*con->consoleHeight*TILEMAPRINGFRAMES))
+	{
+		glStateBindVertexArray(0);
+		glStateDeleteVertexArrays(1, &s_tilemapVao);
+		glStateDeleteProgramPipelines(1, &s_tilemapPipeline);
+		glStateDeleteProgram(s_tilemapFsh);
+		glStateDeleteProgram(s_tilemapVsh);
+		deinitEgl();
+		return false;
+	}
+	glStateBindBuffer(GL_ARRAY_BUFFER, s_tilemapStream.buffer);
 
 	// Configure the only vertex attribute (which is per-instance)
-	glVertexAttribIPointer(0, 1, GL_UNSIGNED_SHORT, sizeof(uint16_t), (void*)0);
+	glVertexAttribIPointer(0, 1, GL_UNSIGNED_INT, sizeof(TilemapEntry), (void*)0);
 	glVertexAttribDivisor(0, 1);
 	glEnableVertexAttribArray(0);
 
 	// We're done with the VBO/VAO, unbind them
-	glBindBuffer(GL_ARRAY_BUFFER, 0);
-	glBindVertexArray(0);
-
-	// Allocate the tilemap and clear it
-	s_tilemap = new uint16_t[con->consoleWidth*con->consoleHeight];
-	memset(s_tilemap, 0, sizeof(uint16_t)*con->consoleWidth*con->consoleHeight);
+	glStateBindBuffer(GL_ARRAY_BUFFER, 0);
+	glStateBindVertexArray(0);
+
+	// Allocate the tilemap, its dirty rows and the scrollback history (along with the buffer used to
+	// display it). Everything created so far is destroyed again if any of them fails.
+	s_tilemap = new (std::nothrow) TilemapEntry[con->consoleWidth*con->consoleHeight];
+	s_dirtyRows = new (std::nothrow) bool[con->consoleHeight];
+	s_historyRow = new (std::nothrow) ScrollbackCell[con->consoleWidth];
+	if (!s_tilemap || !s_dirtyRows || !s_historyRow || !scrollbackInit(&s_history, con->consoleWidth, SCROLLBACK_DEFAULT_CHUNKS))
+	{
+		deinit(con);
+		return false;
+	}
+	s_viewOffset = 0;
+
+	// Clear the tilemap, and mark it all as dirty so that it is copied in full the first time
+	memset(s_tilemap, 0, sizeof(TilemapEntry)*con->consoleWidth*con->consoleHeight);
+	memset(s_dirtyRows, 1, sizeof(bool)*con->consoleHeight);
+	s_dirty = true;
+	s_lastLiveCopy = -1;
+
+	// Set up the glyph cache if the shared font is available. The tileset then holds the built-in font followed by the cache slots
+	unsigned numGlyphSlots = 0;
+	if (sharedFontInit(con->font.tileWidth, con->font.tileHeight) &&
+		glyphCacheInit(&s_glyphs, con->font.tileWidth, con->font.tileHeight, con->font.numChars, GLYPH_CACHE_DEFAULT_SLOTS, sharedFontRasterize, nullptr))
+		numGlyphSlots = s_glyphs.numSlots;
+	glyphCacheSetPinCallback(&s_glyphs, _collectPins, con);
+	s_numTiles = con->font.numChars + numGlyphSlots;
+	s_utf8 = Utf8Decoder{};
 
 	// Unpack 1bpp tileset into a texture image OpenGL can load
 	uint8_t* tileset = new uint8_t[con->font.numChars*con->font.tileWidth*con->font.tileHeight];
@@ -277,17 +384,18 @@ bool GpuConsole::init(PrintConsole* con)
 
 	// Create tileset texture from the unpacked tileset image
 	glGenTextures(1, &s_tilesetTex);
-	glActiveTexture(GL_TEXTURE0); // activate the texture unit first before binding texture
-	glBindTexture(GL_TEXTURE_2D_ARRAY, s_tilesetTex);
+	glStateActiveTexture(GL_TEXTURE0); // activate the texture unit first before binding texture
+	glStateBindTexture(GL_TEXTURE_2D_ARRAY, s_tilesetTex);
 	glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
 	glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
 	glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_NEAREST); // can also use GL_LINEAR here
 	glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-	glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, GL_R8, con->font.tileWidth, con->font.tileHeight, con->font.numChars, 0, GL_RED, GL_UNSIGNED_BYTE, tileset);
+	glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, GL_R8, con->font.tileWidth, con->font.tileHeight, s_numTiles, 0, GL_RED, GL_UNSIGNED_BYTE, nullptr);
+	glTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, 0, 0, 0, con->font.tileWidth, con->font.tileHeight, con->font.numChars, GL_RED, GL_UNSIGNED_BYTE, tileset);
 	delete[] tileset;
 
 	// Bind the texture unit to the fragment shader
-	glProgramUniform1i(s_tilemapFsh, glGetUniformLocation(s_tilemapFsh, "tileset"), 0); // texunit 0
+	glStateProgramUniform1i(s_tilemapFsh, glGetUniformLocation(s_tilemapFsh, "tileset"), 0); // texunit 0
 
 	// Other miscellaneous init
 	glEnable(GL_CULL_FACE);
@@ -303,18 +411,76 @@ bool GpuConsole::init(PrintConsole* con)
 
 void GpuConsole::deinit(PrintConsole* con)
 {
-	glDeleteTextures(1, &s_tilesetTex);
-	glDeleteBuffers(1, &s_tilemapVbo);
-	glDeleteVertexArrays(1, &s_tilemapVao);
-	glDeleteProgramPipelines(1, &s_tilemapPipeline);
-	glDeleteProgram(s_tilemapFsh);
-	glDeleteProgram(s_tilemapVsh);
+	glStateDeleteTextures(1, &s_tilesetTex);
+	streamBufferExit(&s_tilemapStream);
+	glStateDeleteVertexArrays(1, &s_tilemapVao);
+	glStateDeleteProgramPipelines(1, &s_tilemapPipeline);
+	glStateDeleteProgram(s_tilemapFsh);
+	glStateDeleteProgram(s_tilemapVsh);
+	glyphCacheExit(&s_glyphs);
+	sharedFontExit();
+	scrollbackExit(&s_history);
+	delete[] s_historyRow;
+	delete[] s_dirtyRows;
 	delete[] s_tilemap;
+	s_tilesetTex = 0;
+	s_historyRow = nullptr;
+	s_dirtyRows = nullptr;
+	s_tilemap = nullptr;
 	deinitEgl();
 }
 
+unsigned GpuConsole::getTile(PrintConsole* con, uint32_t codepoint)
+{
+	// ASCII comes from the built-in font, everything else from the glyph cache
+	if (codepoint < 0x80 && codepoint >= (uint32_t)con->font.asciiOffset)
+		return codepoint - con->font.asciiOffset;
+	if (s_glyphs.numSlots)
+		return glyphCacheGetTile(&s_glyphs, codepoint);
+
+	// Without the shared font, use the built-in font wherever it has the character
+	if (codepoint >= (uint32_t)con->font.asciiOffset && codepoint - con->font.asciiOffset < con->font.numChars)
+		return codepoint - con->font.asciiOffset;
+	return '?' - con->font.asciiOffset;
+}
+
+uint16_t GpuConsole::getTileChar(PrintConsole* con, unsigned tile)
+{
+	uint32_t codepoint = tile < con->font.numChars ? tile + con->font.asciiOffset : glyphCacheGetCodepoint(&s_glyphs, tile);
+	return codepoint < 0x10000 ? codepoint : GLYPH_CACHE_REPLACEMENT;
+}
+
+void GpuConsole::collectPins(PrintConsole* con, GlyphCache* gc)
+{
+	// Only the tilemap and the view being composed can still be drawn: the copies of the previous
+	// frames in the streaming ring are never drawn again, and GL orders their draws before any upload
+	unsigned numCells = con->consoleWidth*con->consoleHeight;
+	for (unsigned i = 0; i < numCells; i ++)
+		glyphCachePin(gc, GetTilemapEntryTile(s_tilemap[i]));
+	if (s_composing)
+	{
+		for (unsigned i = 0; i < numCells; i ++)
+			glyphCachePin(gc, GetTilemapEntryTile(s_composing[i]));
+	}
+}
+
+TilemapEntry GpuConsole::makeCharEntry(PrintConsole* con, unsigned tile, unsigned palId)
+{
+	// Glyph cache tiles are stored top row first, unlike the built-in font, so flip them vertically
+	return MakeTilemapEntry(tile, false, tile >= con->font.numChars, palId);
+}
+
 void GpuConsole::drawChar(PrintConsole* con, int x, int y, int c)
 {
+	// Decode UTF-8 text. Bytes that don't complete a character don't take up a cell,
+	// so undo the cursor advance the console applies after this call.
+	uint32_t codepoint;
+	if (!utf8DecoderFeed(&s_utf8, c + con->font.asciiOffset, &codepoint))
+	{
+		con->cursorX --;
+		return;
+	}
+
 	int writingColor = con->fg;
 	int screenColor = con->bg;
 
@@ -331,37 +497,173 @@ void GpuConsole::drawChar(PrintConsole* con, int x, int y, int c)
 		screenColor = tmp;
 	}
 
-	s_tilemap[y*con->consoleWidth+x] = MakeTilemapEntry(c, false, false, writingColor);
+	unsigned row = physRow(con, y);
+	s_tilemap[row*con->consoleWidth+x] = makeCharEntry(con, getTile(con, codepoint), writingColor);
+	s_dirtyRows[row] = true;
+	s_dirty = true;
 }
 
 void GpuConsole::scrollWindow(PrintConsole* con)
 {
+	// Save the row that is about to scroll off into the history (storing characters rather than tiles,
+	// since glyph cache tiles are reused once they're off the screen), keeping the history view (if any) in place
+	const TilemapEntry* oldRow = &s_tilemap[physRow(con, con->windowY)*con->consoleWidth];
+	for (int x = 0; x < con->consoleWidth; x ++)
+		s_historyRow[x] = ScrollbackCell{ getTileChar(con, GetTilemapEntryTile(oldRow[x])), uint8_t(GetTilemapEntryPalette(oldRow[x])), 0 };
+	scrollbackPush(&s_history, s_historyRow);
+	if (s_viewOffset && s_viewOffset < scrollbackGetNumLines(&s_history))
+		s_viewOffset ++;
+
+	// If the window covers the whole console, scrolling just moves the start of the ring
+	// (the console itself then clears the row that becomes the last one)
+	if (con->windowX == 0 && con->windowY == 0 && con->windowWidth == con->consoleWidth && con->windowHeight == con->consoleHeight)
+	{
+		s_rowOffset = (s_rowOffset + 1) % con->consoleHeight;
+		s_dirty = true;
+		return;
+	}
+
+	// Otherwise, perform the scrolling row by row
 	for (int y = 0; y < con->windowHeight-1; y ++)
+	{
+		unsigned dstRow = physRow(con, con->windowY+y+0);
 		memcpy(
-			&s_tilemap[(con->windowY+y+0)*con->consoleWidth + con->windowX],
-			&s_tilemap[(con->windowY+y+1)*con->consoleWidth + con->windowX],
-			sizeof(uint16_t)*con->windowWidth);
+			&s_tilemap[dstRow*con->consoleWidth + con->windowX],
+			&s_tilemap[physRow(con, con->windowY+y+1)*con->consoleWidth + con->windowX],
+			sizeof(TilemapEntry)*con->windowWidth);
+		s_dirtyRows[dstRow] = true;
+	}
+	s_dirty = true;
+}
+
+void GpuConsole::composeView(PrintConsole* con, TilemapEntry* out)
+{
+	// Lay out the rows in screen order, pulling the ones above the live screen from the history
+	uint32_t firstViewLine = s_history.endLine - s_viewOffset;
+	s_composing = out;
+	for (int y = 0; y < con->consoleHeight; y ++)
+	{
+		uint32_t line = firstViewLine + y;
+		TilemapEntry* dst = &out[y*con->consoleWidth];
+		if ((int32_t)(line - s_history.endLine) >= 0)
+			memcpy(dst, &s_tilemap[physRow(con, line - s_history.endLine)*con->consoleWidth], sizeof(TilemapEntry)*con->consoleWidth);
+		else if (scrollbackGetLine(&s_history, line, s_historyRow))
+		{
+			for (int x = 0; x < con->consoleWidth; x ++)
+				dst[x] = makeCharEntry(con, getTile(con, s_historyRow[x].ch), s_historyRow[x].frontPal);
+		}
+		else
+			memset(dst, 0, sizeof(TilemapEntry)*con->consoleWidth);
+	}
+	s_composing = nullptr;
+}
+
+void GpuConsole::copyTilemap(PrintConsole* con, TilemapEntry* out, GLintptr outOffset)
+{
+	// Only the changed rows are written by the CPU. The others are copied by the GPU from the previous
+	// copy, which is kept from being overwritten until this frame is done. Both write disjoint rows,
+	// so the order in which they land doesn't matter.
+	GLsizeiptr rowSize = sizeof(TilemapEntry)*con->consoleWidth;
+	if (s_lastLiveCopy < 0 || !streamBufferRetain(&s_tilemapStream, s_lastLiveCopy))
+		memcpy(out, s_tilemap, rowSize*con->consoleHeight);
+	else
+	{
+		glStateBindBuffer(GL_COPY_WRITE_BUFFER, s_tilemapStream.buffer);
+		for (int y = 0; y < con->consoleHeight; )
+		{
+			int first = y;
+			bool dirty = s_dirtyRows[y];
+			do
+				y ++;
+			while (y < con->consoleHeight && s_dirtyRows[y] == dirty);
+
+			if (dirty)
+				memcpy(&out[first*con->consoleWidth], &s_tilemap[first*con->consoleWidth], rowSize*(y-first));
+			else
+				glCopyBufferSubData(GL_COPY_WRITE_BUFFER, GL_COPY_WRITE_BUFFER, s_lastLiveCopy + first*rowSize, outOffset + first*rowSize, rowSize*(y-first));
+		}
+	}
+
+	memset(s_dirtyRows, 0, sizeof(bool)*con->consoleHeight);
+	s_lastLiveCopy = outOffset;
+}
+
+void GpuConsole::uploadGlyphs(PrintConsole* con)
+{
+	unsigned numDirty;
+	const uint32_t* dirty = glyphCacheGetDirty(&s_glyphs, &numDirty);
+	if (!numDirty)
+		return;
+
+	// Slots are mostly handed out in order, so upload runs of consecutive slots at once
+	glStateBindTexture(GL_TEXTURE_2D_ARRAY, s_tilesetTex);
+	for (unsigned i = 0; i < numDirty; )
+	{
+		unsigned first = dirty[i], count = 0;
+		do
+			i ++, count ++;
+		while (i < numDirty && dirty[i] == first + count);
+
+		glTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, 0, 0, s_glyphs.firstTile + first, con->font.tileWidth, con->font.tileHeight, count,
+			GL_RED, GL_UNSIGNED_BYTE, glyphCacheGetSlotPixels(&s_glyphs, first));
+	}
+	glyphCacheClearDirty(&s_glyphs);
 }
 
 void GpuConsole::flushAndSwap(PrintConsole* con)
 {
+	// Nothing changed since the last frame: the screen already shows the right contents, so skip
+	// the rendering entirely. Sleep for about a frame instead, so that the caller's loop is still paced.
+	if (!s_dirty)
+	{
+		svcSleepThread(1000000000ULL/60);
+		return;
+	}
+
+	// Write the tilemap to a new slice of the streaming ring, so that the slices the GPU may still be
+	// reading for the previous frames never need to be updated in place. If that fails, everything is
+	// left dirty for the next frame.
+	GLsizeiptr tilemapSize = sizeof(TilemapEntry)*con->consoleWidth*con->consoleHeight;
+	GLintptr tilemapOffset;
+	TilemapEntry* tilemap = (TilemapEntry*)streamBufferAlloc(&s_tilemapStream, tilemapSize, sizeof(TilemapEntry), &tilemapOffset);
+	if (!tilemap)
+		return;
+	if (s_viewOffset)
+	{
+		// The history is being shown: compose the whole screen, laid out without any ring offset
+		composeView(con, tilemap);
+		s_lastLiveCopy = -1;
+	}
+	else
+		copyTilemap(con, tilemap, tilemapOffset);
+
 	// Clear the framebuffer
 	glClearColor(0x10/255.0f, 0x10/255.0f, 0x10/255.0f, 1.0f);
 	glClear(GL_COLOR_BUFFER_BIT);
 
-	// Update tilemap
-	glBindBuffer(GL_ARRAY_BUFFER, s_tilemapVbo);
-	glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(uint16_t)*con->consoleWidth*con->consoleHeight, s_tilemap);
-	glBindBuffer(GL_ARRAY_BUFFER, 0);
+	// Upload any glyphs needed by the tilemap
+	uploadGlyphs(con);
+	glyphCacheEndFrame(&s_glyphs);
+
+	// Update the start of the tilemap ring
+	glStateProgramUniform1i(s_tilemapVsh, s_rowOffsetLoc, s_viewOffset ? 0 : s_rowOffset);
 
-	// Draw the tilemap
-	glBindProgramPipeline(s_tilemapPipeline);
-	glBindVertexArray(s_tilemapVao);
-	glDrawArraysInstanced(GL_TRIANGLES, 0, 6, con->consoleWidth*con->consoleHeight);
-	glBindVertexArray(0);
+	// Draw the tilemap. The bindings are left in place: this is the only thing drawn, so the state
+	// tracker skips rebinding them on the next frames.
+	glStateBindProgramPipeline(s_tilemapPipeline);
+	glStateBindVertexArray(s_tilemapVao);
+	glDrawArraysInstancedBaseInstance(GL_TRIANGLES, 0, 6, con->consoleWidth*con->consoleHeight, tilemapOffset/sizeof(TilemapEntry));
+	streamBufferEndFrame(&s_tilemapStream);
+	s_dirty = false;
 
 	// Swap buffers
 	eglSwapBuffers(s_display, s_surface);
+
+	// Count the GL calls of this frame
+	glStateEndFrame();
+	static uint32_t frameCount;
+	if (++frameCount % 60 == 0)
+		TRACE("GL state calls: %u issued, %u skipped", glStateGetFrameStats().issued, glStateGetFrameStats().skipped);
 }
 
 bool GpuConsole::initEgl()
@@ -460,8 +762,60 @@ void GpuConsole::deinitEgl()
 	}
 }
 
+void GpuConsole::scrollback(int lines)
+{
+	long offset = (long)s_viewOffset + lines;
+	if (offset < 0)
+		offset = 0;
+	if (offset > (long)scrollbackGetNumLines(&s_history))
+		offset = scrollbackGetNumLines(&s_history);
+	if ((unsigned)offset != s_viewOffset)
+	{
+		s_viewOffset = offset;
+		s_dirty = true;
+	}
+}
+
+void GpuConsole::scrollbackReset()
+{
+	if (s_viewOffset)
+	{
+		s_viewOffset = 0;
+		s_dirty = true;
+	}
+}
+
+bool GpuConsole::scrollbackFind(const char* needle)
+{
+	// Look for the closest match above the top of the screen, and bring it to the top of the screen
+	uint32_t line;
+	unsigned col;
+	if (!::scrollbackFind(&s_history, needle, s_history.endLine - s_viewOffset - 1, true, &line, &col))
+		return false;
+
+	s_viewOffset = s_history.endLine - line;
+	s_dirty = true;
+	return true;
+}
+
+static GpuConsole s_gpuConsole;
+
 extern "C" ConsoleRenderer* getDefaultConsoleRenderer(void)
 {
-	static GpuConsole s_gpuConsole;
 	return &s_gpuConsole;
 }
+
+extern "C" void gpuConsoleScrollback(int lines)
+{
+	s_gpuConsole.scrollback(lines);
+}
+
+extern "C" void gpuConsoleScrollbackReset(void)
+{
+	s_gpuConsole.scrollbackReset();
+}
+
+extern "C" bool gpuConsoleScrollbackFind(const char* needle)
+{
+	return s_gpuConsole.scrollbackFind(needle);
+}
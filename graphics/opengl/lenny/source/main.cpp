@@ -15,6 +15,9 @@
 #include <glm/gtc/type_ptr.hpp>
 #include <glm/gtc/matrix_transform.hpp>
 
+#include "gl_state.h"
+#include "shader_cache.h"
+
 // ( ͡° ͜ʖ ͡°) mesh data
 #include "lenny.h"
 
@@ -270,34 +273,8 @@ static const char* const fragmentShaderSource = R"text(
     }
 )text";
 
-static GLuint createAndCompileShader(GLenum type, const char* source)
-{
-    GLint success;
-    GLchar msg[512];
-
-    GLuint handle = glCreateShader(type);
-    if (!handle)
-    {
-        TRACE("%u: cannot create shader", type);
-        return 0;
-    }
-    glShaderSource(handle, 1, &source, nullptr);
-    glCompileShader(handle);
-    glGetShaderiv(handle, GL_COMPILE_STATUS, &success);
-
-    if (success == GL_FALSE)
-    {
-        glGetShaderInfoLog(handle, sizeof(msg), nullptr, msg);
-        TRACE("%u: %s\n", type, msg);
-        glDeleteShader(handle);
-        return 0;
-    }
-
-    return handle;
-}
-
 static GLuint s_program;
-static GLuint s_vao, s_vbo;
+static GLuint s_vao, s_vbo, s_ebo;
 
 static GLint loc_mdlvMtx, loc_projMtx;
 static GLint loc_lightPos, loc_ambient, loc_diffuse, loc_specular;
@@ -306,24 +283,14 @@ static u64 s_startTicks;
 
 static void sceneInit()
 {
-    GLint vsh = createAndCompileShader(GL_VERTEX_SHADER, vertexShaderSource);
-    GLint fsh = createAndCompileShader(GL_FRAGMENT_SHADER, fragmentShaderSource);
-
-    s_program = glCreateProgram();
-    glAttachShader(s_program, vsh);
-    glAttachShader(s_program, fsh);
-    glLinkProgram(s_program);
-
-    GLint success;
-    glGetProgramiv(s_program, GL_LINK_STATUS, &success);
-    if (success == GL_FALSE)
+    // Build the program, or load it from the shader cache
+    static const ShaderStage stages[] =
     {
-        char buf[512];
-        glGetProgramInfoLog(s_program, sizeof(buf), nullptr, buf);
-        TRACE("Link error: %s", buf);
-    }
-    glDeleteShader(vsh);
-    glDeleteShader(fsh);
+        { GL_VERTEX_SHADER,   vertexShaderSource },
+        { GL_FRAGMENT_SHADER, fragmentShaderSource },
+    };
+    s_program = shaderCacheBuildProgram(stages, 2, nullptr, false);
+    TRACE("Shader cache: %u hits, %u misses, %u rejected", shaderCacheGetStats().hits, shaderCacheGetStats().misses, shaderCacheGetStats().rejected);
 
     loc_mdlvMtx = glGetUniformLocation(s_program, "mdlvMtx");
     loc_projMtx = glGetUniformLocation(s_program, "projMtx");
@@ -337,33 +304,39 @@ static void sceneInit()
 
     glGenVertexArrays(1, &s_vao);
     glGenBuffers(1, &s_vbo);
+    glGenBuffers(1, &s_ebo);
     // bind the Vertex Array Object first, then bind and set vertex buffer(s), and then configure vertex attributes(s).
-    glBindVertexArray(s_vao);
+    glStateBindVertexArray(s_vao);
 
-    glBindBuffer(GL_ARRAY_BUFFER, s_vbo);
+    glStateBindBuffer(GL_ARRAY_BUFFER, s_vbo);
     glBufferData(GL_ARRAY_BUFFER, sizeof(lennyVertices), lennyVertices, GL_STATIC_DRAW);
 
     glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(lennyVertex), (void*)offsetof(lennyVertex, x));
     glEnableVertexAttribArray(0);
 
-    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(lennyVertex), (void*)offsetof(lennyVertex, nx));
+    // The normals are packed into 10 bits per component
+    glVertexAttribPointer(1, 4, GL_INT_2_10_10_10_REV, GL_TRUE, sizeof(lennyVertex), (void*)offsetof(lennyVertex, normal));
     glEnableVertexAttribArray(1);
 
+    // The element buffer binding is part of the VAO state, so it stays bound for drawing
+    glStateBindBuffer(GL_ELEMENT_ARRAY_BUFFER, s_ebo);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(lennyIndices), lennyIndices, GL_STATIC_DRAW);
+
     // note that this is allowed, the call to glVertexAttribPointer registered VBO as the vertex attribute's bound vertex buffer object so afterwards we can safely unbind
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glStateBindBuffer(GL_ARRAY_BUFFER, 0);
 
     // You can unbind the VAO afterwards so other VAO calls won't accidentally modify this VAO, but this rarely happens. Modifying other
     // VAOs requires a call to glBindVertexArray anyways so we generally don't unbind VAOs (nor VBOs) when it's not directly necessary.
-    glBindVertexArray(0);
+    glStateBindVertexArray(0);
 
     // Uniforms
-    glUseProgram(s_program);
+    glStateUseProgram(s_program);
     auto projMtx = glm::perspective(40.0f*TAU/360.0f, 1280.0f/720.0f, 0.01f, 1000.0f);
-    glUniformMatrix4fv(loc_projMtx, 1, GL_FALSE, glm::value_ptr(projMtx));
-    glUniform4f(loc_lightPos, 0.0f, 0.0f, -0.5f, 1.0f);
-    glUniform3f(loc_ambient, 0.1f, 0.1f, 0.1f);
-    glUniform3f(loc_diffuse, 0.4f, 0.4f, 0.4f);
-    glUniform4f(loc_specular, 0.5f, 0.5f, 0.5f, 20.0f);
+    glStateUniformMatrix4fv(loc_projMtx, 1, GL_FALSE, glm::value_ptr(projMtx));
+    glStateUniform4f(loc_lightPos, 0.0f, 0.0f, -0.5f, 1.0f);
+    glStateUniform3f(loc_ambient, 0.1f, 0.1f, 0.1f);
+    glStateUniform3f(loc_diffuse, 0.4f, 0.4f, 0.4f);
+    glStateUniform4f(loc_specular, 0.5f, 0.5f, 0.5f, 20.0f);
     s_startTicks = armGetSystemTick();
 }
 
@@ -379,7 +352,7 @@ static void sceneUpdate()
     mdlvMtx = glm::translate(mdlvMtx, glm::vec3{0.0f, 0.0f, -3.0f});
     mdlvMtx = glm::rotate(mdlvMtx, getTime() * TAU * 0.234375f, glm::vec3{0.0f, 1.0f, 0.0f});
     mdlvMtx = glm::scale(mdlvMtx, glm::vec3{2.0f});
-    glUniformMatrix4fv(loc_mdlvMtx, 1, GL_FALSE, glm::value_ptr(mdlvMtx));
+    glStateUniformMatrix4fv(loc_mdlvMtx, 1, GL_FALSE, glm::value_ptr(mdlvMtx));
 }
 
 static void sceneRender()
@@ -388,15 +361,16 @@ static void sceneRender()
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
     // draw our ( ͡° ͜ʖ ͡°)
-    glBindVertexArray(s_vao); // seeing as we only have a single VAO there's no need to bind it every time, but we'll do so to keep things a bit more organized
-    glDrawArrays(GL_TRIANGLES, 0, lennyVerticesCount);
+    glStateBindVertexArray(s_vao); // the state tracker skips this while the VAO is still bound, so there's no harm in binding it every time
+    glDrawElements(GL_TRIANGLES, lennyLods[0].indexCount, GL_UNSIGNED_SHORT, nullptr);
 }
 
 static void sceneExit()
 {
-    glDeleteBuffers(1, &s_vbo);
-    glDeleteVertexArrays(1, &s_vao);
-    glDeleteProgram(s_program);
+    glStateDeleteBuffers(1, &s_ebo);
+    glStateDeleteBuffers(1, &s_vbo);
+    glStateDeleteVertexArrays(1, &s_vao);
+    glStateDeleteProgram(s_program);
 }
 
 int main(int argc, char* argv[])
@@ -422,6 +396,7 @@ int main(int argc, char* argv[])
     padInitializeDefault(&pad);
 
     // Main graphics loop
+    u32 frameCount = 0;
     while (appletMainLoop())
     {
         // Get and process input
@@ -436,6 +411,11 @@ int main(int argc, char* argv[])
         // Render stuff!
         sceneRender();
         eglSwapBuffers(s_display, s_surface);
+
+        // Count the GL calls of this frame, reporting them about once per second
+        glStateEndFrame();
+        if (++frameCount % 60 == 0)
+            TRACE("GL state calls: %u issued, %u skipped", glStateGetFrameStats().issued, glStateGetFrameStats().skipped);
     }
 
     // Deinitialize our scene
@@ -7,6 +7,9 @@
 #include <EGL/eglext.h> // EGL extensions
 #include <glad/glad.h>  // glad library (OpenGL loader)
 
+#include "gl_state.h"
+#include "shader_cache.h"
+
 //-----------------------------------------------------------------------------
 // nxlink support
 //-----------------------------------------------------------------------------
@@ -207,55 +210,19 @@ static const char* const fragmentShaderSource = R"text(
     }
 )text";
 
-static GLuint createAndCompileShader(GLenum type, const char* source)
-{
-    GLint success;
-    GLchar msg[512];
-
-    GLuint handle = glCreateShader(type);
-    if (!handle)
-    {
-        TRACE("%u: cannot create shader", type);
-        return 0;
-    }
-    glShaderSource(handle, 1, &source, nullptr);
-    glCompileShader(handle);
-    glGetShaderiv(handle, GL_COMPILE_STATUS, &success);
-
-    if (!success)
-    {
-        glGetShaderInfoLog(handle, sizeof(msg), nullptr, msg);
-        TRACE("%u: %s\n", type, msg);
-        glDeleteShader(handle);
-        return 0;
-    }
-
-    return handle;
-}
-
 static GLuint s_program;
 static GLuint s_vao, s_vbo;
 
 static void sceneInit()
 {
-    GLint vsh = createAndCompileShader(GL_VERTEX_SHADER, vertexShaderSource);
-    GLint fsh = createAndCompileShader(GL_FRAGMENT_SHADER, fragmentShaderSource);
-
-    s_program = glCreateProgram();
-    glAttachShader(s_program, vsh);
-    glAttachShader(s_program, fsh);
-    glLinkProgram(s_program);
-
-    GLint success;
-    glGetProgramiv(s_program, GL_LINK_STATUS, &success);
-    if (!success)
+    // Build the program, or load it from the shader cache
+    static const ShaderStage stages[] =
     {
-        char buf[512];
-        glGetProgramInfoLog(s_program, sizeof(buf), nullptr, buf);
-        TRACE("Link error: %s", buf);
-    }
-    glDeleteShader(vsh);
-    glDeleteShader(fsh);
+        { GL_VERTEX_SHADER,   vertexShaderSource },
+        { GL_FRAGMENT_SHADER, fragmentShaderSource },
+    };
+    s_program = shaderCacheBuildProgram(stages, 2, nullptr, false);
+    TRACE("Shader cache: %u hits, %u misses, %u rejected", shaderCacheGetStats().hits, shaderCacheGetStats().misses, shaderCacheGetStats().rejected);
 
     struct Vertex
     {
@@ -273,9 +240,9 @@ static void sceneInit()
     glGenVertexArrays(1, &s_vao);
     glGenBuffers(1, &s_vbo);
     // bind the Vertex Array Object first, then bind and set vertex buffer(s), and then configure vertex attributes(s).
-    glBindVertexArray(s_vao);
+    glStateBindVertexArray(s_vao);
 
-    glBindBuffer(GL_ARRAY_BUFFER, s_vbo);
+    glStateBindBuffer(GL_ARRAY_BUFFER, s_vbo);
     glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
 
     glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, position));
@@ -285,11 +252,11 @@ static void sceneInit()
     glEnableVertexAttribArray(1);
 
     // note that this is allowed, the call to glVertexAttribPointer registered VBO as the vertex attribute's bound vertex buffer object so afterwards we can safely unbind
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glStateBindBuffer(GL_ARRAY_BUFFER, 0);
 
     // You can unbind the VAO afterwards so other VAO calls won't accidentally modify this VAO, but this rarely happens. Modifying other
     // VAOs requires a call to glBindVertexArray anyways so we generally don't unbind VAOs (nor VBOs) when it's not directly necessary.
-    glBindVertexArray(0);
+    glStateBindVertexArray(0);
 }
 
 static void sceneRender()
@@ -298,16 +265,16 @@ static void sceneRender()
     glClear(GL_COLOR_BUFFER_BIT);
 
     // draw our first triangle
-    glUseProgram(s_program);
-    glBindVertexArray(s_vao); // seeing as we only have a single VAO there's no need to bind it every time, but we'll do so to keep things a bit more organized
+    glStateUseProgram(s_program);
+    glStateBindVertexArray(s_vao); // the state tracker skips this while the VAO is still bound, so there's no harm in binding it every time
     glDrawArrays(GL_TRIANGLES, 0, 3);
 }
 
 static void sceneExit()
 {
-    glDeleteBuffers(1, &s_vbo);
-    glDeleteVertexArrays(1, &s_vao);
-    glDeleteProgram(s_program);
+    glStateDeleteBuffers(1, &s_vbo);
+    glStateDeleteVertexArrays(1, &s_vao);
+    glStateDeleteProgram(s_program);
 }
 
 int main(int argc, char* argv[])
@@ -333,6 +300,7 @@ int main(int argc, char* argv[])
     padInitializeDefault(&pad);
 
     // Main graphics loop
+    u32 frameCount = 0;
     while (appletMainLoop())
     {
         // Get and process input
@@ -344,6 +312,11 @@ int main(int argc, char* argv[])
         // Render stuff!
         sceneRender();
         eglSwapBuffers(s_display, s_surface);
+
+        // Count the GL calls of this frame, reporting them about once per second
+        glStateEndFrame();
+        if (++frameCount % 60 == 0)
+            TRACE("GL state calls: %u issued, %u skipped", glStateGetFrameStats().issued, glStateGetFrameStats().skipped);
     }
 
     // Deinitialize our scene
@@ -15,7 +15,9 @@
 #include <glm/gtc/type_ptr.hpp>
 #include <glm/gtc/matrix_transform.hpp>
 
-#include "stb_image.h"
+#include "gl_state.h"
+#include "shader_cache.h"
+#include "texture_loader.h"
 #include "devkitlenny_png.h"
 
 constexpr auto TAU = glm::two_pi<float>();
@@ -276,32 +278,6 @@ static const char* const fragmentShaderSource = R"text(
     }
 )text";
 
-static GLuint createAndCompileShader(GLenum type, const char* source)
-{
-    GLint success;
-    GLchar msg[512];
-
-    GLuint handle = glCreateShader(type);
-    if (!handle)
-    {
-        TRACE("%u: cannot create shader", type);
-        return 0;
-    }
-    glShaderSource(handle, 1, &source, nullptr);
-    glCompileShader(handle);
-    glGetShaderiv(handle, GL_COMPILE_STATUS, &success);
-
-    if (success == GL_FALSE)
-    {
-        glGetShaderInfoLog(handle, sizeof(msg), nullptr, msg);
-        TRACE("%u: %s\n", type, msg);
-        glDeleteShader(handle);
-        return 0;
-    }
-
-    return handle;
-}
-
 typedef struct
 {
     float position[3];
@@ -385,24 +361,14 @@ static u64 s_startTicks;
 
 static void sceneInit()
 {
-    GLint vsh = createAndCompileShader(GL_VERTEX_SHADER, vertexShaderSource);
-    GLint fsh = createAndCompileShader(GL_FRAGMENT_SHADER, fragmentShaderSource);
-
-    s_program = glCreateProgram();
-    glAttachShader(s_program, vsh);
-    glAttachShader(s_program, fsh);
-    glLinkProgram(s_program);
-
-    GLint success;
-    glGetProgramiv(s_program, GL_LINK_STATUS, &success);
-    if (success == GL_FALSE)
+    // Build the program, or load it from the shader cache
+    static const ShaderStage stages[] =
     {
-        char buf[512];
-        glGetProgramInfoLog(s_program, sizeof(buf), nullptr, buf);
-        TRACE("Link error: %s", buf);
-    }
-    glDeleteShader(vsh);
-    glDeleteShader(fsh);
+        { GL_VERTEX_SHADER,   vertexShaderSource },
+        { GL_FRAGMENT_SHADER, fragmentShaderSource },
+    };
+    s_program = shaderCacheBuildProgram(stages, 2, nullptr, false);
+    TRACE("Shader cache: %u hits, %u misses, %u rejected", shaderCacheGetStats().hits, shaderCacheGetStats().misses, shaderCacheGetStats().rejected);
 
     loc_mdlvMtx = glGetUniformLocation(s_program, "mdlvMtx");
     loc_projMtx = glGetUniformLocation(s_program, "projMtx");
@@ -418,9 +384,9 @@ static void sceneInit()
     glGenVertexArrays(1, &s_vao);
     glGenBuffers(1, &s_vbo);
     // bind the Vertex Array Object first, then bind and set vertex buffer(s), and then configure vertex attributes(s).
-    glBindVertexArray(s_vao);
+    glStateBindVertexArray(s_vao);
 
-    glBindBuffer(GL_ARRAY_BUFFER, s_vbo);
+    glStateBindBuffer(GL_ARRAY_BUFFER, s_vbo);
     glBufferData(GL_ARRAY_BUFFER, sizeof(vertex_list), vertex_list, GL_STATIC_DRAW);
 
     glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, position));
@@ -433,36 +399,33 @@ static void sceneInit()
     glEnableVertexAttribArray(2);
 
     // note that this is allowed, the call to glVertexAttribPointer registered VBO as the vertex attribute's bound vertex buffer object so afterwards we can safely unbind
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glStateBindBuffer(GL_ARRAY_BUFFER, 0);
 
     // You can unbind the VAO afterwards so other VAO calls won't accidentally modify this VAO, but this rarely happens. Modifying other
     // VAOs requires a call to glBindVertexArray anyways so we generally don't unbind VAOs (nor VBOs) when it's not directly necessary.
-    glBindVertexArray(0);
+    glStateBindVertexArray(0);
 
     // Textures
-    glGenTextures(1, &s_tex);
-    glActiveTexture(GL_TEXTURE0); // activate the texture unit first before binding texture
-    glBindTexture(GL_TEXTURE_2D, s_tex);
+    // The image is decoded in the background, the cube is drawn with a placeholder until it's ready.
+    // The texture loader takes care of the minification filter, which depends on whether the mipmaps exist yet.
+    if (!texLoaderInit())
+        TRACE("Cannot start the decoding threads, decoding on the main thread");
+    s_tex = texLoaderLoad(devkitlenny_png, devkitlenny_png_size, true);
+    glStateActiveTexture(GL_TEXTURE0); // activate the texture unit first before binding texture
+    glStateBindTexture(GL_TEXTURE_2D, s_tex);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
 
-    int width, height, nchan;
-    stbi_set_flip_vertically_on_load(true);
-    stbi_uc* img = stbi_load_from_memory((const stbi_uc*)devkitlenny_png, devkitlenny_png_size, &width, &height, &nchan, 4);
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, img);
-    stbi_image_free(img);
-
     // Uniforms
-    glUseProgram(s_program);
+    glStateUseProgram(s_program);
     auto projMtx = glm::perspective(40.0f*TAU/360.0f, 1280.0f/720.0f, 0.01f, 1000.0f);
-    glUniformMatrix4fv(loc_projMtx, 1, GL_FALSE, glm::value_ptr(projMtx));
-    glUniform4f(loc_lightPos, 0.0f, 0.0f, 0.5f, 1.0f);
-    glUniform3f(loc_ambient, 0.1f, 0.1f, 0.1f);
-    glUniform3f(loc_diffuse, 0.4f, 0.4f, 0.4f);
-    glUniform4f(loc_specular, 0.5f, 0.5f, 0.5f, 20.0f);
-    glUniform1i(loc_tex_diffuse, 0); // texunit 0
+    glStateUniformMatrix4fv(loc_projMtx, 1, GL_FALSE, glm::value_ptr(projMtx));
+    glStateUniform4f(loc_lightPos, 0.0f, 0.0f, 0.5f, 1.0f);
+    glStateUniform3f(loc_ambient, 0.1f, 0.1f, 0.1f);
+    glStateUniform3f(loc_diffuse, 0.4f, 0.4f, 0.4f);
+    glStateUniform4f(loc_specular, 0.5f, 0.5f, 0.5f, 20.0f);
+    glStateUniform1i(loc_tex_diffuse, 0); // texunit 0
     s_startTicks = armGetSystemTick();
 }
 
@@ -478,7 +441,7 @@ static void sceneUpdate()
     mdlvMtx = glm::translate(mdlvMtx, glm::vec3{0.0f, 0.0f, -3.0f});
     mdlvMtx = glm::rotate(mdlvMtx, getTime() * TAU * 0.234375f, glm::vec3{1.0f, 0.0f, 0.0f});
     mdlvMtx = glm::rotate(mdlvMtx, getTime() * TAU * 0.234375f / 2.0f, glm::vec3{0.0f, 1.0f, 0.0f});
-    glUniformMatrix4fv(loc_mdlvMtx, 1, GL_FALSE, glm::value_ptr(mdlvMtx));
+    glStateUniformMatrix4fv(loc_mdlvMtx, 1, GL_FALSE, glm::value_ptr(mdlvMtx));
 }
 
 static void sceneRender()
@@ -486,17 +449,19 @@ static void sceneRender()
     glClearColor(0x68/255.0f, 0xB0/255.0f, 0xD8/255.0f, 1.0f);
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
-    // draw our textured cube
-    glBindVertexArray(s_vao); // seeing as we only have a single VAO there's no need to bind it every time, but we'll do so to keep things a bit more organized
+    // draw our textured cube (the texture loader may have bound another texture in the meantime)
+    glStateBindTexture(GL_TEXTURE_2D, s_tex);
+    glStateBindVertexArray(s_vao); // the state tracker skips this while the VAO is still bound, so there's no harm in binding it every time
     glDrawArrays(GL_TRIANGLES, 0, vertex_list_count);
 }
 
 static void sceneExit()
 {
-    glDeleteTextures(1, &s_tex);
-    glDeleteBuffers(1, &s_vbo);
-    glDeleteVertexArrays(1, &s_vao);
-    glDeleteProgram(s_program);
+    texLoaderExit();
+    glStateDeleteTextures(1, &s_tex);
+    glStateDeleteBuffers(1, &s_vbo);
+    glStateDeleteVertexArrays(1, &s_vao);
+    glStateDeleteProgram(s_program);
 }
 
 int main(int argc, char* argv[])
@@ -522,6 +487,7 @@ int main(int argc, char* argv[])
     padInitializeDefault(&pad);
 
     // Main graphics loop
+    u32 frameCount = 0;
     while (appletMainLoop())
     {
         // Get and process input
@@ -530,12 +496,20 @@ int main(int argc, char* argv[])
         if (kDown & HidNpadButton_Plus)
             break;
 
+        // Upload the textures that finished loading
+        texLoaderUpdate();
+
         // Update our scene
         sceneUpdate();
 
         // Render stuff!
         sceneRender();
         eglSwapBuffers(s_display, s_surface);
+
+        // Count the GL calls of this frame, reporting them about once per second
+        glStateEndFrame();
+        if (++frameCount % 60 == 0)
+            TRACE("GL state calls: %u issued, %u skipped", glStateGetFrameStats().issued, glStateGetFrameStats().skipped);
     }
 
     // Deinitialize our scene
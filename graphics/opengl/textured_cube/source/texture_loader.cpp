@@ -0,0 +1,324 @@
+#include <stdlib.h>
+#include <string.h>
+#include <switch.h>
+
+#include "texture_loader.h"
+#include "gl_state.h"
+#include "stb_image.h"
+
+// Number of decoding threads (each on its own core, away from the main thread on core 0)
+constexpr unsigned NUMWORKERS = 2;
+
+// Number of pixel unpack buffers, i.e. uploads the GPU may still be reading from
+constexpr unsigned NUMUPLOADBUFFERS = 4;
+
+// Amount of pixel data uploaded per call to texLoaderUpdate (at least one image is always uploaded)
+constexpr size_t UPLOADBUDGET = 8*1024*1024;
+
+struct LoadJob
+{
+    LoadJob* next;
+    GLuint tex;
+    const void* data;
+    size_t size;
+    bool flip;
+
+    // Filled in by the worker
+    int width, height;
+    stbi_uc* pixels;
+};
+
+struct LoadQueue
+{
+    LoadJob* head;
+    LoadJob* tail;
+};
+
+struct UploadBuffer
+{
+    GLuint pbo;
+    GLsizeiptr size;
+    GLsync fence;
+};
+
+static Thread s_workers[NUMWORKERS];
+static unsigned s_numWorkers;
+static Mutex s_mutex;
+static CondVar s_cond;
+static bool s_quit;
+
+// Both queues are protected by s_mutex
+static LoadQueue s_decodeQueue;
+static LoadQueue s_uploadQueue;
+
+static UploadBuffer s_uploadBuffers[NUMUPLOADBUFFERS];
+static unsigned s_nextUploadBuffer;
+static unsigned s_numPending;
+
+static void queuePush(LoadQueue* queue, LoadJob* job)
+{
+    job->next = nullptr;
+    if (queue->tail)
+        queue->tail->next = job;
+    else
+        queue->head = job;
+    queue->tail = job;
+}
+
+static LoadJob* queuePop(LoadQueue* queue)
+{
+    LoadJob* job = queue->head;
+    if (job)
+    {
+        queue->head = job->next;
+        if (!queue->head)
+            queue->tail = nullptr;
+    }
+    return job;
+}
+
+static void freeJob(LoadJob* job)
+{
+    if (job->pixels)
+        stbi_image_free(job->pixels);
+    free(job);
+}
+
+static void decodeJob(LoadJob* job)
+{
+    // Decoding failures leave pixels null, in which case the placeholder is kept
+    int nchan;
+    job->pixels = stbi_load_from_memory((const stbi_uc*)job->data, job->size, &job->width, &job->height, &nchan, 4);
+}
+
+static void workerMain(void* arg)
+{
+    mutexLock(&s_mutex);
+    for (;;)
+    {
+        while (!s_decodeQueue.head && !s_quit)
+            condvarWait(&s_cond, &s_mutex);
+        if (s_quit)
+            break;
+
+        LoadJob* job = queuePop(&s_decodeQueue);
+        mutexUnlock(&s_mutex);
+
+        decodeJob(job);
+
+        mutexLock(&s_mutex);
+        queuePush(&s_uploadQueue, job);
+    }
+    mutexUnlock(&s_mutex);
+}
+
+bool texLoaderInit()
+{
+    mutexInit(&s_mutex);
+    condvarInit(&s_cond);
+    s_quit = false;
+
+    for (unsigned i = 0; i < NUMUPLOADBUFFERS; i ++)
+    {
+        glGenBuffers(1, &s_uploadBuffers[i].pbo);
+        s_uploadBuffers[i].size = 0;
+        s_uploadBuffers[i].fence = nullptr;
+    }
+    s_nextUploadBuffer = 0;
+
+    for (s_numWorkers = 0; s_numWorkers < NUMWORKERS; s_numWorkers ++)
+    {
+        Thread* t = &s_workers[s_numWorkers];
+        if (R_FAILED(threadCreate(t, workerMain, nullptr, nullptr, 0x10000, 0x2C, 1 + s_numWorkers)))
+            break;
+        if (R_FAILED(threadStart(t)))
+        {
+            threadClose(t);
+            break;
+        }
+    }
+
+    return s_numWorkers != 0;
+}
+
+void texLoaderExit()
+{
+    mutexLock(&s_mutex);
+    s_quit = true;
+    condvarWakeAll(&s_cond);
+    mutexUnlock(&s_mutex);
+
+    for (unsigned i = 0; i < s_numWorkers; i ++)
+    {
+        threadWaitForExit(&s_workers[i]);
+        threadClose(&s_workers[i]);
+    }
+    s_numWorkers = 0;
+
+    // The textures themselves belong to the caller
+    LoadJob* job;
+    while ((job = queuePop(&s_decodeQueue)))
+        freeJob(job);
+    while ((job = queuePop(&s_uploadQueue)))
+        freeJob(job);
+    s_numPending = 0;
+
+    for (unsigned i = 0; i < NUMUPLOADBUFFERS; i ++)
+    {
+        if (s_uploadBuffers[i].fence)
+            glDeleteSync(s_uploadBuffers[i].fence);
+        glStateDeleteBuffers(1, &s_uploadBuffers[i].pbo);
+        s_uploadBuffers[i] = UploadBuffer{};
+    }
+}
+
+GLuint texLoaderLoad(const void* data, size_t size, bool flipVertically)
+{
+    LoadJob* job = (LoadJob*)calloc(1, sizeof(LoadJob));
+    if (!job)
+        return 0;
+
+    job->data = data;
+    job->size = size;
+    job->flip = flipVertically;
+
+    // Create the texture with a placeholder image
+    static const uint32_t placeholder = 0xFF808080;
+    glGenTextures(1, &job->tex);
+    glStateBindTexture(GL_TEXTURE_2D, job->tex);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, &placeholder);
+
+    GLuint tex = job->tex;
+    s_numPending ++;
+
+    // Without workers, decode right away; the upload still happens in texLoaderUpdate
+    if (!s_numWorkers)
+    {
+        decodeJob(job);
+        mutexLock(&s_mutex);
+        queuePush(&s_uploadQueue, job);
+        mutexUnlock(&s_mutex);
+        return tex;
+    }
+
+    mutexLock(&s_mutex);
+    queuePush(&s_decodeQueue, job);
+    condvarWakeOne(&s_cond);
+    mutexUnlock(&s_mutex);
+
+    return tex;
+}
+
+// Flips an image upside down in place
+static void flipRows(uint8_t* pixels, size_t stride, int height)
+{
+    for (int y = 0; y < height/2; y ++)
+    {
+        uint8_t* a = pixels + y*stride;
+        uint8_t* b = pixels + (height-1-y)*stride;
+        for (size_t x = 0; x < stride; x ++)
+        {
+            uint8_t tmp = a[x];
+            a[x] = b[x];
+            b[x] = tmp;
+        }
+    }
+}
+
+static bool uploadJob(LoadJob* job)
+{
+    size_t stride = job->width*4;
+    GLsizeiptr bytes = stride*job->height;
+
+    // Take the next buffer of the ring, unless the GPU is still reading from it
+    UploadBuffer* buf = &s_uploadBuffers[s_nextUploadBuffer];
+    if (buf->fence)
+    {
+        if (glClientWaitSync(buf->fence, 0, 0) == GL_TIMEOUT_EXPIRED)
+            return false;
+        glDeleteSync(buf->fence);
+        buf->fence = nullptr;
+    }
+
+    glStateBindBuffer(GL_PIXEL_UNPACK_BUFFER, buf->pbo);
+    if (buf->size < bytes)
+    {
+        glBufferData(GL_PIXEL_UNPACK_BUFFER, bytes, nullptr, GL_STREAM_DRAW);
+        buf->size = bytes;
+    }
+
+    // Copy the image, flipping it on the way if requested
+    const void* src = nullptr; // offset of the image in the unpack buffer
+    uint8_t* dst = (uint8_t*)glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, bytes, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT);
+    if (dst)
+    {
+        if (!job->flip)
+            memcpy(dst, job->pixels, bytes);
+        else for (int y = 0; y < job->height; y ++)
+            memcpy(dst + y*stride, job->pixels + (job->height-1-y)*stride, stride);
+        glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+    }
+    else
+    {
+        // The buffer can't be mapped: upload straight from the decoded image instead, which the
+        // driver copies before glTexImage2D returns
+        glStateBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+        if (job->flip)
+            flipRows(job->pixels, stride, job->height);
+        src = job->pixels;
+    }
+
+    glStateBindTexture(GL_TEXTURE_2D, job->tex);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, job->width, job->height, 0, GL_RGBA, GL_UNSIGNED_BYTE, src);
+    glGenerateMipmap(GL_TEXTURE_2D);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+
+    if (dst)
+    {
+        buf->fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        s_nextUploadBuffer = (s_nextUploadBuffer + 1) % NUMUPLOADBUFFERS;
+    }
+
+    glStateBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    return true;
+}
+
+void texLoaderUpdate()
+{
+    size_t uploaded = 0;
+
+    for (;;)
+    {
+        // Only this thread removes jobs from the upload queue, so it's fine to peek at its head
+        mutexLock(&s_mutex);
+        LoadJob* job = s_uploadQueue.head;
+        mutexUnlock(&s_mutex);
+        if (!job)
+            break;
+
+        if (job->pixels)
+        {
+            size_t bytes = job->width*job->height*4;
+            if (uploaded && uploaded + bytes > UPLOADBUDGET)
+                break;
+
+            if (!uploadJob(job))
+                break;
+            uploaded += bytes;
+        }
+
+        mutexLock(&s_mutex);
+        queuePop(&s_uploadQueue);
+        mutexUnlock(&s_mutex);
+
+        freeJob(job);
+        s_numPending --;
+    }
+}
+
+unsigned texLoaderGetPending()
+{
+    return s_numPending;
+}
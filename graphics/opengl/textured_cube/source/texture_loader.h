@@ -0,0 +1,26 @@
+#pragma once
+#include <stddef.h>
+#include <glad/glad.h>
+
+// Asynchronous texture loader.
+// Images are decoded by worker threads, then uploaded by the GL thread through a ring of pixel
+// unpack buffers, so that loading any number of textures never blocks the calling thread.
+// Textures can be used right away: they show a 1x1 placeholder until their image has been
+// uploaded, at which point mipmaps are generated and the minification filter is set to use them.
+// Textures and buffers are bound through the GL state tracker (gl_state.h), on the active texture
+// unit, so the caller should bind its textures with glStateBindTexture before drawing.
+
+// Returns false if no decoding thread could be started. The loader still works then, but
+// texLoaderLoad decodes each image itself before returning.
+bool texLoaderInit();
+void texLoaderExit();
+
+// Queues an encoded image for loading, returning the texture it will be loaded into.
+// The data must stay valid until the texture has finished loading.
+GLuint texLoaderLoad(const void* data, size_t size, bool flipVertically);
+
+// Uploads the images that finished decoding. Must be called regularly (e.g. once per frame) by the GL thread.
+void texLoaderUpdate();
+
+// Returns the number of textures that are still being decoded or uploaded
+unsigned texLoaderGetPending();
@@ -0,0 +1,91 @@
+// The parts of the GL API used by the texture loader and the GL state tracker, declared as plain
+// functions so that a host tool can implement them (see texture_loader_check.cpp).
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef unsigned int GLenum;
+typedef unsigned int GLuint;
+typedef int GLint;
+typedef int GLsizei;
+typedef unsigned char GLboolean;
+typedef unsigned int GLbitfield;
+typedef float GLfloat;
+typedef intptr_t GLintptr;
+typedef intptr_t GLsizeiptr;
+typedef uint64_t GLuint64;
+typedef struct __GLsync* GLsync;
+
+#define GL_FALSE                       0
+#define GL_TRUE                        1
+#define GL_UNSIGNED_BYTE               0x1401
+#define GL_RGBA                        0x1908
+#define GL_RGBA8                       0x8058
+#define GL_UNPACK_ALIGNMENT            0x0CF5
+#define GL_TEXTURE_2D                  0x0DE1
+#define GL_TEXTURE_3D                  0x806F
+#define GL_TEXTURE_CUBE_MAP            0x8513
+#define GL_TEXTURE_2D_ARRAY            0x8C1A
+#define GL_TEXTURE0                    0x84C0
+#define GL_TEXTURE_MIN_FILTER          0x2801
+#define GL_LINEAR                      0x2601
+#define GL_LINEAR_MIPMAP_LINEAR        0x2703
+#define GL_ARRAY_BUFFER                0x8892
+#define GL_ELEMENT_ARRAY_BUFFER        0x8893
+#define GL_PIXEL_PACK_BUFFER           0x88EB
+#define GL_PIXEL_UNPACK_BUFFER         0x88EC
+#define GL_UNIFORM_BUFFER              0x8A11
+#define GL_COPY_READ_BUFFER            0x8F36
+#define GL_COPY_WRITE_BUFFER           0x8F37
+#define GL_DRAW_INDIRECT_BUFFER        0x8F3F
+#define GL_STREAM_DRAW                 0x88E0
+#define GL_MAP_WRITE_BIT               0x0002
+#define GL_MAP_INVALIDATE_RANGE_BIT    0x0004
+#define GL_SYNC_GPU_COMMANDS_COMPLETE  0x9117
+#define GL_ALREADY_SIGNALED            0x911A
+#define GL_TIMEOUT_EXPIRED             0x911B
+#define GL_CONDITION_SATISFIED         0x911C
+
+// Objects
+void glGenTextures(GLsizei n, GLuint* textures);
+void glDeleteTextures(GLsizei n, const GLuint* textures);
+void glGenBuffers(GLsizei n, GLuint* buffers);
+void glDeleteBuffers(GLsizei n, const GLuint* buffers);
+void glDeleteVertexArrays(GLsizei n, const GLuint* arrays);
+void glDeleteProgramPipelines(GLsizei n, const GLuint* pipelines);
+void glDeleteProgram(GLuint program);
+
+// Bindings
+void glActiveTexture(GLenum texture);
+void glBindTexture(GLenum target, GLuint texture);
+void glBindBuffer(GLenum target, GLuint buffer);
+void glBindVertexArray(GLuint array);
+void glBindProgramPipeline(GLuint pipeline);
+void glUseProgram(GLuint program);
+
+// Uniforms
+void glUniform1i(GLint location, GLint v0);
+void glUniform1f(GLint location, GLfloat v0);
+void glUniform2f(GLint location, GLfloat v0, GLfloat v1);
+void glUniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2);
+void glUniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3);
+void glUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat* value);
+void glProgramUniform1i(GLuint program, GLint location, GLint v0);
+void glProgramUniform2i(GLuint program, GLint location, GLint v0, GLint v1);
+
+// Textures
+void glTexParameteri(GLenum target, GLenum pname, GLint param);
+void glPixelStorei(GLenum pname, GLint param);
+void glTexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void* pixels);
+void glGenerateMipmap(GLenum target);
+
+// Buffers
+void glBufferData(GLenum target, GLsizeiptr size, const void* data, GLenum usage);
+void* glMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access);
+GLboolean glUnmapBuffer(GLenum target);
+
+// Sync objects
+GLsync glFenceSync(GLenum condition, GLbitfield flags);
+GLenum glClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout);
+void glDeleteSync(GLsync sync);
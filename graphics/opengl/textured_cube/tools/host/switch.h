@@ -0,0 +1,62 @@
+// Just enough of libnx for the texture loader to build on the host: types, and threads, mutexes
+// and condition variables implemented with pthreads (threads ignore their priority and core).
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <pthread.h>
+
+typedef uint8_t u8;
+typedef uint16_t u16;
+typedef uint32_t u32;
+typedef uint64_t u64;
+typedef int32_t s32;
+
+typedef u32 Result;
+#define R_FAILED(rc) ((rc) != 0)
+
+// When set, threadCreate fails, as it does on the Switch when the requested core isn't available
+inline bool hostFailThreads;
+
+typedef void (*ThreadFunc)(void*);
+
+typedef struct
+{
+    pthread_t handle;
+    ThreadFunc entry;
+    void* arg;
+} Thread;
+
+typedef pthread_mutex_t Mutex;
+typedef pthread_cond_t CondVar;
+
+static inline void mutexInit(Mutex* m)   { pthread_mutex_init(m, NULL); }
+static inline void mutexLock(Mutex* m)   { pthread_mutex_lock(m); }
+static inline void mutexUnlock(Mutex* m) { pthread_mutex_unlock(m); }
+
+static inline void condvarInit(CondVar* c)             { pthread_cond_init(c, NULL); }
+static inline Result condvarWait(CondVar* c, Mutex* m) { return pthread_cond_wait(c, m); }
+static inline Result condvarWakeOne(CondVar* c)        { return pthread_cond_signal(c); }
+static inline Result condvarWakeAll(CondVar* c)        { return pthread_cond_broadcast(c); }
+
+static inline void* hostThreadMain(void* arg)
+{
+    Thread* t = (Thread*)arg;
+    t->entry(t->arg);
+    return NULL;
+}
+
+static inline Result threadCreate(Thread* t, ThreadFunc entry, void* arg, void* stack_mem, size_t stack_sz, int prio, int cpuid)
+{
+    (void)stack_mem; (void)stack_sz; (void)prio; (void)cpuid;
+    if (hostFailThreads)
+        return 1;
+    t->entry = entry;
+    t->arg = arg;
+    return 0;
+}
+
+static inline Result threadStart(Thread* t)       { return pthread_create(&t->handle, NULL, hostThreadMain, t); }
+static inline Result threadWaitForExit(Thread* t) { return pthread_join(t->handle, NULL); }
+static inline Result threadClose(Thread* t)       { (void)t; return 0; }
@@ -0,0 +1,468 @@
+/*
+ * Checks the asynchronous texture loader: source/texture_loader.cpp is built as is (along with
+ * stb_image and the GL state tracker) against host versions of libnx (host/switch.h, threads are
+ * pthreads) and GL, which this tool implements. The mocked GL keeps the images of the textures,
+ * and runs a GPU that lags GPULAG frames behind: fences signal that late, and a buffer a texture
+ * was uploaded from is read by the GPU until then.
+ *
+ * Generated PNG images of various sizes (and one that fails to decode) are loaded, flipped and not,
+ * with texLoaderUpdate called once per frame until nothing is pending. The tool checks that:
+ * - every texture ends up with its image (or keeps the placeholder), with mipmaps
+ * - texLoaderUpdate never blocks, and never maps a buffer the GPU may still be reading
+ * - each update uploads at most UPLOADBUDGET bytes, unless it uploads a single image
+ * - every buffer and fence is deleted by texLoaderExit
+ * This runs with the decoding threads, without them (threadCreate failing), and with every third
+ * glMapBufferRange failing, in which case the images must be uploaded from client memory.
+ *
+ * This is a host tool, not part of the Switch build:
+ *   c++ -std=gnu++17 -O2 -pthread -Ihost -I../source -I../../common texture_loader_check.cpp \
+ *      ../source/texture_loader.cpp ../source/stb_image.cpp ../../common/gl_state.cpp -o texture_loader_check
+ *   ./texture_loader_check
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <map>
+#include <vector>
+
+#include <switch.h>
+#include "gl_state.h"
+#include "texture_loader.h"
+
+// Frames the GPU lags behind
+constexpr unsigned GPULAG = 2;
+
+// Must match texture_loader.cpp
+constexpr size_t UPLOADBUDGET = 8*1024*1024;
+
+// ----------------------------------------------------------------------------
+// Mocked GL
+
+struct MockTexture
+{
+    int width, height;
+    std::vector<uint8_t> pixels;
+    GLint minFilter;
+    bool mipmaps;
+};
+
+struct MockBuffer
+{
+    std::vector<uint8_t> data;
+    bool mapped;
+    unsigned busyUntil; // frame on which the GPU is done reading it
+};
+
+struct MockFence
+{
+    unsigned frame;
+};
+
+static unsigned s_frame;
+static GLuint s_nextName = 1;
+static std::map<GLuint, MockTexture> s_textures;
+static std::map<GLuint, MockBuffer> s_buffers;
+static GLuint s_boundTexture, s_unpackBuffer;
+static unsigned s_numFences;
+static unsigned s_failMapEvery, s_numMaps;
+
+// What went wrong, and what was uploaded during the current update
+static unsigned s_blockingWaits, s_busyMaps, s_errors;
+static size_t s_updateBytes;
+static unsigned s_updateImages;
+
+static void error(const char* what)
+{
+    if (s_errors++ < 10)
+        fprintf(stderr, "GL: %s\n", what);
+}
+
+void glGenTextures(GLsizei n, GLuint* textures)
+{
+    for (GLsizei i = 0; i < n; i ++)
+    {
+        textures[i] = s_nextName++;
+        s_textures[textures[i]] = MockTexture{ 0, 0, {}, GL_LINEAR_MIPMAP_LINEAR, false };
+    }
+}
+
+void glDeleteTextures(GLsizei n, const GLuint* textures)
+{
+    for (GLsizei i = 0; i < n; i ++)
+        s_textures.erase(textures[i]);
+}
+
+void glGenBuffers(GLsizei n, GLuint* buffers)
+{
+    for (GLsizei i = 0; i < n; i ++)
+    {
+        buffers[i] = s_nextName++;
+        s_buffers[buffers[i]] = MockBuffer{ {}, false, 0 };
+    }
+}
+
+void glDeleteBuffers(GLsizei n, const GLuint* buffers)
+{
+    for (GLsizei i = 0; i < n; i ++)
+    {
+        if (buffers[i] == s_unpackBuffer)
+            s_unpackBuffer = 0;
+        s_buffers.erase(buffers[i]);
+    }
+}
+
+void glBindTexture(GLenum target, GLuint texture)
+{
+    if (target == GL_TEXTURE_2D)
+        s_boundTexture = texture;
+}
+
+void glBindBuffer(GLenum target, GLuint buffer)
+{
+    if (target == GL_PIXEL_UNPACK_BUFFER)
+        s_unpackBuffer = buffer;
+}
+
+void glTexParameteri(GLenum target, GLenum pname, GLint param)
+{
+    if (target == GL_TEXTURE_2D && pname == GL_TEXTURE_MIN_FILTER)
+        s_textures[s_boundTexture].minFilter = param;
+}
+
+void glPixelStorei(GLenum pname, GLint param)
+{
+    if (pname == GL_UNPACK_ALIGNMENT && param != 4)
+        error("unexpected unpack alignment");
+}
+
+void glTexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void* pixels)
+{
+    if (target != GL_TEXTURE_2D || level != 0 || internalformat != GL_RGBA8 || border != 0 || format != GL_RGBA || type != GL_UNSIGNED_BYTE)
+        error("unexpected glTexImage2D parameters");
+
+    MockTexture& tex = s_textures[s_boundTexture];
+    size_t size = (size_t)width*height*4;
+    tex.width = width;
+    tex.height = height;
+    tex.pixels.assign(size, 0);
+    tex.mipmaps = false;
+
+    const uint8_t* src = (const uint8_t*)pixels;
+    if (s_unpackBuffer)
+    {
+        // The pointer is an offset in the unpack buffer, which the GPU reads later on
+        MockBuffer& buf = s_buffers[s_unpackBuffer];
+        if (buf.mapped || (uintptr_t)pixels + size > buf.data.size())
+        {
+            error("glTexImage2D from a mapped or too small buffer");
+            return;
+        }
+        src = buf.data.data() + (uintptr_t)pixels;
+        buf.busyUntil = s_frame + GPULAG;
+    }
+    if (src)
+    {
+        memcpy(tex.pixels.data(), src, size);
+        s_updateBytes += size;
+        s_updateImages ++;
+    }
+}
+
+void glGenerateMipmap(GLenum target)
+{
+    if (target == GL_TEXTURE_2D)
+        s_textures[s_boundTexture].mipmaps = true;
+}
+
+void glBufferData(GLenum target, GLsizeiptr size, const void* data, GLenum usage)
+{
+    (void)usage;
+    if (target != GL_PIXEL_UNPACK_BUFFER || !s_unpackBuffer || data)
+    {
+        error("unexpected glBufferData");
+        return;
+    }
+
+    // New storage: the GPU keeps reading the old one
+    MockBuffer& buf = s_buffers[s_unpackBuffer];
+    buf.data.assign(size, 0);
+    buf.busyUntil = 0;
+}
+
+void* glMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access)
+{
+    (void)access;
+    if (target != GL_PIXEL_UNPACK_BUFFER || !s_unpackBuffer)
+    {
+        error("unexpected glMapBufferRange");
+        return nullptr;
+    }
+    if (s_failMapEvery && ++s_numMaps % s_failMapEvery == 0)
+        return nullptr;
+
+    MockBuffer& buf = s_buffers[s_unpackBuffer];
+    if (buf.mapped || offset + length > (GLintptr)buf.data.size())
+    {
+        error("glMapBufferRange of a mapped buffer, or out of its range");
+        return nullptr;
+    }
+    if (s_frame < buf.busyUntil)
+        s_busyMaps ++;
+    buf.mapped = true;
+    return buf.data.data() + offset;
+}
+
+GLboolean glUnmapBuffer(GLenum target)
+{
+    if (target != GL_PIXEL_UNPACK_BUFFER || !s_unpackBuffer || !s_buffers[s_unpackBuffer].mapped)
+    {
+        error("unexpected glUnmapBuffer");
+        return GL_FALSE;
+    }
+    s_buffers[s_unpackBuffer].mapped = false;
+    return GL_TRUE;
+}
+
+GLsync glFenceSync(GLenum condition, GLbitfield flags)
+{
+    (void)condition; (void)flags;
+    s_numFences ++;
+    return (GLsync)new MockFence{ s_frame };
+}
+
+GLenum glClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout)
+{
+    (void)flags;
+    if (timeout)
+        s_blockingWaits ++;
+    return s_frame >= ((MockFence*)sync)->frame + GPULAG ? GL_ALREADY_SIGNALED : GL_TIMEOUT_EXPIRED;
+}
+
+void glDeleteSync(GLsync sync)
+{
+    s_numFences --;
+    delete (MockFence*)sync;
+}
+
+// Used by the GL state tracker only
+void glActiveTexture(GLenum) { }
+void glBindVertexArray(GLuint) { }
+void glBindProgramPipeline(GLuint) { }
+void glUseProgram(GLuint) { }
+void glDeleteVertexArrays(GLsizei, const GLuint*) { }
+void glDeleteProgramPipelines(GLsizei, const GLuint*) { }
+void glDeleteProgram(GLuint) { }
+void glUniform1i(GLint, GLint) { }
+void glUniform1f(GLint, GLfloat) { }
+void glUniform2f(GLint, GLfloat, GLfloat) { }
+void glUniform3f(GLint, GLfloat, GLfloat, GLfloat) { }
+void glUniform4f(GLint, GLfloat, GLfloat, GLfloat, GLfloat) { }
+void glUniformMatrix4fv(GLint, GLsizei, GLboolean, const GLfloat*) { }
+void glProgramUniform1i(GLuint, GLint, GLint) { }
+void glProgramUniform2i(GLuint, GLint, GLint, GLint) { }
+
+// ----------------------------------------------------------------------------
+// Test images: uncompressed PNGs (stored deflate blocks)
+
+static uint32_t crc32(const uint8_t* data, size_t size, uint32_t crc = 0)
+{
+    static uint32_t table[256];
+    if (!table[1])
+    {
+        for (uint32_t i = 0; i < 256; i ++)
+        {
+            uint32_t c = i;
+            for (int k = 0; k < 8; k ++)
+                c = c & 1 ? 0xEDB88320 ^ (c >> 1) : c >> 1;
+            table[i] = c;
+        }
+    }
+    crc = ~crc;
+    for (size_t i = 0; i < size; i ++)
+        crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+    return ~crc;
+}
+
+static void putBE32(std::vector<uint8_t>& out, uint32_t v)
+{
+    for (int i = 24; i >= 0; i -= 8)
+        out.push_back(v >> i);
+}
+
+static void putChunk(std::vector<uint8_t>& out, const char* type, const std::vector<uint8_t>& data)
+{
+    putBE32(out, data.size());
+    size_t start = out.size();
+    out.insert(out.end(), type, type + 4);
+    out.insert(out.end(), data.begin(), data.end());
+    putBE32(out, crc32(&out[start], out.size() - start));
+}
+
+static uint8_t pixelValue(unsigned image, int x, int y, int c)
+{
+    switch (c)
+    {
+        case 0:  return x*7 + image;
+        case 1:  return y*13 + image*3;
+        case 2:  return x ^ y;
+        default: return 255 - image;
+    }
+}
+
+static std::vector<uint8_t> makePng(unsigned image, int width, int height)
+{
+    // Rows of RGBA pixels, each preceded by its filter type (none)
+    std::vector<uint8_t> raw;
+    for (int y = 0; y < height; y ++)
+    {
+        raw.push_back(0);
+        for (int x = 0; x < width; x ++)
+            for (int c = 0; c < 4; c ++)
+                raw.push_back(pixelValue(image, x, y, c));
+    }
+
+    std::vector<uint8_t> zlib = { 0x78, 0x01 };
+    for (size_t pos = 0; pos < raw.size() || pos == 0; )
+    {
+        size_t len = raw.size() - pos < 65535 ? raw.size() - pos : 65535;
+        zlib.push_back(pos + len == raw.size());
+        zlib.push_back(len);
+        zlib.push_back(len >> 8);
+        zlib.push_back(~len);
+        zlib.push_back(~len >> 8);
+        zlib.insert(zlib.end(), raw.begin() + pos, raw.begin() + pos + len);
+        pos += len;
+    }
+    uint32_t a = 1, b = 0;
+    for (uint8_t v : raw)
+    {
+        a = (a + v) % 65521;
+        b = (b + a) % 65521;
+    }
+    putBE32(zlib, (b << 16) | a);
+
+    std::vector<uint8_t> png = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+    std::vector<uint8_t> ihdr;
+    putBE32(ihdr, width);
+    putBE32(ihdr, height);
+    ihdr.insert(ihdr.end(), { 8, 6, 0, 0, 0 }); // 8 bits per channel, RGBA
+    putChunk(png, "IHDR", ihdr);
+    putChunk(png, "IDAT", zlib);
+    putChunk(png, "IEND", {});
+    return png;
+}
+
+// ----------------------------------------------------------------------------
+
+struct TestImage
+{
+    int width, height; // 0 for data that doesn't decode
+    std::vector<uint8_t> png;
+};
+
+struct Load
+{
+    GLuint tex;
+    unsigned image;
+    bool flip;
+};
+
+static bool checkTexture(const Load& load, const TestImage& img)
+{
+    auto it = s_textures.find(load.tex);
+    if (it == s_textures.end())
+        return false;
+    const MockTexture& tex = it->second;
+
+    // Images that fail to decode keep the gray placeholder
+    if (!img.width)
+    {
+        static const uint8_t placeholder[] = { 0x80, 0x80, 0x80, 0xFF };
+        return tex.width == 1 && tex.height == 1 && !memcmp(tex.pixels.data(), placeholder, 4) &&
+            tex.minFilter == GL_LINEAR && !tex.mipmaps;
+    }
+
+    if (tex.width != img.width || tex.height != img.height || tex.minFilter != GL_LINEAR_MIPMAP_LINEAR || !tex.mipmaps)
+        return false;
+    for (int y = 0; y < img.height; y ++)
+    {
+        int srcY = load.flip ? img.height-1-y : y;
+        for (int x = 0; x < img.width; x ++)
+            for (int c = 0; c < 4; c ++)
+                if (tex.pixels[((size_t)y*img.width + x)*4 + c] != pixelValue(load.image, x, srcY, c))
+                    return false;
+    }
+    return true;
+}
+
+static bool run(const char* what, const std::vector<TestImage>& images, bool threads, unsigned failMapEvery)
+{
+    s_errors = s_blockingWaits = s_busyMaps = 0;
+    s_failMapEvery = failMapEvery;
+    s_numMaps = 0;
+    hostFailThreads = !threads;
+
+    bool ok = texLoaderInit() == threads;
+    if (!ok)
+        fprintf(stderr, "%s: texLoaderInit returned %s\n", what, threads ? "false" : "true");
+
+    // Everything is queued at once, in three rounds
+    std::vector<Load> loads;
+    for (unsigned round = 0; round < 3; round ++)
+    {
+        for (unsigned i = 0; i < images.size(); i ++)
+        {
+            bool flip = (round + i) & 1;
+            loads.push_back(Load{ texLoaderLoad(images[i].png.data(), images[i].png.size(), flip), i, flip });
+        }
+    }
+
+    unsigned frames = 0, budgetOverruns = 0;
+    while (texLoaderGetPending() && frames < 100000)
+    {
+        s_updateBytes = 0;
+        s_updateImages = 0;
+        texLoaderUpdate();
+        if (s_updateImages > 1 && s_updateBytes > UPLOADBUDGET)
+            budgetOverruns ++;
+
+        s_frame ++;
+        frames ++;
+        usleep(100);
+    }
+
+    unsigned bad = 0;
+    for (const Load& load : loads)
+        bad += !checkTexture(load, images[load.image]);
+
+    texLoaderExit();
+    for (const Load& load : loads)
+        glStateDeleteTextures(1, &load.tex);
+
+    printf("%-14s %3zu textures over %4u frames: %u wrong, %u over budget, %u blocking waits, %u busy maps, %u GL errors, %zu buffers and %u fences left\n",
+        what, loads.size(), frames, bad, budgetOverruns, s_blockingWaits, s_busyMaps, s_errors, s_buffers.size(), s_numFences);
+    return ok && !texLoaderGetPending() && !bad && !budgetOverruns && !s_blockingWaits && !s_busyMaps && !s_errors &&
+        s_buffers.empty() && !s_numFences && s_textures.empty();
+}
+
+int main(void)
+{
+    static const int sizes[][2] = { { 1, 1 }, { 37, 19 }, { 256, 256 }, { 640, 480 }, { 1500, 3 }, { 1024, 1024 }, { 2048, 1024 }, { 512, 2048 } };
+
+    std::vector<TestImage> images;
+    for (unsigned i = 0; i < sizeof(sizes)/sizeof(sizes[0]); i ++)
+        images.push_back(TestImage{ sizes[i][0], sizes[i][1], makePng(images.size(), sizes[i][0], sizes[i][1]) });
+
+    // Data that fails to decode: a PNG cut short
+    std::vector<uint8_t> truncated = makePng(images.size(), 64, 64);
+    truncated.resize(truncated.size() / 2);
+    images.push_back(TestImage{ 0, 0, truncated });
+
+    bool ok = run("threads", images, true, 0);
+    ok = run("no threads", images, false, 0) && ok;
+    ok = run("map failures", images, true, 3) && ok;
+    printf("Texture loader: %s\n", ok ? "ok" : "FAILED");
+    return ok ? 0 : 1;
+}
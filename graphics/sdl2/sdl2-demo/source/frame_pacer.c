@@ -0,0 +1,118 @@
+#include <string.h>
+
+#include <switch.h>
+
+#include "frame_pacer.h"
+
+static double ticks_to_ms(const FramePacer *pacer, double ticks)
+{
+    return ticks * 1000.0 / pacer->freq;
+}
+
+void frame_pacer_init(FramePacer *pacer, int fps, int vsync_hz)
+{
+    memset(pacer, 0, sizeof(*pacer));
+    pacer->freq = SDL_GetPerformanceFrequency();
+    frame_pacer_set_fps(pacer, fps);
+    frame_pacer_set_vsync(pacer, vsync_hz);
+    frame_pacer_reset_stats(pacer);
+
+    Uint64 now = SDL_GetPerformanceCounter();
+    pacer->frame_start = now;
+    pacer->last_present = now;
+    pacer->deadline = now + pacer->period;
+}
+
+void frame_pacer_set_fps(FramePacer *pacer, int fps)
+{
+    pacer->period = pacer->freq / fps;
+}
+
+void frame_pacer_set_vsync(FramePacer *pacer, int vsync_hz)
+{
+    pacer->vsync_period = vsync_hz > 0 ? pacer->freq / vsync_hz : 0;
+}
+
+void frame_pacer_wait(FramePacer *pacer)
+{
+    Uint64 now = SDL_GetPerformanceCounter();
+    Uint64 work = now - pacer->frame_start;
+    pacer->work += work;
+    if (work > pacer->max_work)
+        pacer->max_work = work;
+
+    // presenting blocks until the next vblank, so only sleep up to the vblank before the deadline
+    Uint64 wake = pacer->deadline;
+    if (pacer->vsync_period) {
+        // the refresh rate is the fastest frames can go anyway
+        if (pacer->period <= pacer->vsync_period + pacer->vsync_period / 20)
+            return;
+        wake -= pacer->vsync_period / 2;
+    }
+
+    if (now < wake)
+        svcSleepThread((wake - now) * 1000000000ull / pacer->freq);
+}
+
+void frame_pacer_end_frame(FramePacer *pacer)
+{
+    Uint64 now = SDL_GetPerformanceCounter();
+    Uint64 interval = now - pacer->last_present;
+
+    pacer->frames++;
+    pacer->interval_sum += interval;
+    pacer->interval_sq_sum += (double)interval * interval;
+    if (interval > pacer->interval_max)
+        pacer->interval_max = interval;
+
+    // with vsync, frames can't come faster than the refresh rate
+    Uint64 period = pacer->period;
+    if (pacer->vsync_period && period < pacer->vsync_period)
+        period = pacer->vsync_period;
+    if (interval > period + period / 2)
+        pacer->late++;
+
+    // keep the schedule so that timing errors don't add up, but don't try to catch up on missed
+    // frames by presenting a burst of them: start over from now instead. With vsync, presents
+    // land on vblanks, so the schedule follows them: deadlines then stay on vblanks, and
+    // frame_pacer_wait wakes up halfway between two of them rather than close to one
+    if (pacer->vsync_period) {
+        pacer->deadline = now + period;
+    } else {
+        pacer->deadline += period;
+        if (pacer->deadline < now)
+            pacer->deadline = now + period;
+    }
+
+    pacer->last_present = now;
+    pacer->frame_start = now;
+}
+
+void frame_pacer_get_stats(const FramePacer *pacer, FrameStats *stats)
+{
+    memset(stats, 0, sizeof(*stats));
+    stats->frames = pacer->frames;
+    stats->late = pacer->late;
+    if (!pacer->frames)
+        return;
+
+    double mean = pacer->interval_sum / pacer->frames;
+    double variance = pacer->interval_sq_sum / pacer->frames - mean * mean;
+    stats->fps = mean > 0 ? pacer->freq / mean : 0;
+    stats->work_ms = ticks_to_ms(pacer, (double)pacer->work / pacer->frames);
+    stats->max_work_ms = ticks_to_ms(pacer, pacer->max_work);
+    stats->interval_ms = ticks_to_ms(pacer, mean);
+    stats->jitter_ms = ticks_to_ms(pacer, variance > 0 ? SDL_sqrt(variance) : 0);
+    stats->max_interval_ms = ticks_to_ms(pacer, pacer->interval_max);
+}
+
+void frame_pacer_reset_stats(FramePacer *pacer)
+{
+    pacer->frames = 0;
+    pacer->late = 0;
+    pacer->work = 0;
+    pacer->max_work = 0;
+    pacer->interval_max = 0;
+    pacer->interval_sum = 0;
+    pacer->interval_sq_sum = 0;
+}
@@ -0,0 +1,53 @@
+/* Frame pacing for the SDL2 demo
+ *
+ * Frames are presented on a fixed schedule instead of sleeping a fixed time after each one: the
+ * pacer measures how long the frame took and only sleeps what's left of the target period. When
+ * presenting waits for vsync, the pacer leaves the timing to it and only sleeps for frame rates
+ * below the refresh rate.
+ */
+
+#pragma once
+
+#include <SDL.h>
+
+typedef struct {
+    unsigned frames;
+    unsigned late;          // frames that took more than one and a half periods, i.e. missed their slot
+    double fps;
+    double work_ms;         // average time from the start of a frame until frame_pacer_wait
+    double max_work_ms;
+    double interval_ms;     // average time between two presents
+    double jitter_ms;       // standard deviation of the time between two presents
+    double max_interval_ms;
+} FrameStats;
+
+typedef struct {
+    Uint64 freq;            // performance counter ticks per second
+    Uint64 period;          // target time between two presents, in ticks
+    Uint64 vsync_period;    // refresh period when presenting waits for vsync, otherwise 0
+    Uint64 deadline;        // when the current frame should be presented
+    Uint64 frame_start;
+    Uint64 last_present;
+
+    // accumulated since the last frame_pacer_reset_stats, in ticks
+    unsigned frames, late;
+    Uint64 work, max_work;
+    Uint64 interval_max;
+    double interval_sum, interval_sq_sum;
+} FramePacer;
+
+void frame_pacer_init(FramePacer *pacer, int fps, int vsync_hz);
+
+void frame_pacer_set_fps(FramePacer *pacer, int fps);
+
+// vsync_hz is the refresh rate if presenting waits for vsync, 0 otherwise
+void frame_pacer_set_vsync(FramePacer *pacer, int vsync_hz);
+
+// Call right before presenting: sleeps until the frame is due
+void frame_pacer_wait(FramePacer *pacer);
+
+// Call right after presenting: records the frame and schedules the next one
+void frame_pacer_end_frame(FramePacer *pacer);
+
+void frame_pacer_get_stats(const FramePacer *pacer, FrameStats *stats);
+void frame_pacer_reset_stats(FramePacer *pacer);
@@ -19,6 +19,7 @@
  *
  */
 
+#include <stdio.h>
 #include <time.h>
 #include <unistd.h>
 
@@ -28,6 +29,9 @@
 #include <SDL_ttf.h>
 #include <switch.h>
 
+#include "frame_pacer.h"
+#include "sprite_batch.h"
+
 // some switch buttons
 #define JOY_A     0
 #define JOY_B     1
@@ -43,19 +47,44 @@
 #define SCREEN_W 1280
 #define SCREEN_H 720
 
-SDL_Texture * render_text(SDL_Renderer *renderer, const char* text, TTF_Font *font, SDL_Color color, SDL_Rect *rect) 
-{
-    SDL_Surface *surface;
-    SDL_Texture *texture;
+// small logos bouncing around when X is pressed
+#define NUM_LOGOS 500
+#define LOGO_SIZE 30
 
-    surface = TTF_RenderText_Solid(font, text, color);
-    texture = SDL_CreateTextureFromSurface(renderer, surface);
-    rect->w = surface->w;
-    rect->h = surface->h;
+typedef struct {
+    float x, y;
+    float vel_x, vel_y;
+    SDL_Color color;
+} Logo;
 
+static Atlas atlas;
+static TextCache text_cache;
+static SpriteBatch batch;
+static Logo logos[NUM_LOGOS];
+
+// load an image from file into the atlas
+int load_sprite(const char *path, Sprite *sprite)
+{
+    SDL_Surface *surface = IMG_Load(path);
+    if (!surface)
+        return 0;
+
+    int ok = atlas_add_surface(&atlas, surface, sprite);
     SDL_FreeSurface(surface);
+    return ok;
+}
 
-    return texture;
+// refresh rate if presenting waits for vsync, 0 otherwise
+int get_vsync_hz(SDL_Window *window, SDL_Renderer *renderer)
+{
+    SDL_RendererInfo info;
+    SDL_DisplayMode mode;
+
+    if (SDL_GetRendererInfo(renderer, &info) != 0 || !(info.flags & SDL_RENDERER_PRESENTVSYNC))
+        return 0;
+    if (SDL_GetWindowDisplayMode(window, &mode) != 0 || mode.refresh_rate <= 0)
+        return 60;
+    return mode.refresh_rate;
 }
 
 int rand_range(int min, int max){
@@ -70,23 +99,26 @@ int main(int argc, char** argv) {
 
     int exit_requested = 0;
     int trail = 0;
-    int wait = 25;
+    int fps = 60;
 
-    SDL_Texture *switchlogo_tex = NULL, *sdllogo_tex = NULL, *helloworld_tex = NULL;
+    int show_logos = 0;
+
+    Sprite switchlogo, sdllogo;
+    int has_switchlogo = 0, has_sdllogo = 0;
     SDL_Rect pos = { 0, 0, 0, 0 }, sdl_pos = { 0, 0, 0, 0 };
     Mix_Music *music = NULL;
     Mix_Chunk *sound[4] = { NULL };
     SDL_Event event;
 
     SDL_Color colors[] = {
-        { 128, 128, 128, 0 }, // gray
-        { 255, 255, 255, 0 }, // white
-        { 255, 0, 0, 0 },     // red
-        { 0, 255, 0, 0 },     // green
-        { 0, 0, 255, 0 },     // blue
-        { 255, 255, 0, 0 },   // brown
-        { 0, 255, 255, 0 },   // cyan
-        { 255, 0, 255, 0 },   // purple
+        { 128, 128, 128, 255 }, // gray
+        { 255, 255, 255, 255 }, // white
+        { 255, 0, 0, 255 },     // red
+        { 0, 255, 0, 255 },     // green
+        { 0, 0, 255, 255 },     // blue
+        { 255, 255, 0, 255 },   // brown
+        { 0, 255, 255, 255 },   // cyan
+        { 255, 0, 255, 255 },   // purple
     };
     int col = 0, snd = 0;
 
@@ -100,29 +132,38 @@ int main(int argc, char** argv) {
     TTF_Init();
 
     SDL_Window* window = SDL_CreateWindow("sdl2+mixer+image+ttf demo", SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED, SCREEN_W, SCREEN_H, SDL_WINDOW_SHOWN);
-    SDL_Renderer* renderer = SDL_CreateRenderer(window, -1, SDL_RENDERER_ACCELERATED);
+    SDL_Renderer* renderer = SDL_CreateRenderer(window, -1, SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC);
+
+    // all sprites share one atlas texture, and text gets an atlas of its own
+    atlas_init(&atlas, renderer, 512, 512);
+    text_cache_init(&text_cache, renderer, 1024, 512);
+    batch_init(&batch, renderer);
 
     // load logos from file
-    SDL_Surface *sdllogo = IMG_Load("data/sdl.png");
-    if (sdllogo) {
-        sdl_pos.w = sdllogo->w;
-        sdl_pos.h = sdllogo->h;
-        sdllogo_tex = SDL_CreateTextureFromSurface(renderer, sdllogo);
-        SDL_FreeSurface(sdllogo);
+    has_sdllogo = load_sprite("data/sdl.png", &sdllogo);
+    if (has_sdllogo) {
+        sdl_pos.w = sdllogo.w;
+        sdl_pos.h = sdllogo.h;
     }
 
-    SDL_Surface *switchlogo = IMG_Load("data/switch.png");
-    if (switchlogo) {
-        pos.x = SCREEN_W / 2 - switchlogo->w / 2;
-        pos.y = SCREEN_H / 2 - switchlogo->h / 2;
-        pos.w = switchlogo->w;
-        pos.h = switchlogo->h;
-        switchlogo_tex = SDL_CreateTextureFromSurface(renderer, switchlogo);
-        SDL_FreeSurface(switchlogo);
+    has_switchlogo = load_sprite("data/switch.png", &switchlogo);
+    if (has_switchlogo) {
+        pos.x = SCREEN_W / 2 - switchlogo.w / 2;
+        pos.y = SCREEN_H / 2 - switchlogo.h / 2;
+        pos.w = switchlogo.w;
+        pos.h = switchlogo.h;
     }
 
     col = rand_range(0, 7);
 
+    for (int i = 0; i < NUM_LOGOS; i++) {
+        logos[i].x = rand_range(0, SCREEN_W - LOGO_SIZE);
+        logos[i].y = rand_range(0, SCREEN_H - LOGO_SIZE);
+        logos[i].vel_x = rand_range(-20, 20) / 10.0f;
+        logos[i].vel_y = rand_range(-20, 20) / 10.0f;
+        logos[i].color = colors[rand_range(0, 7)];
+    }
+
     SDL_InitSubSystem(SDL_INIT_JOYSTICK);
     SDL_JoystickEventState(SDL_ENABLE);
     SDL_JoystickOpen(0);
@@ -130,12 +171,9 @@ int main(int argc, char** argv) {
     // load font from romfs
     TTF_Font* font = TTF_OpenFont("data/LeroyLetteringLightBeta01.ttf", 36);
 
-    // render text as texture
-    SDL_Rect helloworld_rect = { 0, SCREEN_H - 36, 0, 0 };
-    helloworld_tex = render_text(renderer, "Hello, world!", font, colors[1], &helloworld_rect);
-
-    // no need to keep the font loaded
-    TTF_CloseFont(font);
+    // text is rendered (and cached) when it's first drawn, so the font stays loaded
+    char stats[64] = "";
+    char timing[96] = "";
 
     SDL_InitSubSystem(SDL_INIT_AUDIO);
     Mix_AllocateChannels(5);
@@ -150,6 +188,11 @@ int main(int argc, char** argv) {
     if (music)
         Mix_PlayMusic(music, -1);
 
+    // present at a steady rate, relying on vsync when the renderer waits for it
+    FramePacer pacer;
+    frame_pacer_init(&pacer, fps, get_vsync_hz(window, renderer));
+    Uint32 stats_ticks = SDL_GetTicks();
+
     while (!exit_requested
         && appletMainLoop()
         ) {
@@ -160,17 +203,25 @@ int main(int argc, char** argv) {
             // use joystick
             if (event.type == SDL_JOYBUTTONDOWN) {
                 if (event.jbutton.button == JOY_UP)
-                    if (wait > 0)
-                        wait--;
+                    if (fps < 120)
+                        frame_pacer_set_fps(&pacer, fps += 5);
                 if (event.jbutton.button == JOY_DOWN)
-                    if (wait < 100)
-                        wait++;
+                    if (fps > 5)
+                        frame_pacer_set_fps(&pacer, fps -= 5);
 
                 if (event.jbutton.button == JOY_PLUS)
                     exit_requested = 1;
 
                 if (event.jbutton.button == JOY_B)
                     trail =! trail;
+
+                if (event.jbutton.button == JOY_X)
+                    show_logos =! show_logos;
+
+                if (event.jbutton.button == JOY_Y) {
+                    SDL_RenderSetVSync(renderer, !get_vsync_hz(window, renderer));
+                    frame_pacer_set_vsync(&pacer, get_vsync_hz(window, renderer));
+                }
             }
         }
 
@@ -215,32 +266,68 @@ int main(int argc, char** argv) {
             SDL_RenderClear(renderer);
         }
 
+        // everything below is queued and drawn by batch_end, in as few calls as possible
+        batch_begin(&batch);
+
         // put logos on screen
-        if (sdllogo_tex)
-            SDL_RenderCopy(renderer, sdllogo_tex, NULL, &sdl_pos);
-        if (switchlogo_tex) {
-            SDL_SetTextureColorMod(switchlogo_tex, colors[col].r, colors[col].g, colors[col].b);
-            SDL_RenderCopy(renderer, switchlogo_tex, NULL, &pos);
+        if (has_sdllogo) {
+            SDL_FRect dst = { sdl_pos.x, sdl_pos.y, sdl_pos.w, sdl_pos.h };
+            batch_draw(&batch, &sdllogo, &dst, colors[1]);
         }
-        
+        if (has_switchlogo && show_logos) {
+            for (int i = 0; i < NUM_LOGOS; i++) {
+                Logo *logo = &logos[i];
+                logo->x += logo->vel_x;
+                logo->y += logo->vel_y;
+                if (logo->x < 0 || logo->x + LOGO_SIZE > SCREEN_W)
+                    logo->vel_x = -logo->vel_x;
+                if (logo->y < 0 || logo->y + LOGO_SIZE > SCREEN_H)
+                    logo->vel_y = -logo->vel_y;
+
+                SDL_FRect dst = { logo->x, logo->y, LOGO_SIZE, LOGO_SIZE };
+                batch_draw(&batch, &switchlogo, &dst, logo->color);
+            }
+        }
+        if (has_switchlogo) {
+            SDL_FRect dst = { pos.x, pos.y, pos.w, pos.h };
+            batch_draw(&batch, &switchlogo, &dst, colors[col]);
+        }
+
         // put text on screen
-        if (helloworld_tex)
-            SDL_RenderCopy(renderer, helloworld_tex, NULL, &helloworld_rect);
+        if (font) {
+            batch_draw_text(&batch, &text_cache, font, "Hello, world!", 0, SCREEN_H - 36, colors[1], NULL);
+            batch_draw_text(&batch, &text_cache, font, stats, 0, SCREEN_H - 72, colors[0], NULL);
+            batch_draw_text(&batch, &text_cache, font, timing, 0, SCREEN_H - 108, colors[0], NULL);
+        }
+
+        batch_end(&batch);
+
+        // shown on the next frame, it only changes when X is pressed so it stays cached
+        snprintf(stats, sizeof(stats), "%d quads, %d draw calls", batch.quads, batch.draw_calls);
 
+        // sleep only for what's left of the frame (if anything), then present
+        frame_pacer_wait(&pacer);
         SDL_RenderPresent(renderer);
+        frame_pacer_end_frame(&pacer);
 
-        SDL_Delay(wait);
+        // update the frame timing once per second
+        if (SDL_GetTicks() - stats_ticks >= 1000) {
+            FrameStats frame_stats;
+            frame_pacer_get_stats(&pacer, &frame_stats);
+            frame_pacer_reset_stats(&pacer);
+            stats_ticks = SDL_GetTicks();
+
+            snprintf(timing, sizeof(timing), "%.1f/%d fps%s, work %.1f ms, jitter %.2f ms, %u late",
+                frame_stats.fps, fps, pacer.vsync_period ? " (vsync)" : "", frame_stats.work_ms, frame_stats.jitter_ms, frame_stats.late);
+        }
     }
 
     // clean up your textures when you are done with them
-    if (sdllogo_tex)
-        SDL_DestroyTexture(sdllogo_tex);
-
-    if (switchlogo_tex)
-        SDL_DestroyTexture(switchlogo_tex);
+    text_cache_exit(&text_cache);
+    atlas_exit(&atlas);
 
-    if (helloworld_tex)
-        SDL_DestroyTexture(helloworld_tex);
+    if (font)
+        TTF_CloseFont(font);
 
     // stop sounds and free loaded data
     Mix_HaltChannel(-1);
@@ -0,0 +1,255 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "sprite_batch.h"
+
+int atlas_init(Atlas *atlas, SDL_Renderer *renderer, int w, int h)
+{
+    memset(atlas, 0, sizeof(*atlas));
+
+    atlas->texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_STATIC, w, h);
+    if (!atlas->texture)
+        return 0;
+    SDL_SetTextureBlendMode(atlas->texture, SDL_BLENDMODE_BLEND);
+
+    // the padding has to be transparent, so clear the whole texture once
+    void *pixels = calloc(w * h, 4);
+    if (pixels) {
+        SDL_UpdateTexture(atlas->texture, NULL, pixels, w * 4);
+        free(pixels);
+    }
+
+    atlas->w = w;
+    atlas->h = h;
+    return 1;
+}
+
+void atlas_exit(Atlas *atlas)
+{
+    if (atlas->texture)
+        SDL_DestroyTexture(atlas->texture);
+    memset(atlas, 0, sizeof(*atlas));
+}
+
+void atlas_reset(Atlas *atlas)
+{
+    // only the padding of packed images is cleared, so clear the areas between them as well
+    void *pixels = calloc(atlas->w * atlas->h, 4);
+    if (pixels) {
+        SDL_UpdateTexture(atlas->texture, NULL, pixels, atlas->w * 4);
+        free(pixels);
+    }
+
+    atlas->shelf_x = 0;
+    atlas->shelf_y = 0;
+    atlas->shelf_h = 0;
+}
+
+int atlas_add_surface(Atlas *atlas, SDL_Surface *surface, Sprite *sprite)
+{
+    int w = surface->w + ATLAS_PADDING;
+    int h = surface->h + ATLAS_PADDING;
+
+    // start a new shelf if the image doesn't fit next to the previous one. The atlas is only
+    // updated once the image is in, so that failing to add one doesn't waste the current shelf
+    int x = atlas->shelf_x;
+    int y = atlas->shelf_y;
+    int shelf_h = atlas->shelf_h;
+    if (x + w > atlas->w) {
+        y += shelf_h;
+        x = 0;
+        shelf_h = 0;
+    }
+    if (w > atlas->w || y + h > atlas->h)
+        return 0;
+
+    SDL_Surface *converted = surface;
+    if (surface->format->format != SDL_PIXELFORMAT_RGBA32) {
+        converted = SDL_ConvertSurfaceFormat(surface, SDL_PIXELFORMAT_RGBA32, 0);
+        if (!converted)
+            return 0;
+    }
+
+    SDL_Rect rect = { x, y, surface->w, surface->h };
+    SDL_LockSurface(converted);
+    SDL_UpdateTexture(atlas->texture, &rect, converted->pixels, converted->pitch);
+    SDL_UnlockSurface(converted);
+    if (converted != surface)
+        SDL_FreeSurface(converted);
+
+    atlas->shelf_x = x + w;
+    atlas->shelf_y = y;
+    atlas->shelf_h = h > shelf_h ? h : shelf_h;
+
+    sprite->texture = atlas->texture;
+    sprite->w = rect.w;
+    sprite->h = rect.h;
+    sprite->u0 = (float)rect.x / atlas->w;
+    sprite->v0 = (float)rect.y / atlas->h;
+    sprite->u1 = (float)(rect.x + rect.w) / atlas->w;
+    sprite->v1 = (float)(rect.y + rect.h) / atlas->h;
+    return 1;
+}
+
+void batch_init(SpriteBatch *batch, SDL_Renderer *renderer)
+{
+    memset(batch, 0, sizeof(*batch));
+    batch->renderer = renderer;
+
+    // all quads are made of the same two triangles, so the indices never change
+    for (int i = 0; i < BATCH_MAX_QUADS; i++) {
+        int *index = &batch->indices[i * 6];
+        index[0] = i * 4 + 0;
+        index[1] = i * 4 + 1;
+        index[2] = i * 4 + 2;
+        index[3] = i * 4 + 0;
+        index[4] = i * 4 + 2;
+        index[5] = i * 4 + 3;
+    }
+}
+
+void batch_begin(SpriteBatch *batch)
+{
+    batch->quads = 0;
+    batch->draw_calls = 0;
+}
+
+void batch_flush(SpriteBatch *batch)
+{
+    if (!batch->num_quads)
+        return;
+
+    SDL_RenderGeometry(batch->renderer, batch->texture, batch->vertices, batch->num_quads * 4, batch->indices, batch->num_quads * 6);
+    batch->draw_calls++;
+    batch->num_quads = 0;
+}
+
+void batch_draw(SpriteBatch *batch, const Sprite *sprite, const SDL_FRect *dst, SDL_Color color)
+{
+    if (batch->texture != sprite->texture || batch->num_quads == BATCH_MAX_QUADS) {
+        batch_flush(batch);
+        batch->texture = sprite->texture;
+    }
+
+    SDL_Vertex *v = &batch->vertices[batch->num_quads * 4];
+    v[0].position.x = dst->x;          v[0].position.y = dst->y;
+    v[1].position.x = dst->x + dst->w; v[1].position.y = dst->y;
+    v[2].position.x = dst->x + dst->w; v[2].position.y = dst->y + dst->h;
+    v[3].position.x = dst->x;          v[3].position.y = dst->y + dst->h;
+    v[0].tex_coord.x = sprite->u0;     v[0].tex_coord.y = sprite->v0;
+    v[1].tex_coord.x = sprite->u1;     v[1].tex_coord.y = sprite->v0;
+    v[2].tex_coord.x = sprite->u1;     v[2].tex_coord.y = sprite->v1;
+    v[3].tex_coord.x = sprite->u0;     v[3].tex_coord.y = sprite->v1;
+    v[0].color = v[1].color = v[2].color = v[3].color = color;
+
+    batch->num_quads++;
+    batch->quads++;
+}
+
+void batch_draw_text(SpriteBatch *batch, TextCache *cache, TTF_Font *font, const char *text, float x, float y, SDL_Color color, SDL_Rect *rect)
+{
+    const Sprite *sprite = text_cache_get(cache, batch, font, text);
+    if (rect) {
+        rect->x = (int)x;
+        rect->y = (int)y;
+        rect->w = sprite ? sprite->w : 0;
+        rect->h = sprite ? sprite->h : 0;
+    }
+    if (!sprite)
+        return;
+
+    SDL_FRect dst = { x, y, (float)sprite->w, (float)sprite->h };
+    batch_draw(batch, sprite, &dst, color);
+}
+
+void batch_end(SpriteBatch *batch)
+{
+    batch_flush(batch);
+}
+
+int text_cache_init(TextCache *cache, SDL_Renderer *renderer, int w, int h)
+{
+    memset(cache, 0, sizeof(*cache));
+    return atlas_init(&cache->atlas, renderer, w, h);
+}
+
+static void text_cache_clear(TextCache *cache)
+{
+    for (int i = 0; i < TEXT_CACHE_SIZE; i++) {
+        free(cache->entries[i].text);
+        cache->entries[i].text = NULL;
+    }
+    cache->num_entries = 0;
+    atlas_reset(&cache->atlas);
+}
+
+void text_cache_exit(TextCache *cache)
+{
+    text_cache_clear(cache);
+    atlas_exit(&cache->atlas);
+}
+
+static Uint32 hash_text(TTF_Font *font, int style, const char *text)
+{
+    // FNV-1a
+    Uint32 hash = 2166136261u;
+    uintptr_t key[2] = { (uintptr_t)font, (uintptr_t)style };
+    const Uint8 *p = (const Uint8 *)key;
+    for (size_t i = 0; i < sizeof(key); i++)
+        hash = (hash ^ p[i]) * 16777619u;
+    for (p = (const Uint8 *)text; *p; p++)
+        hash = (hash ^ *p) * 16777619u;
+    return hash;
+}
+
+const Sprite *text_cache_get(TextCache *cache, SpriteBatch *batch, TTF_Font *font, const char *text)
+{
+    if (!text[0])
+        return NULL;
+
+    int style = TTF_GetFontStyle(font);
+    Uint32 hash = hash_text(font, style, text);
+
+    // open addressing, the table is kept at most 3/4 full so that probing stays short
+    unsigned slot = hash & (TEXT_CACHE_SIZE - 1);
+    for (; cache->entries[slot].text; slot = (slot + 1) & (TEXT_CACHE_SIZE - 1)) {
+        TextEntry *entry = &cache->entries[slot];
+        if (entry->hash == hash && entry->font == font && entry->style == style && !strcmp(entry->text, text)) {
+            cache->hits++;
+            return &entry->sprite;
+        }
+    }
+    cache->misses++;
+
+    static const SDL_Color white = { 255, 255, 255, 255 };
+    SDL_Surface *surface = TTF_RenderUTF8_Blended(font, text, white);
+    if (!surface)
+        return NULL;
+
+    // when the cache is full, start over: strings still in use are simply rendered again.
+    // quads pending in the batch may refer to the atlas, so submit them before it's overwritten
+    Sprite sprite;
+    int full = cache->num_entries >= TEXT_CACHE_SIZE * 3 / 4;
+    if (full || !atlas_add_surface(&cache->atlas, surface, &sprite)) {
+        batch_flush(batch);
+        text_cache_clear(cache);
+        cache->flushes++;
+        if (!atlas_add_surface(&cache->atlas, surface, &sprite)) {
+            SDL_FreeSurface(surface);
+            return NULL;
+        }
+        slot = hash & (TEXT_CACHE_SIZE - 1);
+    }
+    SDL_FreeSurface(surface);
+
+    TextEntry *entry = &cache->entries[slot];
+    entry->text = strdup(text);
+    if (!entry->text)
+        return NULL;
+    entry->font = font;
+    entry->style = style;
+    entry->hash = hash;
+    entry->sprite = sprite;
+    cache->num_entries++;
+    return &entry->sprite;
+}
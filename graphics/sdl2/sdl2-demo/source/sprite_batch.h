@@ -0,0 +1,85 @@
+/* Sprite batching for the SDL2 demo
+ *
+ * Images are packed into atlas textures, rendered text is cached in an atlas of its own, and all
+ * the quads drawn in a frame are submitted with as few SDL_RenderGeometry calls as possible
+ * (one per run of quads sharing a texture) instead of one SDL_RenderCopy each.
+ */
+
+#pragma once
+
+#include <SDL.h>
+#include <SDL_ttf.h>
+
+#define ATLAS_PADDING    1    // empty pixels around each image, so that filtering doesn't bleed
+#define BATCH_MAX_QUADS  1024
+#define TEXT_CACHE_SIZE  256  // must be a power of two
+
+// Texture that images are packed into, shelf by shelf
+typedef struct {
+    SDL_Texture *texture;
+    int w, h;
+    int shelf_x, shelf_y, shelf_h;
+} Atlas;
+
+// Image in an atlas
+typedef struct {
+    SDL_Texture *texture;
+    int w, h;
+    float u0, v0, u1, v1;
+} Sprite;
+
+typedef struct {
+    SDL_Renderer *renderer;
+    SDL_Texture *texture;   // texture of the pending quads
+    int num_quads;
+    SDL_Vertex vertices[BATCH_MAX_QUADS * 4];
+    int indices[BATCH_MAX_QUADS * 6];
+
+    // counted since batch_begin
+    int quads;
+    int draw_calls;
+} SpriteBatch;
+
+typedef struct {
+    char *text;
+    TTF_Font *font;
+    int style;
+    Uint32 hash;
+    Sprite sprite;
+} TextEntry;
+
+// Rendered strings, looked up by font, style and text. Text is rendered in white and tinted
+// when drawn, so the color isn't part of the key.
+typedef struct {
+    Atlas atlas;
+    TextEntry entries[TEXT_CACHE_SIZE];
+    int num_entries;
+    int hits, misses, flushes;
+} TextCache;
+
+int atlas_init(Atlas *atlas, SDL_Renderer *renderer, int w, int h);
+void atlas_exit(Atlas *atlas);
+
+// Forgets all the images in the atlas (their sprites become invalid)
+void atlas_reset(Atlas *atlas);
+
+// Copies a surface into the atlas, returns 0 if there is no room left
+int atlas_add_surface(Atlas *atlas, SDL_Surface *surface, Sprite *sprite);
+
+void batch_init(SpriteBatch *batch, SDL_Renderer *renderer);
+void batch_begin(SpriteBatch *batch);
+void batch_draw(SpriteBatch *batch, const Sprite *sprite, const SDL_FRect *dst, SDL_Color color);
+
+// Draws a string at (x, y), returns its size in the rect if not NULL
+void batch_draw_text(SpriteBatch *batch, TextCache *cache, TTF_Font *font, const char *text, float x, float y, SDL_Color color, SDL_Rect *rect);
+
+// Submits the pending quads, needed before anything else is rendered
+void batch_flush(SpriteBatch *batch);
+void batch_end(SpriteBatch *batch);
+
+int text_cache_init(TextCache *cache, SDL_Renderer *renderer, int w, int h);
+void text_cache_exit(TextCache *cache);
+
+// Returns the sprite of a string, rendering it if it isn't cached yet. Returns NULL for empty strings
+// or if rendering fails. The batch is flushed if the cache has to make room.
+const Sprite *text_cache_get(TextCache *cache, SpriteBatch *batch, TTF_Font *font, const char *text);
@@ -0,0 +1,170 @@
+/* Checks the frame pacing of the SDL2 demo: source/frame_pacer.c is built as is against host
+ * versions of SDL2 and libnx (host/), with a simulated clock instead of the real one, so that the
+ * results are the same on every run. Frames take a random amount of work, sleeps wake up to half
+ * a millisecond late (as threads do), and with vsync, presenting waits for the next vblank.
+ *
+ * For each scenario, the tool prints the stats the pacer measured, and checks them (and the
+ * shortest time between two presents, which must not drop after a late frame) against what the
+ * scenario should give, whenever the pacer starts relative to the vblanks. The old main loop, a
+ * fixed delay after each frame, is run for comparison.
+ *
+ * This is a host tool, not part of the Switch build:
+ *   cc -std=gnu11 -O2 -Ihost -I../source frame_pacer_check.c ../source/frame_pacer.c -lm -o frame_pacer_check
+ *   ./frame_pacer_check
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <switch.h>
+#include "frame_pacer.h"
+
+// ----------------------------------------------------------------------------
+// Simulated clock, ticking at the rate of the Switch's system counter
+
+#define FREQ        19200000ull
+#define OVERSLEEP   500000  // how late sleeps may wake up, in ns
+
+static Uint64 s_now;
+static unsigned s_sleeps;
+
+Uint64 SDL_GetPerformanceCounter(void)
+{
+    return s_now;
+}
+
+Uint64 SDL_GetPerformanceFrequency(void)
+{
+    return FREQ;
+}
+
+double SDL_sqrt(double x)
+{
+    return sqrt(x);
+}
+
+void svcSleepThread(s64 nano)
+{
+    nano += rand() % (OVERSLEEP + 1);
+    s_now += (Uint64)nano * FREQ / 1000000000ull;
+    s_sleeps++;
+}
+
+static void work(double ms)
+{
+    s_now += (Uint64)(ms * FREQ / 1000.0);
+}
+
+static void present(int vsync_hz)
+{
+    if (vsync_hz) {
+        Uint64 vblank = FREQ / vsync_hz;
+        s_now = (s_now / vblank + 1) * vblank;
+    }
+}
+
+// ----------------------------------------------------------------------------
+
+typedef struct {
+    const char *name;
+    int fps, vsync_hz;
+    double work_min, work_max;  // work of each frame, in ms
+    int heavy_every;            // every that many frames, the work is heavy_ms instead
+    double heavy_ms;
+    double fixed_delay_ms;      // if not 0, the old loop: sleep that long instead of frame_pacer_wait
+
+    // what the stats must be
+    double fps_min, fps_max;
+    double max_jitter_ms;
+    unsigned late;
+    double min_interval_ms;
+} Scenario;
+
+#define FRAMES 600
+
+static const Scenario s_scenarios[] = {
+    { "60 fps",                 60,  0, 2, 14,  0,  0, 0,     59.5, 60.5, 0.3,  0,           16.0 },
+    { "60 fps, fixed delay",    60,  0, 2, 14,  0,  0, 8.7,   55.0, 65.0, 10.0, 0,           0.0 },
+    { "60 fps, heavy frames",   60,  0, 2, 14,  10, 40, 0,    50.0, 55.0, 10.0, FRAMES / 10, 16.0 },
+    { "30 fps",                 30,  0, 2, 14,  0,  0, 0,     29.8, 30.2, 0.3,  0,           32.7 },
+    { "vsync 60 Hz",            60, 60, 2, 14,  0,  0, 0,     59.9, 60.1, 0.01, 0,           16.6 },
+    { "vsync 60 Hz, heavy",     60, 60, 2, 14,  10, 20, 0,    54.0, 55.0, 10.0, FRAMES / 10, 16.6 },
+    { "vsync 60 Hz, 30 fps",    30, 60, 2, 14,  0,  0, 0,     29.9, 30.1, 0.01, 0,           33.3 },
+    { "vsync 60 Hz, 20 fps",    20, 60, 2, 14,  0,  0, 0,     19.9, 20.1, 0.01, 0,           49.9 },
+};
+
+static double ticks_to_ms(Uint64 ticks)
+{
+    return ticks * 1000.0 / FREQ;
+}
+
+static int run(const Scenario *sc, Uint64 start, FrameStats *stats)
+{
+    FramePacer pacer;
+    srand(1);
+    s_now = start;
+    s_sleeps = 0;
+    frame_pacer_init(&pacer, sc->fps, sc->vsync_hz);
+
+    Uint64 last_present = s_now, min_interval = ~0ull;
+    for (int i = 0; i <= FRAMES; i++) {
+        if (sc->heavy_every && i % sc->heavy_every == sc->heavy_every - 1)
+            work(sc->heavy_ms);
+        else
+            work(sc->work_min + (sc->work_max - sc->work_min) * rand() / RAND_MAX);
+
+        if (sc->fixed_delay_ms)
+            svcSleepThread((s64)(sc->fixed_delay_ms * 1000000));
+        else
+            frame_pacer_wait(&pacer);
+        present(sc->vsync_hz);
+        frame_pacer_end_frame(&pacer);
+
+        // the first frame starts from frame_pacer_init rather than from a present, so leave it out
+        if (!i)
+            frame_pacer_reset_stats(&pacer);
+        else if (s_now - last_present < min_interval)
+            min_interval = s_now - last_present;
+        last_present = s_now;
+    }
+    frame_pacer_get_stats(&pacer, stats);
+
+    // when the target frame rate is the refresh rate, presenting does all the waiting
+    unsigned expected_sleeps = sc->vsync_hz && sc->fps >= sc->vsync_hz ? 0 : FRAMES + 1;
+
+    return stats->frames == FRAMES && stats->fps >= sc->fps_min && stats->fps <= sc->fps_max &&
+        stats->jitter_ms <= sc->max_jitter_ms && stats->late == sc->late &&
+        ticks_to_ms(min_interval) >= sc->min_interval_ms && s_sleeps <= expected_sleeps;
+}
+
+int main(void)
+{
+    int ok = 1;
+    FrameStats paced = { 0 }, fixed = { 0 };
+    for (unsigned i = 0; i < sizeof(s_scenarios) / sizeof(s_scenarios[0]); i++) {
+        const Scenario *sc = &s_scenarios[i];
+        FrameStats stats, other;
+        int passed = 1;
+        for (Uint64 start = 0; start < FREQ / 60; start += FREQ / 60 / 64)
+            passed = run(sc, start, start ? &other : &stats) && passed;
+        printf("%-22s %5.1f fps, work %5.2f ms, interval %6.2f ms, jitter %6.3f ms, max %6.2f ms, %3u late%s\n",
+            sc->name, stats.fps, stats.work_ms, stats.interval_ms, stats.jitter_ms, stats.max_interval_ms, stats.late,
+            passed ? "" : "  FAILED");
+        ok = ok && passed;
+
+        if (i == 0)
+            paced = stats;
+        else if (i == 1)
+            fixed = stats;
+    }
+
+    // the point of pacing: the same work, presented much more regularly
+    if (paced.jitter_ms * 10 > fixed.jitter_ms) {
+        printf("Pacing doesn't reduce the jitter of the fixed delay\n");
+        ok = 0;
+    }
+
+    printf("Frame pacer: %s\n", ok ? "ok" : "FAILED");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,58 @@
+/* Just enough of SDL2 for sprite_batch.c and frame_pacer.c to build on the host; the functions
+ * are implemented by the tools that use it (sprite_batch_check.c and frame_pacer_check.c).
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef uint8_t Uint8;
+typedef uint32_t Uint32;
+typedef uint64_t Uint64;
+
+typedef struct { Uint8 r, g, b, a; } SDL_Color;
+typedef struct { int x, y, w, h; } SDL_Rect;
+typedef struct { float x, y, w, h; } SDL_FRect;
+typedef struct { float x, y; } SDL_FPoint;
+
+typedef struct {
+    SDL_FPoint position;
+    SDL_Color color;
+    SDL_FPoint tex_coord;
+} SDL_Vertex;
+
+typedef struct {
+    Uint32 format;
+} SDL_PixelFormat;
+
+typedef struct {
+    SDL_PixelFormat *format;
+    int w, h;
+    int pitch;
+    void *pixels;
+} SDL_Surface;
+
+typedef struct SDL_Texture SDL_Texture;
+typedef struct SDL_Renderer SDL_Renderer;
+
+#define SDL_PIXELFORMAT_RGBA32    0x16762004u  // ABGR8888 on little endian hosts
+#define SDL_PIXELFORMAT_ARGB8888  0x16362004u
+#define SDL_TEXTUREACCESS_STATIC  0
+#define SDL_BLENDMODE_BLEND       1
+
+SDL_Texture *SDL_CreateTexture(SDL_Renderer *renderer, Uint32 format, int access, int w, int h);
+void SDL_DestroyTexture(SDL_Texture *texture);
+int SDL_SetTextureBlendMode(SDL_Texture *texture, int mode);
+int SDL_UpdateTexture(SDL_Texture *texture, const SDL_Rect *rect, const void *pixels, int pitch);
+
+SDL_Surface *SDL_ConvertSurfaceFormat(SDL_Surface *surface, Uint32 format, Uint32 flags);
+int SDL_LockSurface(SDL_Surface *surface);
+void SDL_UnlockSurface(SDL_Surface *surface);
+void SDL_FreeSurface(SDL_Surface *surface);
+
+int SDL_RenderGeometry(SDL_Renderer *renderer, SDL_Texture *texture, const SDL_Vertex *vertices, int num_vertices, const int *indices, int num_indices);
+
+Uint64 SDL_GetPerformanceCounter(void);
+Uint64 SDL_GetPerformanceFrequency(void);
+double SDL_sqrt(double x);
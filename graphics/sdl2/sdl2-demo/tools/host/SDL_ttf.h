@@ -0,0 +1,10 @@
+/* Just enough of SDL2_ttf for sprite_batch.c to build on the host (see SDL.h) */
+
+#pragma once
+
+#include "SDL.h"
+
+typedef struct TTF_Font TTF_Font;
+
+int TTF_GetFontStyle(const TTF_Font *font);
+SDL_Surface *TTF_RenderUTF8_Blended(TTF_Font *font, const char *text, SDL_Color fg);
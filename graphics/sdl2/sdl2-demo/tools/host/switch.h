@@ -0,0 +1,9 @@
+/* Just enough of libnx for frame_pacer.c to build on the host (see frame_pacer_check.c) */
+
+#pragma once
+
+#include <stdint.h>
+
+typedef int64_t s64;
+
+void svcSleepThread(s64 nano);
@@ -0,0 +1,523 @@
+/* Checks the sprite batching of the SDL2 demo: source/sprite_batch.c is built as is against host
+ * versions of SDL2 and SDL2_ttf (host/), which this tool implements. The mocked textures keep
+ * their pixels, and every quad submitted with SDL_RenderGeometry is checked against the image it
+ * was drawn with (which its color identifies), so a quad showing the wrong part of an atlas, or
+ * an atlas overwritten while quads using it are still pending, is caught.
+ *
+ * - images of random sizes and formats are packed into an atlas, which must keep them apart
+ * - an image that doesn't fit (or can't be converted) leaves the atlas as it was
+ * - 2000 quads sharing a texture take two draw calls, while alternating textures take one each
+ * - 1000 frames of text, with the cache flushed when its table or its atlas is full
+ *
+ * This is a host tool, not part of the Switch build; the sanitizers catch memory errors and leaks:
+ *   cc -std=gnu11 -O1 -g -fsanitize=address,undefined -Ihost -I../source sprite_batch_check.c \
+ *      ../source/sprite_batch.c -o sprite_batch_check
+ *   ./sprite_batch_check
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "sprite_batch.h"
+
+// ----------------------------------------------------------------------------
+// Mocked SDL
+
+#define MAX_TEXTURES 8
+
+struct SDL_Texture {
+    int w, h;
+    Uint32 *pixels;
+};
+
+static SDL_Texture s_textures[MAX_TEXTURES];
+static int s_live_textures, s_live_surfaces;
+static int s_fail_convert;
+static int s_errors;
+
+// Batch whose pending quads must not be overwritten in their atlas
+static const SpriteBatch *s_batch;
+
+// Submitted quads and draw calls
+static int s_quads, s_draw_calls;
+
+static SDL_PixelFormat s_rgba32 = { SDL_PIXELFORMAT_RGBA32 };
+static SDL_PixelFormat s_argb8888 = { SDL_PIXELFORMAT_ARGB8888 };
+
+static void error(const char *what)
+{
+    if (s_errors++ < 10)
+        fprintf(stderr, "%s\n", what);
+}
+
+SDL_Texture *SDL_CreateTexture(SDL_Renderer *renderer, Uint32 format, int access, int w, int h)
+{
+    (void)renderer;
+    if (format != SDL_PIXELFORMAT_RGBA32 || access != SDL_TEXTUREACCESS_STATIC)
+        error("unexpected texture format");
+
+    for (int i = 0; i < MAX_TEXTURES; i++) {
+        SDL_Texture *tex = &s_textures[i];
+        if (tex->pixels)
+            continue;
+        // the contents of new textures are undefined
+        tex->pixels = malloc(w * h * 4);
+        memset(tex->pixels, 0xCD, w * h * 4);
+        tex->w = w;
+        tex->h = h;
+        s_live_textures++;
+        return tex;
+    }
+    return NULL;
+}
+
+void SDL_DestroyTexture(SDL_Texture *texture)
+{
+    free(texture->pixels);
+    memset(texture, 0, sizeof(*texture));
+    s_live_textures--;
+}
+
+int SDL_SetTextureBlendMode(SDL_Texture *texture, int mode)
+{
+    (void)texture; (void)mode;
+    return 0;
+}
+
+// Texels of a quad in its texture
+static SDL_Rect quad_rect(const SDL_Texture *tex, const SDL_Vertex *v)
+{
+    int x0 = (int)lroundf(v[0].tex_coord.x * tex->w);
+    int y0 = (int)lroundf(v[0].tex_coord.y * tex->h);
+    int x1 = (int)lroundf(v[2].tex_coord.x * tex->w);
+    int y1 = (int)lroundf(v[2].tex_coord.y * tex->h);
+    SDL_Rect rect = { x0, y0, x1 - x0, y1 - y0 };
+    return rect;
+}
+
+static int overlap(const SDL_Rect *a, const SDL_Rect *b)
+{
+    return a->x < b->x + b->w && b->x < a->x + a->w && a->y < b->y + b->h && b->y < a->y + a->h;
+}
+
+int SDL_UpdateTexture(SDL_Texture *texture, const SDL_Rect *rect, const void *pixels, int pitch)
+{
+    SDL_Rect full = { 0, 0, texture->w, texture->h };
+    if (!rect)
+        rect = &full;
+    if (rect->x < 0 || rect->y < 0 || rect->x + rect->w > texture->w || rect->y + rect->h > texture->h) {
+        error("texture update out of bounds");
+        return -1;
+    }
+
+    // quads are only rendered when the batch is flushed, so what they show must not change until then
+    if (s_batch && s_batch->texture == texture) {
+        for (int i = 0; i < s_batch->num_quads; i++) {
+            SDL_Rect quad = quad_rect(texture, &s_batch->vertices[i * 4]);
+            if (overlap(&quad, rect)) {
+                error("texture updated under a pending quad");
+                break;
+            }
+        }
+    }
+
+    for (int y = 0; y < rect->h; y++)
+        memcpy(&texture->pixels[(rect->y + y) * texture->w + rect->x], (const Uint8 *)pixels + y * pitch, rect->w * 4);
+    return 0;
+}
+
+static SDL_Surface *create_surface(int w, int h, SDL_PixelFormat *format)
+{
+    SDL_Surface *surface = calloc(1, sizeof(*surface));
+    surface->format = format;
+    surface->w = w;
+    surface->h = h;
+    surface->pitch = w * 4 + 12; // padded rows
+    surface->pixels = calloc(h, surface->pitch);
+    s_live_surfaces++;
+    return surface;
+}
+
+static Uint32 swap_red_blue(Uint32 pixel)
+{
+    return (pixel & 0xFF00FF00) | ((pixel >> 16) & 0xFF) | ((pixel & 0xFF) << 16);
+}
+
+SDL_Surface *SDL_ConvertSurfaceFormat(SDL_Surface *surface, Uint32 format, Uint32 flags)
+{
+    (void)flags;
+    if (s_fail_convert || surface->format->format != SDL_PIXELFORMAT_ARGB8888 || format != SDL_PIXELFORMAT_RGBA32)
+        return NULL;
+
+    SDL_Surface *converted = create_surface(surface->w, surface->h, &s_rgba32);
+    for (int y = 0; y < surface->h; y++) {
+        const Uint32 *src = (const Uint32 *)((const Uint8 *)surface->pixels + y * surface->pitch);
+        Uint32 *dst = (Uint32 *)((Uint8 *)converted->pixels + y * converted->pitch);
+        for (int x = 0; x < surface->w; x++)
+            dst[x] = swap_red_blue(src[x]);
+    }
+    return converted;
+}
+
+int SDL_LockSurface(SDL_Surface *surface)
+{
+    (void)surface;
+    return 0;
+}
+
+void SDL_UnlockSurface(SDL_Surface *surface)
+{
+    (void)surface;
+}
+
+void SDL_FreeSurface(SDL_Surface *surface)
+{
+    if (!surface)
+        return;
+    free(surface->pixels);
+    free(surface);
+    s_live_surfaces--;
+}
+
+// ----------------------------------------------------------------------------
+// Test images. Quads are drawn with a color identifying their image: red and green hold its
+// index, blue tells sprites (0) from strings (1).
+
+#define MAX_IMAGES 256
+#define MAX_STRINGS 8192
+
+typedef struct {
+    int w, h;
+    Uint32 seed;
+} Image;
+
+static Image s_images[MAX_IMAGES];
+static int s_num_images;
+static char *s_strings[MAX_STRINGS];
+static int s_num_strings;
+
+// Pixel of an image, in the atlas format; never 0, which is what the padding must be
+static Uint32 image_pixel(Uint32 seed, int x, int y)
+{
+    Uint32 v = seed * 2654435761u ^ (Uint32)x * 73856093u ^ (Uint32)y * 19349663u;
+    return v | 0x01000000;
+}
+
+static Uint32 text_seed(const char *text)
+{
+    Uint32 hash = 2166136261u;
+    for (const Uint8 *p = (const Uint8 *)text; *p; p++)
+        hash = (hash ^ *p) * 16777619u;
+    return hash;
+}
+
+static void text_size(const char *text, int *w, int *h)
+{
+    int len = (int)strlen(text);
+    *w = len * 6;
+    *h = 12 + len % 3;
+}
+
+static SDL_Color id_color(int id, int is_text)
+{
+    SDL_Color color = { (Uint8)id, (Uint8)(id >> 8), (Uint8)is_text, 255 };
+    return color;
+}
+
+static SDL_Surface *make_image_surface(int w, int h, Uint32 seed, int argb)
+{
+    SDL_Surface *surface = create_surface(w, h, argb ? &s_argb8888 : &s_rgba32);
+    for (int y = 0; y < h; y++) {
+        Uint32 *row = (Uint32 *)((Uint8 *)surface->pixels + y * surface->pitch);
+        for (int x = 0; x < w; x++)
+            row[x] = argb ? swap_red_blue(image_pixel(seed, x, y)) : image_pixel(seed, x, y);
+    }
+    return surface;
+}
+
+int TTF_GetFontStyle(const TTF_Font *font)
+{
+    (void)font;
+    return 0;
+}
+
+SDL_Surface *TTF_RenderUTF8_Blended(TTF_Font *font, const char *text, SDL_Color fg)
+{
+    (void)font; (void)fg;
+    int w, h;
+    text_size(text, &w, &h);
+    return make_image_surface(w, h, text_seed(text), 0);
+}
+
+// Checks that a quad shows its whole image, followed by transparent padding
+static void check_quad(const SDL_Texture *tex, const SDL_Vertex *v)
+{
+    int id = v[0].color.r | v[0].color.g << 8;
+    int w, h;
+    Uint32 seed;
+    if (v[0].color.b) {
+        text_size(s_strings[id], &w, &h);
+        seed = text_seed(s_strings[id]);
+    } else {
+        w = s_images[id].w;
+        h = s_images[id].h;
+        seed = s_images[id].seed;
+    }
+
+    SDL_Rect rect = quad_rect(tex, v);
+    if (rect.w != w || rect.h != h || v[1].position.x - v[0].position.x != w || v[3].position.y - v[0].position.y != h) {
+        error("quad of the wrong size");
+        return;
+    }
+    for (int y = 0; y <= h; y++) {
+        for (int x = 0; x <= w; x++) {
+            int tx = rect.x + x, ty = rect.y + y;
+            if (tx >= tex->w || ty >= tex->h)
+                continue;
+            Uint32 expected = x < w && y < h ? image_pixel(seed, x, y) : 0;
+            if (tex->pixels[ty * tex->w + tx] != expected) {
+                error(x < w && y < h ? "quad showing the wrong pixels" : "padding that isn't transparent");
+                return;
+            }
+        }
+    }
+}
+
+int SDL_RenderGeometry(SDL_Renderer *renderer, SDL_Texture *texture, const SDL_Vertex *vertices, int num_vertices, const int *indices, int num_indices)
+{
+    (void)renderer;
+    if (num_vertices % 4 || num_indices != num_vertices / 4 * 6) {
+        error("unexpected number of vertices or indices");
+        return -1;
+    }
+    for (int i = 0; i < num_indices; i++) {
+        static const int pattern[6] = { 0, 1, 2, 0, 2, 3 };
+        if (indices[i] != i / 6 * 4 + pattern[i % 6]) {
+            error("unexpected indices");
+            return -1;
+        }
+    }
+
+    for (int i = 0; i < num_vertices; i += 4)
+        check_quad(texture, &vertices[i]);
+    s_quads += num_vertices / 4;
+    s_draw_calls++;
+    return 0;
+}
+
+// ----------------------------------------------------------------------------
+
+static int s_failures;
+
+static void check(int ok, const char *what)
+{
+    if (!ok) {
+        fprintf(stderr, "FAILED: %s\n", what);
+        s_failures++;
+    }
+}
+
+static int add_image(Atlas *atlas, int w, int h, int argb, Sprite *sprite)
+{
+    int id = s_num_images++;
+    s_images[id].w = w;
+    s_images[id].h = h;
+    s_images[id].seed = id * 7919 + 1;
+    SDL_Surface *surface = make_image_surface(w, h, s_images[id].seed, argb);
+    int ok = atlas_add_surface(atlas, surface, sprite);
+    SDL_FreeSurface(surface);
+    return ok ? id : -1;
+}
+
+static void draw_sprite(SpriteBatch *batch, const Sprite *sprite, int id, float x, float y)
+{
+    SDL_FRect dst = { x, y, (float)sprite->w, (float)sprite->h };
+    batch_draw(batch, sprite, &dst, id_color(id, 0));
+}
+
+// Images of random sizes and formats until the atlas is full, then their quads
+static void check_packing(SpriteBatch *batch)
+{
+    static Sprite sprites[MAX_IMAGES];
+    static int ids[MAX_IMAGES];
+    Atlas atlas;
+    check(atlas_init(&atlas, NULL, 512, 512), "atlas_init");
+
+    int count = 0, failures = 0;
+    srand(1234);
+    while (failures < 20 && count < MAX_IMAGES / 2) {
+        Atlas before = atlas;
+        int id = add_image(&atlas, 1 + rand() % 100, 1 + rand() % 60, rand() & 1, &sprites[count]);
+        if (id < 0) {
+            check(!memcmp(&before, &atlas, sizeof(atlas)), "an image that doesn't fit leaves the atlas as it was");
+            failures++;
+            continue;
+        }
+        ids[count++] = id;
+    }
+
+    batch_begin(batch);
+    for (int i = 0; i < count; i++)
+        draw_sprite(batch, &sprites[i], ids[i], 0, 0);
+    batch_end(batch);
+    check(batch->draw_calls == 1, "images in an atlas are drawn at once");
+    atlas_exit(&atlas);
+    printf("Packing: %d images in a 512x512 atlas\n", count);
+}
+
+static void check_failed_add(void)
+{
+    Atlas atlas;
+    Sprite first, second, third;
+    atlas_init(&atlas, NULL, 64, 64);
+
+    // the first shelf is 21 pixels high, and has room for images up to 22 pixels wide
+    check(add_image(&atlas, 40, 20, 0, &first) >= 0, "first image");
+
+    // too tall for a new shelf, or failing to convert: the first shelf must stay in use
+    Atlas before = atlas;
+    check(add_image(&atlas, 30, 50, 0, &second) < 0, "an image too tall for a new shelf is rejected");
+    check(!memcmp(&before, &atlas, sizeof(atlas)), "a rejected image leaves the atlas as it was");
+    s_fail_convert = 1;
+    check(add_image(&atlas, 30, 10, 1, &second) < 0, "an image that can't be converted is rejected");
+    s_fail_convert = 0;
+    check(!memcmp(&before, &atlas, sizeof(atlas)), "an image that can't be converted leaves the atlas as it was");
+
+    check(add_image(&atlas, 20, 10, 0, &third) >= 0 && third.u0 == 41.0f / 64 && third.v0 == 0,
+        "the next image goes next to the first one");
+    atlas_exit(&atlas);
+}
+
+static void check_batching(SpriteBatch *batch)
+{
+    Atlas atlas1, atlas2;
+    Sprite a, b, c;
+    atlas_init(&atlas1, NULL, 512, 512);
+    atlas_init(&atlas2, NULL, 512, 512);
+    int ida = add_image(&atlas1, 60, 60, 0, &a);
+    int idb = add_image(&atlas1, 200, 104, 1, &b);
+    int idc = add_image(&atlas2, 30, 30, 0, &c);
+
+    s_draw_calls = s_quads = 0;
+    batch_begin(batch);
+    for (int i = 0; i < 2000; i++)
+        draw_sprite(batch, i & 1 ? &a : &b, i & 1 ? ida : idb, (float)i, 0);
+    batch_end(batch);
+    check(batch->quads == 2000 && s_quads == 2000, "2000 quads are drawn");
+    check(batch->draw_calls == 2 && s_draw_calls == 2, "2000 quads sharing a texture take 2 draw calls");
+
+    s_draw_calls = s_quads = 0;
+    batch_begin(batch);
+    for (int i = 0; i < 2000; i++)
+        draw_sprite(batch, i & 1 ? &a : &c, i & 1 ? ida : idc, (float)i, 0);
+    batch_end(batch);
+    check(s_quads == 2000 && batch->draw_calls == 2000, "alternating textures take a draw call each");
+
+    atlas_exit(&atlas1);
+    atlas_exit(&atlas2);
+}
+
+static int string_id(const char *text)
+{
+    for (int i = s_num_strings - 1; i >= 0; i--) {
+        if (!strcmp(s_strings[i], text))
+            return i;
+    }
+    if (s_num_strings == MAX_STRINGS)
+        return 0;
+    s_strings[s_num_strings] = strdup(text);
+    return s_num_strings++;
+}
+
+static void draw_text(SpriteBatch *batch, TextCache *cache, TTF_Font *font, const char *text)
+{
+    batch_draw_text(batch, cache, font, text, 0, 0, id_color(string_id(text), 1), NULL);
+}
+
+// Text mixed with sprites from another atlas, over 1000 frames. Most strings change every frame,
+// and every 10 frames a burst of long strings fills the atlas; then a burst of short strings fills
+// the table of the cache.
+static void check_text(SpriteBatch *batch)
+{
+    static TextCache cache;
+    TTF_Font *font = (TTF_Font *)1;
+    Atlas atlas;
+    Sprite sprite;
+    atlas_init(&atlas, NULL, 512, 512);
+    int id = add_image(&atlas, 4, 4, 0, &sprite);
+    check(text_cache_init(&cache, NULL, 1024, 512), "text_cache_init");
+
+    s_draw_calls = s_quads = 0;
+    int quads = 0;
+    for (int frame = 0; frame < 1000; frame++) {
+        char text[128];
+        batch_begin(batch);
+        for (int i = 0; i < 2000; i++)
+            draw_sprite(batch, &sprite, id, 0, 0);
+        draw_text(batch, &cache, font, "Hello, world!");
+        snprintf(text, sizeof(text), "frame %d", frame);
+        draw_text(batch, &cache, font, text);
+        quads += 2002;
+        if (frame % 10 == 0) {
+            for (int i = 0; i < 40; i++) {
+                snprintf(text, sizeof(text), "%03d %0*d", frame, 90, i);
+                draw_text(batch, &cache, font, text);
+            }
+            quads += 40;
+        }
+        batch_end(batch);
+    }
+    check(s_quads == quads, "every quad is drawn");
+    check(cache.flushes >= 100, "the cache is flushed when its atlas is full");
+
+    // the strings of the last frame are still cached
+    int flushes = cache.flushes;
+    int entries = cache.num_entries;
+    batch_begin(batch);
+    for (int i = 0; i < TEXT_CACHE_SIZE; i++) {
+        char text[16];
+        snprintf(text, sizeof(text), "%d", i);
+        draw_text(batch, &cache, font, text);
+    }
+    batch_end(batch);
+    check(cache.flushes == flushes + 1 && cache.num_entries == TEXT_CACHE_SIZE - (TEXT_CACHE_SIZE * 3 / 4 - entries),
+        "the cache is flushed when its table is 3/4 full");
+
+    SDL_Rect rect = { -1, -1, -1, -1 };
+    char wide[200];
+    memset(wide, 'W', sizeof(wide) - 1);
+    wide[sizeof(wide) - 1] = 0;
+    batch_begin(batch);
+    batch_draw_text(batch, &cache, font, wide, 5, 6, id_color(0, 1), &rect);
+    check(batch->quads == 0 && rect.x == 5 && rect.y == 6 && rect.w == 0 && rect.h == 0, "a string wider than the atlas isn't drawn");
+    check(!text_cache_get(&cache, batch, font, ""), "empty strings aren't drawn");
+    const Sprite *hello = text_cache_get(&cache, batch, font, "Hello, world!");
+    check(hello && text_cache_get(&cache, batch, font, "Hello, world!") == hello, "cached strings are found again");
+    batch_end(batch);
+
+    printf("Text: %d hits, %d misses, %d flushes, %d draw calls\n", cache.hits, cache.misses, cache.flushes, s_draw_calls);
+    text_cache_exit(&cache);
+    atlas_exit(&atlas);
+}
+
+int main(void)
+{
+    static SpriteBatch batch;
+    batch_init(&batch, NULL);
+    s_batch = &batch;
+
+    check_packing(&batch);
+    check_failed_add();
+    check_batching(&batch);
+    check_text(&batch);
+
+    for (int i = 0; i < s_num_strings; i++)
+        free(s_strings[i]);
+    check(!s_live_textures && !s_live_surfaces, "every texture and surface is freed");
+    check(!s_errors, "no errors from SDL");
+
+    printf("Sprite batch: %s\n", s_failures ? "FAILED" : "ok");
+    return s_failures ? 1 : 0;
+}
@@ -7,6 +7,9 @@
 // Include the main libnx system header, for Switch development
 #include <switch.h>
 
+#include "soft2d.h"
+#include "tile_pool.h"
+
 #ifdef DISPLAY_IMAGE
 #include "image_bin.h"//Your own raw RGB888 1280x720 image at "data/image.bin" is required.
 #endif
@@ -51,6 +54,29 @@ void userAppExit()
     deinitNxLink();
 }
 
+#ifdef DISPLAY_IMAGE
+typedef struct
+{
+    const u8* image;
+    u32 width, height;
+    u32 add;
+} ImageJob;
+
+// Draws the part of the image covered by a tile
+static void drawImageTile(void* user, const Soft2dSurface* tile, u32 x, u32 y)
+{
+    const ImageJob* job = (const ImageJob*)user;
+
+    // Offsetting the image by the position of the tile lets soft2d clip it to the tile
+    soft2dCopyRgb888(tile, -(s32)x, -(s32)y, job->image, job->width, job->height, job->width * 3, job->add);
+}
+#else
+static void fillTile(void* user, const Soft2dSurface* tile, u32 x, u32 y)
+{
+    soft2dFill(tile, 0, 0, tile->width, tile->height, *(const u32*)user);
+}
+#endif
+
 // Main program entrypoint
 int main(int argc, char* argv[])
 {
@@ -111,6 +137,10 @@ int main(int argc, char* argv[])
     PadState pad;
     padInitializeDefault(&pad);
 
+    // Start the threads drawing the framebuffer, one per core available to us
+    TilePool pool;
+    tilePoolCreate(&pool, TILEPOOL_MAX_THREADS);
+
     u32 cnt = 0;
 
     // Main loop
@@ -135,19 +165,17 @@ int main(int argc, char* argv[])
         else
             cnt = 0;
 
-        // Each pixel is 4-bytes due to RGBA8888.
-        for (u32 y = 0; y < FB_HEIGHT; y ++)
-        {
-            for (u32 x = 0; x < FB_WIDTH; x ++)
-            {
-                u32 pos = y * stride / sizeof(u32) + x;
+        // Each pixel is 4-bytes due to RGBA8888, the stride of the rows is handled by soft2d.
+        // The framebuffer is split into tiles which are drawn by all the threads of the pool.
+        Soft2dSurface surf = { framebuf, FB_WIDTH, FB_HEIGHT, stride };
 #ifdef DISPLAY_IMAGE
-                framebuf[pos] = RGBA8_MAXALPHA(imageptr[pos*3+0]+(cnt*4), imageptr[pos*3+1], imageptr[pos*3+2]);
+        // Convert the image to RGBA8888, with its red channel shifted by the counter.
+        ImageJob job = { imageptr, FB_WIDTH, FB_HEIGHT, RGBA8(cnt*4, 0, 0, 0) };
+        tilePoolRun(&pool, &surf, TILEPOOL_TILE_WIDTH, TILEPOOL_TILE_HEIGHT, drawImageTile, &job);
 #else
-                framebuf[pos] = 0x01010101 * cnt * 4;//Set framebuf to different shades of grey.
+        u32 color = 0x01010101 * cnt * 4;//Set framebuf to different shades of grey.
+        tilePoolRun(&pool, &surf, TILEPOOL_TILE_WIDTH, TILEPOOL_TILE_HEIGHT, fillTile, &color);
 #endif
-            }
-        }
 
         // Retrieve the MovieMaker framebuffer.
         u32* framebuf_movie = (u32*) framebufferBegin(&fb_movie, NULL); // Not using stride since we're just doing memcpy from the above image.
@@ -167,6 +195,7 @@ int main(int argc, char* argv[])
         if (R_FAILED(rc)) printf("grcMovieMakerEncodeAudioSample(): 0x%x\n", rc);
     }
 
+    tilePoolClose(&pool);
     framebufferClose(&fb);
     framebufferClose(&fb_movie);
 
@@ -6,6 +6,9 @@
 // Include the main libnx system header, for Switch development
 #include <switch.h>
 
+#include "soft2d.h"
+#include "tile_pool.h"
+
 // Joy-Con IR-sensor example, displays the image from the IR camera. See also libnx irs.h.
 
 // Define the desired framebuffer resolution (here we set it to 720p).
@@ -26,6 +29,30 @@ void userAppExit(void)
     irsExit();
 }
 
+typedef struct
+{
+    const u8* image;
+    u32 width, height;
+} IrImageJob;
+
+// Draws the part of the IR image covered by a tile, clearing the rest of it
+static void drawIrImageTile(void* user, const Soft2dSurface* tile, u32 x, u32 y)
+{
+    const IrImageJob* job = (const IrImageJob*)user;
+
+    for (u32 row = 0; row < tile->height; row ++) {
+        u32* dst = soft2dRow(tile, row);
+        u32 cols = 0;
+        if (y + row < job->height && x < job->width) {
+            cols = job->width - x < tile->width ? job->width - x : tile->width;
+            const u8* src = &job->image[(y + row) * job->width + x];//The IR image/camera is sideways with the joycon held flat. We won't rotate it here - you can do so yourself if you want.
+            for (u32 i = 0; i < cols; i ++)
+                dst[i] = RGBA8_MAXALPHA(/*src[i]*/0, src[i], /*src[i]*/0);
+        }
+        memset(dst + cols, 0, (tile->width - cols) * sizeof(u32));
+    }
+}
+
 __attribute__((format(printf, 2, 3)))
 static int error_screen(PadState *pad, const char* fmt, ...)
 {
@@ -96,6 +123,10 @@ int main(int argc, char* argv[])
     framebufferCreate(&fb, nwindowGetDefault(), FB_WIDTH, FB_HEIGHT, PIXEL_FORMAT_RGBA_8888, 2);
     framebufferMakeLinear(&fb);
 
+    // Start the threads drawing the framebuffer, one per core available to us
+    TilePool pool;
+    tilePoolCreate(&pool, TILEPOOL_MAX_THREADS);
+
     u64 sampling_number=0;
 
     while (appletMainLoop())
@@ -120,26 +151,22 @@ int main(int argc, char* argv[])
 
         if (R_SUCCEEDED(rc) && state.sampling_number != sampling_number) { // Only update framebuf when irsGetImageTransferProcessorState() is successful, where sampling_number changed.
             sampling_number = state.sampling_number;
-            memset(framebuf, 0, stride*FB_HEIGHT);
 
             // IR image width/height with the default config.
             // The image is grayscale (1 byte per pixel / 8bits, with 1 color-component).
             const u32 ir_width = 320;
             const u32 ir_height = 240;
 
-            u32 x, y;
-            for (y=0; y<ir_height; y++) { // Access the buffer linearly.
-                for (x=0; x<ir_width; x++) {
-                    u32 pos = y * stride/sizeof(u32) + x;
-                    u32 pos2 = y * ir_width + x;//The IR image/camera is sideways with the joycon held flat. We won't rotate it here - you can do so yourself if you want.
-                    framebuf[pos] = RGBA8_MAXALPHA(/*ir_buffer[pos2]*/0, ir_buffer[pos2], /*ir_buffer[pos2]*/0);
-                }
-            }
+            // The framebuffer is split into tiles which are drawn (and cleared) by all the threads of the pool.
+            Soft2dSurface surf = { framebuf, FB_WIDTH, FB_HEIGHT, stride };
+            IrImageJob job = { ir_buffer, ir_width, ir_height };
+            tilePoolRun(&pool, &surf, TILEPOOL_TILE_WIDTH, TILEPOOL_TILE_HEIGHT, drawIrImageTile, &job);
         }
 
         framebufferEnd(&fb);
     }
 
+    tilePoolClose(&pool);
     framebufferClose(&fb);
     irsStopImageProcessor(irhandle);
     free(ir_buffer);